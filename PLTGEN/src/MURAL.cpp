@@ -23,15 +23,24 @@
 #include <iostream>
 #include <new>
 #include <string>
+#include <vector>
 
 #include "general/exception/CommandLineException.h"
+#include "general/utility/MemoryAccounting.h"
+#include "general/utility/TaskScheduler.h"
 
+#include "mural/ParametricSweep.h"
+#include "mural/ScenarioContext.h"
 #include "mural/element/DataProvider.h"
 #include "mural/element/DataProviderCollection.h"
+#include "mural/io/FileNames.h"
+#include "mural/io/ModuleCheckpoint.h"
 #include "mural/io/MURALInputProcessor.h"
 #include "mural/io/OutputGenerator.h"
+#include "mural/modules/pg/Journey.h"
 #include "mural/modules/pg/PositionGenerator.h"
 #include "mural/modules/lg/LinksGenerator.h"
+#include "mural/modules/vtg/RequirementMap.h"
 #include "mural/modules/vtg/ValueTimelineGenerator.h"
 
 using namespace std;
@@ -43,6 +52,36 @@ using namespace std;
  *   (PositionGenerator, LinksGenerator, ...), creates the output
  *   (OutputGenerator).
  *
+ * The modules run as a dependency driven pipeline (TaskScheduler): the
+ *   positions of each data provider are generated concurrently, and the
+ *   orbit output is written while the links (and their output) are being
+ *   generated.  LinksGenerator orders its link types (downlinks before
+ *   crosslinks, conjunctions last), so it starts once every journey is ready.
+ *
+ * Each task is bound (ScenarioContext::BindTask) to the scenario of the
+ *   thread that scheduled it, so the pipeline can also be run for several
+ *   scenarios in one process.
+ *
+ * Running with --sweep <sweep file> runs the scenario as the base of a
+ *   parametric sweep (ParametricSweep): the positions are generated once and
+ *   the links, timelines and output are generated for each variant in the
+ *   sweep file.
+ *
+ * As each module finishes, the memory held by each subsystem (positions,
+ *   links, timelines, ...) is recorded along with the process resident set
+ *   (MemoryAccounting) and the breakdown is printed at the end of the run.
+ *
+ * When a 'Position Checkpoint File' is defined the generated positions are
+ *   written to it, and running with --resume restores them from it (when it
+ *   matches the current inputs) instead of generating them again.  Likewise
+ *   a 'Link Checkpoint Directory' receives every link status array (keyed by
+ *   everything the array is derived from), and a resumed run reads them back
+ *   instead of evaluating the links again; the conjunctions and the rest of
+ *   the links module still run.  The timelines and the reports are always
+ *   regenerated: the timelines also update the link statuses, vehicles and
+ *   requirement maps, so restoring them would mean checkpointing all of
+ *   those, and the reports are only written from data already in memory.
+ *
  * It contains the main entry point which references the murallib.lib static
  * libary.  This was done to allow for easier reuse of MURAL's componenets in
  * other software and to structure it similar to HASRD.
@@ -56,45 +95,119 @@ main(const int argc, const char *argv[])
     enum COMMAND_LINE {
         EXECUTABLE_NAME = 0,
         INPUT_FILE_NAME = 1,
-        NUMBER_OF_ARGUMENTS = 2
+        NUMBER_OF_ARGUMENTS = 2,
+        RESUME_OPTION = 2,
+        SWEEP_OPTION = 2,
+        SWEEP_FILE_NAME = 3
     };
     int									returnStatus = 0;
+    bool								resumeRun = false;
+    bool								restoredPositions = false;
     MURALInputProcessor					*ptrInputProcessor = NULL;
     OutputGenerator						*ptrOutputGenerator = NULL;
     PositionGenerator					*ptrPositionGenerator = NULL;
     LinksGenerator						*ptrLinksGenerator = NULL;
     ValueTimelineGenerator				*ptrTimelineGenerator = NULL;
     shared_ptr<DataProviderCollection>	ptrDataProviderCollection = NULL;
+    shared_ptr<MURALTypes::DataProviderVector>	ptrDataProviderList = NULL;
+    MURALTypes::DataProviderVector::iterator	dataProviderIter;
+    TaskScheduler						moduleScheduler;
+    vector<int>							positionTasks;
+    vector<int>							timelineDependencies;
+    int									orbitOutputTask = 0;
+    int									linksTask = 0;
+    int									linkOutputTask = 0;
+    int									timelinesTask = 0;
 
     try {
-        if (argc != NUMBER_OF_ARGUMENTS) {
+        if ((argc == (NUMBER_OF_ARGUMENTS + 2)) && (string(argv[SWEEP_OPTION]) == "--sweep")) {
+            ParametricSweep parametricSweep((string(argv[SWEEP_FILE_NAME])));
+            parametricSweep.Run(string(argv[INPUT_FILE_NAME]), string(argv[EXECUTABLE_NAME]));
+            parametricSweep.PrintSweepTimes(cout);
+            return(returnStatus);
+        } else if ((argc == (NUMBER_OF_ARGUMENTS + 1)) && (string(argv[RESUME_OPTION]) == "--resume")) {
+            resumeRun = true;
+        } else if (argc != NUMBER_OF_ARGUMENTS) {
             throw new CommandLineException(argc, NUMBER_OF_ARGUMENTS);
         }
 
         TimePiece::SetSystemStartTime();
+        LinksGenerator::SetResumeFromCheckpoint(resumeRun);
         ptrInputProcessor = new MURALInputProcessor(string(argv[INPUT_FILE_NAME]));
         ptrDataProviderCollection = ptrInputProcessor->CreateDataProviderList();
+        MemoryAccounting::RecordBoundary("Input");
 
         ptrOutputGenerator = new OutputGenerator(ptrDataProviderCollection);
         ptrPositionGenerator = new PositionGenerator();
-        ptrPositionGenerator->GeneratePositions(ptrDataProviderCollection);
-        ptrOutputGenerator->GenerateOrbitOutput();
+        ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
+
+        if ((resumeRun == true) && (FileNames::HasFileNameDefined(FileNames::POSITION_CHECKPOINTFILE) == true)) {
+            restoredPositions = ModuleCheckpoint::RestorePositions(ptrDataProviderCollection,
+                                FileNames::GetFileName(FileNames::POSITION_CHECKPOINTFILE));
+        }
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            shared_ptr<DataProvider> ptrDataProvider = (*dataProviderIter);
+            positionTasks.push_back(moduleScheduler.AddTask(("Positions " + ptrDataProvider->GetDesignator()),
+            ScenarioContext::BindTask([ptrPositionGenerator, ptrDataProvider]() {
+                ptrPositionGenerator->GenerateProviderPositions(ptrDataProvider);
+                MemoryAccounting::AddBytes(MemoryAccounting::POSITIONS, ptrDataProvider->GetJourney()->GetMemoryFootprint());
+            })));
+        }
+
+        if ((restoredPositions == false) && (FileNames::HasFileNameDefined(FileNames::POSITION_CHECKPOINTFILE) == true)) {
+            moduleScheduler.AddTask("Position Checkpoint", ScenarioContext::BindTask([ptrDataProviderCollection]() {
+                ModuleCheckpoint::WritePositions(ptrDataProviderCollection,
+                                                 FileNames::GetFileName(FileNames::POSITION_CHECKPOINTFILE));
+            }), positionTasks);
+        }
+
+        orbitOutputTask = moduleScheduler.AddTask("Orbit Output", ScenarioContext::BindTask([ptrOutputGenerator]() {
+            MemoryAccounting::RecordBoundary("Positions");
+            ptrOutputGenerator->GenerateOrbitOutput();
+            MemoryAccounting::RecordBoundary("Orbit Output");
+        }), positionTasks);
 
         if (MURALInputProcessor::RunLinkPathGenerator() == true) {
             ptrLinksGenerator = new LinksGenerator();
-            ptrLinksGenerator->GenerateLinks(ptrDataProviderCollection);
-            ptrOutputGenerator->GenerateLinkOutput();
+            linksTask = moduleScheduler.AddTask("Links", ScenarioContext::BindTask([ptrLinksGenerator, ptrDataProviderCollection]() {
+                ptrLinksGenerator->GenerateLinks(ptrDataProviderCollection);
+                MemoryAccounting::SetBytes(MemoryAccounting::LINKS, ptrDataProviderCollection->GetLinksMemoryFootprint());
+                MemoryAccounting::RecordBoundary("Links");
+            }), positionTasks);
+            linkOutputTask = moduleScheduler.AddTask("Link Output", ScenarioContext::BindTask([ptrOutputGenerator]() {
+                ptrOutputGenerator->GenerateLinkOutput();
+                MemoryAccounting::RecordBoundary("Link Output");
+            }), vector<int>(1, linksTask));
 
             if (MURALInputProcessor::RunTimelineGenerator() == true) {
                 ptrTimelineGenerator = new ValueTimelineGenerator();
-                ptrTimelineGenerator->GenerateValueTimelines(ptrDataProviderCollection);
-                ptrOutputGenerator->GenerateValueTimelineOutput();
+                // the timelines update the vehicles, so wait for the orbit output as well
+                timelineDependencies.push_back(orbitOutputTask);
+                timelineDependencies.push_back(linkOutputTask);
+                timelinesTask = moduleScheduler.AddTask("Timelines", ScenarioContext::BindTask([ptrTimelineGenerator, ptrDataProviderCollection]() {
+                    size_t regionDataBytes = 0;
+                    ptrTimelineGenerator->GenerateValueTimelines(ptrDataProviderCollection);
+                    MemoryAccounting::SetBytes(MemoryAccounting::TIMELINES,
+                                               ptrDataProviderCollection->GetTimelinesMemoryFootprint(regionDataBytes));
+                    MemoryAccounting::SetBytes(MemoryAccounting::REGIONS, regionDataBytes);
+                    MemoryAccounting::SetBytes(MemoryAccounting::REQUIREMENTS,
+                                               TimelineGenerator::requirementMap_s->GetMemoryFootprint());
+                    MemoryAccounting::RecordBoundary("Timelines");
+                }), timelineDependencies);
+                moduleScheduler.AddTask("Timeline Output", ScenarioContext::BindTask([ptrOutputGenerator]() {
+                    ptrOutputGenerator->GenerateValueTimelineOutput();
+                    MemoryAccounting::RecordBoundary("Timeline Output");
+                }), vector<int>(1, timelinesTask));
 
             } //END: if (MURALInputProcessor::RunTimelineGenerator() == true)
         } //END: if (MURALInputProcessor::RunLinkPathGenerator() == true)
 
-        ptrOutputGenerator->GenerateMainOutput(string(argv[EXECUTABLE_NAME]));
-        ptrOutputGenerator->GenerateRegionsInViewOutputFile();
+        moduleScheduler.Run();
+        moduleScheduler.PrintTaskTimes(cout, "MURAL");
+        ptrOutputGenerator->GenerateFinalOutput(string(argv[EXECUTABLE_NAME]));
+        MemoryAccounting::RecordBoundary("Final Output");
+        MemoryAccounting::PrintReport(cout, "MURAL");
     } catch (Exception *ptrError) {
         ptrError->AddMethod("MURAL", "main(const int, const char**)");
         returnStatus = ptrError->ReportError();
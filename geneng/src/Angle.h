@@ -83,7 +83,10 @@ class Angle
 {
 public:
     Angle() : m_angle(0.0) {;}
-    Angle(const Angle& a) : m_angle(a.m_angle) {;}
+    // defaulted so Angle stays trivially copyable, MatrixBase and
+    // VectorReal3D copy and clear arrays of it with memcpy/memset
+    Angle(const Angle& a) = default;
+    Angle& operator=(const Angle& a) = default;
 
 
     Angle(const double& angle_radians) : m_angle(angle_radians) {;}
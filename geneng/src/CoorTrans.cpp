@@ -149,10 +149,10 @@ CoorTrans::ToBase( const VectorCartesian& vecPositionSource,
                    VectorCartesian& vecVelocityBase,
                    VectorCartesian& vecAccelerationBase )
 {
-    static VectorCartesian wxr;
-    static VectorCartesian wxwxr;
-    static VectorCartesian wxv;
-    static VectorCartesian axr;
+    static thread_local VectorCartesian wxr;
+    static thread_local VectorCartesian wxwxr;
+    static thread_local VectorCartesian wxv;
+    static thread_local VectorCartesian axr;
 
     if (!areBitsOn(ACC_EI, m_fgEIS)) {
         ThrowNotEnabled(__FUNCSIG__);
@@ -185,10 +185,10 @@ CoorTrans::ToBase( const VectorCartesian& vecPositionSource,
                    VectorCartesian& vecVelocityBase,
                    VectorCartesian& vecAccelerationBase ) const
 {
-    static VectorCartesian wxr;
-    static VectorCartesian wxwxr;
-    static VectorCartesian wxv;
-    static VectorCartesian axr;
+    static thread_local VectorCartesian wxr;
+    static thread_local VectorCartesian wxwxr;
+    static thread_local VectorCartesian wxv;
+    static thread_local VectorCartesian axr;
 
     if (!areBitsOn(ACC_EI, m_fgEIS)) {
         ThrowNotEnabled(__FUNCSIG__);
@@ -289,11 +289,11 @@ CoorTrans::ToSource( const VectorCartesian& vecPositionBase,
                      VectorCartesian& vecVelocitySource,
                      VectorCartesian& vecAccelerationSource  )
 {
-    static VectorCartesian wxr;
-    static VectorCartesian wxwxr;
-    static VectorCartesian wxv;
-    static VectorCartesian axr;
-    static VectorCartesian x;
+    static thread_local VectorCartesian wxr;
+    static thread_local VectorCartesian wxwxr;
+    static thread_local VectorCartesian wxv;
+    static thread_local VectorCartesian axr;
+    static thread_local VectorCartesian x;
 
     if (!areBitsOn(ACC_EI, m_fgEIS)) {
         ThrowNotEnabled(__FUNCSIG__);
@@ -329,11 +329,11 @@ CoorTrans::ToSource( const VectorCartesian& vecPositionBase,
                      VectorCartesian& vecVelocitySource,
                      VectorCartesian& vecAccelerationSource  ) const
 {
-    static VectorCartesian wxr;
-    static VectorCartesian wxwxr;
-    static VectorCartesian wxv;
-    static VectorCartesian axr;
-    static VectorCartesian x;
+    static thread_local VectorCartesian wxr;
+    static thread_local VectorCartesian wxwxr;
+    static thread_local VectorCartesian wxv;
+    static thread_local VectorCartesian axr;
+    static thread_local VectorCartesian x;
 
     if (!areBitsOn(ACC_EI, m_fgEIS)) {
         ThrowNotEnabled(__FUNCSIG__);
@@ -364,6 +364,58 @@ CoorTrans::ToSource( const VectorCartesian& vecPositionBase,
     }
 }
 
+// -----------------------------------------------------------------------------
+// batch transformations
+bool
+CoorTrans::GetDcmAt( const TimeJ2000&, Matrix3& ) const // tm, dcm
+{
+    return false;
+}
+
+void
+CoorTrans::ToBaseBatch( const std::vector< TimeJ2000 >& tms,
+                        const std::vector< VectorCartesian >& vecPositionSource,
+                        std::vector< VectorCartesian >& vecPositionBase ) const
+{
+    if ( tms.size() != vecPositionSource.size() ) {
+        throw std::invalid_argument(
+            "CoorTrans::ToBaseBatch() times and positions differ in size" );
+    }
+
+    vecPositionBase.resize( tms.size() );
+    Matrix3 dcm;
+
+    for ( size_t i = 0; i < tms.size(); ++i ) {
+        if ( !GetDcmAt( tms[i], dcm ) ) {
+            ThrowNotImplemented( "ToBaseBatch()" );
+        }
+
+        dcm.Multiply( vecPositionSource[i], vecPositionBase[i] );
+    }
+}
+
+void
+CoorTrans::ToSourceBatch( const std::vector< TimeJ2000 >& tms,
+                          const std::vector< VectorCartesian >& vecPositionBase,
+                          std::vector< VectorCartesian >& vecPositionSource ) const
+{
+    if ( tms.size() != vecPositionBase.size() ) {
+        throw std::invalid_argument(
+            "CoorTrans::ToSourceBatch() times and positions differ in size" );
+    }
+
+    vecPositionSource.resize( tms.size() );
+    Matrix3 dcm;
+
+    for ( size_t i = 0; i < tms.size(); ++i ) {
+        if ( !GetDcmAt( tms[i], dcm ) ) {
+            ThrowNotImplemented( "ToSourceBatch()" );
+        }
+
+        dcm.TransposeMultiply( vecPositionBase[i], vecPositionSource[i] );
+    }
+}
+
 // -----------------------------------------------------------------------------
 void CoorTrans::ThrowStaleCoorTrans( const std::string& strFunctionName ) const
 {
@@ -89,6 +89,8 @@
 #include "CoorSystem.h"
 #include "CoorTransDcm.h"
 #include "GenMath.h"
+#include "TimeJ2000.h"
+#include <vector>
 
 // ============================================================================
 // A3 namespace start
@@ -199,6 +201,26 @@ public:
               VectorCartesian& vecVelocitySource,
               VectorCartesian& vecAccelerationSource  ) const;
 
+    //----------------------------------------------------------------------
+    // Batch position transformations, one DCM per time in tms.  The
+    // transformation is evaluated directly at each time through GetDcmAt,
+    // bypassing the AutoUpdate state, which is neither read nor changed.
+    // Throws if this transformation cannot be evaluated at an arbitrary
+    // time.
+    void
+    ToBaseBatch( const std::vector< TimeJ2000 >& tms,
+                 const std::vector< VectorCartesian >& vecPositionSource,
+                 std::vector< VectorCartesian >& vecPositionBase ) const;
+
+    void
+    ToSourceBatch( const std::vector< TimeJ2000 >& tms,
+                   const std::vector< VectorCartesian >& vecPositionBase,
+                   std::vector< VectorCartesian >& vecPositionSource ) const;
+
+    // Source to base DCM at time tm (TT).  Returns false if the
+    // transformation depends on state other than time (the default).
+    virtual bool GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const;
+
     //----------------------------------------------------------------------
     CoorSystem::Type GetBaseSystem() const;
     CoorSystem::Type GetSourceSystem() const;
@@ -50,6 +50,7 @@
 #define COORTRANSDCM_H	"CoorTransDcm V5.0"
 
 #include "MatrixFP.h"
+#include "Matrix3.h"
 
 // A3 namespace start
 namespace A3
@@ -70,6 +71,10 @@ public:
 
     explicit CoorTransDcm(const Quaternion& q) : MatrixFP<double>(q) {;}
     explicit CoorTransDcm(const EulerElemRotation& eer) : MatrixFP(eer) {;}
+    explicit CoorTransDcm(const Matrix3& dcm) : MatrixFP<double>(3, 3)
+    {
+        dcm.CopyTo(*this);
+    }
 
     CoorTransDcm& operator=(const CoorTransDcm& dcm)
     {
@@ -86,6 +91,13 @@ public:
         MatrixFP<double>::operator=(dcm);
         return *this;
     }
+
+    // writes into the existing 3x3 storage, no allocation
+    CoorTransDcm& operator=(const Matrix3& dcm)
+    {
+        dcm.CopyTo(*this);
+        return *this;
+    }
 };
 }
 // A3 namespace end
@@ -33,7 +33,7 @@
 namespace A3
 {
 //-----------------------------------------------------------------------------
-CoorTransEciEcf::CoorTransEciEcf(HandleConst<TimeJ2000> hdlTime,
+CoorTransEciEcf::CoorTransEciEcf(const HandleConst<TimeJ2000>& hdlTime,
                                  GrAngTyp grAngTyp)
     : CoorTransBaseEci(CoorSystem::ECF),
       m_hdlTime(hdlTime),
@@ -48,7 +48,11 @@ CoorTransEciEcf::CoorTransEciEcf(HandleConst<TimeJ2000> hdlTime,
 //-----------------------------------------------------------------------------
 Angle CoorTransEciEcf::GetGreenwichAngle() const
 {
-    TimeJ2000 tmTT(*m_hdlTime);
+    return GetGreenwichAngle(*m_hdlTime);
+}
+
+Angle CoorTransEciEcf::GetGreenwichAngle(const TimeJ2000& tmTT) const
+{
     Angle ga;
 
     switch (m_grAngTyp) {
@@ -88,19 +92,26 @@ CoorTransEciEcf::operator!=( const CoorTransEciEcf& coorTrans ) const
     return !operator==( coorTrans );
 }
 
+//-----------------------------------------------------------------------------
+bool
+CoorTransEciEcf::GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const
+{
+    double theta = GetGreenwichAngle(tm);
+    double csTheta = cos(theta);
+    double snTheta = sin(theta);
+    dcm = Matrix3(csTheta, -snTheta, 0.0,
+                  snTheta,  csTheta, 0.0,
+                  0.0,      0.0,     1.0);
+    return true;
+}
+
 void
 CoorTransEciEcf::UpdateState()
 {
     CoorTransBaseEci::UpdateState();
-    double theta = GetGreenwichAngle();
-    double csTheta = cos(theta);
-    double snTheta = sin(theta);
-    CoorTransDcm &a(Dcm());
-    a.IdentityThis();
-    a[0][0] =  csTheta;
-    a[0][1] = -snTheta;
-    a[1][0] =  snTheta;
-    a[1][1] =  csTheta;
+    Matrix3 dcm;
+    GetDcmAt(*m_hdlTime, dcm);
+    Dcm() = dcm;
     m_timeOfLastTransformation = m_hdlTime.Ref();
 }
 
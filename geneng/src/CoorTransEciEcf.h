@@ -80,18 +80,21 @@ class CoorTransEciEcf : public CoorTransBaseEci
 public:
     enum GrAngTyp {GMSA92C, GMSA92U, GMSA96, GSA96};
 
-    CoorTransEciEcf(HandleConst<TimeJ2000> hdlTime,
+    CoorTransEciEcf(const HandleConst<TimeJ2000>& hdlTime,
                     GrAngTyp grAngTyp = GMSA96);
 
     bool operator==( const CoorTransEciEcf& coorTrans ) const;
     bool operator!=( const CoorTransEciEcf& coorTrans ) const;
 
     Angle GetGreenwichAngle() const;
+    Angle GetGreenwichAngle(const TimeJ2000& tmTT) const;
     Angle RightAscensionToLongitude( Angle ra ) const;
     Angle LongitudeToRightAscension( Angle lon ) const;
 
     virtual bool IsStale() const;
 
+    virtual bool GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const;
+
 protected:
     virtual void UpdateState();
     const TimeJ2000& GetTimeOfLastTransformation() const;
@@ -63,6 +63,13 @@ CoorTransEciEci::CoorTransEciEci()
     EIClrSet(POS_EI|VEL_EI|ACC_EI);
 }
 
+bool
+CoorTransEciEci::GetDcmAt( const TimeJ2000&, Matrix3& dcm ) const // tm
+{
+    dcm = Matrix3::Identity();
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 void
 CoorTransEciEci::ToBase( const VectorCartesian& vecPositionSource,
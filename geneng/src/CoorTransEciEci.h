@@ -142,6 +142,9 @@ public:
               VectorCartesian& vecVelocitySource,
               VectorCartesian& vecAccelerationSource  ) const;
 
+    // identity at any time
+    virtual bool GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const;
+
     const char* GetVersion() const;
 
 protected:
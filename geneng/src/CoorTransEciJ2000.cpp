@@ -34,8 +34,10 @@
 namespace A3
 {
 //-----------------------------------------------------------------------------
-CoorTransEciJ2000::CoorTransEciJ2000(HandleConst<TimeJ2000> hdlTime)
-    : CoorTransBaseEci(CoorSystem::MOD), m_hdlTime(hdlTime)
+CoorTransEciJ2000::CoorTransEciJ2000(HandleConst<TimeJ2000> hdlTime,
+                                     double dcmGranularity)
+    : CoorTransBaseEci(CoorSystem::MOD), m_hdlTime(hdlTime),
+      m_dcmCache(dcmGranularity)
 {
     SetAngularVelocityZero();
     SetAngularAccelerationZero();
@@ -58,16 +60,30 @@ CoorTransEciJ2000::operator!=( const CoorTransEciJ2000& coorTrans ) const
     return !operator==( coorTrans );
 }
 
+bool
+CoorTransEciJ2000::GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const
+{
+    if ( 0.0 < m_dcmCache.GetGranularity() ) {
+        std::lock_guard<std::mutex> lock(m_dcmCacheMutex);
+        m_dcmCache.J2000ToTod(tm, dcm);
+    } else {
+        Matrix3 dcmJ2000Mod, dcmModTod;
+        IERS96::dcmJ2000ToMod(tm, dcmJ2000Mod);
+        IERS96::dcmModToTod(tm, dcmModTod);
+        dcm = dcmModTod * dcmJ2000Mod;
+    }
+
+    return true;
+}
+
 void
 CoorTransEciJ2000::UpdateState()
 {
-    static MatrixFP<double> dcmJ2000Mod(3,3,MatrixOption::IDENTITY),
-           dcmModTod(3,3,MatrixOption::IDENTITY);
+    Matrix3 dcm;
     CoorTransBaseEci::UpdateState();
     m_timeOfLastTransformation = m_hdlTime.Ref();
-    IERS96::dcmJ2000ToMod(m_timeOfLastTransformation, dcmJ2000Mod);
-    IERS96::dcmModToTod(m_timeOfLastTransformation, dcmModTod);
-    dcmModTod.Multiply(dcmJ2000Mod, Dcm());
+    GetDcmAt(m_timeOfLastTransformation, dcm);
+    Dcm() = dcm;
 }
 
 // ============================================================================
@@ -50,6 +50,9 @@
 #include "CoorTransBaseEci.h"
 #include "HandleConst.h"
 #include "TimeJ2000.h"
+#include "IERS96DcmCache.h"
+
+#include <mutex>
 
 // ============================================================================
 // A3 namespace start
@@ -62,13 +65,22 @@ namespace A3
 class CoorTransEciJ2000 : public CoorTransBaseEci
 {
 public:
-    explicit CoorTransEciJ2000(HandleConst<TimeJ2000> hdlTime);
+    // dcmGranularity is the IERS96 DCM node spacing, sec; 0 (default)
+    // bypasses the cache and evaluates the series at every time.  A
+    // positive spacing interpolates linearly between nodes, see
+    // IERS96DcmCache.h.  It is fixed for the life of the transformation.
+    explicit CoorTransEciJ2000(HandleConst<TimeJ2000> hdlTime,
+                               double dcmGranularity = 0.0);
 
     bool operator==( const CoorTransEciJ2000& coorTrans ) const;
     bool operator!=( const CoorTransEciJ2000& coorTrans ) const;
 
     virtual bool IsStale() const;
 
+    virtual bool GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const;
+
+    double GetDcmGranularity() const;
+
     const char* GetVersion() const;
 
 protected:
@@ -77,6 +89,11 @@ protected:
 
     HandleConst< TimeJ2000 > m_hdlTime;
     TimeJ2000 m_timeOfLastTransformation;
+    // only used with a positive granularity; GetDcmAt is const and may be
+    // called from several threads, so the cache nodes are read and updated
+    // under this transformation's m_dcmCacheMutex
+    mutable IERS96::DcmCache m_dcmCache;
+    mutable std::mutex m_dcmCacheMutex;
 
 private:
 };
@@ -95,6 +112,12 @@ CoorTransEciJ2000::IsStale() const
            || CoorTransBaseEci::IsStale();
 }
 
+inline double
+CoorTransEciJ2000::GetDcmGranularity() const
+{
+    return m_dcmCache.GetGranularity();
+}
+
 inline const char* CoorTransEciJ2000::GetVersion() const
 {
     return COORTRANSECIJ2000_H;
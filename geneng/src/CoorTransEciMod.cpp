@@ -34,9 +34,10 @@
 namespace A3
 {
 //-----------------------------------------------------------------------------
-CoorTransEciMod::CoorTransEciMod(HandleConst<TimeJ2000> hdlTime)
+CoorTransEciMod::CoorTransEciMod(HandleConst<TimeJ2000> hdlTime,
+                                 double dcmGranularity)
     : CoorTransBaseEci(CoorSystem::MOD),
-      m_hdlTime(hdlTime)
+      m_hdlTime(hdlTime), m_dcmCache(dcmGranularity)
 {
     SetAngularVelocityZero();
     SetAngularAccelerationZero();
@@ -59,12 +60,27 @@ CoorTransEciMod::operator!=( const CoorTransEciMod& coorTrans ) const
     return !operator==( coorTrans );
 }
 
+bool
+CoorTransEciMod::GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const
+{
+    if ( 0.0 < m_dcmCache.GetGranularity() ) {
+        std::lock_guard<std::mutex> lock(m_dcmCacheMutex);
+        m_dcmCache.ModToTod(tm, dcm);
+    } else {
+        IERS96::dcmModToTod(tm, dcm);
+    }
+
+    return true;
+}
+
 void
 CoorTransEciMod::UpdateState()
 {
     CoorTransBaseEci::UpdateState();
     m_timeOfLastTransformation = m_hdlTime.Ref();
-    IERS96::dcmModToTod(m_timeOfLastTransformation, Dcm());
+    Matrix3 dcmModTod;
+    GetDcmAt(m_timeOfLastTransformation, dcmModTod);
+    Dcm() = dcmModTod;
 }
 
 // ============================================================================
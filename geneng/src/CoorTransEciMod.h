@@ -50,6 +50,9 @@
 #include "CoorTransBaseEci.h"
 #include "HandleConst.h"
 #include "TimeJ2000.h"
+#include "IERS96DcmCache.h"
+
+#include <mutex>
 
 // ============================================================================
 // A3 namespace start
@@ -63,13 +66,22 @@ class CoorTransEciMod : public CoorTransBaseEci
 {
 public:
 
-    explicit CoorTransEciMod(HandleConst<TimeJ2000> hdlTime);
+    // dcmGranularity is the IERS96 DCM node spacing, sec; 0 (default)
+    // bypasses the cache and evaluates the series at every time.  A
+    // positive spacing interpolates linearly between nodes, see
+    // IERS96DcmCache.h.  It is fixed for the life of the transformation.
+    explicit CoorTransEciMod(HandleConst<TimeJ2000> hdlTime,
+                             double dcmGranularity = 0.0);
 
     bool operator==( const CoorTransEciMod& coorTrans ) const;
     bool operator!=( const CoorTransEciMod& coorTrans ) const;
 
     virtual bool IsStale() const;
 
+    virtual bool GetDcmAt( const TimeJ2000& tm, Matrix3& dcm ) const;
+
+    double GetDcmGranularity() const;
+
     const char* GetVersion() const;
 
 protected:
@@ -78,6 +90,11 @@ protected:
     const TimeJ2000& GetTimeOfLastTransformation() const;
     HandleConst< TimeJ2000 > m_hdlTime;
     TimeJ2000 m_timeOfLastTransformation;
+    // only used with a positive granularity; GetDcmAt is const and may be
+    // called from several threads, so the cache nodes are read and updated
+    // under this transformation's m_dcmCacheMutex
+    mutable IERS96::DcmCache m_dcmCache;
+    mutable std::mutex m_dcmCacheMutex;
 
 private:
 };
@@ -96,6 +113,12 @@ CoorTransEciMod::IsStale() const
            || CoorTransBaseEci::IsStale();
 }
 
+inline double
+CoorTransEciMod::GetDcmGranularity() const
+{
+    return m_dcmCache.GetGranularity();
+}
+
 inline const char* CoorTransEciMod::GetVersion() const
 {
     return COORTRANSECIMOD_H;
@@ -107,6 +107,11 @@ CoorTransEciPci::CoorTransEciPci(TimeJ2000 tmPostInertialRefEpoch,
     UpdateState();
 }
 
+bool CoorTransEciPci::GetDcmAt(const TimeJ2000&, Matrix3& dcm) const // tm
+{
+    return CoorTransEciEcf::GetDcmAt(*m_hdlTime, dcm);
+}
+
 // =========================================================================
 // Note: DcmAttWrtPci = DcmLnchAxesWrtPci * DcmAttWrtLnchAxes
 //       DcmAttWrtEci = DcmPciWrtEci * DcmAttWrtPci
@@ -174,6 +174,9 @@ class CoorTransEciPci : public CoorTransEciEcf
 public:
     CoorTransEciPci(TimeJ2000 tmPostInertialRefEpoch,
                     GrAngTyp grAngTyp = GMSA96);
+
+    // PCI is fixed at the reference epoch, tm is ignored
+    virtual bool GetDcmAt(const TimeJ2000& tm, Matrix3& dcm) const;
 };
 
 // =========================================================================
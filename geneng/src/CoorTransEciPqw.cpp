@@ -63,7 +63,7 @@ namespace A3
 {
 // ============================================================================
 CoorTransEciPqw
-::CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian > hdlAngles  )
+::CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian >& hdlAngles  )
     : CoorTransBaseEci( CoorSystem::PQW ),
       m_hdlAngles( hdlAngles )
 {
@@ -74,7 +74,7 @@ CoorTransEciPqw
 }
 
 CoorTransEciPqw
-::CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian > hdlAngles,
+::CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian >& hdlAngles,
                    const EulerAnglesKeplerian& eaRates  )
     : CoorTransBaseEci( CoorSystem::PQW ),
       m_hdlAngles( hdlAngles ),
@@ -127,6 +127,14 @@ void CoorTransEciPqw::UpdateState()
 
 void dcmPqwToEci(const double &ra, const double &i, const double &ap,
                  MatrixFP<double> &dcm)
+{
+    Matrix3 m;
+    dcmPqwToEci(ra, i, ap, m);
+    m.CopyTo(dcm);
+}
+
+void dcmPqwToEci(const double &ra, const double &i, const double &ap,
+                 Matrix3 &dcm)
 {
     const double cosRA(cos(ra));
     const double cosAP(cos(ap));
@@ -134,21 +142,15 @@ void dcmPqwToEci(const double &ra, const double &i, const double &ap,
     const double sinRA(sin(ra));
     const double sinAP(sin(ap));
     const double sinI(sin(i));
-
-    if (!dcm.IsSquare(3)) {
-        dcm.Resize(3,3);
-    }
-
-    CoorTransDcm::iterator a(dcm.begin());
-    a[0] =  cosRA*cosAP - sinRA*sinAP*cosI;
-    a[1] = -cosRA*sinAP - sinRA*cosAP*cosI;
-    a[2] =  sinRA*sinI;
-    a[3] =  sinRA*cosAP + cosRA*sinAP*cosI;
-    a[4] = -sinRA*sinAP + cosRA*cosAP*cosI;
-    a[5] = -cosRA*sinI;
-    a[6] =  sinAP*sinI;
-    a[7] =  cosAP*sinI;
-    a[8] =  cosI;
+    dcm = Matrix3( cosRA*cosAP - sinRA*sinAP*cosI,
+                  -cosRA*sinAP - sinRA*cosAP*cosI,
+                   sinRA*sinI,
+                   sinRA*cosAP + cosRA*sinAP*cosI,
+                  -sinRA*sinAP + cosRA*cosAP*cosI,
+                  -cosRA*sinI,
+                   sinAP*sinI,
+                   cosAP*sinI,
+                   cosI);
 }
 
 // ============================================================================
@@ -81,9 +81,9 @@ class CoorTransEciPqw : public CoorTransBaseEci
     //-------------------------------------------------------------------------
 public:
 
-    explicit CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian > hdlAngles );
+    explicit CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian >& hdlAngles );
 
-    CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian > hdlAngles,
+    CoorTransEciPqw( const HandleConst< EulerAnglesKeplerian >& hdlAngles,
                      const EulerAnglesKeplerian& eaRates );
 
     virtual bool IsStale() const;
@@ -120,6 +120,9 @@ inline const char* CoorTransEciPqw::GetVersion() const
 void dcmPqwToEci(const double &ra, const double &i, const double &ap,
                  MatrixFP<double> &dcm);
 
+void dcmPqwToEci(const double &ra, const double &i, const double &ap,
+                 Matrix3 &dcm);
+
 // ============================================================================
 }
 // A3 namespace end
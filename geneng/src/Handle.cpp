@@ -168,11 +168,18 @@ Handle<std::ostream>::Handle()
 }
 
 Handle<std::ostream>::Handle(std::ostream* pT)
-    : m_ptr(pT), m_cnt(pT ? new unsigned(1) : NULL)
+    : m_ptr(pT), m_cnt(NULL)
 {
     // ensure that standard std::ostreams are never deleted
     if (isStdStream(pT)) {
-        ++m_cnt;
+        m_cnt = new Hdl::RefCountNoDelete();
+    } else if (pT) {
+        try {
+            m_cnt = new Hdl::RefCountPtr<std::ostream>(pT);
+        } catch (...) {
+            delete pT;
+            throw;
+        }
     }
 
 #       ifdef HDLDB
@@ -186,9 +193,8 @@ Handle<std::ostream>::~Handle()
     HdlSet::Decrement(m_ptr);
 #       endif
 
-    if (m_cnt && --(*m_cnt) == 0) {
-        delete m_ptr;
-        delete m_cnt;
+    if (m_cnt && m_cnt->Decrement()) {
+        m_cnt->Dispose();
     }
 }
 
@@ -203,16 +209,17 @@ Handle<std::ostream>::operator=(const Handle<std::ostream>& hdl)
         HdlSet::Decrement(m_ptr);
 #           endif
 
-        if (m_cnt && --(*m_cnt) == 0) {
-            delete m_ptr;
-            delete m_cnt;
+        Hdl::RefCount* pCnt = m_cnt;
+
+        if (hdl.m_cnt) {
+            hdl.m_cnt->Increment();
         }
 
         m_ptr = hdl.m_ptr;
         m_cnt = hdl.m_cnt;
 
-        if (m_cnt) {
-            (*m_cnt)++;
+        if (pCnt && pCnt->Decrement()) {
+            pCnt->Dispose();
         }
 
 #           ifdef HDLDB
@@ -340,7 +347,7 @@ Handle<std::ostream>::IsNullObject() const
 unsigned
 Handle<std::ostream>::GetReferenceCount() const
 {
-    return *m_cnt;
+    return m_cnt ? m_cnt->Count() : 0;
 }
 }
 // A3 namespace end
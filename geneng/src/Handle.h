@@ -140,6 +140,14 @@
 //  Argument Type:  const Handle<T>&
 //  Argument Value: source handle
 
+//  Name:           operator=(Handle<T>&&)
+//  Purpose:        move assignment; releases current object, takes over
+//                  the source's reference and leaves the source NULL
+//  Return Type:    Handle<T>&
+//  Return Value:   *this
+//  Argument Type:  Handle<T>&&
+//  Argument Value: source handle
+
 //  Name:           operator==(const Handle<T>&) const
 //  Purpose:        test for equality
 //  Return Type:    bool
@@ -195,7 +203,7 @@ public:
         if (!hdl.IsNullObject()) {
             m_ptr = hdl.m_ptr;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #                   ifdef HDLDB
             HdlSet::Insert(m_ptr, hdl.m_ptr);
             HdlSet::Increment(m_ptr);
@@ -203,6 +211,14 @@ public:
         }
     }
 
+    // the reference moves with the pointer, the count is unchanged
+    Handle(Handle<T>&& hdl)
+        : m_ptr(hdl.m_ptr), m_cnt(hdl.m_cnt)
+    {
+        hdl.m_ptr = NULL;
+        hdl.m_cnt = NULL;
+    }
+
     template <typename U>
     Handle(const Handle<U>& hdl)
         : m_ptr(NULL), m_cnt(NULL)
@@ -217,7 +233,7 @@ public:
 
             m_ptr = pT;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #                   ifdef HDLDB
             HdlSet::Insert(m_ptr, hdl.m_ptr);
             HdlSet::Increment(m_ptr);
@@ -228,6 +244,7 @@ public:
     ~Handle();
 
     Handle& operator=(const Handle& hdl);
+    Handle& operator=(Handle&& hdl);
 
     bool operator==(const Handle& hdl) const;
     bool operator!=(const Handle& hdl) const;
@@ -258,12 +275,34 @@ protected:
 
 private:
     T* m_ptr;
-    /*mutable*/ unsigned* m_cnt;
+    Hdl::RefCount* m_cnt;
+
+    // adopts a count block that already holds the creating reference
+    Handle(T* pT, Hdl::RefCount* pCnt)
+        : m_ptr(pT), m_cnt(pCnt)
+    {
+#       ifdef HDLDB
+        HdlSet::Increment(m_ptr);
+#       endif
+    }
 
     template <typename U> friend class HandleConst;
     template <typename U> friend class Handle;
+    template <typename U, typename... Args>
+    friend Handle<U> MakeHandle(Args&&... args);
 };
 
+// MakeHandle<T>(args...)
+// constructs a T from args and its reference count in a single allocation
+template <typename T, typename... Args>
+inline Handle<T>
+MakeHandle(Args&&... args)
+{
+    Hdl::RefCountInplace<T>* pCnt
+        = new Hdl::RefCountInplace<T>(std::forward<Args>(args)...);
+    return Handle<T>(pCnt->Ptr(), pCnt);
+}
+
 // Handle()
 // default constructor safely creates an uninitialized handle
 // if a function tries to access the object controlled by this handle,
@@ -279,8 +318,17 @@ Handle<T>::Handle()
 template <typename T>
 inline
 Handle<T>::Handle(T* pT)
-    : m_ptr(pT), m_cnt(pT ? new unsigned(1) : NULL)
+    : m_ptr(pT), m_cnt(NULL)
 {
+    if (pT) {
+        try {
+            m_cnt = new Hdl::RefCountPtr<T>(pT);
+        } catch (...) {
+            delete pT;
+            throw;
+        }
+    }
+
 #       ifdef HDLDB
     HdlSet::Increment(m_ptr);
 #       endif
@@ -297,9 +345,8 @@ Handle<T>::~Handle()
     HdlSet::Decrement(m_ptr);
 #       endif
 
-    if (m_cnt && --(*m_cnt) == 0) {
-        delete m_ptr;
-        delete m_cnt;
+    if (m_cnt && m_cnt->Decrement()) {
+        m_cnt->Dispose();
     }
 }
 
@@ -313,17 +360,19 @@ Handle<T>::operator=(const Handle<T>& hdl)
 #           ifdef HDLDB
         HdlSet::Decrement(m_ptr);
 #           endif
+        // take the new reference before releasing the old one in case
+        // hdl is owned by the object being released
+        Hdl::RefCount* pCnt = m_cnt;
 
-        if (m_cnt && --(*m_cnt) == 0) {
-            delete m_ptr;
-            delete m_cnt;
+        if (hdl.m_cnt) {
+            hdl.m_cnt->Increment();
         }
 
         m_ptr = hdl.m_ptr;
         m_cnt = hdl.m_cnt;
 
-        if (m_cnt) {
-            (*m_cnt)++;
+        if (pCnt && pCnt->Decrement()) {
+            pCnt->Dispose();
         }
 
 #           ifdef HDLDB
@@ -334,6 +383,30 @@ Handle<T>::operator=(const Handle<T>& hdl)
     return *this;
 }
 
+// operator=(Handle<T>&& hdl)
+// releases current object, takes over the reference held by hdl
+template <typename T>
+inline Handle<T>&
+Handle<T>::operator=(Handle<T>&& hdl)
+{
+    if (this != &hdl) {
+#           ifdef HDLDB
+        HdlSet::Decrement(m_ptr);
+#           endif
+        Hdl::RefCount* pCnt = m_cnt;
+        m_ptr = hdl.m_ptr;
+        m_cnt = hdl.m_cnt;
+        hdl.m_ptr = NULL;
+        hdl.m_cnt = NULL;
+
+        if (pCnt && pCnt->Decrement()) {
+            pCnt->Dispose();
+        }
+    }
+
+    return *this;
+}
+
 // operator->()
 // access operator to the managed object's member functions
 template <typename T>
@@ -463,12 +536,12 @@ Handle<T>::IsNullObject() const
 }
 
 // GetReferenceCount() const
-// returns the reference count
+// returns the reference count, 0 for a NULL handle
 template <typename T>
 inline unsigned
 Handle<T>::GetReferenceCount() const
 {
-    return *m_cnt;
+    return m_cnt ? m_cnt->Count() : 0;
 }
 
 // =========================================================================
@@ -493,7 +566,7 @@ public:
         if (!hdl.IsNullObject()) {
             m_ptr = hdl.m_ptr;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #                   ifdef HDLDB
             HdlSet::Insert(m_ptr, hdl.m_ptr);
             HdlSet::Increment(m_ptr);
@@ -515,7 +588,7 @@ public:
 
             m_ptr = pT;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #                   ifdef HDLDB
             HdlSet::Insert(m_ptr, hdl.m_ptr);
             HdlSet::Increment(m_ptr);
@@ -557,7 +630,7 @@ protected:
 
 private:
     std::ostream* m_ptr;
-    /*mutable*/ unsigned* m_cnt;
+    Hdl::RefCount* m_cnt;
 };
 } // A3 namespace end
 #endif // Handle_H
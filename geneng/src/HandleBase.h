@@ -54,7 +54,17 @@
 //              V5.0      2010-06-01  JAM  moved release version of
 //                                         ReportHandles to Handle.cpp
 //  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-//  NOTES :
+//  NOTES :    The reference count lives in a small Hdl::RefCount block
+//              shared by every handle to the same object.  The count is
+//              atomic so handles may be copied and released from any
+//              thread.  The block also disposes of the object with the type
+//              it was created with.  MakeHandle co-allocates the block and
+//              the object so a handle costs a single heap allocation.
+//              HdlSet tracking is compiled in only when HDLDB is defined.
+//              Increments are relaxed, only the decrement that may dispose
+//              of the object orders memory (acq_rel).  Moving a handle
+//              transfers its reference without touching the count, so
+//              temporaries and returned handles cost no atomic operation.
 
 //****************************************************************************//
 
@@ -62,6 +72,10 @@
 #define HANDLEBASE_H __FILE__ " " __DATE__
 
 #include <iosfwd>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 // HDLDB enables tracking to support debugging
 #ifdef HDLDB
@@ -305,6 +319,96 @@ void ThrowNullPointer(const char* sHdlType);
 
 void ThrowBadCast(const char* sHdlType, const char* strDestType,
                   const char* strSrcType);
+
+// RefCount: shared reference count, starts at 1 for the creating handle
+// Dispose is only called by the handle that released the last reference
+class RefCount
+{
+public:
+    RefCount() : m_cnt(1) {;}
+
+    void Increment()
+    {
+        m_cnt.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Decrement: returns true when the last reference was released
+    bool Decrement()
+    {
+        return m_cnt.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    unsigned Count() const
+    {
+        return m_cnt.load(std::memory_order_relaxed);
+    }
+
+    // Dispose: destroys the managed object and this count
+    virtual void Dispose() = 0;
+
+protected:
+    virtual ~RefCount() {;}
+
+private:
+    RefCount(const RefCount&);
+    RefCount& operator=(const RefCount&);
+
+    std::atomic<unsigned> m_cnt;
+};
+
+// RefCountPtr: count for an object created separately with new
+template <typename T>
+class RefCountPtr : public RefCount
+{
+public:
+    explicit RefCountPtr(T* ptr) : m_ptr(ptr) {;}
+
+    virtual void Dispose()
+    {
+        delete m_ptr;
+        delete this;
+    }
+
+private:
+    T* m_ptr;
+};
+
+// RefCountNoDelete: count for an object the handle must never delete
+// (e.g. std::cout)
+class RefCountNoDelete : public RefCount
+{
+public:
+    virtual void Dispose()
+    {
+        delete this;
+    }
+};
+
+// RefCountInplace: count and object in one allocation, see MakeHandle
+template <typename T>
+class RefCountInplace : public RefCount
+{
+public:
+    template <typename... Args>
+    explicit RefCountInplace(Args&&... args)
+    {
+        new (&m_obj) T(std::forward<Args>(args)...);
+    }
+
+    T* Ptr()
+    {
+        return reinterpret_cast<T*>(&m_obj);
+    }
+
+    virtual void Dispose()
+    {
+        Ptr()->~T();
+        delete this;
+    }
+
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type m_obj;
+};
 }
 
 }
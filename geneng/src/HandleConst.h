@@ -132,6 +132,14 @@
 //  Argument Type:  const HandleConst<T>&
 //  Argument Value: source handle
 
+//  Name:           operator=(HandleConst<T>&&)
+//  Purpose:        move assignment; releases current object, takes over
+//                  the source's reference and leaves the source NULL
+//  Return Type:    HandleConst<T>&
+//  Return Value:   *this
+//  Argument Type:  HandleConst<T>&&
+//  Argument Value: source handle
+
 //  Name:           operator==(const HandleConst<T>&) const
 //  Purpose:        test for equality
 //  Return Type:    bool
@@ -194,7 +202,7 @@ public:
         if (!hdl.IsNullObject()) {
             m_ptr = hdl.m_ptr;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #               ifdef HDLDB
             HdlSet::Increment(m_ptr);
 #               endif
@@ -218,7 +226,7 @@ public:
 
             m_ptr = pT;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #               ifdef HDLDB
             HdlSet::Increment(m_ptr);
 #               endif
@@ -231,7 +239,7 @@ public:
         if (!hdl.IsNullObject()) {
             m_ptr = hdl.m_ptr;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #               ifdef HDLDB
             HdlSet::Insert(m_ptr, hdl.m_ptr);
             HdlSet::Increment(m_ptr);
@@ -239,6 +247,14 @@ public:
         }
     }
 
+    // the reference moves with the pointer, the count is unchanged
+    HandleConst(HandleConst<T>&& hdl)
+        : m_ptr(hdl.m_ptr), m_cnt(hdl.m_cnt)
+    {
+        hdl.m_ptr = NULL;
+        hdl.m_cnt = NULL;
+    }
+
     template <typename U>
     HandleConst(const HandleConst<U>& hdl)
         : m_ptr(NULL), m_cnt(NULL)
@@ -253,7 +269,7 @@ public:
 
             m_ptr = pT;
             m_cnt = hdl.m_cnt;
-            ++(*m_cnt);
+            m_cnt->Increment();
 #               ifdef HDLDB
             HdlSet::Insert(m_ptr, hdl.m_ptr);
             HdlSet::Increment(m_ptr);
@@ -264,6 +280,7 @@ public:
     ~HandleConst();
 
     HandleConst& operator=(const HandleConst& hdl);
+    HandleConst& operator=(HandleConst&& hdl);
 
     bool operator==(const HandleConst& hdl) const;
     bool operator!=(const HandleConst& hdl) const;
@@ -289,7 +306,7 @@ protected:
 
 private:
     T* m_ptr;
-    /*mutable*/ unsigned* m_cnt;
+    Hdl::RefCount* m_cnt;
 
     template <typename U> friend class HandleConst;
 };
@@ -310,8 +327,17 @@ HandleConst<T>::HandleConst()
 template <typename T>
 inline
 HandleConst<T>::HandleConst(T* pT)
-    : m_ptr(pT), m_cnt(pT ? new unsigned(1) : NULL)
+    : m_ptr(pT), m_cnt(NULL)
 {
+    if (pT) {
+        try {
+            m_cnt = new Hdl::RefCountPtr<T>(pT);
+        } catch (...) {
+            delete pT;
+            throw;
+        }
+    }
+
 #   ifdef HDLDB
     HdlSet::Increment(m_ptr);
 #   endif
@@ -328,9 +354,8 @@ HandleConst<T>::~HandleConst()
     HdlSet::Decrement(m_ptr);
 #   endif
 
-    if (m_cnt && --(*m_cnt) == 0) {
-        delete m_ptr;
-        delete m_cnt;
+    if (m_cnt && m_cnt->Decrement()) {
+        m_cnt->Dispose();
     }
 }
 
@@ -345,16 +370,19 @@ HandleConst<T>::operator=(const HandleConst<T>& hdl)
         HdlSet::Decrement(m_ptr);
 #       endif
 
-        if (m_cnt && --(*m_cnt) == 0) {
-            delete m_ptr;
-            delete m_cnt;
+        // take the new reference before releasing the old one in case
+        // hdl is owned by the object being released
+        Hdl::RefCount* pCnt = m_cnt;
+
+        if (hdl.m_cnt) {
+            hdl.m_cnt->Increment();
         }
 
         m_ptr = hdl.m_ptr;
         m_cnt = hdl.m_cnt;
 
-        if (m_cnt) {
-            (*m_cnt)++;
+        if (pCnt && pCnt->Decrement()) {
+            pCnt->Dispose();
         }
 
 #       ifdef HDLDB
@@ -365,6 +393,30 @@ HandleConst<T>::operator=(const HandleConst<T>& hdl)
     return *this;
 }
 
+// operator=(HandleConst<T>&& hdl)
+// releases current object, takes over the reference held by hdl
+template <typename T>
+inline HandleConst<T>&
+HandleConst<T>::operator=(HandleConst<T>&& hdl)
+{
+    if (this != &hdl) {
+#       ifdef HDLDB
+        HdlSet::Decrement(m_ptr);
+#       endif
+        Hdl::RefCount* pCnt = m_cnt;
+        m_ptr = hdl.m_ptr;
+        m_cnt = hdl.m_cnt;
+        hdl.m_ptr = NULL;
+        hdl.m_cnt = NULL;
+
+        if (pCnt && pCnt->Decrement()) {
+            pCnt->Dispose();
+        }
+    }
+
+    return *this;
+}
+
 // operator->() const
 // access operator to const member functions of the managed object
 template <typename T>
@@ -444,12 +496,12 @@ HandleConst<T>::IsNullObject() const
 }
 
 // GetReferenceCount() const
-// returns the reference count
+// returns the reference count, 0 for a NULL handle
 template <typename T>
 inline unsigned
 HandleConst<T>::GetReferenceCount() const
 {
-    return *m_cnt;
+    return m_cnt ? m_cnt->Count() : 0;
 }
 
 // ============================================================================
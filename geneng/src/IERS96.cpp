@@ -111,38 +111,36 @@ Angle moe(const TimeJ2000& tmTT)
 
 // J2000 to Mean Equator, Mean Equinox of Date
 // Direction Cosine Matrix
-void dcmJ2000ToMod(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
+void dcmJ2000ToMod(const TimeJ2000& tmTT, Matrix3& dcm)
 {
-    if (!dcm.IsSquare(3)) {
-        dcm.Resize(3,3);
-    }
-
     Angle zetaA, thetaA, zA;
     prcang(tmTT, zetaA, thetaA, zA);
     double cze(cos(zetaA)), sze(sin(zetaA));
     double cth(cos(thetaA)), sth(sin(thetaA));
     double czz(cos(zA)), szz(sin(zA));
-    MatrixFP<double>::iterator m(dcm.begin());
-    m[0] =  cze*cth*czz-sze*szz;
-    m[1] = -sze*cth*czz-cze*szz;
-    m[2] = -sth*czz;
-    m[3] =  cze*cth*szz+sze*czz;
-    m[4] = -sze*cth*szz+cze*czz;
-    m[5] = -sth*szz;
-    m[6] =  cze*sth;
-    m[7] = -sze*sth;
-    m[8] =  cth;
+    dcm = Matrix3( cze*cth*czz-sze*szz,
+                  -sze*cth*czz-cze*szz,
+                  -sth*czz,
+                   cze*cth*szz+sze*czz,
+                  -sze*cth*szz+cze*czz,
+                  -sth*szz,
+                   cze*sth,
+                  -sze*sth,
+                   cth);
+}
+
+void dcmJ2000ToMod(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
+{
+    Matrix3 m;
+    dcmJ2000ToMod(tmTT, m);
+    m.CopyTo(dcm);
 }
 
 // Mean Equator, Mean Equinox of Date to
 // True Equator, True Equinox of Date
 // Direction Cosine Matrix
-void dcmModToTod(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
+void dcmModToTod(const TimeJ2000& tmTT, Matrix3& dcm)
 {
-    if (!dcm.IsSquare(3)) {
-        dcm.Resize(3,3);
-    }
-
     Angle nl(Jpl::nutations().Longitude(tmTT));
     Angle ne(Jpl::nutations().Obliquity(tmTT));
     Angle me(moe(tmTT));
@@ -150,34 +148,40 @@ void dcmModToTod(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
     double cnl(cos(nl)), snl(sin(nl));
     double cme(cos(me)), sme(sin(me));
     double cmt(cos(mt)), smt(sin(mt));
-    MatrixFP<double>::iterator m(dcm.begin());
-    m[0] =  cnl;
-    m[1] = -cme*snl;
-    m[2] = -sme*snl;
-    m[3] =  cmt*snl;
-    m[4] =  cme*cmt*cnl+sme*smt;
-    m[5] =  sme*cmt*cnl-cme*smt;
-    m[6] =  smt*snl;
-    m[7] =  cme*smt*cnl-sme*cmt;
-    m[8] =  sme*smt*cnl+cme*cmt;
+    dcm = Matrix3( cnl,
+                  -cme*snl,
+                  -sme*snl,
+                   cmt*snl,
+                   cme*cmt*cnl+sme*smt,
+                   sme*cmt*cnl-cme*smt,
+                   smt*snl,
+                   cme*smt*cnl-sme*cmt,
+                   sme*smt*cnl+cme*cmt);
+}
+
+void dcmModToTod(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
+{
+    Matrix3 m;
+    dcmModToTod(tmTT, m);
+    m.CopyTo(dcm);
 }
 
 // True Equator, True Equinox of Date to Pseudo Body Fixed
 // Direction Cosine Matrix
-void dcmTodToPbf(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
+void dcmTodToPbf(const TimeJ2000& tmTT, Matrix3& dcm)
 {
-    if (!dcm.IsSquare(3)) {
-        dcm.Resize(3,3);
-    }
-
     Angle a(gsa(tmTT));
     double ca(cos(a)), sa(sin(a));
-    dcm.IdentityThis();
-    MatrixFP<double>::iterator m(dcm.begin());
-    m[0] =  ca;
-    m[1] =  sa;
-    m[3] = -sa;
-    m[4] =  ca;
+    dcm = Matrix3( ca,  sa, 0.0,
+                  -sa,  ca, 0.0,
+                  0.0, 0.0, 1.0);
+}
+
+void dcmTodToPbf(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
+{
+    Matrix3 m;
+    dcmTodToPbf(tmTT, m);
+    m.CopyTo(dcm);
 }
 
 // True Equator, True Equinox of Date to Pseudo Body Fixed
@@ -55,6 +55,7 @@
 #include "TimeJ2000.h"
 #include "Angle.h"
 #include "MatrixFP.h"
+#include "Matrix3.h"
 #include <math.h>
 
 /// Astrodynamics, Allocation and Availability
@@ -131,6 +132,7 @@ Angle gmsa(const TimeR2000& tmTT);
 /// @param [in] tmTT time, J2000, TT, sec
 /// @param [out] dcm J2000 to Mean of Date DCM
 void dcmJ2000ToMod(const TimeJ2000& tmTT, MatrixFP<double>& dcm);
+void dcmJ2000ToMod(const TimeJ2000& tmTT, Matrix3& dcm);
 
 /// @brief Mean Equator, Mean Equinox of Date to J2000
 /// Direction Cosine Matrix
@@ -143,12 +145,20 @@ void dcmModToJ2000(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
     dcm.TransposeThis();
 }
 
+inline
+void dcmModToJ2000(const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    dcmJ2000ToMod(tmTT, dcm);
+    dcm.TransposeThis();
+}
+
 /// @brief Mean Equator, Mean Equinox of Date to
 /// True Equator, True Equinox of Date
 /// Direction Cosine Matrix
 /// @param [in] tmTT time, J2000, TT, sec
 /// @param [out] dcm Mean of Date to True of Date DCM
 void dcmModToTod(const TimeJ2000& tmTT, MatrixFP<double>& dcm);
+void dcmModToTod(const TimeJ2000& tmTT, Matrix3& dcm);
 
 /// @brief True Equator, True Equinox of Date to
 /// Mean Equator, Mean Equinox of Date
@@ -162,11 +172,19 @@ void dcmTodToMod(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
     dcm.TransposeThis();
 }
 
+inline
+void dcmTodToMod(const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    dcmModToTod(tmTT, dcm);
+    dcm.TransposeThis();
+}
+
 /// @brief True Equator, True Equinox of Date to Pseudo Body Fixed
 /// Direction Cosine Matrix
 /// @param [in] tmTT time, J2000, TT, sec
 /// @param [out] dcm True of Date to Pseudo Body Fixed DCM
 void dcmTodToPbf(const TimeJ2000& tmTT, MatrixFP<double>& dcm);
+void dcmTodToPbf(const TimeJ2000& tmTT, Matrix3& dcm);
 
 /// @brief Pseudo Body Fixed to True Equator, True Equinox of Date
 /// Direction Cosine Matrix
@@ -179,6 +197,13 @@ void dcmPbfToTod(const TimeJ2000& tmTT, MatrixFP<double>& dcm)
     dcm.TransposeThis();
 }
 
+inline
+void dcmPbfToTod(const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    dcmTodToPbf(tmTT, dcm);
+    dcm.TransposeThis();
+}
+
 /// @brief True Equator, True Equinox of Date to Pseudo Body Fixed
 /// Direction Cosine Matrix and Rate Matrix
 /// @param [in] tmTT time, J2000, TT, sec
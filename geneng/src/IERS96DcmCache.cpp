@@ -0,0 +1,149 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * IERS96DcmCache.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+// =============================================================================
+//                         U N C L A S S I F I E D
+// =============================================================================
+// IERS96 DCM Cache
+// Refer to IERS96DcmCache.h more info.
+//===============================================================================
+#include "IERS96DcmCache.h"
+#include "IERS96.h"
+#include "constants.h"
+
+#include <math.h>
+
+// Astrodynamics, Allocation and Availability
+namespace A3
+{
+// IERS Conventions 1996
+namespace IERS96
+{
+DcmCache::DcmCache(double granularity)
+    : m_granularity(0.0)
+{
+    SetGranularity(granularity);
+}
+
+void DcmCache::SetGranularity(double granularity)
+{
+    m_granularity = granularity > 0.0 ? granularity : 0.0;
+    Clear();
+}
+
+void DcmCache::Clear()
+{
+    for (int i = 0; i < NUMBER_OF_DCMS; ++i) {
+        m_entry[i].m_valid = false;
+    }
+}
+
+// J2000 to True of Date, the two factors share the cache entries used by
+// J2000ToMod and ModToTod
+void DcmCache::J2000ToTod(const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    Matrix3 dcmJ2000Mod, dcmModTod;
+    Lookup(J2000_MOD, tmTT, dcmJ2000Mod);
+    Lookup(MOD_TOD, tmTT, dcmModTod);
+    dcm = dcmModTod * dcmJ2000Mod;
+}
+
+// evaluate the series for one node, TOD->PBF keeps the sidereal angle
+void DcmCache::Evaluate(DcmId id, const TimeJ2000& tmTT, Entry& entry, int node)
+{
+    switch (id) {
+        case J2000_MOD:
+            dcmJ2000ToMod(tmTT, entry.m_dcm[node]);
+            break;
+
+        case MOD_TOD:
+            dcmModToTod(tmTT, entry.m_dcm[node]);
+            break;
+
+        default:
+            entry.m_angle[node] = gsa(tmTT);
+            break;
+    }
+}
+
+void DcmCache::Lookup(DcmId id, const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    Entry& entry(m_entry[id]);
+    double angle(0.0);
+
+    if (m_granularity == 0.0) {
+        // exact, memoize the last time only
+        if (!entry.m_valid || entry.m_tm != tmTT) {
+            Evaluate(id, tmTT, entry, 0);
+            entry.m_tm = tmTT;
+            entry.m_valid = true;
+        }
+
+        if (TOD_PBF != id) {
+            dcm = entry.m_dcm[0];
+            return;
+        }
+
+        angle = entry.m_angle[0];
+    } else {
+        double index(floor(tmTT / m_granularity));
+
+        if (!entry.m_valid || index != entry.m_index) {
+            if (entry.m_valid && index == entry.m_index + 1.0) {
+                // stepping forward, the old upper node is the new lower node
+                entry.m_dcm[0] = entry.m_dcm[1];
+                entry.m_angle[0] = entry.m_angle[1];
+            } else {
+                Evaluate(id, TimeJ2000(index * m_granularity), entry, 0);
+            }
+
+            Evaluate(id, TimeJ2000((index + 1.0) * m_granularity), entry, 1);
+            entry.m_index = index;
+            entry.m_valid = true;
+        }
+
+        double frac((tmTT - index * m_granularity) / m_granularity);
+
+        if (TOD_PBF != id) {
+            const double* pA(entry.m_dcm[0][0]);
+            const double* pB(entry.m_dcm[1][0]);
+            double* pDcm(dcm[0]);
+
+            for (int i = 0; i < 9; ++i) {
+                pDcm[i] = pA[i] + frac * (pB[i] - pA[i]);
+            }
+
+            return;
+        }
+
+        // the sidereal angle may wrap between the nodes
+        double delta(entry.m_angle[1] - entry.m_angle[0]);
+        delta -= TWO_PI * floor((delta + PI) / TWO_PI);
+        angle = entry.m_angle[0] + frac * delta;
+    }
+
+    double ca(cos(angle)), sa(sin(angle));
+    dcm = Matrix3( ca,  sa, 0.0,
+                  -sa,  ca, 0.0,
+                  0.0, 0.0, 1.0);
+}
+} // IERS96
+} // A3
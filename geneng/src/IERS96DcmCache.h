@@ -0,0 +1,143 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * IERS96DcmCache.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+// =============================================================================
+//                         U N C L A S S I F I E D
+// =============================================================================
+/// @file
+/// @brief Time keyed cache of the IERS96 precession, nutation and sidereal
+/// rotation direction cosine matrices
+///
+/// @details With a granularity of zero the cache memoizes the direct
+/// series for the last time requested, so repeated transformations at the
+/// same time (e.g. J2000->MOD then MOD->TOD) evaluate the series once and
+/// results are identical to the IERS96 functions.
+///
+/// With a positive granularity the series are evaluated on a grid of node
+/// times k*granularity and a request between two nodes is interpolated
+/// linearly.  This is not a Chebyshev fit over the run span: linear nodes
+/// need no pre-pass over the span, and the nutation they sample already
+/// comes from the JPL Chebyshev coefficients.  The error bound below is
+/// the price; pick the granularity against it.
+/// Precession and nutation change slowly, so the J2000->MOD and MOD->TOD
+/// matrices are interpolated element by element.  The interpolation error
+/// grows with the square of the granularity and is set by the 13.66 day
+/// nutation term, roughly 1e-14 at one minute and 5e-11 at one hour per
+/// DCM element.  The TOD->PBF rotation turns once a day,
+/// so its sidereal angle is interpolated instead of the matrix elements.
+/// Only the two nodes bracketing the last request are kept per matrix, so
+/// memory is constant and sequential time stepping recomputes one node
+/// per granularity interval.
+///
+/// A cache is not thread safe.  CoorTransEciJ2000 and CoorTransEciMod lock
+/// around theirs, and bypass it entirely when the granularity is zero since
+/// memoizing one time is slower than evaluating the series directly.
+///
+/// @par Units
+/// - Function Arg & Return: time, J2000 TT sec; granularity, sec
+// =============================================================================
+#ifndef IERS96DCMCACHE_H
+/// header guard macro
+#define IERS96DCMCACHE_H   __FILE__ " " __DATE__
+
+#include "TimeJ2000.h"
+#include "Matrix3.h"
+
+/// Astrodynamics, Allocation and Availability
+namespace A3
+{
+/// IERS Conventions 1996
+namespace IERS96
+{
+/// @brief Cache of the J2000->MOD, MOD->TOD and TOD->PBF DCMs
+class DcmCache
+{
+public:
+    /// @param [in] granularity node spacing, sec; 0 disables interpolation
+    explicit DcmCache(double granularity = 0.0);
+
+    /// @brief Change the node spacing, discards cached nodes
+    /// @param [in] granularity node spacing, sec; 0 disables interpolation
+    void SetGranularity(double granularity);
+
+    /// @return node spacing, sec; 0 if interpolation is disabled
+    double GetGranularity() const;
+
+    /// @brief Discard cached matrices
+    void Clear();
+
+    /// @brief J2000 to Mean of Date DCM, see IERS96::dcmJ2000ToMod
+    void J2000ToMod(const TimeJ2000& tmTT, Matrix3& dcm);
+
+    /// @brief Mean of Date to True of Date DCM, see IERS96::dcmModToTod
+    void ModToTod(const TimeJ2000& tmTT, Matrix3& dcm);
+
+    /// @brief J2000 to True of Date DCM, MOD->TOD * J2000->MOD
+    void J2000ToTod(const TimeJ2000& tmTT, Matrix3& dcm);
+
+    /// @brief True of Date to Pseudo Body Fixed DCM, see IERS96::dcmTodToPbf
+    void TodToPbf(const TimeJ2000& tmTT, Matrix3& dcm);
+
+private:
+    enum DcmId { J2000_MOD, MOD_TOD, TOD_PBF, NUMBER_OF_DCMS };
+
+    // node pair for one matrix, node 0 at m_index*granularity and node 1
+    // one granularity later; with no granularity only node 0 is used and
+    // m_tm is the exact time it was computed for
+    struct Entry {
+        Entry() : m_valid(false), m_index(0.0), m_tm(0.0) {;}
+
+        bool m_valid;
+        double m_index;
+        double m_tm;
+        Matrix3 m_dcm[2];
+        double m_angle[2];
+    };
+
+    void Evaluate(DcmId id, const TimeJ2000& tmTT, Entry& entry, int node);
+    void Lookup(DcmId id, const TimeJ2000& tmTT, Matrix3& dcm);
+
+    double m_granularity;
+    Entry m_entry[NUMBER_OF_DCMS];
+};
+
+inline double DcmCache::GetGranularity() const
+{
+    return m_granularity;
+}
+
+inline void DcmCache::J2000ToMod(const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    Lookup(J2000_MOD, tmTT, dcm);
+}
+
+inline void DcmCache::ModToTod(const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    Lookup(MOD_TOD, tmTT, dcm);
+}
+
+inline void DcmCache::TodToPbf(const TimeJ2000& tmTT, Matrix3& dcm)
+{
+    Lookup(TOD_PBF, tmTT, dcm);
+}
+} // IERS96
+} // A3
+#endif  // IERS96DCMCACHE_H
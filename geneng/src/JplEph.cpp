@@ -99,7 +99,7 @@ EphCoeff::EphCoeff(const EphCoeff& ec)
     std::copy(ec.m_pCoeff, ec.m_pCoeff+TCoefficients(), m_pCoeff);
 }
 
-EphCoeff::EphCoeff(Handle<EphObjDesc> hDesc,
+EphCoeff::EphCoeff(const Handle<EphObjDesc>& hDesc,
                    const TimeJ2000& tmStr, const TimeJ2000& tmEnd,
                    EphRec::const_iterator pCoeff)
     : m_hDesc(hDesc), m_tmStr(tmStr), m_dt(tmEnd-tmStr),
@@ -228,7 +228,7 @@ std::ostream& EphCoeff::ReportState(std::ostream& os) const
 // ---------------------------------------------------------------------
 EphInterval::EphInterval() : m_hDesc(new EphObjDesc) {;}
 
-EphInterval::EphInterval(Handle<EphObjDesc> hDesc, const EphRec& rec)
+EphInterval::EphInterval(const Handle<EphObjDesc>& hDesc, const EphRec& rec)
     : m_hDesc(hDesc), m_tmStr(rec.TmStart()), m_tmEnd(rec.TmEnd())
 {
     EphObjDesc &od(*m_hDesc);
@@ -246,7 +246,7 @@ EphInterval::EphInterval(Handle<EphObjDesc> hDesc, const EphRec& rec)
     } while(etr != itr);
 }
 
-EphInterval::EphInterval(Handle<EphObjDesc> hDesc,
+EphInterval::EphInterval(const Handle<EphObjDesc>& hDesc,
                          EphRecVec::const_iterator itr, EphRecVec::const_iterator etr)
     : m_hDesc(hDesc), m_tmStr(itr->TmStart()), m_tmEnd((etr-1)->TmEnd())
 {
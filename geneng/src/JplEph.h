@@ -155,7 +155,7 @@ public:
     /// @param [in] tmStr interpolation period start, J2000 TT sec
     /// @param [in] tmEnd interpolation period end, J2000 TT sec
     /// @param [in] pCoeff Chebyshev coefficient recort
-    EphCoeff(Handle<EphObjDesc> hDesc,
+    EphCoeff(const Handle<EphObjDesc>& hDesc,
              const TimeJ2000& tmStr, const TimeJ2000& tmEnd,
              EphRec::const_iterator pCoeff);
     virtual ~EphCoeff();
@@ -226,7 +226,7 @@ public:
 
     /// Ephemeris Object Description
     /// @return handle to Ephemeris Object Description
-    const Handle<EphObjDesc> Description() const
+    const Handle<EphObjDesc>& Description() const
     {
         return m_hDesc;
     }
@@ -270,19 +270,19 @@ public:
     /// Ephemeris record
     /// @param [in] handle to an Ephemeris Object Description
     /// @param [in] handle to an Ephemeris Record
-    EphInterval(Handle<EphObjDesc> hDesc, const EphRec& rec);
+    EphInterval(const Handle<EphObjDesc>& hDesc, const EphRec& rec);
     /// Initialize from an Ephemeris Object Description and
     /// a container of Ephemeris Records
     /// @param [in] handle to an Ephemeris Object Description
     /// @param [in] iterator to the 1st ephemeris record
     /// @param [in] iterator beyond the last ephemeris record
-    EphInterval(Handle<EphObjDesc> hDesc,
+    EphInterval(const Handle<EphObjDesc>& hDesc,
                 EphRecVec::const_iterator itr,
                 EphRecVec::const_iterator etr);
 
     /// Ephemeris object description
     /// @return handle to the Ephemeris Object Description
-    const Handle<EphObjDesc> Description() const
+    const Handle<EphObjDesc>& Description() const
     {
         return m_hDesc;
     }
@@ -416,10 +416,12 @@ private:
 };
 
 /// JPL Ephemeris Dataset Static Object
+/// (one per thread: the dataset lazily reads its header and keeps a
+/// buffer of records, so threads must not share it)
 // extern Eph eph;
 inline Eph& eph()
 {
-    static Eph e;
+    static thread_local Eph e;
     return e;
 }
 
@@ -487,9 +489,10 @@ private:
 };
 
 // extern Nutations nutations;
+/// (one per thread, as it caches the last interval and angles)
 inline Nutations& nutations()
 {
-    static Nutations nut;
+    static thread_local Nutations nut;
     return nut;
 }
 
@@ -0,0 +1,301 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * Matrix3.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+//****************************************************************************//
+//                         U N C L A S S I F I E D                            //
+//****************************************************************************//
+
+//  FILE      : Matrix3.h
+
+//  NAMESPACE : A3
+
+//  SYSTEM    : SatSim 2000
+
+//  SUBSYSTEM : SatTools
+
+//  MODULE(s) : Matrix3, Vector3
+
+//  NOTES : Fixed size 3x3 matrix and 3-vector for direction cosine matrix
+//          work.  Storage is a plain array held by value (no heap, no
+//          scratch, no resize) so the rotation chains built every time
+//          step do not pay for MatrixBase allocation and size checks.
+//          Matrix3 is row-major with the same element order as a 3x3
+//          MatrixFP so the two interoperate element for element.
+//          Multiply and TransposeMultiply allow the input and output
+//          vector to be the same object.
+
+//==============================================================================
+#ifndef MATRIX3_H
+#define MATRIX3_H	__FILE__ " " __DATE__
+
+#include "MatrixFP.h"
+#include "VectorCartesian.h"
+#include "Quaternion.h"
+#include "EulerElemRotation.h"
+#include <math.h>
+
+// A3 namespace start
+namespace A3
+{
+// ============================================================================
+class Vector3
+{
+public:
+    constexpr Vector3()
+        : m_v {0.0, 0.0, 0.0} {;}
+
+    constexpr Vector3(double x, double y, double z)
+        : m_v {x, y, z} {;}
+
+    explicit Vector3(const VectorCartesian& v)
+        : m_v {v[0], v[1], v[2]} {;}
+
+    constexpr double operator[](unsigned i) const
+    {
+        return m_v[i];
+    }
+
+    double& operator[](unsigned i)
+    {
+        return m_v[i];
+    }
+
+    constexpr double Dot(const Vector3& v) const
+    {
+        return m_v[0]*v.m_v[0] + m_v[1]*v.m_v[1] + m_v[2]*v.m_v[2];
+    }
+
+    constexpr Vector3 Cross(const Vector3& v) const
+    {
+        return Vector3(m_v[1]*v.m_v[2] - m_v[2]*v.m_v[1],
+                       m_v[2]*v.m_v[0] - m_v[0]*v.m_v[2],
+                       m_v[0]*v.m_v[1] - m_v[1]*v.m_v[0]);
+    }
+
+    VectorCartesian ToVectorCartesian() const
+    {
+        return VectorCartesian(m_v[0], m_v[1], m_v[2]);
+    }
+
+private:
+    double m_v[3];
+};
+
+// ============================================================================
+class Matrix3
+{
+public:
+    // zero matrix
+    constexpr Matrix3()
+        : m_m {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0} {;}
+
+    // row-major elements
+    constexpr Matrix3(double m00, double m01, double m02,
+                      double m10, double m11, double m12,
+                      double m20, double m21, double m22)
+        : m_m {m00, m01, m02, m10, m11, m12, m20, m21, m22} {;}
+
+    explicit Matrix3(const MatrixFP<double>& mtx);
+    explicit Matrix3(const Quaternion& q);
+    explicit Matrix3(const EulerElemRotation& eer);
+
+    static constexpr Matrix3 Identity()
+    {
+        return Matrix3(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
+    }
+
+    // copies into a MatrixFP, resizing it to 3x3 if required
+    void CopyTo(MatrixFP<double>& mtx) const;
+
+    // element access, m[row][col]
+    const double* operator[](unsigned row) const
+    {
+        return m_m + 3*row;
+    }
+
+    double* operator[](unsigned row)
+    {
+        return m_m + 3*row;
+    }
+
+    constexpr double operator()(unsigned row, unsigned col) const
+    {
+        return m_m[3*row+col];
+    }
+
+    const double* begin() const
+    {
+        return m_m;
+    }
+
+    const double* end() const
+    {
+        return m_m + 9;
+    }
+
+    constexpr Matrix3 Transpose() const
+    {
+        return Matrix3(m_m[0], m_m[3], m_m[6],
+                       m_m[1], m_m[4], m_m[7],
+                       m_m[2], m_m[5], m_m[8]);
+    }
+
+    void TransposeThis()
+    {
+        *this = Transpose();
+    }
+
+    Matrix3 operator*(const Matrix3& b) const;
+
+    constexpr Vector3 operator*(const Vector3& b) const
+    {
+        return Vector3(m_m[0]*b[0] + m_m[1]*b[1] + m_m[2]*b[2],
+                       m_m[3]*b[0] + m_m[4]*b[1] + m_m[5]*b[2],
+                       m_m[6]*b[0] + m_m[7]*b[1] + m_m[8]*b[2]);
+    }
+
+    // v = this * b
+    void Multiply(const VectorCartesian& b, VectorCartesian& v) const;
+
+    // v = transpose(this) * b
+    void TransposeMultiply(const VectorCartesian& b, VectorCartesian& v) const;
+
+private:
+    double m_m[9];
+};
+
+// ----------------------------------------------------------------------------
+inline
+Matrix3::Matrix3(const MatrixFP<double>& mtx)
+{
+    if (!mtx.IsSquare(3)) {
+        MatrixExcept::ThrowMustBe3X3("Matrix3(const MatrixFP<double>&)",
+                                     mtx.size_row(), mtx.size_column());
+    }
+
+    std::copy(mtx.begin(), mtx.end(), m_m);
+}
+
+// same element layout as MatrixFP(const Quaternion&)
+inline
+Matrix3::Matrix3(const Quaternion& q)
+{
+    double qq0(q[0]*q[0]);
+    double qq1(q[1]*q[1]);
+    double qq2(q[2]*q[2]);
+    double qq3(q[3]*q[3]);
+    double q01(2.0*q[0]*q[1]);
+    double q02(2.0*q[0]*q[2]);
+    double q03(2.0*q[0]*q[3]);
+    double q12(2.0*q[1]*q[2]);
+    double q13(2.0*q[1]*q[3]);
+    double q23(2.0*q[2]*q[3]);
+    m_m[0] =  qq0-qq1-qq2+qq3;
+    m_m[1] =  q01+q23;
+    m_m[2] =  q02-q13;
+    m_m[3] =  q01-q23;
+    m_m[4] = -qq0+qq1-qq2+qq3;
+    m_m[5] =  q12+q03;
+    m_m[6] =  q02+q13;
+    m_m[7] =  q12-q03;
+    m_m[8] = -qq0-qq1+qq2+qq3;
+}
+
+// same element layout as MatrixFP(const EulerElemRotation&)
+inline
+Matrix3::Matrix3(const EulerElemRotation& eer)
+{
+    typedef EulerElemRotation EER;
+    *this = Identity();
+    Angle a = eer.GetAngle();
+    double c = cos(a);
+    double s = sin(a);
+
+    switch (eer.GetAxis()) {
+        case EER::A1:
+            m_m[4] = c;
+            m_m[5] = -s;
+            m_m[7] = s;
+            m_m[8] = c;
+            break;
+
+        case EER::A2:
+            m_m[0] = c;
+            m_m[2] = s;
+            m_m[6] = -s;
+            m_m[8] = c;
+            break;
+
+        case EER::A3:
+            m_m[0] = c;
+            m_m[1] = -s;
+            m_m[3] = s;
+            m_m[4] = c;
+            break;
+    }
+}
+
+inline void
+Matrix3::CopyTo(MatrixFP<double>& mtx) const
+{
+    if (!mtx.IsSquare(3)) {
+        mtx.Resize(3, 3);
+    }
+
+    std::copy(m_m, m_m + 9, mtx.begin());
+}
+
+inline Matrix3
+Matrix3::operator*(const Matrix3& b) const
+{
+    const double* a(m_m);
+    const double* c(b.m_m);
+    return Matrix3(a[0]*c[0] + a[1]*c[3] + a[2]*c[6],
+                   a[0]*c[1] + a[1]*c[4] + a[2]*c[7],
+                   a[0]*c[2] + a[1]*c[5] + a[2]*c[8],
+                   a[3]*c[0] + a[4]*c[3] + a[5]*c[6],
+                   a[3]*c[1] + a[4]*c[4] + a[5]*c[7],
+                   a[3]*c[2] + a[4]*c[5] + a[5]*c[8],
+                   a[6]*c[0] + a[7]*c[3] + a[8]*c[6],
+                   a[6]*c[1] + a[7]*c[4] + a[8]*c[7],
+                   a[6]*c[2] + a[7]*c[5] + a[8]*c[8]);
+}
+
+inline void
+Matrix3::Multiply(const VectorCartesian& b, VectorCartesian& v) const
+{
+    double x(b[0]), y(b[1]), z(b[2]);
+    v[0] = m_m[0]*x + m_m[1]*y + m_m[2]*z;
+    v[1] = m_m[3]*x + m_m[4]*y + m_m[5]*z;
+    v[2] = m_m[6]*x + m_m[7]*y + m_m[8]*z;
+}
+
+inline void
+Matrix3::TransposeMultiply(const VectorCartesian& b, VectorCartesian& v) const
+{
+    double x(b[0]), y(b[1]), z(b[2]);
+    v[0] = m_m[0]*x + m_m[3]*y + m_m[6]*z;
+    v[1] = m_m[1]*x + m_m[4]*y + m_m[7]*z;
+    v[2] = m_m[2]*x + m_m[5]*y + m_m[8]*z;
+}
+}
+// A3 namespace end
+#endif  // MATRIX3_H
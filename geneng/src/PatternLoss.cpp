@@ -56,6 +56,8 @@
 //==============================================================================
 #include "PatternLoss.h"
 #include "constants.h"
+// using math.h since Microsoft's cmath is not in the std namespace
+#include <math.h>
 
 // ============================================================================
 // A3 namespace start
@@ -63,6 +65,98 @@ namespace A3
 {
 // ============================================================================
 const Angle PatternLoss::s_maxOffBoreSightAngle = PI;
+const unsigned PatternLoss::s_lutErrorSamples = 16;
+
+// -----------------------------------------------------------------------------
+void
+PatternLoss::ComputePatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                                      std::vector< double >& patternLoss ) const
+{
+    patternLoss.resize( offBoreSightAngles.size() );
+
+    for ( size_t i = 0; i < offBoreSightAngles.size(); ++i ) {
+        patternLoss[i] = GetPatternLoss_dB( offBoreSightAngles[i] );
+    }
+}
+
+void
+PatternLoss::GetPatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                                  std::vector< double >& patternLoss ) const
+{
+    if ( m_lutLoss.empty() ) {
+        ComputePatternLosses_dB( offBoreSightAngles, patternLoss );
+        return;
+    }
+
+    const size_t lastInterval = m_lutLoss.size() - 2;
+    patternLoss.resize( offBoreSightAngles.size() );
+
+    for ( size_t i = 0; i < offBoreSightAngles.size(); ++i ) {
+        double angle = offBoreSightAngles[i];
+
+        if ( 0.0 > angle || s_maxOffBoreSightAngle < angle ) {
+            std::ostringstream stmMsg;
+            stmMsg << ioAngleDegrees
+                   << "PatternLoss::GetPatternLosses_dB\n"
+                   << "Off BoreSight angle out of range (0, 180).\n"
+                   << "Off BoreSight angle = " << offBoreSightAngles[i]
+                   << " degs.\n" << std::ends;
+            throw std::range_error( stmMsg.str() );
+        }
+
+        double x = angle / m_lutStep;
+        size_t k = static_cast< size_t >( x );
+
+        if ( k > lastInterval ) {
+            k = lastInterval;
+        }
+
+        double f = x - static_cast< double >( k );
+        patternLoss[i] = m_lutLoss[k] + f * ( m_lutLoss[k+1] - m_lutLoss[k] );
+    }
+}
+
+double
+PatternLoss::BuildLookupTable( unsigned numberOfIntervals )
+{
+    if ( 0 == numberOfIntervals ) {
+        throw std::invalid_argument(
+            "PatternLoss::BuildLookupTable() needs at least one interval" );
+    }
+
+    const double step = s_maxOffBoreSightAngle / numberOfIntervals;
+    std::vector< Angle > angles( numberOfIntervals + 1 );
+    std::vector< double > loss;
+
+    for ( unsigned k = 0; k <= numberOfIntervals; ++k ) {
+        angles[k] = k * step;
+    }
+
+    // keep the end point exact
+    angles[numberOfIntervals] = s_maxOffBoreSightAngle;
+
+    ComputePatternLosses_dB( angles, loss );
+    double maxError = 0.0;
+
+    // the error peaks where the pattern curves most, which need not be an
+    // interval mid point (side lobe nulls), so sample across each interval
+    for ( unsigned k = 0; k < numberOfIntervals; ++k ) {
+        for ( unsigned j = 1; j < s_lutErrorSamples; ++j ) {
+            double f = static_cast< double >( j ) / s_lutErrorSamples;
+            double interpolated = loss[k] + f * ( loss[k+1] - loss[k] );
+            double error = fabs( interpolated
+                                 - GetPatternLoss_dB( ( k + f ) * step ) );
+
+            if ( error > maxError ) {
+                maxError = error;
+            }
+        }
+    }
+
+    m_lutLoss.swap( loss );
+    m_lutStep = step;
+    return maxError;
+}
 // ============================================================================
 }
 // A3 namespace end
@@ -62,6 +62,7 @@
 #include "Angle.h"
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 
 // ============================================================================
 // A3 namespace start
@@ -74,6 +75,8 @@ class PatternLoss
 public:
     //----------------------------------------------------------------------
     // constructors & destructors
+    PatternLoss() : m_lutStep( 0.0 ) { ; }
+
     // virtual destructor is defined since this class will be inherited
     virtual ~PatternLoss() { ; }
 
@@ -82,6 +85,22 @@ public:
     virtual double
     GetPatternLoss_dB( Angle offBoreSightAngle ) const = 0;
 
+    //----------------------------------------------------------------------
+    // batch form, fills patternLoss with the loss at each off boresight
+    // angle; uses the lookup table when one is built, otherwise the
+    // exact pattern
+    void GetPatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                              std::vector< double >& patternLoss ) const;
+
+    // samples the pattern on a uniform grid of numberOfIntervals over
+    // 0 to 180 deg for linear interpolation by GetPatternLosses_dB;
+    // returns the largest interpolation error (dB) against
+    // GetPatternLoss_dB at s_lutErrorSamples points across each interval,
+    // the caller decides whether the table is fine enough
+    double BuildLookupTable( unsigned numberOfIntervals );
+    inline void ClearLookupTable();
+    inline bool IsLookupTableBuilt() const;
+
     virtual PatternLoss& operator=( const PatternLoss& )
     {
         return *this;
@@ -95,10 +114,32 @@ public:
 protected:
     inline static void CheckOffBoreSightAngle( Angle offBoreSightAngle );
     static const Angle s_maxOffBoreSightAngle;
+
+    // exact batch evaluation, the default calls GetPatternLoss_dB per
+    // angle; derived classes override with a non-virtual loop
+    virtual void
+    ComputePatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                             std::vector< double >& patternLoss ) const;
+
     //--------------------------------------------------------------------------
 private:
+    static const unsigned s_lutErrorSamples;
+
+    std::vector< double > m_lutLoss;
+    double m_lutStep;
 };
 
+inline void PatternLoss::ClearLookupTable()
+{
+    m_lutLoss.clear();
+    m_lutStep = 0.0;
+}
+
+inline bool PatternLoss::IsLookupTableBuilt() const
+{
+    return !m_lutLoss.empty();
+}
+
 //==============================================================================
 inline void PatternLoss::CheckOffBoreSightAngle( Angle offBoreSightAngle )
 {
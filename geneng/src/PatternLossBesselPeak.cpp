@@ -79,7 +79,17 @@ PatternLossBesselPeak::PatternLossBesselPeak(double diameter,
     m_carrierWaveLength( carrierWaveLength ),
     m_diameter( diameter ),
     m_diaWaveLenRatio( diameter / carrierWaveLength ),
-    m_diaWaveLenRatioTimesPI( diameter / carrierWaveLength * PI)
+    m_diaWaveLenRatioTimesPI( diameter / carrierWaveLength * PI),
+    m_besselThresAngle2( 0.80 * asin(m_carrierWaveLength
+                                     * m_besselThresAngle2_const) ),
+    m_besselThresAngle3( asin(m_carrierWaveLength
+                              * m_besselThresAngle3_const) ),
+    m_logBesselThres2( log10(m_diaWaveLenRatioTimesPI
+                             * sin(m_besselThresAngle2)) ),
+    m_logBesselThres3( log10(m_diaWaveLenRatioTimesPI
+                             * sin(m_besselThresAngle3)) ),
+    m_backLobeLoss( 39.42 * pow((log10(m_diaWaveLenRatioTimesPI)
+                                 / m_logBesselThres3), 1.088) )
 // 1.4392354 = 20 * sqrt(17) * DEG_TO_RAD
 {
 }
@@ -94,8 +104,6 @@ double
 PatternLossBesselPeak::GetPatternLoss_dB( Angle offBoreSightAngle ) const
 {
     double patternLoss(0.0);
-    Angle  besselThresAngle2;
-    Angle  besselThresAngle3;
 
     try {
         if ( offBoreSightAngle < m_besselThresAngle1 ) {
@@ -105,32 +113,21 @@ PatternLossBesselPeak::GetPatternLoss_dB( Angle offBoreSightAngle ) const
             // 8.2070159 = .0025 * (180/PI)^2
             patternLoss = 8.2070159 * obsRatioProd * obsRatioProd;
         } else {
-            besselThresAngle2 = 0.80 * asin(m_carrierWaveLength
-                                            * m_besselThresAngle2_const);
-
-            if ( offBoreSightAngle < besselThresAngle2 ) {
+            if ( offBoreSightAngle < m_besselThresAngle2 ) {
                 patternLoss = 17.0;
             } else {
-                besselThresAngle3 = asin(m_carrierWaveLength
-                                         * m_besselThresAngle3_const);
-
-                if ( offBoreSightAngle < besselThresAngle3 ) {
+                if ( offBoreSightAngle < m_besselThresAngle3 ) {
                     patternLoss = 17.0 * pow(( log10(m_diaWaveLenRatioTimesPI
                                                      * sin( offBoreSightAngle ) )
-                                               / log10(m_diaWaveLenRatioTimesPI
-                                                       * sin(besselThresAngle2)) )
+                                               / m_logBesselThres2 )
                                              , 1.23 );
                 } else if ( offBoreSightAngle <= s_boreNormalAngle ) {
                     patternLoss = 39.42 * pow(( log10(m_diaWaveLenRatioTimesPI
                                                       * sin(offBoreSightAngle))
-                                                / log10(m_diaWaveLenRatioTimesPI
-                                                        * sin(besselThresAngle3)) )
+                                                / m_logBesselThres3 )
                                               , 1.088 );
                 } else if ( offBoreSightAngle <= s_maxOffBoreSightAngle ) {
-                    patternLoss = 39.42 * pow((log10(m_diaWaveLenRatioTimesPI)
-                                               / log10(m_diaWaveLenRatioTimesPI
-                                                       * sin(besselThresAngle3)) )
-                                              , 1.088 );
+                    patternLoss = m_backLobeLoss;
                 } else {
                     std::ostringstream stmMsg;
                     stmMsg << ioAngleDegrees
@@ -153,6 +150,21 @@ PatternLossBesselPeak::GetPatternLoss_dB( Angle offBoreSightAngle ) const
     return patternLoss;
 }
 
+//==============================================================================
+// batch evaluation, non-virtual per angle call
+void
+PatternLossBesselPeak::ComputePatternLosses_dB(
+    const std::vector< Angle >& offBoreSightAngles,
+    std::vector< double >& patternLoss ) const
+{
+    patternLoss.resize( offBoreSightAngles.size() );
+
+    for ( size_t i = 0; i < offBoreSightAngles.size(); ++i ) {
+        patternLoss[i]
+            = PatternLossBesselPeak::GetPatternLoss_dB( offBoreSightAngles[i] );
+    }
+}
+
 // ============================================================================
 }
 // A3 namespace end
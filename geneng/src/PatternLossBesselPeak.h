@@ -95,6 +95,9 @@ public:
 
     //--------------------------------------------------------------------------
 protected:
+    virtual void
+    ComputePatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                             std::vector< double >& patternLoss ) const;
 
     //--------------------------------------------------------------------------
 private:
@@ -111,6 +114,13 @@ private:
     const double m_diameter;
     const double m_diaWaveLenRatio;
     const double m_diaWaveLenRatioTimesPI;
+
+    // angle independent terms, computed once per instance
+    const double m_besselThresAngle2;
+    const double m_besselThresAngle3;
+    const double m_logBesselThres2;
+    const double m_logBesselThres3;
+    const double m_backLobeLoss;
 };
 
 //------------------------------------------------------------------------------
@@ -70,7 +70,19 @@ const Angle PatternLossCCIR::s_ccirThresAngle3 = .83775804; // 48 deg
 PatternLossCCIR::PatternLossCCIR(double maxGain, double diameter,
                                  double carrierWaveLength ):
     m_maxGain(maxGain),
-    m_antennaDiameterOverWaveLength(diameter / carrierWaveLength)
+    m_antennaDiameterOverWaveLength(diameter / carrierWaveLength),
+    m_logDiameterOverWaveLength(log10(m_antennaDiameterOverWaveLength)),
+    // simplified math .34906585 = 20 * DEG_TO_RAD
+    m_ccirThresAngle1(.34906585 / m_antennaDiameterOverWaveLength
+                      * sqrt(m_maxGain
+                             - (2.0 + 15.0 * m_logDiameterOverWaveLength))),
+    // simplified math .27663469 = 15.85 * DEG_TO_RAD
+    // 1.7453292 = 100 * Deg_TO_RAD
+    m_ccirThresAngle2(m_antennaDiameterOverWaveLength >= 100.0
+                      ? .27663469 * pow(m_antennaDiameterOverWaveLength,-0.6)
+                      : 1.7453292 / m_antennaDiameterOverWaveLength),
+    m_smallApertureGain(52.0 - 10.0 * m_logDiameterOverWaveLength),
+    m_smallApertureBackLobeGain(10.0 - 10.0 * m_logDiameterOverWaveLength)
 {
 }
 
@@ -83,31 +95,22 @@ PatternLossCCIR::PatternLossCCIR(double maxGain, double diameter,
 double
 PatternLossCCIR::GetPatternLoss_dB( Angle offBoreSightAngle ) const
 {
-    Angle  ccirThresAngle1;
-    Angle  ccirThresAngle2;
     double patternLoss( 0.0 );
 
     try {
         double gain;
-        gain = 2.0 + 15.0 * log10(m_antennaDiameterOverWaveLength);
-        // simplified math .34906585 = 20 * DEG_TO_RAD
-        ccirThresAngle1 = .34906585 / m_antennaDiameterOverWaveLength
-                          * sqrt(m_maxGain - gain);
+        gain = 2.0 + 15.0 * m_logDiameterOverWaveLength;
 
         // 0 < offBoreSightAngle < theta1
-        if ( offBoreSightAngle < ccirThresAngle1) {
+        if ( offBoreSightAngle < m_ccirThresAngle1) {
             double obsRatioProd;
             obsRatioProd = offBoreSightAngle * m_antennaDiameterOverWaveLength;
             // simplified math 8.207016 = .0025 * (180/PI)^2
             gain = m_maxGain - 8.207016 * obsRatioProd*obsRatioProd;
         } else {
+            // if theta1 < offBoreSightAngle < theta2, do NOT recalc gain
             if (m_antennaDiameterOverWaveLength >= 100.0) {
-                // simplified math .27663469 = 15.85 * DEG_TO_RAD
-                ccirThresAngle2 = .27663469
-                                  * pow(m_antennaDiameterOverWaveLength,-0.6);
-
-                // if theta1 < offBoreSightAngle < theta2, do NOT recalc gain
-                if ( offBoreSightAngle >= ccirThresAngle2 ) {
+                if ( offBoreSightAngle >= m_ccirThresAngle2 ) {
                     // theta2 < offBoreSightAngle < theta3 (theta3=48deg)
                     if ( offBoreSightAngle < s_ccirThresAngle3 ) {
                         gain = 32.0 - 25.0
@@ -117,18 +120,12 @@ PatternLossCCIR::GetPatternLoss_dB( Angle offBoreSightAngle ) const
                     }
                 }
             } else {
-                // 1.7453292 = 100 * Deg_TO_RAD
-                ccirThresAngle2 = 1.7453292 / m_antennaDiameterOverWaveLength;
-
-                // if theta1 < offBoreSightAngle < theta2, do NOT recalc gain
-                if ( offBoreSightAngle >= ccirThresAngle2 ) {
+                if ( offBoreSightAngle >= m_ccirThresAngle2 ) {
                     if ( offBoreSightAngle < s_ccirThresAngle3 ) {
-                        gain = 52.0
-                               - 10.0 * log10( m_antennaDiameterOverWaveLength )
+                        gain = m_smallApertureGain
                                - 25.0 * log10( offBoreSightAngle * RAD_TO_DEG);
                     } else if ( offBoreSightAngle <= s_maxOffBoreSightAngle ) {
-                        gain = 10.0
-                               - 10.0 * log10( m_antennaDiameterOverWaveLength );
+                        gain = m_smallApertureBackLobeGain;
                     } else {
                         std::ostringstream stmMsg;
                         stmMsg << ioAngleDegrees
@@ -141,7 +138,7 @@ PatternLossCCIR::GetPatternLoss_dB( Angle offBoreSightAngle ) const
                     }
                 }
             }//end if (m_antennaDiameterOverWaveLength >= 100.0)
-        }//end if ( offBoreSightAngle < ccirThresAngle1)
+        }//end if ( offBoreSightAngle < m_ccirThresAngle1)
 
         patternLoss = m_maxGain - gain;
     } catch ( ... ) {
@@ -154,6 +151,21 @@ PatternLossCCIR::GetPatternLoss_dB( Angle offBoreSightAngle ) const
     return patternLoss;
 }
 
+//==============================================================================
+// batch evaluation, non-virtual per angle call
+void
+PatternLossCCIR::ComputePatternLosses_dB(
+    const std::vector< Angle >& offBoreSightAngles,
+    std::vector< double >& patternLoss ) const
+{
+    patternLoss.resize( offBoreSightAngles.size() );
+
+    for ( size_t i = 0; i < offBoreSightAngles.size(); ++i ) {
+        patternLoss[i]
+            = PatternLossCCIR::GetPatternLoss_dB( offBoreSightAngles[i] );
+    }
+}
+
 // ============================================================================
 }
 // A3 namespace end
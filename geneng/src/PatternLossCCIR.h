@@ -91,6 +91,9 @@ public:
 
     //--------------------------------------------------------------------------
 protected:
+    virtual void
+    ComputePatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                             std::vector< double >& patternLoss ) const;
 
     //--------------------------------------------------------------------------
 private:
@@ -101,6 +104,13 @@ private:
 
     const double m_maxGain;
     const double m_antennaDiameterOverWaveLength;
+
+    // angle independent terms, computed once per instance
+    const double m_logDiameterOverWaveLength;
+    const double m_ccirThresAngle1;
+    const double m_ccirThresAngle2;
+    const double m_smallApertureGain;
+    const double m_smallApertureBackLobeGain;
 };
 
 //------------------------------------------------------------------------------
@@ -77,6 +77,9 @@ public:
 
     //--------------------------------------------------------------------------
 protected:
+    virtual void
+    ComputePatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                             std::vector< double >& patternLoss ) const;
 
     //--------------------------------------------------------------------------
 private:
@@ -90,6 +93,16 @@ PatternLossOmni::GetPatternLoss_dB( Angle  ) const // offBoreSightAngle
     return 0.0;
 }
 
+//==============================================================================
+// batch evaluation, loss is zero at every angle
+inline void
+PatternLossOmni::ComputePatternLosses_dB(
+    const std::vector< Angle >& offBoreSightAngles,
+    std::vector< double >& patternLoss ) const
+{
+    patternLoss.assign( offBoreSightAngles.size(), 0.0 );
+}
+
 //------------------------------------------------------------------------------
 // misc functions
 inline const char* PatternLossOmni::GetVersion() const
@@ -81,6 +81,19 @@ PatternLossSinCardioid::GetPatternLoss_dB( Angle ) const // offBoreSightAngle
     // return 0;
 }
 
+void
+PatternLossSinCardioid::ComputePatternLosses_dB(
+    const std::vector< Angle >& offBoreSightAngles,
+    std::vector< double >& patternLoss ) const
+{
+    patternLoss.resize( offBoreSightAngles.size() );
+
+    for ( size_t i = 0; i < offBoreSightAngles.size(); ++i ) {
+        patternLoss[i]
+            = PatternLossSinCardioid::GetPatternLoss_dB( offBoreSightAngles[i] );
+    }
+}
+
 // ============================================================================
 }
 // A3 namespace end
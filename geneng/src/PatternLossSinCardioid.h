@@ -94,6 +94,10 @@ public:
 
     //--------------------------------------------------------------------------
 protected:
+    // routed through the scalar pattern, which is not implemented yet
+    virtual void
+    ComputePatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                             std::vector< double >& patternLoss ) const;
 
     //--------------------------------------------------------------------------
 private:
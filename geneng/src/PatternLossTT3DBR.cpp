@@ -84,6 +84,21 @@ PatternLossTT3DBR::GetPatternLoss_dB( Angle offBoreSightAngle ) const
     return patternLoss;
 }
 
+//==============================================================================
+// batch evaluation, non-virtual per angle call
+void
+PatternLossTT3DBR::ComputePatternLosses_dB(
+    const std::vector< Angle >& offBoreSightAngles,
+    std::vector< double >& patternLoss ) const
+{
+    patternLoss.resize( offBoreSightAngles.size() );
+
+    for ( size_t i = 0; i < offBoreSightAngles.size(); ++i ) {
+        patternLoss[i]
+            = PatternLossTT3DBR::GetPatternLoss_dB( offBoreSightAngles[i] );
+    }
+}
+
 // ============================================================================
 }
 // A3 namespace end
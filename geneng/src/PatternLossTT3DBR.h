@@ -94,6 +94,9 @@ public:
 
     //--------------------------------------------------------------------------
 protected:
+    virtual void
+    ComputePatternLosses_dB( const std::vector< Angle >& offBoreSightAngles,
+                             std::vector< double >& patternLoss ) const;
 
     //--------------------------------------------------------------------------
 private:
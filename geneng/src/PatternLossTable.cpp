@@ -73,6 +73,21 @@ PatternLossTable::GetPatternLoss_dB( Angle offBoreSightAngle ) const
     return m_table( offBoreSightAngle );
 }
 
+//==============================================================================
+// batch evaluation, non-virtual per angle call
+void
+PatternLossTable::ComputePatternLosses_dB(
+    const std::vector< Angle >& offBoreSightAngles,
+    std::vector< double >& patternLoss ) const
+{
+    patternLoss.resize( offBoreSightAngles.size() );
+
+    for ( size_t i = 0; i < offBoreSightAngles.size(); ++i ) {
+        patternLoss[i]
+            = PatternLossTable::GetPatternLoss_dB( offBoreSightAngles[i] );
+    }
+}
+
 //==============================================================================
 // Load Pattern Loss Table and return number of points in table
 PatternLossTable::size_type
@@ -259,6 +259,35 @@ void SpatialEphFile::Interpolate( double time )  // time in sec
     }
 }
 
+//------------------------------------------------------------------------------
+// position only interpolation for the batch interface, shares the search
+// hint with Interpolate so time ordered samples stay cheap
+bool SpatialEphFile::GetEciPositionAt( const TimeJ2000& tm,
+                                       VectorCartesian& position )
+{
+    double time( tm );
+
+    if ( time < GetFirstTime() || time > GetLastTime() ) {
+        throw std::out_of_range(
+            "SpatialEphFile::GetPositions() time outside the ephemeris" );
+    }
+
+    if ( bDoHintInit ) {
+        m_iTimeHint = m_vTime.begin();
+        bDoHintInit = false;
+    }
+
+    std::vector<TimeJ2000>::const_iterator
+    itrT( m_vTime.begin() ),
+          etrT( m_vTime.end() );
+    std::vector<VectorCartesian>::const_iterator
+    itrP( m_vVecPosition.begin() );
+    m_iTimeHint =
+        interpolLagrangePoly( itrT, etrT, m_iTimeHint, itrP,
+                              m_order, time, position );
+    return true;
+}
+
 //------------------------------------------------------------------------------
 void SpatialEphFile::ClearAndReserve()
 {
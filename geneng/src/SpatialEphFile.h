@@ -163,6 +163,8 @@ public:
 protected:
     void ClearAndReserve();
     virtual void UpdateState();
+    virtual bool GetEciPositionAt( const TimeJ2000& tm,
+                                   VectorCartesian& position );
     void Interpolate( double timeSec );
     static void ThrowBadInterpolate( int error );
 
@@ -203,36 +203,7 @@ void SpatialEphFileGAP::UpdateState()
         }
 
         SpatialTimeDep::UpdateState();
-        double tmRel(GetTime() - m_epoch);
-
-        if (m_waypts.begin()->first > tmRel) {
-            m_vecEcfPosition = m_waypts.begin()->second;
-            m_vecEcfVelocity = VectorCartesian(0.0, 0.0, 0.0);
-        } else if(m_waypts.rbegin()->first <= tmRel) {
-            m_vecEcfPosition = m_waypts.rbegin()->second;
-            m_vecEcfVelocity = VectorCartesian(0.0, 0.0, 0.0);
-        } else {
-            std::map<double, VectorCartesian>::iterator
-            // find end point of current segment
-            itrH(m_waypts.upper_bound( tmRel )),
-                 itrL(m_waypts.end());
-
-            if (m_waypts.begin()==itrH || m_waypts.end()==itrH) {
-                throw std::logic_error("find way point failed");
-            }
-
-            // set start point of segment
-            itrL = itrH;
-            --itrL;
-            // set start time and vector of segment
-            double tmRel0(itrL->first);
-            VectorCartesian posEcf0(itrL->second);
-            // set end time and vector of segement
-            double tmRel1(itrH->first);
-            VectorCartesian posEcf1(itrH->second);
-            GreatArcPath(tmRel0, posEcf0, tmRel1, posEcf1, tmRel,
-                         m_vecEcfPosition, m_vecEcfVelocity);
-        }
+        GetEcfStateAt(GetTime(), m_vecEcfPosition, m_vecEcfVelocity);
 
         if (CoorSystem::ECF == m_hdlCoorTrans->GetSourceSystem()) {
             m_vecPosition = m_vecEcfPosition;
@@ -254,6 +225,73 @@ void SpatialEphFileGAP::UpdateState()
     }
 }
 
+// ECF position and velocity along the way points at time tm
+void SpatialEphFileGAP::GetEcfStateAt(const TimeJ2000& tm,
+                                      VectorCartesian& posEcf,
+                                      VectorCartesian& velEcf) const
+{
+    double tmRel(tm - m_epoch);
+
+    if (m_waypts.begin()->first > tmRel) {
+        posEcf = m_waypts.begin()->second;
+        velEcf = VectorCartesian(0.0, 0.0, 0.0);
+    } else if(m_waypts.rbegin()->first <= tmRel) {
+        posEcf = m_waypts.rbegin()->second;
+        velEcf = VectorCartesian(0.0, 0.0, 0.0);
+    } else {
+        std::map<double, VectorCartesian>::const_iterator
+        // find end point of current segment
+        itrH(m_waypts.upper_bound( tmRel )),
+             itrL(m_waypts.end());
+
+        if (m_waypts.begin()==itrH || m_waypts.end()==itrH) {
+            throw std::logic_error("find way point failed");
+        }
+
+        // set start point of segment
+        itrL = itrH;
+        --itrL;
+        // set start time and vector of segment
+        double tmRel0(itrL->first);
+        VectorCartesian posEcf0(itrL->second);
+        // set end time and vector of segement
+        double tmRel1(itrH->first);
+        VectorCartesian posEcf1(itrH->second);
+        GreatArcPath(tmRel0, posEcf0, tmRel1, posEcf1, tmRel,
+                     posEcf, velEcf);
+    }
+}
+
+//------------------------------------------------------------------------------
+// batch evaluation
+bool SpatialEphFileGAP::GetEciPositionAt(const TimeJ2000& tm,
+                                         VectorCartesian& position)
+{
+    VectorCartesian posEcf, velEcf;
+    Matrix3 dcm;
+    GetEcfStateAt(tm, posEcf, velEcf);
+    m_coorTransEciEcf.GetDcmAt(tm, dcm);
+    dcm.Multiply(posEcf, position);
+    return true;
+}
+
+void SpatialEphFileGAP::GetPositions(const std::vector<TimeJ2000>& tms,
+                                     std::vector<VectorCartesian>& positions)
+{
+    if (CoorSystem::ECF != m_hdlCoorTrans->GetSourceSystem()) {
+        SpatialTimeDep::GetPositions(tms, positions);
+        return;
+    }
+
+    VectorCartesian velEcf;
+    positions.resize(tms.size());
+
+    for (size_t i = 0; i < tms.size(); ++i) {
+        GetEcfStateAt(tms[i], positions[i], velEcf);
+    }
+}
+
+//------------------------------------------------------------------------------
 // given 2 ECF way pts, GreatArcPath returns the ECF at some time between
 // the way pts
 void GreatArcPath(double tmRel0, const VectorCartesian& posEcf0,
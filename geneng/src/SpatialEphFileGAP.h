@@ -111,12 +111,23 @@ public:
 
     virtual const char* GetVersion() const;
 
+    // batch position evaluation, see SpatialTimeDep; ECF targets are
+    // returned straight from the way points
+    virtual void GetPositions( const std::vector< TimeJ2000 >& tms,
+                               std::vector< VectorCartesian >& positions );
+
 protected:
     // file functions
     void ReadExtWayPtFile();
     void ReadExtWayPt( std::istream& isWayPts );
     virtual std::istream& Initialize( std::istream& is );
     virtual void UpdateState();
+    virtual bool GetEciPositionAt( const TimeJ2000& tm,
+                                   VectorCartesian& position );
+
+    void GetEcfStateAt( const TimeJ2000& tm,
+                        VectorCartesian& posEcf,
+                        VectorCartesian& velEcf ) const;
 
 private:
     TimeJ2000 m_epoch;
@@ -77,6 +77,50 @@ bool SpatialJpl<id>::operator!=(const SpatialJpl& spatial) const
     return !operator==(spatial);
 }
 
+//--------------------------------------------------------------------------
+// batch evaluation
+template <Jpl::EphObjId id>
+void SpatialJpl<id>::GetJ2000PositionAt(const TimeJ2000& tm,
+                                        VectorCartesian& position)
+{
+    m_eogc.Position(tm, position);
+
+    if (m_bDoLightTime) {
+        TimeJ2000 tmLt(tm);
+        tmLt -= position.Magnitude()/SPEED_OF_LIGHT;
+        m_eogc.Position(tmLt, position);
+    }
+}
+
+template <Jpl::EphObjId id>
+bool SpatialJpl<id>::GetEciPositionAt(const TimeJ2000& tm,
+                                      VectorCartesian& position)
+{
+    VectorCartesian j2000Pos;
+    Matrix3 dcm;
+    GetJ2000PositionAt(tm, j2000Pos);
+    m_xEciJ2000.GetDcmAt(tm, dcm);
+    dcm.Multiply(j2000Pos, position);
+    return true;
+}
+
+template <Jpl::EphObjId id>
+void SpatialJpl<id>::GetPositions(const std::vector<TimeJ2000>& tms,
+                                  std::vector<VectorCartesian>& positions)
+{
+    if (m_hdlCoorTrans->GetSourceSystem() != CoorSystem::J2000) {
+        SpatialTimeDep::GetPositions(tms, positions);
+        return;
+    }
+
+    positions.resize(tms.size());
+
+    for (size_t i = 0; i < tms.size(); ++i) {
+        GetJ2000PositionAt(tms[i], positions[i]);
+    }
+}
+
+//--------------------------------------------------------------------------
 template <Jpl::EphObjId id>
 void SpatialJpl<id>::UpdateState()
 {
@@ -83,9 +83,23 @@ public:
 
     virtual const char* GetVersion() const;
 
+    /// @brief Batch position evaluation, see SpatialTimeDep
+    /// @details J2000 targets are returned straight from the ephemeris,
+    /// other targets go through ECI
+    /// @param [in] tms times
+    /// @param [out] positions position at each time
+    virtual void GetPositions(const std::vector<TimeJ2000>& tms,
+                              std::vector<VectorCartesian>& positions);
+
 protected:
     virtual void UpdateState();
 
+    virtual bool GetEciPositionAt(const TimeJ2000& tm,
+                                  VectorCartesian& position);
+
+    /// @brief J2000 position at tm, light-time corrected if enabled
+    void GetJ2000PositionAt(const TimeJ2000& tm, VectorCartesian& position);
+
     virtual const VectorCartesian& GetAcceleration() const;
 
 private:
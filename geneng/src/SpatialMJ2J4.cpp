@@ -57,6 +57,7 @@
 //==============================================================================
 #include "SpatialMJ2J4.h"
 #include "Normalize.h"
+#include "anomaly.h"
 
 // ============================================================================
 // A3 namespace start
@@ -232,6 +233,30 @@ void SpatialMJ2J4::UpdateElements()
     m_curOrbitElements.SetEpoch( GetTime() );
 }
 
+// same propagation as UpdateElements and UpdateState, evaluated at tm
+// without touching the current elements
+bool SpatialMJ2J4::GetEciPositionAt( const TimeJ2000& tm,
+                                     VectorCartesian& position )
+{
+    double dt = tm - m_icOrbitElements.GetEpoch();
+    double ra = normalizeZeroTwoPi( m_icOrbitElements.GetRAAscendingNode()
+                                    + dt * m_nodePrecessionRate );
+    double ap = normalizeZeroTwoPi( m_icOrbitElements.GetArgumentOfPeriapsis()
+                                    + dt * m_apsidalRotationRate );
+    double ma = normalizeZeroTwoPi( m_icOrbitElements.GetMeanAnomaly()
+                                    + dt * m_anomalisticMeanMotion );
+    double ecc = m_icOrbitElements.GetEccentricity();
+    double ta  = meanToTrueAnomaly( ecc, ma );
+    double cta = cos(ta);
+    double sta = sin(ta);
+    double radius = m_icOrbitElements.GetSemiLatusRectum()
+                    / ( 1.0 + ecc * cta );
+    Matrix3 dcm;
+    dcmPqwToEci( ra, m_icOrbitElements.GetInclination(), ap, dcm );
+    dcm.Multiply( VectorCartesian( radius * cta, radius * sta, 0.0 ), position );
+    return true;
+}
+
 void SpatialMJ2J4::UpdateState()
 {
     SpatialTimeDep::UpdateState();
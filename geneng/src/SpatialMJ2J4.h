@@ -121,6 +121,9 @@ public:
 protected:
     virtual void UpdateState();
 
+    virtual bool GetEciPositionAt( const TimeJ2000& tm,
+                                   VectorCartesian& position );
+
     //--------------------------------------------------------------------------
 private:
     OrbitElKeplerian m_icOrbitElements;
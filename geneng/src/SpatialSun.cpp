@@ -77,6 +77,50 @@ bool SpatialSun::operator!=( const SpatialSun& spatial ) const
     return !operator==( spatial );
 }
 
+// low precision solar coordinates coefficients, shared by UpdateState and
+// GetEciPositionAt
+static const double d_mls = 0.017202792; // rad/day
+static const double c_mls = 4.89495042;  // rad
+static const double d_mas = 0.01720197034; // rad/day
+static const double c_mas = 6.240040768;   // rad
+static const double c0_elng = 0.033423055; // rad
+static const double c1_elng = 0.000349065; // rad
+static const double d_oblq = 6.9813e-9;   // rad/day
+static const double c_oblq = 0.409087723; // rad
+static const double c0_rad = 23458.07467;
+static const double c1_rad = 391.92956;
+static const double c2_rad = 3.28367;
+
+// ECI position at tm for the batch interface, same formulation as the
+// position half of UpdateState
+bool SpatialSun::GetEciPositionAt( const TimeJ2000& tm,
+                                   VectorCartesian& position )
+{
+    double j2000Day = tm * SEC_TO_DAY;
+    double meanLongitude = normalizeZeroTwoPi( c_mls + d_mls * j2000Day );
+    double meanAnomaly   = normalizeZeroTwoPi( c_mas + d_mas * j2000Day );
+    double cos_mas  = cos( meanAnomaly );
+    double cos_2mas = 2.0 * cos_mas * cos_mas - 1;
+    double sin_mas  = sin( meanAnomaly );
+    double sin_2mas = 2.0 * sin_mas * cos_mas;
+    double eclipticLongitude
+        = normalizeZeroTwoPi( meanLongitude
+                              + c0_elng * sin_mas
+                              + c1_elng * sin_2mas );
+    double sin_elng = sin( eclipticLongitude );
+    double eclipticObliquity = c_oblq + d_oblq * j2000Day;
+    double sin_dec = sin( eclipticObliquity ) * sin_elng;
+    double cos_dec = cos( asin( sin_dec ) );
+    double rightAscension = atan2( cos( eclipticObliquity ) * sin_elng,
+                                   cos( eclipticLongitude ) );
+    double radius = EARTH_RADIUS_NMI * ( c0_rad - c1_rad * cos_mas
+                                         - c2_rad * cos_2mas );
+    position.Set( cos_dec * cos( rightAscension ) * radius,
+                  cos_dec * sin( rightAscension ) * radius,
+                  sin_dec * radius );
+    return true;
+}
+
 void SpatialSun::UpdateState()
 {
     // ------------------------------------------------------------------------
@@ -89,13 +133,9 @@ void SpatialSun::UpdateState()
     // Position of the Sun w.r.t. the Earth
     // ------------------------------------------------------------------------
     // calculate the mean longitude of the sun, corrected for aberration
-    static const double d_mls = 0.017202792; // rad/day
-    static const double c_mls = 4.89495042;  // rad
     m_meanLongitude = normalizeZeroTwoPi( c_mls + d_mls * j2000Day ); // rad
     // ------------------------------------------------------------------------
     // calculate the mean anomaly of the sun
-    static const double d_mas = 0.01720197034; // rad/day
-    static const double c_mas = 6.240040768;   // rad
     m_meanAnomaly = normalizeZeroTwoPi( c_mas + d_mas * j2000Day ); // rad
     double cos_mas  = cos( m_meanAnomaly );
     double cos_2mas = 2.0 * cos_mas * cos_mas - 1;
@@ -103,8 +143,6 @@ void SpatialSun::UpdateState()
     double sin_2mas = 2.0 * sin_mas * cos_mas;
     // ------------------------------------------------------------------------
     // calculate the ecliptic longitude
-    static const double c0_elng = 0.033423055; // rad
-    static const double c1_elng = 0.000349065; // rad
     m_eclipticLongitude = m_meanLongitude
                           + c0_elng * sin_mas
                           + c1_elng * sin_2mas;  // rad
@@ -112,8 +150,6 @@ void SpatialSun::UpdateState()
     double sin_elng = sin( m_eclipticLongitude );
     // ------------------------------------------------------------------------
     // calculate the obliquity of the ecliptic
-    static const double d_oblq = 6.9813e-9;   // rad/day
-    static const double c_oblq = 0.409087723; // rad
     m_eclipticObliquity = c_oblq + d_oblq * j2000Day; // rad
     double sin_oblq = sin( m_eclipticObliquity );
     // ------------------------------------------------------------------------
@@ -132,9 +168,6 @@ void SpatialSun::UpdateState()
     m_eciUnitVector.Set( cos_dec * cos_ras, cos_dec * sin_ras, sin_dec );
     // ------------------------------------------------------------------------
     // calculate the radius
-    static const double c0_rad = 23458.07467;
-    static const double c1_rad = 391.92956;
-    static const double c2_rad = 3.28367;
     m_radius = EARTH_RADIUS_NMI * ( c0_rad - c1_rad * cos_mas
                                     - c2_rad * cos_2mas );
 
@@ -134,6 +134,9 @@ public:
 protected:
     virtual void UpdateState();
 
+    virtual bool GetEciPositionAt( const TimeJ2000& tm,
+                                   VectorCartesian& position );
+
     //--------------------------------------------------------------------------
 private:
     VectorCartesian  m_eciUnitVector;
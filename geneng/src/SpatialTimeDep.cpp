@@ -65,6 +65,39 @@ bool SpatialTimeDep::operator!=( const SpatialTimeDep& spatial ) const
     return !operator==( spatial );
 }
 
+// -----------------------------------------------------------------------------
+// batch evaluation
+bool SpatialTimeDep::GetEciPositionAt( const TimeJ2000&, VectorCartesian& )
+{
+    return false;
+}
+
+void SpatialTimeDep::GetPositions( const std::vector< TimeJ2000 >& tms,
+                                   std::vector< VectorCartesian >& positions )
+{
+    const bool bIsEci
+        = m_hdlCoorTrans->GetSourceSystem() == CoorSystem::ECI;
+    VectorCartesian eciPosition;
+    Matrix3 dcm;
+    positions.resize( tms.size() );
+
+    for ( size_t i = 0; i < tms.size(); ++i ) {
+        if ( !GetEciPositionAt( tms[i], eciPosition ) ) {
+            ThrowNotImplemented( "GetPositions()" );
+        }
+
+        if ( bIsEci ) {
+            positions[i] = eciPosition;
+        } else {
+            if ( !m_hdlCoorTrans->GetDcmAt( tms[i], dcm ) ) {
+                ThrowNotImplemented( "GetPositions() coordinate transformation" );
+            }
+
+            dcm.TransposeMultiply( eciPosition, positions[i] );
+        }
+    }
+}
+
 // ============================================================================
 }
 // A3 namespace end
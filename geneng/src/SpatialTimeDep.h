@@ -135,6 +135,7 @@
 #include "Spatial.h"
 #include "HandleConst.h"
 #include "TimeJ2000.h"
+#include <vector>
 
 // #include <map>
 
@@ -173,7 +174,7 @@ public:
 
     //----------------------------------------------------------------------
     // returns a handle to the time object
-    inline HandleConst< TimeJ2000 > GetHdlConstTime() const;
+    inline const HandleConst< TimeJ2000 >& GetHdlConstTime() const;
     // returns the current time
     inline TimeJ2000 GetTime() const;
 
@@ -184,6 +185,16 @@ public:
     inline void SetFDDT( double seconds );
     inline double GetFDDT() const;
 
+    //----------------------------------------------------------------------
+    // batch position evaluation: fills positions with the position at
+    // each time in tms, in the same coordinate system as GetPosition().
+    // The samples are computed directly, without the AutoUpdate
+    // bookkeeping, and the current state (and time) of this object is
+    // left as is.  Throws if the class or its coordinate transformation
+    // has no batch form.
+    virtual void GetPositions( const std::vector< TimeJ2000 >& tms,
+                               std::vector< VectorCartesian >& positions );
+
     //----------------------------------------------------------------------
     // operators
     bool operator==( const SpatialTimeDep& spatial ) const;
@@ -197,6 +208,11 @@ public:
 protected:
     inline virtual void UpdateState();
 
+    // ECI position at time tm for GetPositions, derived classes that
+    // support batch evaluation override this; returns false by default
+    virtual bool GetEciPositionAt( const TimeJ2000& tm,
+                                   VectorCartesian& position );
+
     //--------------------------------------------------------------------------
 private:
     HandleConst< TimeJ2000 >  m_hdlTime;
@@ -211,7 +227,7 @@ inline bool SpatialTimeDep::IsStale() const
     return Spatial::IsStale() || *m_hdlTime != m_lastUpdate;
 }
 
-inline HandleConst< TimeJ2000 > SpatialTimeDep::GetHdlConstTime() const
+inline const HandleConst< TimeJ2000 >& SpatialTimeDep::GetHdlConstTime() const
 {
     return m_hdlTime;
 }
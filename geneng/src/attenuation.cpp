@@ -84,8 +84,16 @@ const char *const sRainRegion[] = {
     "G",  "H",  "undefined"
 };
 
+//=======================================================================
+// constants shared by the free functions and AttenuationEvaluator
+static const double RADRAT = 790.3226;
+static const double COMM_EFF_EARTH_RADIUS = 8500.0 * KM_TO_NMI;
+
 //=======================================================================
 // prototypes of supporting functions
+void calcAtmosphericAttenuationCoeff( double& zenatn, double& o2h2oatn,
+                                      double frequencyGHz );
+
 double surfaceProjectedAttenuation( double rainRate, double projSurfPathLength,
                                     double alpha, double beta, double height0DegIso,
                                     double stationAltitude);
@@ -178,82 +186,12 @@ double atmosphericAttenuation( double carrierFrequency,
                                double stationAltitude,
                                double elevationAngle )
 {
-    // static const double EFFECTIVE_HEIGHT = 8.06 * KM_TO_NMI;
-    static const double RADRAT = 790.3226;
-    static const int NAT = 19;
-    // ------------------------------------------------------------------------
-    /***
-    static double FRQTBL[] =
-        { 1.0,  2.0,  4.0,  6.0,  12.0, 15.0, 20.0, 21.7,
-          22.7, 25.0, 30.0, 41.0, 54.0, 59.5, 61.5, 66.0,
-          84.5, 94.0, 100.0 };
-
-    static double ZENTBL[] =
-        { 0.0225, 0.0253, 0.0292, 0.0345, 0.061, 0.08,  0.26,  0.48,
-          0.48,   0.245,  0.2,    0.37,   9.0,   242.0, 242.0, 6.2,
-          0.7,    0.89,   1.06 };
-
-    static double O2TBL[] =
-        { 0.005,  0.006,  0.0065, 0.0067, 0.0071, 0.0078, 0.009,  0.00955,
-          0.01,   0.0109, 0.0143, 0.0436, 3.16,   15.42,  14.86,  0.794,
-          0.052,  0.0452, 0.0466 };
-
-    static double H2OTBL[] =
-        { 5.0E-5, 1.5E-4, 5.0E-4, 1.5E-3, 0.0058, 0.0150, 0.0760, 0.1560,
-          0.1610, 0.1096, 0.0592, 0.0575, 0.0912, 0.1070, 0.1150, 0.1380,
-          0.2230, 0.2692, 0.3076 };
-    ***/
-    // natural log of LOGFRQTBL table
-    static const double LOGFRQTBL[] = {
-        0.000000000, 0.693147181, 1.386294361, 1.791759469,
-        2.484906650, 2.708050201, 2.995732274, 3.077312261,
-        3.122364924, 3.218875825, 3.401197382, 3.713572067,
-        3.988984047, 4.085976313, 4.119037175, 4.189654742,
-        4.436751534, 4.543294782, 4.605170186
-    };
-    // natural log of LOGZENTBL table
-    static const double LOGZENTBL[] = {
-        -3.794239970, -3.676950883, -3.533586570, -3.366795955,
-        -2.796881415, -2.525728644, -1.347073648, -0.733969175,
-        -0.733969175, -1.406497068, -1.609437912, -0.994252273,
-        2.197224577,  5.488937726,  5.488937726,  1.824549292,
-        -0.356674944, -0.116533816,  0.058268908
-    };
-    // natural log of LOGO2TBL table
-    static const double LOGO2TBL[] = {
-        -5.298317367, -5.115995810, -5.035953102, -5.005647753,
-        -4.947660495, -4.853631545, -4.710530702, -4.651214124,
-        -4.605170186, -4.518992490, -4.247495742, -3.132698129,
-        1.150572028,  2.735665368,  2.698673039, -0.230671818,
-        -2.956511560, -3.096658192, -3.066154738
-    };
-    // natural log of LOGH20TBL table
-    static const double LOGH20TBL[] = {
-        -9.903487553, -8.804875264, -7.600902460, -6.502290171,
-        -5.149897361, -4.199705078, -2.577021939, -1.857899272,
-        -1.826350914, -2.210917904, -2.826833737, -2.855970331,
-        -2.394700382, -2.234926445, -2.162823151, -1.980501594,
-        -1.500583508, -1.312300681, -1.178955041
-    };
-    // ------------------------------------------------------------------------
     double attenuation, sinElevAngle;
-    double frequencyGHz, logFreq, zenatn, o2atn, h2oatn;
+    double zenatn, o2h2oatn;
     double sclfac, x2, pts, aveden;
     // **********************************************************************
-    // CONVERT FROM (HZ) TO (GHZ)
-    frequencyGHz = carrierFrequency * 1.E-9;
-    // FIND ZENITH ATTENTUATION (10)
-    logFreq = log( frequencyGHz );
-    // zenatn = newtonInterpolate3Ext( logFreq, NAT, LOGFRQTBL, LOGZENTBL );
-    interpolLagrangePoly( LOGFRQTBL, LOGFRQTBL+NAT, LOGZENTBL, 3, logFreq, zenatn );
-    zenatn=exp( zenatn );
-    // FIND THE ATTENTUATION COEFFICIENTS FOR O2 AND H2O
-    // o2atn = newtonInterpolate3Ext( logFreq, NAT, LOGFRQTBL, LOGO2TBL );
-    interpolLagrangePoly( LOGFRQTBL, LOGFRQTBL+NAT, LOGO2TBL, 3, logFreq, o2atn );
-    o2atn = exp(o2atn);
-    // h2oatn = newtonInterpolate3Ext( logFreq, NAT, LOGFRQTBL, LOGH20TBL );
-    interpolLagrangePoly( LOGFRQTBL, LOGFRQTBL+NAT, LOGH20TBL, 3, logFreq, h2oatn );
-    h2oatn = exp(h2oatn);
+    // CONVERT FROM (HZ) TO (GHZ) AND FIND THE ZENITH, O2 AND H2O TERMS
+    calcAtmosphericAttenuationCoeff( zenatn, o2h2oatn, carrierFrequency * 1.E-9 );
     // CALCULATE THE elevation ANGLE SCALING FACTOR
     sinElevAngle = sin(elevationAngle);
     sclfac = -RADRAT * sinElevAngle
@@ -268,7 +206,7 @@ double atmosphericAttenuation( double carrierFrequency,
     aveden = ( pow( 0.5, stationAltitude/3.02376 ) + 1.0 ) * 0.5;
     // CALCULATE THE RESULTING ATTENUATION
     attenuation = zenatn * sclfac
-                  - aveden * pts * NMI_TO_KM * ( o2atn + h2oatn );
+                  - aveden * pts * NMI_TO_KM * o2h2oatn;
     return attenuation;
 }
 
@@ -294,7 +232,6 @@ double rainAttenuation( double rainRate, // if set 0, function will calculate it
                         double stationLatitude, double stationAltitude,
                         RainRegion rainRegion,  double elevationAngle )
 {
-    static const double COMM_EFF_EARTH_RADIUS = 8500.0 * KM_TO_NMI;
     double attenuation;
     double height0DegIso;
     double projSurfPathLength, adjProjSurfPathLength, adjRainRate, phi(0.0);
@@ -397,6 +334,86 @@ double calcRainRate( double percOut, RainRegion rainRegion)
     return rainRate > 0.0 ? rainRate : 0.0;
 }
 
+//=======================================================================
+// FIND THE ZENITH ATTENUATION AND THE SUM OF THE O2 AND H2O ATTENUATION
+// COEFFICIENTS AT 'frequencyGHz'
+// converted from Comm Section and QUARC FORTRAN codes to C
+void calcAtmosphericAttenuationCoeff( double& zenatn, double& o2h2oatn,
+                                      double frequencyGHz )
+{
+    // static const double EFFECTIVE_HEIGHT = 8.06 * KM_TO_NMI;
+    static const int NAT = 19;
+    // ------------------------------------------------------------------------
+    /***
+    static double FRQTBL[] =
+        { 1.0,  2.0,  4.0,  6.0,  12.0, 15.0, 20.0, 21.7,
+          22.7, 25.0, 30.0, 41.0, 54.0, 59.5, 61.5, 66.0,
+          84.5, 94.0, 100.0 };
+
+    static double ZENTBL[] =
+        { 0.0225, 0.0253, 0.0292, 0.0345, 0.061, 0.08,  0.26,  0.48,
+          0.48,   0.245,  0.2,    0.37,   9.0,   242.0, 242.0, 6.2,
+          0.7,    0.89,   1.06 };
+
+    static double O2TBL[] =
+        { 0.005,  0.006,  0.0065, 0.0067, 0.0071, 0.0078, 0.009,  0.00955,
+          0.01,   0.0109, 0.0143, 0.0436, 3.16,   15.42,  14.86,  0.794,
+          0.052,  0.0452, 0.0466 };
+
+    static double H2OTBL[] =
+        { 5.0E-5, 1.5E-4, 5.0E-4, 1.5E-3, 0.0058, 0.0150, 0.0760, 0.1560,
+          0.1610, 0.1096, 0.0592, 0.0575, 0.0912, 0.1070, 0.1150, 0.1380,
+          0.2230, 0.2692, 0.3076 };
+    ***/
+    // natural log of LOGFRQTBL table
+    static const double LOGFRQTBL[] = {
+        0.000000000, 0.693147181, 1.386294361, 1.791759469,
+        2.484906650, 2.708050201, 2.995732274, 3.077312261,
+        3.122364924, 3.218875825, 3.401197382, 3.713572067,
+        3.988984047, 4.085976313, 4.119037175, 4.189654742,
+        4.436751534, 4.543294782, 4.605170186
+    };
+    // natural log of LOGZENTBL table
+    static const double LOGZENTBL[] = {
+        -3.794239970, -3.676950883, -3.533586570, -3.366795955,
+        -2.796881415, -2.525728644, -1.347073648, -0.733969175,
+        -0.733969175, -1.406497068, -1.609437912, -0.994252273,
+        2.197224577,  5.488937726,  5.488937726,  1.824549292,
+        -0.356674944, -0.116533816,  0.058268908
+    };
+    // natural log of LOGO2TBL table
+    static const double LOGO2TBL[] = {
+        -5.298317367, -5.115995810, -5.035953102, -5.005647753,
+        -4.947660495, -4.853631545, -4.710530702, -4.651214124,
+        -4.605170186, -4.518992490, -4.247495742, -3.132698129,
+        1.150572028,  2.735665368,  2.698673039, -0.230671818,
+        -2.956511560, -3.096658192, -3.066154738
+    };
+    // natural log of LOGH20TBL table
+    static const double LOGH20TBL[] = {
+        -9.903487553, -8.804875264, -7.600902460, -6.502290171,
+        -5.149897361, -4.199705078, -2.577021939, -1.857899272,
+        -1.826350914, -2.210917904, -2.826833737, -2.855970331,
+        -2.394700382, -2.234926445, -2.162823151, -1.980501594,
+        -1.500583508, -1.312300681, -1.178955041
+    };
+    // ------------------------------------------------------------------------
+    double logFreq, o2atn, h2oatn;
+    // FIND ZENITH ATTENTUATION (10)
+    logFreq = log( frequencyGHz );
+    // zenatn = newtonInterpolate3Ext( logFreq, NAT, LOGFRQTBL, LOGZENTBL );
+    interpolLagrangePoly( LOGFRQTBL, LOGFRQTBL+NAT, LOGZENTBL, 3, logFreq, zenatn );
+    zenatn=exp( zenatn );
+    // FIND THE ATTENTUATION COEFFICIENTS FOR O2 AND H2O
+    // o2atn = newtonInterpolate3Ext( logFreq, NAT, LOGFRQTBL, LOGO2TBL );
+    interpolLagrangePoly( LOGFRQTBL, LOGFRQTBL+NAT, LOGO2TBL, 3, logFreq, o2atn );
+    o2atn = exp(o2atn);
+    // h2oatn = newtonInterpolate3Ext( logFreq, NAT, LOGFRQTBL, LOGH20TBL );
+    interpolLagrangePoly( LOGFRQTBL, LOGFRQTBL+NAT, LOGH20TBL, 3, logFreq, h2oatn );
+    h2oatn = exp(h2oatn);
+    o2h2oatn = o2atn + h2oatn;
+}
+
 //=======================================================================
 // FIND THE ZERO DEGREE (C) ISOTHERM HEIGHT FOR THE LATITUDE 'stalat'
 // in radians AND FOR THE PROBABILITY OF OUTAGE OF 'percOutage' %
@@ -605,6 +622,153 @@ double surfaceProjectedAttenuation( double rainRate,
     return spatn;
 }
 
+//=======================================================================
+// ATTENUATION EVALUATOR
+// the frequency, availability and station dependent terms are computed
+// once here, the per elevation work below follows atmosphericAttenuation
+// and rainAttenuation step for step
+AttenuationEvaluator::AttenuationEvaluator( double carrierFrequency,
+                                            double availability,
+                                            double stationLatitude,
+                                            double stationAltitude,
+                                            RainRegion rainRegion,
+                                            double rainRate )
+    : m_stationAltitude( stationAltitude ),
+      m_rainRegion( rainRegion )
+{
+    if ( rainRegion < RR_A || rainRegion >= RR_UNDEFINED ) {
+        throw std::invalid_argument(
+            "AttenuationEvaluator::AttenuationEvaluator(...)\n"
+            "rain region is undefined" );
+    }
+
+    double frequencyGHz = carrierFrequency * 1.0e-9;
+    // atmospheric terms
+    calcAtmosphericAttenuationCoeff( m_zenithAttenuation, m_o2h2oAttenuation,
+                                     frequencyGHz );
+    m_averageDensity = ( pow( 0.5, stationAltitude/3.02376 ) + 1.0 ) * 0.5;
+    m_altitudeTerm = stationAltitude
+                     * ( stationAltitude + EARTH_RADIUS_NMI + EARTH_RADIUS_NMI );
+    // rain rate, forced by the input rain rate if one is given
+    m_percOutage = 100.0 * ( 1.0 - availability );
+    m_rainRate = calcRainRate( m_percOutage, rainRegion );
+
+    if ( rainRate > 0.0 ) {
+        m_rainRateRatio = rainRate / m_rainRate;
+        m_rainRate      = rainRate;
+    } else {
+        m_rainRateRatio = 1.0;
+    }
+
+    m_height0DegIso = height0DegIsotherm( m_percOutage, stationLatitude );
+    calcRainAttenuationCoeff( m_alpha, m_beta, frequencyGHz );
+    // surface projected attenuation terms that depend only on the
+    // unadjusted rain rate, see surfaceProjectedAttenuation
+    m_B = 2.3 * pow( m_rainRate, -0.17 );
+    m_C = 0.026 - 0.03 * log( m_rainRate );
+    m_D = 20.0 * m_C + 3.28;
+    m_C /= KM_TO_NMI;
+    m_D *= KM_TO_NMI;
+    m_U = log(m_B) / m_D + m_C;
+    m_expUDBeta = exp( m_U * m_D * m_beta );
+    m_expCDBeta = exp( m_C * m_beta * m_D );
+    m_powBBeta = pow( m_B, m_beta );
+    m_alphaRainRatePowBeta = m_alpha * pow( m_rainRate, m_beta );
+}
+
+//=======================================================================
+double
+AttenuationEvaluator::GetAtmosphericAttenuation( double elevationAngle ) const
+{
+    double sinElevAngle, sclfac, x2, pts;
+    sinElevAngle = sin(elevationAngle);
+    sclfac = -RADRAT * sinElevAngle
+             + sqrt( RADRAT * ( RADRAT * sinElevAngle * sinElevAngle
+                                + 2.0) + 1.0 );
+    x2 = EARTH_RADIUS_NMI * sinElevAngle;
+    pts = -x2 + sqrt( x2 * x2 + m_altitudeTerm );
+    return m_zenithAttenuation * sclfac
+           - m_averageDensity * pts * NMI_TO_KM * m_o2h2oAttenuation;
+}
+
+//=======================================================================
+double
+AttenuationEvaluator::GetRainAttenuation( double elevationAngle ) const
+{
+    double projSurfPathLength, adjProjSurfPathLength, adjRainRate, phi(0.0);
+    double spatn, sltcor;
+    projectedSurfacePathLength( projSurfPathLength,
+                                adjProjSurfPathLength, adjRainRate,
+                                phi, m_rainRate, m_rainRateRatio, m_percOutage,
+                                m_height0DegIso, elevationAngle,
+                                m_stationAltitude, m_rainRegion,
+                                COMM_EFF_EARTH_RADIUS );
+
+    if ( projSurfPathLength > 12.149 ) {
+        // path was shortened and the rain rate adjusted, nothing cached
+        spatn = surfaceProjectedAttenuation( adjRainRate,
+                                             adjProjSurfPathLength,
+                                             m_alpha, m_beta,
+                                             m_height0DegIso, m_stationAltitude );
+    } else {
+        double X1;
+
+        if ( projSurfPathLength <= 0.0054 ) {
+            X1 = m_height0DegIso - m_stationAltitude;
+        } else if ( m_D > projSurfPathLength ) {
+            X1 = ( exp( m_U * m_beta * projSurfPathLength ) - 1.0 )
+                 / ( m_U * m_beta );
+        } else {
+            X1 = ( m_expUDBeta - 1.0 ) / ( m_U * m_beta ) + m_powBBeta
+                 / ( m_C * m_beta )
+                 * ( exp( m_C * m_beta * projSurfPathLength ) - m_expCDBeta );
+        }
+
+        spatn = m_alphaRainRatePowBeta * X1 * NMI_TO_KM;
+    }
+
+    if ( projSurfPathLength <= 0.01 ) {
+        sltcor = 1.0;
+    } else if ( elevationAngle >= (10.0 * DEG_TO_RAD) ) {
+        sltcor = 1.0 / cos( elevationAngle );
+    } else {
+        sltcor = sqrt( (COMM_EFF_EARTH_RADIUS
+                        * (COMM_EFF_EARTH_RADIUS + m_height0DegIso + m_stationAltitude)
+                        + m_height0DegIso * m_stationAltitude)
+                       * phi * phi + (m_height0DegIso - m_stationAltitude)
+                       * (m_height0DegIso - m_stationAltitude) )
+                 / projSurfPathLength;
+    }
+
+    return spatn * sltcor;
+}
+
+//=======================================================================
+void
+AttenuationEvaluator::GetAtmosphericAttenuations(
+    const std::vector<double>& elevationAngles,
+    std::vector<double>& attenuations ) const
+{
+    attenuations.resize( elevationAngles.size() );
+
+    for ( size_t i = 0; i < elevationAngles.size(); ++i ) {
+        attenuations[i] = GetAtmosphericAttenuation( elevationAngles[i] );
+    }
+}
+
+//=======================================================================
+void
+AttenuationEvaluator::GetRainAttenuations(
+    const std::vector<double>& elevationAngles,
+    std::vector<double>& attenuations ) const
+{
+    attenuations.resize( elevationAngles.size() );
+
+    for ( size_t i = 0; i < elevationAngles.size(); ++i ) {
+        attenuations[i] = GetRainAttenuation( elevationAngles[i] );
+    }
+}
+
 // ============================================================================
 }
 // A3 namespace end
@@ -31,7 +31,7 @@
 
 //  SUBSYSTEM : GenEngr
 
-//  MODULE(s) : attenuation
+//  MODULE(s) : attenuation, AttenuationEvaluator
 
 //  AUTHOR(s) : J. McCormick
 
@@ -53,6 +53,15 @@
 //                                         I've added the deprecated pragma to
 //                                         as a reminder
 
+//  NOTES : AttenuationEvaluator holds the frequency, station and outage
+//          dependent terms of atmosphericAttenuation and rainAttenuation
+//          so repeated evaluation over elevation angle only pays for the
+//          geometry.  Results match the free functions.
+//          Polarization is not an input: the Crain model here uses a
+//          single alpha/beta table rather than separate horizontal and
+//          vertical coefficients, so a link's polarization is ignored
+//          and the rain attenuation is the same for every polarization.
+
 //  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 //  Contents derived from SE and SST Ver 1.0.
 
@@ -61,6 +70,8 @@
 #ifndef ATTENUATION_H
 #define ATTENUATION_H "attenuation V2.0"
 
+#include <vector>
+
 // ============================================================================
 // A3 namespace start
 namespace A3
@@ -89,6 +100,70 @@ double calcRainRate( double percOut, RainRegion rainRegion);
 
 RainRegion stringToRainRegion( const char* strRainRegion );
 
+// ============================================================================
+class AttenuationEvaluator
+{
+public:
+    // rainRate of 0 computes the rain rate from the region and availability,
+    // same convention as rainAttenuation; there is no polarization input,
+    // see NOTES
+    AttenuationEvaluator( double carrierFrequency, // Hz
+                          double availability,     // .98 TO .99999
+                          double stationLatitude,  // radians
+                          double stationAltitude,  // nmi
+                          RainRegion rainRegion,
+                          double rainRate = 0.0 ); // mm/hr
+
+    double GetAtmosphericAttenuation( double elevationAngle ) const; // radians
+    double GetRainAttenuation( double elevationAngle ) const;        // radians
+
+    void GetAtmosphericAttenuations( const std::vector<double>& elevationAngles,
+                                     std::vector<double>& attenuations ) const;
+    void GetRainAttenuations( const std::vector<double>& elevationAngles,
+                              std::vector<double>& attenuations ) const;
+
+    inline double GetRainRate() const;
+    inline RainRegion GetRainRegion() const;
+
+private:
+    double m_stationAltitude;
+    RainRegion m_rainRegion;
+
+    // atmospheric terms
+    double m_zenithAttenuation;
+    double m_o2h2oAttenuation;
+    double m_averageDensity;
+    double m_altitudeTerm;
+
+    // rain terms
+    double m_percOutage;
+    double m_rainRate;
+    double m_rainRateRatio;
+    double m_height0DegIso;
+    double m_alpha;
+    double m_beta;
+
+    // surface projected attenuation terms at m_rainRate
+    double m_alphaRainRatePowBeta;
+    double m_B;
+    double m_C;
+    double m_D;
+    double m_U;
+    double m_expUDBeta;
+    double m_expCDBeta;
+    double m_powBBeta;
+};
+
+inline double AttenuationEvaluator::GetRainRate() const
+{
+    return m_rainRate;
+}
+
+inline RainRegion AttenuationEvaluator::GetRainRegion() const
+{
+    return m_rainRegion;
+}
+
 // ============================================================================
 }
 // A3 namespace end
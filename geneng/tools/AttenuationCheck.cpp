@@ -0,0 +1,169 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * AttenuationCheck.cpp
+ *
+ * MURAL- Multi User Resource Allocator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+//  Standalone regression check for atmosphericAttenuation, rainAttenuation
+//  and AttenuationEvaluator against values recorded from the implementation
+//  that preceded AttenuationEvaluator.  The reference file holds one case
+//  per line, all values as hexadecimal floating point so the comparison is
+//  bit for bit:
+//
+//      frequency availability latitude altitude region rainRate elevation
+//      atmosphericAttenuation rainAttenuation
+//
+//  The evaluator is checked through both its scalar and vector entry
+//  points.  Prints each mismatch and exits non-zero if any is found.
+//
+//  Build (from the repository root):
+//    g++ -std=c++17 -I geneng/src geneng/tools/AttenuationCheck.cpp
+//        geneng/src/attenuation.cpp -o AttenuationCheck
+//  Run:
+//    AttenuationCheck PLTGEN/data/nominal/comparison/Attenuation.txt
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "attenuation.h"
+
+using namespace std;
+using namespace A3;
+
+namespace
+{
+int numberOfChecks_s = 0;
+int numberOfMismatches_s = 0;
+
+double
+ParseValue(const string &token)
+{
+    return strtod(token.c_str(), NULL);
+}
+
+void
+Compare(const string &description,
+        const string &expected,
+        double actual)
+{
+    ++numberOfChecks_s;
+
+    if ((expected == "EXCEPTION") || (ParseValue(expected) != actual)) {
+        ++numberOfMismatches_s;
+        cout << "MISMATCH " << description << ": reference " << expected
+             << " current " << hexfloat << actual << defaultfloat << endl;
+    }
+
+    return;
+}
+
+void
+CompareException(const string &description,
+                 const string &expected)
+{
+    ++numberOfChecks_s;
+
+    if (expected != "EXCEPTION") {
+        ++numberOfMismatches_s;
+        cout << "MISMATCH " << description << ": reference " << expected
+             << " current threw" << endl;
+    }
+
+    return;
+}
+}
+
+int
+main(int argc,
+     char *argv[])
+{
+    if (argc != 2) {
+        cout << "Usage: AttenuationCheck <reference file>" << endl;
+        return 2;
+    }
+
+    ifstream referenceFile(argv[1]);
+    string   line;
+
+    if (!referenceFile) {
+        cout << "Unable to open " << argv[1] << endl;
+        return 2;
+    }
+
+    while (getline(referenceFile, line)) {
+        if (line.empty() || (line[0] == '#')) {
+            continue;
+        }
+
+        istringstream fields(line);
+        string        token[9];
+
+        for (string &field : token) {
+            fields >> field;
+        }
+
+        const double     frequency = ParseValue(token[0]);
+        const double     availability = ParseValue(token[1]);
+        const double     latitude = ParseValue(token[2]);
+        const double     altitude = ParseValue(token[3]);
+        const RainRegion region = (RainRegion)atoi(token[4].c_str());
+        const double     rainRate = ParseValue(token[5]);
+        const double     elevation = ParseValue(token[6]);
+        const string     description = line.substr(0, line.find(token[7]) - 1);
+
+        try {
+            Compare("atmosphericAttenuation " + description, token[7],
+                    atmosphericAttenuation(frequency, altitude, elevation));
+        } catch (...) {
+            CompareException("atmosphericAttenuation " + description, token[7]);
+        }
+
+        try {
+            Compare("rainAttenuation " + description, token[8],
+                    rainAttenuation(rainRate, availability, frequency,
+                                    latitude, altitude, region, elevation));
+        } catch (...) {
+            CompareException("rainAttenuation " + description, token[8]);
+        }
+
+        try {
+            const AttenuationEvaluator evaluator(frequency, availability, latitude,
+                                                 altitude, region, rainRate);
+            const vector<double>       elevations(1, elevation);
+            vector<double>             attenuations;
+            Compare("GetAtmosphericAttenuation " + description, token[7],
+                    evaluator.GetAtmosphericAttenuation(elevation));
+            Compare("GetRainAttenuation " + description, token[8],
+                    evaluator.GetRainAttenuation(elevation));
+            evaluator.GetAtmosphericAttenuations(elevations, attenuations);
+            Compare("GetAtmosphericAttenuations " + description, token[7], attenuations[0]);
+            evaluator.GetRainAttenuations(elevations, attenuations);
+            Compare("GetRainAttenuations " + description, token[8], attenuations[0]);
+        } catch (...) {
+            CompareException("AttenuationEvaluator " + description, token[7]);
+        }
+    }
+
+    cout << numberOfChecks_s << " checks, " << numberOfMismatches_s << " mismatches" << endl;
+    return (numberOfMismatches_s == 0) ? 0 : 1;
+}
@@ -0,0 +1,262 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * BatchPositionCheck.cpp
+ *
+ * MURAL- Multi User Resource Allocator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+//  Standalone check of the batch position paths against the scalar paths
+//  they replace, over a day of sample times:
+//
+//  - CoorTrans::ToBaseBatch and ToSourceBatch against ToBase and ToSource
+//    called after setting the shared time, for each transformation with a
+//    GetDcmAt (ECI/ECI, ECI/ECF for each Greenwich angle type, ECI/PCI,
+//    ECI/J2000, ECI/MOD).  The transformations without one (ECI/Quat,
+//    ECI/PQW) must throw the not implemented error instead.
+//  - SpatialTimeDep::GetPositions against GetPosition after setting the
+//    shared time, for SpatialSun in ECI and SpatialMJ2J4 in ECI and ECF.
+//
+//  The batch DCM products are Matrix3 and the scalar ones MatrixFP, so the
+//  two may differ in the last bits; a difference larger than
+//  TOLERANCE_s (relative to the vector magnitude) is a mismatch.  The
+//  current state of each object must be left as the batch call found it.
+//  Prints the largest difference of each case and exits non-zero on any
+//  mismatch.
+//
+//  The IERS96 nutation used by ECI/J2000 and ECI/MOD comes from the JPL
+//  ephemeris, so the JPL binary file (bin.421) must be on the standard file
+//  search path, as for a MURAL run.
+//
+//  Build (from the repository root, linked with the geneng library built
+//  by the solution's geneng project):
+//    g++ -std=c++17 -I geneng/src geneng/tools/BatchPositionCheck.cpp
+//        <geneng library> -o BatchPositionCheck
+//  Run:
+//    BatchPositionCheck
+
+#include <cstdio>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+#include "constants.h"
+#include "CoorTransEciEcf.h"
+#include "CoorTransEciEci.h"
+#include "CoorTransEciJ2000.h"
+#include "CoorTransEciMod.h"
+#include "CoorTransEciPost.h"
+#include "CoorTransEciPqw.h"
+#include "CoorTransEciQuat.h"
+#include "EulerAnglesKeplerian.h"
+#include "Handle.h"
+#include "HandleConst.h"
+#include "OrbitElKeplerian.h"
+#include "SpatialMJ2J4.h"
+#include "SpatialSun.h"
+#include "TimeJ2000.h"
+#include "VectorCartesian.h"
+
+using namespace A3;
+
+namespace
+{
+const double START_TIME_s = 8.0e8;
+const double DAY_SEC_s = 86400.0;
+const int    NUMBER_OF_TIMES_s = 200;
+const double TOLERANCE_s = 1.0e-14;
+
+int numberOfChecks_s = 0;
+int numberOfMismatches_s = 0;
+
+double
+RelativeDifference(const VectorCartesian &v,
+                   const VectorCartesian &reference)
+{
+    return (v - reference).Magnitude() / reference.Magnitude();
+}
+
+void
+Report(const char *name,
+       double maximumDifference,
+       int numberOfMismatches)
+{
+    printf("%-40s max relative difference %.3e%s\n", name, maximumDifference,
+           (numberOfMismatches > 0) ? "  MISMATCH" : "");
+    numberOfMismatches_s += numberOfMismatches;
+    return;
+}
+
+void
+CheckCoorTrans(const char *name,
+               CoorTrans &coorTrans,
+               Handle<TimeJ2000> &hdlTime,
+               const std::vector<TimeJ2000> &tms)
+{
+    const CoorTrans             &constCoorTrans = coorTrans;
+    std::vector<VectorCartesian> source(tms.size()), base(tms.size());
+    std::vector<VectorCartesian> batchBase, batchSource;
+    VectorCartesian              scalar;
+    double                       maximumDifference = 0.0;
+    int                          numberOfMismatches = 0;
+
+    for (size_t i = 0; i < tms.size(); ++i) {
+        source[i].Set(3780.0 * cos(0.1 * i), 3780.0 * sin(0.1 * i), 500.0 * cos(0.37 * i));
+        base[i].Set(-2100.0 * sin(0.2 * i), 4100.0 * cos(0.2 * i), 700.0 * sin(0.53 * i));
+    }
+
+    *hdlTime = tms.front();
+    coorTrans.ToBase(source.front(), scalar);
+    const CoorTransDcm dcmBefore(constCoorTrans.Dcm());
+    coorTrans.ToBaseBatch(tms, source, batchBase);
+    coorTrans.ToSourceBatch(tms, base, batchSource);
+
+    if (constCoorTrans.Dcm() != dcmBefore) {
+        ++numberOfMismatches;
+        printf("%s: the batch calls changed the current DCM\n", name);
+    }
+
+    for (size_t i = 0; i < tms.size(); ++i) {
+        *hdlTime = tms[i];
+        coorTrans.ToBase(source[i], scalar);
+        double difference = RelativeDifference(batchBase[i], scalar);
+        coorTrans.ToSource(base[i], scalar);
+        difference = fmax(difference, RelativeDifference(batchSource[i], scalar));
+        maximumDifference = fmax(maximumDifference, difference);
+        ++numberOfChecks_s;
+
+        if (difference > TOLERANCE_s) {
+            ++numberOfMismatches;
+        }
+    }
+
+    Report(name, maximumDifference, numberOfMismatches);
+    return;
+}
+
+void
+CheckNotImplemented(const char *name,
+                    const CoorTrans &coorTrans,
+                    const std::vector<TimeJ2000> &tms)
+{
+    const std::vector<VectorCartesian> source(tms.size(), VectorCartesian(1.0, 2.0, 3.0));
+    std::vector<VectorCartesian>       result;
+    int                                numberOfMismatches = 0;
+
+    try {
+        coorTrans.ToBaseBatch(tms, source, result);
+        ++numberOfMismatches;
+    } catch (std::runtime_error &) {
+    }
+
+    try {
+        coorTrans.ToSourceBatch(tms, source, result);
+        ++numberOfMismatches;
+    } catch (std::runtime_error &) {
+    }
+
+    numberOfChecks_s += 2;
+    printf("%-40s %s\n", name, (numberOfMismatches == 0) ? "batch not implemented, as expected"
+           : "batch did not throw  MISMATCH");
+    numberOfMismatches_s += numberOfMismatches;
+    return;
+}
+
+void
+CheckSpatial(const char *name,
+             SpatialTimeDep &spatial,
+             Handle<TimeJ2000> &hdlTime,
+             const std::vector<TimeJ2000> &tms)
+{
+    std::vector<VectorCartesian> batch;
+    double                       maximumDifference = 0.0;
+    int                          numberOfMismatches = 0;
+
+    *hdlTime = tms.front();
+    const VectorCartesian positionBefore(spatial.GetPosition());
+    spatial.GetPositions(tms, batch);
+
+    if (spatial.GetPosition() != positionBefore) {
+        ++numberOfMismatches;
+        printf("%s: the batch call changed the current position\n", name);
+    }
+
+    for (size_t i = 0; i < tms.size(); ++i) {
+        *hdlTime = tms[i];
+        const double difference = RelativeDifference(batch[i], spatial.GetPosition());
+        maximumDifference = fmax(maximumDifference, difference);
+        ++numberOfChecks_s;
+
+        if (difference > TOLERANCE_s) {
+            ++numberOfMismatches;
+        }
+    }
+
+    Report(name, maximumDifference, numberOfMismatches);
+    return;
+}
+}
+
+int
+main()
+{
+    std::vector<TimeJ2000> tms;
+    Handle<TimeJ2000>      hdlTime(new TimeJ2000(START_TIME_s));
+    const char            *grAngTypName[] = {"ECI/ECF GMSA92C", "ECI/ECF GMSA92U", "ECI/ECF GMSA96", "ECI/ECF GSA96"};
+
+    for (int i = 0; i < NUMBER_OF_TIMES_s; ++i) {
+        tms.push_back(TimeJ2000(START_TIME_s + ((DAY_SEC_s * i) / NUMBER_OF_TIMES_s) + (0.37 * i)));
+    }
+
+    try {
+        CoorTransEciEci eciEci;
+        CheckCoorTrans("ECI/ECI", eciEci, hdlTime, tms);
+
+        for (int grAngTyp = CoorTransEciEcf::GMSA92C; grAngTyp <= CoorTransEciEcf::GSA96; ++grAngTyp) {
+            CoorTransEciEcf eciEcf(hdlTime, CoorTransEciEcf::GrAngTyp(grAngTyp));
+            CheckCoorTrans(grAngTypName[grAngTyp], eciEcf, hdlTime, tms);
+        }
+
+        CoorTransEciPci eciPci(TimeJ2000(START_TIME_s - DAY_SEC_s));
+        CheckCoorTrans("ECI/PCI", eciPci, hdlTime, tms);
+        CoorTransEciJ2000 eciJ2000(hdlTime);
+        CheckCoorTrans("ECI/J2000", eciJ2000, hdlTime, tms);
+        CoorTransEciMod eciMod(hdlTime);
+        CheckCoorTrans("ECI/MOD", eciMod, hdlTime, tms);
+
+        CoorTransEciQuat eciQuat(hdlTime);
+        CheckNotImplemented("ECI/Quat", eciQuat, tms);
+        CoorTransEciPqw eciPqw(HandleConst<EulerAnglesKeplerian>(
+                                   new EulerAnglesKeplerian(Angle(0.4), Angle(0.9), Angle(1.3))));
+        CheckNotImplemented("ECI/PQW", eciPqw, tms);
+
+        const OrbitElKeplerian elements(TimeJ2000(START_TIME_s), 3780.0, 0.002, Angle(0.5),
+                                        Angle(0.4), Angle(0.9), Angle(1.3));
+        SpatialSun sun(hdlTime);
+        CheckSpatial("SpatialSun ECI", sun, hdlTime, tms);
+        SpatialMJ2J4 mj2j4Eci(hdlTime, elements);
+        CheckSpatial("SpatialMJ2J4 ECI", mj2j4Eci, hdlTime, tms);
+        SpatialMJ2J4 mj2j4Ecf(hdlTime, Handle<CoorTransBaseEci>(new CoorTransEciEcf(hdlTime)), elements);
+        CheckSpatial("SpatialMJ2J4 ECF", mj2j4Ecf, hdlTime, tms);
+    } catch (std::exception &error) {
+        printf("%s\n", error.what());
+        return 1;
+    }
+
+    printf("%d checks, %d mismatches\n", numberOfChecks_s, numberOfMismatches_s);
+    return (numberOfMismatches_s == 0) ? 0 : 1;
+}
@@ -0,0 +1,166 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * DcmCacheBenchmark.cpp
+ *
+ * MURAL- Multi User Resource Allocator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+//  Standalone accuracy and throughput check for the IERS96 DCM cache as used
+//  by CoorTransEciJ2000 (J2000->TOD) and CoorTransEciMod (MOD->TOD).
+//
+//  Accuracy: over a month sampled every 997.3 sec, the largest DCM element
+//  difference between GetDcmAt and the direct IERS96 series for each
+//  granularity.  Granularity 0 must report exactly 0.
+//
+//  Throughput: a month of one second states through the direct series and
+//  through GetDcmAt at each granularity, in nanoseconds per state.
+//  Granularity 0 bypasses the cache and should match the direct series.
+//
+//  The IERS96 nutation comes from the JPL ephemeris, so the JPL binary file
+//  (bin.421) must be on the standard file search path, as for a MURAL run.
+//
+//  Build (from the repository root, optimized, linked with the geneng
+//  library built by the solution's geneng project):
+//    g++ -std=c++17 -O2 -I geneng/src geneng/tools/DcmCacheBenchmark.cpp
+//        <geneng library> -o DcmCacheBenchmark
+//  Run:
+//    DcmCacheBenchmark [start time, J2000 TT sec]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <math.h>
+
+#include "CoorTransEciJ2000.h"
+#include "CoorTransEciMod.h"
+#include "HandleConst.h"
+#include "IERS96.h"
+#include "Matrix3.h"
+#include "TimeJ2000.h"
+
+using namespace A3;
+
+namespace
+{
+const double MONTH_SEC_s = 30.0 * 86400.0;
+const double ACCURACY_STEP_SEC_s = 997.3;
+const double GRANULARITY_s[] = {0.0, 60.0, 600.0, 3600.0};
+
+// defeats dead code elimination of the matrices being timed
+volatile double sink_s = 0.0;
+
+void
+DirectJ2000ToTod(double tm,
+                 Matrix3 &dcm)
+{
+    Matrix3 dcmJ2000Mod, dcmModTod;
+    IERS96::dcmJ2000ToMod(tm, dcmJ2000Mod);
+    IERS96::dcmModToTod(tm, dcmModTod);
+    dcm = dcmModTod * dcmJ2000Mod;
+    return;
+}
+
+void
+DirectModToTod(double tm,
+               Matrix3 &dcm)
+{
+    IERS96::dcmModToTod(tm, dcm);
+    return;
+}
+
+double
+MaximumElementError(const Matrix3 &dcm,
+                    const Matrix3 &reference)
+{
+    double maximumError = 0.0;
+
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            const double error = fabs(dcm[row][column] - reference[row][column]);
+
+            if (error > maximumError) {
+                maximumError = error;
+            }
+        }
+    }
+
+    return maximumError;
+}
+
+template <typename CoorTrans>
+void
+Check(const char *name,
+      const HandleConst<TimeJ2000> &hdlTime,
+      void (*direct)(double, Matrix3&),
+      double startTime)
+{
+    Matrix3 dcm, reference;
+    double  tm = 0.0;
+    printf("%s\n", name);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (tm = startTime; tm < (startTime + MONTH_SEC_s); tm += 1.0) {
+        direct(tm, dcm);
+        sink_s = sink_s + dcm[0][1];
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    printf("  direct series                               %8.1f ns/state\n",
+           elapsed.count() / MONTH_SEC_s);
+
+    for (double granularity : GRANULARITY_s) {
+        double maximumError = 0.0;
+        CoorTrans coorTrans(hdlTime, granularity);
+
+        for (tm = startTime; tm < (startTime + MONTH_SEC_s); tm += ACCURACY_STEP_SEC_s) {
+            coorTrans.GetDcmAt(TimeJ2000(tm), dcm);
+            direct(tm, reference);
+            const double error = MaximumElementError(dcm, reference);
+
+            if (error > maximumError) {
+                maximumError = error;
+            }
+        }
+
+        start = std::chrono::steady_clock::now();
+
+        for (tm = startTime; tm < (startTime + MONTH_SEC_s); tm += 1.0) {
+            coorTrans.GetDcmAt(TimeJ2000(tm), dcm);
+            sink_s = sink_s + dcm[0][1];
+        }
+
+        elapsed = std::chrono::steady_clock::now() - start;
+        printf("  granularity %6.0f s  max |dcm error| %.3e %8.1f ns/state\n",
+               granularity, maximumError, elapsed.count() / MONTH_SEC_s);
+    }
+
+    return;
+}
+}
+
+int
+main(int argc,
+     char *argv[])
+{
+    const double            startTime = (argc > 1) ? atof(argv[1]) : 8.0e8;
+    HandleConst<TimeJ2000>  hdlTime(new TimeJ2000(startTime));
+    Check<CoorTransEciJ2000>("J2000->TOD, CoorTransEciJ2000::GetDcmAt", hdlTime, DirectJ2000ToTod, startTime);
+    Check<CoorTransEciMod>("MOD->TOD, CoorTransEciMod::GetDcmAt", hdlTime, DirectModToTod, startTime);
+    return 0;
+}
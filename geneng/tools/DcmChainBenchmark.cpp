@@ -0,0 +1,254 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * DcmChainBenchmark.cpp
+ *
+ * MURAL- Multi User Resource Allocator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+//  Standalone check and benchmark of the J2000->MOD->TOD DCM chain, as used
+//  by Orbit::ConvertOsculatingVectors for an osculating state with JPL files.
+//
+//  Accuracy: sample LEO, inclined LEO and GEO states are rotated J2000->TOD
+//  at a set of epochs three ways: the reference (MatrixFP DCMs, each
+//  product into a separate vector), the old in place chain (two
+//  CoorTransDcm::Multiply(v, v), which overwrites v[0] before it computes
+//  v[1] and v[2]) and the combined Matrix3 rotated in place.  The largest
+//  position (m) and velocity (m/s) error of each, and the change in the
+//  mean elements the old chain caused (over the epochs where
+//  osculatingToMean converged for both), are printed.  The Matrix3 chain
+//  must match the reference to CHAIN_TOLERANCE_s.
+//
+//  Throughput: a day of one second states through the MatrixFP chain and
+//  through the Matrix3 chain (both DCMs built, position and velocity
+//  rotated), in nanoseconds per state.
+//
+//  The IERS96 nutation comes from the JPL ephemeris, so the JPL binary file
+//  (bin.421) must be on the standard file search path, as for a MURAL run.
+//
+//  Build (from the repository root, optimized, linked with the geneng
+//  library built by the solution's geneng project):
+//    g++ -std=c++17 -O2 -I geneng/src geneng/tools/DcmChainBenchmark.cpp
+//        <geneng library> -o DcmChainBenchmark
+//  Run:
+//    DcmChainBenchmark [start time, J2000 TT sec]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <math.h>
+
+#include "constants.h"
+#include "CoorTransDcm.h"
+#include "IERS96.h"
+#include "Matrix3.h"
+#include "MeanOsc.h"
+#include "OrbitElKeplerian.h"
+#include "TimeJ2000.h"
+#include "VectorCartesian.h"
+
+using namespace A3;
+
+namespace
+{
+const double DAY_SEC_s = 86400.0;
+const double YEAR_SEC_s = 365.25 * DAY_SEC_s;
+const int    NUMBER_OF_EPOCHS_s = 8;
+
+// relative to the vector magnitude, the two chains differ only in rounding
+const double CHAIN_TOLERANCE_s = 1.0e-14;
+
+struct SampleState {
+    const char *name;
+    double      radius;         // nmi
+    double      inclination;    // deg
+};
+
+const SampleState SAMPLE_STATE_s[] = {
+    {"LEO  0 deg", 3780.0, 0.0},
+    {"LEO 51.6 deg", 3780.0, 51.6},
+    {"LEO 97.8 deg", 3780.0, 97.8},
+    {"GEO  0 deg", 22767.0, 0.0}
+};
+
+// defeats dead code elimination of the vectors being timed
+volatile double sink_s = 0.0;
+
+void
+ReferenceChain(const TimeJ2000 &tm,
+               const VectorCartesian &vIn,
+               VectorCartesian &vOut)
+{
+    CoorTransDcm    dcmJ2000Mod, dcmModTod;
+    VectorCartesian vMod;
+    IERS96::dcmJ2000ToMod(tm, dcmJ2000Mod);
+    IERS96::dcmModToTod(tm, dcmModTod);
+    dcmJ2000Mod.Multiply(vIn, vMod);
+    dcmModTod.Multiply(vMod, vOut);
+    return;
+}
+
+// the rotation ConvertOsculatingVectors made before the Matrix3 chain
+void
+InPlaceChain(const TimeJ2000 &tm,
+             VectorCartesian &v)
+{
+    CoorTransDcm dcmJ2000Mod, dcmModTod;
+    IERS96::dcmJ2000ToMod(tm, dcmJ2000Mod);
+    dcmJ2000Mod.Multiply(v, v);
+    IERS96::dcmModToTod(tm, dcmModTod);
+    dcmModTod.Multiply(v, v);
+    return;
+}
+
+void
+Matrix3Chain(const TimeJ2000 &tm,
+             VectorCartesian &v)
+{
+    Matrix3 dcmJ2000Mod, dcmModTod;
+    IERS96::dcmJ2000ToMod(tm, dcmJ2000Mod);
+    IERS96::dcmModToTod(tm, dcmModTod);
+    const Matrix3 dcmJ2000Tod(dcmModTod * dcmJ2000Mod);
+    dcmJ2000Tod.Multiply(v, v);
+    return;
+}
+
+double
+Difference(const VectorCartesian &v,
+           const VectorCartesian &reference)
+{
+    return (v - reference).Magnitude();
+}
+
+double
+AngleDifferenceDeg(const Angle &a,
+                   const Angle &b)
+{
+    return fabs(remainder(double(a) - double(b), TWO_PI)) * RAD_TO_DEG;
+}
+
+int
+CheckAccuracy(double startTime)
+{
+    int numberOfFailures = 0;
+
+    printf("%-14s %12s %12s %12s %12s %12s %12s %s\n", "state", "old pos m", "old vel m/s",
+           "new pos m", "new vel m/s", "old d sma m", "old d inc deg", "unconverged");
+
+    for (const SampleState &sample : SAMPLE_STATE_s) {
+        // e about 0.002, the mean elements of an exactly circular state are
+        // ill conditioned
+        const double speed = 1.001 * sqrt(EARTH_GRAV_CONST_NMI3_PER_S2 / sample.radius);
+        const double inclination = sample.inclination * DEG_TO_RAD;
+        double       oldPosition = 0.0, oldVelocity = 0.0, newPosition = 0.0, newVelocity = 0.0;
+        double       oldSemiMajorAxis = 0.0, oldInclination = 0.0;
+        int          numberOfUnconverged = 0;
+
+        for (int epoch = 0; epoch < NUMBER_OF_EPOCHS_s; ++epoch) {
+            const TimeJ2000       tm(startTime + (epoch * YEAR_SEC_s));
+            const VectorCartesian position(sample.radius * cos(0.3 * epoch), sample.radius * sin(0.3 * epoch), 0.0);
+            const VectorCartesian velocity(-speed * sin(0.3 * epoch) * cos(inclination),
+                                           speed * cos(0.3 * epoch) * cos(inclination),
+                                           speed * sin(inclination));
+            VectorCartesian       referencePosition, referenceVelocity;
+            VectorCartesian       oldPos(position), oldVel(velocity);
+            VectorCartesian       newPos(position), newVel(velocity);
+            OrbitElKeplerian      referenceMean, oldMean;
+
+            ReferenceChain(tm, position, referencePosition);
+            ReferenceChain(tm, velocity, referenceVelocity);
+            InPlaceChain(tm, oldPos);
+            InPlaceChain(tm, oldVel);
+            Matrix3Chain(tm, newPos);
+            Matrix3Chain(tm, newVel);
+
+            oldPosition = fmax(oldPosition, Difference(oldPos, referencePosition) * NMI_TO_M);
+            oldVelocity = fmax(oldVelocity, Difference(oldVel, referenceVelocity) * NMI_TO_M);
+            newPosition = fmax(newPosition, Difference(newPos, referencePosition) * NMI_TO_M);
+            newVelocity = fmax(newVelocity, Difference(newVel, referenceVelocity) * NMI_TO_M);
+
+            if ((Difference(newPos, referencePosition) > (CHAIN_TOLERANCE_s * sample.radius))
+                    || (Difference(newVel, referenceVelocity) > (CHAIN_TOLERANCE_s * speed))) {
+                ++numberOfFailures;
+            }
+
+            if ((osculatingToMean(OrbitElKeplerian(tm, referencePosition, referenceVelocity), referenceMean) == false)
+                    || (osculatingToMean(OrbitElKeplerian(tm, oldPos, oldVel), oldMean) == false)) {
+                ++numberOfUnconverged;
+                continue;
+            }
+
+            oldSemiMajorAxis = fmax(oldSemiMajorAxis,
+                                    fabs(oldMean.GetSemiMajorAxis() - referenceMean.GetSemiMajorAxis()) * NMI_TO_M);
+            oldInclination = fmax(oldInclination,
+                                  AngleDifferenceDeg(oldMean.GetInclination(), referenceMean.GetInclination()));
+        }
+
+        printf("%-14s %12.3e %12.3e %12.3e %12.3e %12.3e %12.3e %d\n", sample.name, oldPosition, oldVelocity,
+               newPosition, newVelocity, oldSemiMajorAxis, oldInclination, numberOfUnconverged);
+    }
+
+    return numberOfFailures;
+}
+
+void
+CheckThroughput(double startTime)
+{
+    const VectorCartesian position(3780.0, 0.0, 0.0);
+    const VectorCartesian velocity(0.0, 2.5, 3.2);
+    double                tm = 0.0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (tm = startTime; tm < (startTime + DAY_SEC_s); tm += 1.0) {
+        VectorCartesian pos, vel;
+        ReferenceChain(TimeJ2000(tm), position, pos);
+        ReferenceChain(TimeJ2000(tm), velocity, vel);
+        sink_s = sink_s + pos[0] + vel[0];
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    printf("MatrixFP chain %8.1f ns/state\n", elapsed.count() / DAY_SEC_s);
+    start = std::chrono::steady_clock::now();
+
+    for (tm = startTime; tm < (startTime + DAY_SEC_s); tm += 1.0) {
+        VectorCartesian pos(position), vel(velocity);
+        Matrix3         dcmJ2000Mod, dcmModTod;
+        IERS96::dcmJ2000ToMod(tm, dcmJ2000Mod);
+        IERS96::dcmModToTod(tm, dcmModTod);
+        const Matrix3 dcmJ2000Tod(dcmModTod * dcmJ2000Mod);
+        dcmJ2000Tod.Multiply(pos, pos);
+        dcmJ2000Tod.Multiply(vel, vel);
+        sink_s = sink_s + pos[0] + vel[0];
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start;
+    printf("Matrix3 chain  %8.1f ns/state\n", elapsed.count() / DAY_SEC_s);
+    return;
+}
+}
+
+int
+main(int argc,
+     char *argv[])
+{
+    const double startTime = (argc > 1) ? atof(argv[1]) : 0.0;
+    const int    numberOfFailures = CheckAccuracy(startTime);
+    CheckThroughput(startTime);
+    printf("%d Matrix3 chain failures\n", numberOfFailures);
+    return (numberOfFailures == 0) ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * HandleBenchmark.cpp
+ *
+ * MURAL- Multi User Resource Allocator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+//  Standalone microbenchmark for Handle and HandleConst reference counting.
+//  Reports nanoseconds per operation, single thread, for:
+//    - copy construct and destroy
+//    - copy assign between handles to different objects
+//    - move construct and move assign
+//    - passing a handle by value and by const reference
+//    - create and destroy with Handle(new T) and with MakeHandle
+//
+//  Build (from the repository root, optimized):
+//    g++ -std=c++17 -O2 -I geneng/src geneng/tools/HandleBenchmark.cpp
+//        geneng/src/Handle.cpp -o HandleBenchmark
+//  Run:
+//    HandleBenchmark [iterations]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+#include "Handle.h"
+#include "HandleConst.h"
+
+using namespace std;
+using namespace A3;
+
+namespace
+{
+struct Payload
+{
+    Payload() : value(1.0) {;}
+    explicit Payload(double v) : value(v) {;}
+    double value;
+};
+
+// defeats dead code elimination of the handle traffic being measured
+volatile double sink_s = 0.0;
+
+__attribute__((noinline)) void
+UseByValue(Handle<Payload> hdl)
+{
+    sink_s = sink_s + hdl->value;
+}
+
+__attribute__((noinline)) void
+UseByReference(const Handle<Payload> &hdl)
+{
+    sink_s = sink_s + hdl->value;
+}
+
+__attribute__((noinline)) void
+UseConstByValue(HandleConst<Payload> hdl)
+{
+    sink_s = sink_s + hdl->value;
+}
+
+__attribute__((noinline)) void
+UseConstByReference(const HandleConst<Payload> &hdl)
+{
+    sink_s = sink_s + hdl->value;
+}
+
+template <typename Operation>
+void
+Measure(const char *description,
+        long iterations,
+        Operation operation)
+{
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    for (long i = 0; i < iterations; ++i) {
+        operation();
+    }
+
+    const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+    cout << setw(40) << left << description << right
+         << fixed << setprecision(2) << setw(10)
+         << (elapsed.count() / (double)iterations) << " ns/op" << endl;
+    return;
+}
+}
+
+int
+main(int argc,
+     char *argv[])
+{
+    const long           iterations = (argc > 1) ? atol(argv[1]) : 20000000L;
+    Handle<Payload>      first(new Payload(1.0));
+    Handle<Payload>      second(new Payload(2.0));
+    HandleConst<Payload> firstConst(first);
+    Handle<Payload>      target;
+    Handle<Payload>      moving(first);
+    int                  flip = 0;
+    Measure("Handle copy construct + destroy", iterations, [&]() {
+        Handle<Payload> copy(first);
+        sink_s = sink_s + copy->value;
+    });
+    Measure("HandleConst copy construct + destroy", iterations, [&]() {
+        HandleConst<Payload> copy(firstConst);
+        sink_s = sink_s + copy->value;
+    });
+    Measure("Handle copy assign", iterations, [&]() {
+        target = ((++flip & 1) != 0) ? first : second;
+        sink_s = sink_s + target->value;
+    });
+    Measure("Handle move construct + move back", iterations, [&]() {
+        Handle<Payload> moved(std::move(moving));
+        sink_s = sink_s + moved->value;
+        moving = std::move(moved);
+    });
+    Measure("Handle pass by value", iterations, [&]() {
+        UseByValue(first);
+    });
+    Measure("Handle pass by const reference", iterations, [&]() {
+        UseByReference(first);
+    });
+    Measure("HandleConst pass by value", iterations, [&]() {
+        UseConstByValue(firstConst);
+    });
+    Measure("HandleConst pass by const reference", iterations, [&]() {
+        UseConstByReference(firstConst);
+    });
+    Measure("Handle(new T) create + destroy", iterations / 4, [&]() {
+        Handle<Payload> created(new Payload(3.0));
+        sink_s = sink_s + created->value;
+    });
+    Measure("MakeHandle create + destroy", iterations / 4, [&]() {
+        Handle<Payload> created(MakeHandle<Payload>(3.0));
+        sink_s = sink_s + created->value;
+    });
+    return 0;
+}
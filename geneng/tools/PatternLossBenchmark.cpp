@@ -0,0 +1,188 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * PatternLossBenchmark.cpp
+ *
+ * MURAL- Multi User Resource Allocator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+//  Standalone accuracy and throughput check for each antenna pattern:
+//    - scalar: GetPatternLoss_dB per angle
+//    - batch: GetPatternLosses_dB with no lookup table (the cached term
+//      loops of each pattern), which must match the scalar loss
+//    - table N: GetPatternLosses_dB interpolating a BuildLookupTable(N)
+//      table, with the error BuildLookupTable reports and the largest
+//      error against the scalar loss over the random angles
+//  Times are nanoseconds per angle over random angles from 0 to 180 deg.
+//  PatternLossSinCardioid is left out, it is not implemented.
+//  Exits non-zero if a batch loss differs from the scalar loss by more
+//  than 1e-9 dB, or if the error over the random angles exceeds the error
+//  BuildLookupTable reported by more than 10%.  The reported error is
+//  sampled at a fixed number of points per interval, so it can fall a few
+//  percent short of the true largest error.
+//
+//  Build (from the repository root, optimized):
+//    g++ -std=c++17 -O2 -I geneng/src geneng/tools/PatternLossBenchmark.cpp
+//        geneng/src/PatternLoss*.cpp geneng/src/Angle.cpp <geneng library>
+//        -o PatternLossBenchmark
+//  Run:
+//    PatternLossBenchmark [angles]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <math.h>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "Angle.h"
+#include "constants.h"
+#include "PatternLoss.h"
+#include "PatternLossBesselPeak.h"
+#include "PatternLossCCIR.h"
+#include "PatternLossOmni.h"
+#include "PatternLossTT3DBR.h"
+#include "PatternLossTable.h"
+
+using namespace A3;
+
+namespace
+{
+const unsigned TABLE_INTERVALS_s[] = {1800, 18000, 180000};
+const double   BATCH_TOLERANCE_s = 1.0e-9;
+const double   TABLE_TOLERANCE_s = 0.1;
+
+int numberOfFailures_s = 0;
+
+// defeats dead code elimination of the losses being measured
+volatile double sink_s = 0.0;
+
+double
+NanosecondsPerAngle(const std::chrono::steady_clock::time_point &start,
+                    size_t numberOfAngles)
+{
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / numberOfAngles;
+}
+
+double
+MaximumDifference(const std::vector<double> &loss,
+                  const std::vector<double> &reference)
+{
+    double maximumDifference = 0.0;
+
+    for (size_t i = 0; i < loss.size(); ++i) {
+        const double difference = fabs(loss[i] - reference[i]);
+
+        if (difference > maximumDifference) {
+            maximumDifference = difference;
+        }
+    }
+
+    return maximumDifference;
+}
+
+void
+Check(const char *name,
+      PatternLoss &pattern,
+      const std::vector<Angle> &angles)
+{
+    std::vector<double> scalarLoss(angles.size());
+    // sized up front so no timed call pays for the allocation
+    std::vector<double> loss(angles.size());
+    printf("%s\n", name);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < angles.size(); ++i) {
+        scalarLoss[i] = pattern.GetPatternLoss_dB(angles[i]);
+    }
+
+    printf("  scalar                                      %8.1f ns/angle\n",
+           NanosecondsPerAngle(start, angles.size()));
+
+    pattern.ClearLookupTable();
+    start = std::chrono::steady_clock::now();
+    pattern.GetPatternLosses_dB(angles, loss);
+    const double batchTime = NanosecondsPerAngle(start, angles.size());
+    const double batchDifference = MaximumDifference(loss, scalarLoss);
+    sink_s = sink_s + loss[0];
+    printf("  batch                   max |diff| %.3e %8.1f ns/angle\n",
+           batchDifference, batchTime);
+
+    if (batchDifference > BATCH_TOLERANCE_s) {
+        ++numberOfFailures_s;
+        printf("  FAILED: the batch loss differs from the scalar loss\n");
+    }
+
+    for (unsigned numberOfIntervals : TABLE_INTERVALS_s) {
+        const double reportedError = pattern.BuildLookupTable(numberOfIntervals);
+        start = std::chrono::steady_clock::now();
+        pattern.GetPatternLosses_dB(angles, loss);
+        const double tableTime = NanosecondsPerAngle(start, angles.size());
+        const double tableError = MaximumDifference(loss, scalarLoss);
+        sink_s = sink_s + loss[0];
+        printf("  table %6u  reported %.3e  max |error| %.3e %8.1f ns/angle\n",
+               numberOfIntervals, reportedError, tableError, tableTime);
+
+        if (tableError > ((1.0 + TABLE_TOLERANCE_s) * reportedError)) {
+            ++numberOfFailures_s;
+            printf("  FAILED: BuildLookupTable reported less than the table error\n");
+        }
+    }
+
+    pattern.ClearLookupTable();
+    return;
+}
+}
+
+int
+main(int argc,
+     char *argv[])
+{
+    const size_t                           numberOfAngles = (argc > 1) ? atol(argv[1]) : 1000000;
+    std::mt19937_64                        generator(20231);
+    std::uniform_real_distribution<double> angleDistribution(0.0, PI);
+    std::vector<Angle>                     angles(numberOfAngles);
+    std::stringstream                      tableStream;
+
+    for (size_t i = 0; i < numberOfAngles; ++i) {
+        angles[i] = angleDistribution(generator);
+    }
+
+    // a 3 deg beam rolling off to a -40 dB floor, deg and dB per row
+    for (int degree = 0; degree <= 180; ++degree) {
+        const double offBoreSight = degree / 3.0;
+        tableStream << degree << " " << -fmin(40.0, 12.0 * offBoreSight * offBoreSight) << "\n";
+    }
+
+    PatternLossOmni       omni;
+    PatternLossBesselPeak besselPeak(1.0, 0.0136);
+    PatternLossCCIR       ccir(45.0, 1.0, 0.0136);
+    PatternLossTT3DBR     tt3dbr(1.5 * DEG_TO_RAD);
+    PatternLossTable      table;
+    table.LoadTable(tableStream);
+
+    Check("PatternLossOmni", omni, angles);
+    Check("PatternLossBesselPeak, 1 m at 22 GHz", besselPeak, angles);
+    Check("PatternLossCCIR, 45 dB, 1 m at 22 GHz", ccir, angles);
+    Check("PatternLossTT3DBR, 1.5 deg", tt3dbr, angles);
+    Check("PatternLossTable, 3 deg beam", table, angles);
+    printf("%d failures\n", numberOfFailures_s);
+    return (numberOfFailures_s == 0) ? 0 : 1;
+}
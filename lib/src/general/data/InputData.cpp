@@ -20,6 +20,12 @@
  *============================================================================================*/
 
 
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
 #include "InputData.h"
 #include "general/utility/Constant.h"
 #include "general/utility/StringEditor.h"
@@ -42,15 +48,28 @@ InputData::InputData(const string &newLabel,
                      const string &newValue)
     : ptrLabel_a(NULL), ptrValueString_a(NULL), ptrValueArray_a(NULL)
 {
-    string       value = "";
     ptrValueString_a = shared_ptr<string>(new string(newValue));
     ptrLabel_a = shared_ptr<string>(new string(newLabel));
     ptrValueArray_a = shared_ptr<Array<string>>(new Array<string>());
     StringEditor::RemoveCharacter(*ptrValueString_a, INPUT_SEPARATOR_s);
-    istringstream newValueStream(*ptrValueString_a);
+    // split on white space directly over the value string (same tokens an
+    // istringstream would extract)
+    const char *ptrCursor = ptrValueString_a->c_str();
+
+    while (*ptrCursor != '\0') {
+        while ((*ptrCursor != '\0') && (isspace((unsigned char)*ptrCursor) != 0)) {
+            ++ptrCursor;
+        }
+
+        const char *ptrTokenStart = ptrCursor;
+
+        while ((*ptrCursor != '\0') && (isspace((unsigned char)*ptrCursor) == 0)) {
+            ++ptrCursor;
+        }
 
-    while (newValueStream >> value) {
-        ptrValueArray_a->AddElement(value);
+        if (ptrCursor > ptrTokenStart) {
+            ptrValueArray_a->AddElement(string(ptrTokenStart, ptrCursor));
+        }
     }
 
     if (ptrValueArray_a->Size() == 0) {
@@ -109,34 +128,42 @@ InputData::FindValue(int index) const
     return(returnValue);
 }
 
+const string&
+InputData::FindValueString(int index) const
+{
+    return((*ptrValueArray_a)[index]);
+}
+
 int
 InputData::GetIntValue(int index) const
 {
-    string valueString = "";
+    const char *ptrValue = NULL;
 
     try {
-        valueString = FindValue(index);
+        ptrValue = FindValueString(index).c_str();
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetIntValue(int)");
         throw;
     }
 
-    return(StringEditor::ConvertToInt(valueString));
+    // same conversion as StringEditor::ConvertToInt without the string copy
+    return((int)strtol(ptrValue, NULL, 10));
 }
 
 double
 InputData::GetDoubleValue(int index) const
 {
-    string valueString = "";
+    const char *ptrValue = NULL;
 
     try {
-        valueString = FindValue(index);
+        ptrValue = FindValueString(index).c_str();
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetDoubleValue(int)");
         throw;
     }
 
-    return(StringEditor::ConvertToDouble(valueString));
+    // same conversion as StringEditor::ConvertToDouble without the string copy
+    return(strtod(ptrValue, NULL));
 }
 
 bool
@@ -230,17 +257,13 @@ InputData::GetInputDataLine() const
 bool
 InputData::GetSpecificIntNumber(int &specificNumber) const
 {
-    string                  specificTypeString = "";
-    const string::size_type startPosition = ptrLabel_a->find_first_of(SPECIFIC_INPUT_START_s);
-    const string::size_type endPosition = ptrLabel_a->find_last_of(SPECIFIC_INPUT_END_s);
+    char        buffer[SPECIFIC_BUFFER_SIZE_s];
+    string      overflowBuffer = "";
+    const char *ptrCursor = CopySpecificSpan(buffer, overflowBuffer, false);
     specificNumber = 0;
 
-    if ( (startPosition != string::npos) && (endPosition != string::npos) &&
-            ((startPosition + 1) < endPosition) ) {
-        specificTypeString = ptrLabel_a->substr((startPosition + 1),
-                                                (endPosition - startPosition - 1));
-        istringstream specificTypeStream(specificTypeString);
-        specificTypeStream >> specificNumber;
+    if (ptrCursor != NULL) {
+        ParseNumber(ptrCursor, specificNumber);
     }
 
     return(specificNumber > 0);
@@ -249,20 +272,13 @@ InputData::GetSpecificIntNumber(int &specificNumber) const
 bool
 InputData::GetSpecificDoubleNumber(double &specificNumber) const
 {
-    bool                    foundSpecificDoubleNumber = false;
-    string                  specificTypeString = "";
-    const string::size_type startPosition = ptrLabel_a->find_first_of(SPECIFIC_INPUT_START_s);
-    const string::size_type endPosition = ptrLabel_a->find_last_of(SPECIFIC_INPUT_END_s);
-
-    if ( (startPosition != string::npos) && (endPosition != string::npos) &&
-            ((startPosition + 1) < endPosition) ) {
-        specificTypeString = ptrLabel_a->substr((startPosition + 1),
-                                                (endPosition - startPosition - 1));
-        istringstream specificTypeStream(specificTypeString);
+    bool        foundSpecificDoubleNumber = false;
+    char        buffer[SPECIFIC_BUFFER_SIZE_s];
+    string      overflowBuffer = "";
+    const char *ptrCursor = CopySpecificSpan(buffer, overflowBuffer, false);
 
-        if (specificTypeStream >> specificNumber) {
-            foundSpecificDoubleNumber = true;
-        }
+    if (ptrCursor != NULL) {
+        foundSpecificDoubleNumber = ParseNumber(ptrCursor, specificNumber);
     }
 
     return(foundSpecificDoubleNumber);
@@ -272,21 +288,14 @@ bool
 InputData::GetSpecificIntNumbers(int &specificNumber1,
                                  int &specificNumber2) const
 {
-    bool                    foundSpecificNumbers = false;
-    string                  specificTypeString = "";
-    const string::size_type startPosition = ptrLabel_a->find_first_of(SPECIFIC_INPUT_START_s);
-    const string::size_type endPosition = ptrLabel_a->find_last_of(SPECIFIC_INPUT_END_s);
-
-    if ( (startPosition != string::npos) && (endPosition != string::npos) &&
-            ((startPosition + 1) < endPosition) ) {
-        specificTypeString = ptrLabel_a->substr((startPosition + 1),
-                                                (endPosition - startPosition - 1));
-        StringEditor::RemoveCharacter(specificTypeString, INPUT_SEPARATOR_s);
-        istringstream specificTypeStream(specificTypeString);
-
-        if (specificTypeStream >> specificNumber1 >> specificNumber2) {
-            foundSpecificNumbers = true;
-        }
+    bool        foundSpecificNumbers = false;
+    char        buffer[SPECIFIC_BUFFER_SIZE_s];
+    string      overflowBuffer = "";
+    const char *ptrCursor = CopySpecificSpan(buffer, overflowBuffer, true);
+
+    if (ptrCursor != NULL) {
+        foundSpecificNumbers = (ParseNumber(ptrCursor, specificNumber1) == true) &&
+                               (ParseNumber(ptrCursor, specificNumber2) == true);
     }
 
     return(foundSpecificNumbers);
@@ -296,20 +305,16 @@ bool
 InputData::GetSpecificNumbers(double &specificNumber1,
                               double &specificNumber2) const
 {
-    bool                    foundSpecificNumbers = false;
-    string                  specificTypeString = "";
-    const string::size_type startPosition = ptrLabel_a->find_first_of(SPECIFIC_INPUT_START_s);
-    const string::size_type endPosition = ptrLabel_a->find_last_of(SPECIFIC_INPUT_END_s);
+    bool foundSpecificNumbers = false;
 
-    if ( (startPosition != string::npos) && (endPosition != string::npos) &&
-            ((startPosition + 1) < endPosition) && (ptrLabel_a->find(INPUT_SEPARATOR_s) != string::npos) ) {
-        specificTypeString = ptrLabel_a->substr((startPosition + 1),
-                                                (endPosition - startPosition - 1));
-        StringEditor::RemoveCharacter(specificTypeString, INPUT_SEPARATOR_s);
-        istringstream specificTypeStream(specificTypeString);
+    if (ptrLabel_a->find(INPUT_SEPARATOR_s) != string::npos) {
+        char        buffer[SPECIFIC_BUFFER_SIZE_s];
+        string      overflowBuffer = "";
+        const char *ptrCursor = CopySpecificSpan(buffer, overflowBuffer, true);
 
-        if (specificTypeStream >> specificNumber1 >> specificNumber2) {
-            foundSpecificNumbers = true;
+        if (ptrCursor != NULL) {
+            foundSpecificNumbers = (ParseNumber(ptrCursor, specificNumber1) == true) &&
+                                   (ParseNumber(ptrCursor, specificNumber2) == true);
         }
     }
 
@@ -319,20 +324,15 @@ InputData::GetSpecificNumbers(double &specificNumber1,
 int
 InputData::GetSpecificNumbers(Array<double> *specificNumberList) const
 {
-    int numberCount                     = 0;
-    string specificTypeString             = "";
-    const string::size_type startPosition = ptrLabel_a->find_first_of(SPECIFIC_INPUT_START_s);
-    const string::size_type endPosition   = ptrLabel_a->find_last_of(SPECIFIC_INPUT_END_s);
+    int         numberCount = 0;
+    char        buffer[SPECIFIC_BUFFER_SIZE_s];
+    string      overflowBuffer = "";
+    const char *ptrCursor = CopySpecificSpan(buffer, overflowBuffer, true);
 
-    if ( (startPosition != string::npos) && (endPosition != string::npos) &&
-            ((startPosition + 1) < endPosition) ) {
+    if (ptrCursor != NULL) {
         double nextNumber = 0.0;
-        specificTypeString = ptrLabel_a->substr((startPosition + 1),
-                                                (endPosition - startPosition - 1));
-        StringEditor::RemoveCharacter(specificTypeString, INPUT_SEPARATOR_s);
-        istringstream specificTypeStream(specificTypeString);
 
-        while (specificTypeStream >> nextNumber ) {
+        while (ParseNumber(ptrCursor, nextNumber) == true) {
             specificNumberList->AddElement(nextNumber);
             numberCount++;
         }
@@ -341,6 +341,107 @@ InputData::GetSpecificNumbers(Array<double> *specificNumberList) const
     return(numberCount);
 }
 
+const char*
+InputData::CopySpecificSpan(char *ptrBuffer,
+                            string &overflowBuffer,
+                            bool removeSeparator) const
+{
+    char                   *ptrSpan = NULL;
+    const string::size_type startPosition = ptrLabel_a->find_first_of(SPECIFIC_INPUT_START_s);
+    const string::size_type endPosition = ptrLabel_a->find_last_of(SPECIFIC_INPUT_END_s);
+
+    if ( (startPosition != string::npos) && (endPosition != string::npos) &&
+            ((startPosition + 1) < endPosition) ) {
+        const string::size_type spanSize = endPosition - startPosition - 1;
+        const char             *ptrSource = ptrLabel_a->c_str() + startPosition + 1;
+        const char             *ptrSourceEnd = ptrSource + spanSize;
+        char                   *ptrTarget = NULL;
+
+        if (spanSize < (string::size_type)SPECIFIC_BUFFER_SIZE_s) {
+            ptrSpan = ptrBuffer;
+        } else {
+            overflowBuffer.resize(spanSize + 1);
+            ptrSpan = &overflowBuffer[0];
+        }
+
+        ptrTarget = ptrSpan;
+
+        while (ptrSource < ptrSourceEnd) {
+            if ((removeSeparator == false) || (*ptrSource != INPUT_SEPARATOR_s)) {
+                *ptrTarget = *ptrSource;
+                ++ptrTarget;
+            }
+
+            ++ptrSource;
+        }
+
+        *ptrTarget = '\0';
+    }
+
+    return(ptrSpan);
+}
+
+bool
+InputData::ParseNumber(const char *&ptrCursor,
+                       double &number)
+{
+    bool        parsedNumber = false;
+    const char *ptrDigits = NULL;
+    char       *ptrEnd = NULL;
+
+    while (isspace((unsigned char)*ptrCursor) != 0) {
+        ++ptrCursor;
+    }
+
+    ptrDigits = ptrCursor;
+
+    if ((*ptrDigits == '+') || (*ptrDigits == '-')) {
+        ++ptrDigits;
+    }
+
+    // strtod also accepts inf, nan and hexadecimal which a stream extraction
+    // does not, so only hand it text that starts like a decimal number
+    if ((isdigit((unsigned char)*ptrDigits) != 0) || (*ptrDigits == '.')) {
+        if ((ptrDigits[0] == '0') && ((ptrDigits[1] == 'x') || (ptrDigits[1] == 'X'))) {
+            number = 0.0;
+            ptrCursor = ptrDigits + 1;
+            parsedNumber = true;
+        } else {
+            const double value = strtod(ptrCursor, &ptrEnd);
+
+            if (ptrEnd != ptrCursor) {
+                number = value;
+                ptrCursor = ptrEnd;
+                parsedNumber = true;
+            }
+        }
+    }
+
+    return(parsedNumber);
+}
+
+bool
+InputData::ParseNumber(const char *&ptrCursor,
+                       int &number)
+{
+    bool  parsedNumber = false;
+    char *ptrEnd = NULL;
+    long  value = 0;
+    errno = 0;
+    value = strtol(ptrCursor, &ptrEnd, 10);
+
+    if ( (ptrEnd != ptrCursor) && (errno != ERANGE) &&
+            (value >= INT_MIN) && (value <= INT_MAX) ) {
+        number = (int)value;
+        ptrCursor = ptrEnd;
+        parsedNumber = true;
+    } else {
+        number = 0;
+    }
+
+    return(parsedNumber);
+}
+
 bool
 InputData::GetSpecificType(string &specificType) const
 {
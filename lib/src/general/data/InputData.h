@@ -117,11 +117,31 @@ private:
 
     string FindValue(int index) const;
 
+    const string& FindValueString(int index) const;
+
+    /**
+     * Copies the text between the first '[' and the last ']' of the label into
+     * the given buffer (or the overflow string when it does not fit), optionally
+     * dropping the input separator, without building any stream.
+     *
+     * @return pointer to the null terminated text, NULL when there are no
+     *         specific values in the label
+     */
+    const char* CopySpecificSpan(char *ptrBuffer,
+                                 string &overflowBuffer,
+                                 bool removeSeparator) const;
+
+    static bool ParseNumber(const char *&ptrCursor,
+                            double &number);
+    static bool ParseNumber(const char *&ptrCursor,
+                            int &number);
+
     static inline string GetClassName();
 
     static const char   INPUT_SEPARATOR_s;
     static const char   SPECIFIC_INPUT_START_s;
     static const char   SPECIFIC_INPUT_END_s;
+    static const int    SPECIFIC_BUFFER_SIZE_s = 128;
 
     shared_ptr<string>         ptrLabel_a;
     shared_ptr<string>         ptrValueString_a;
@@ -175,29 +175,22 @@ InputDataElement::AddInputDataElement(shared_ptr<InputDataElement> ptrNewElement
     return;
 }
 
-InputData&
-InputDataElement::RetrieveInputData(const string &label)
+shared_ptr<InputData>
+InputDataElement::RetrieveInputData(const string &label) const
 {
-    bool                    found = false;
-    InputDataList::iterator inputDataIter;   // Iterator of InputData
-    shared_ptr<InputData>   ptrReturnData = NULL;
+    InputDataList::const_iterator inputDataIter;   // Iterator of InputData
+    shared_ptr<InputData>         ptrReturnData = NULL;
 
-    // Initialize the iterator
     if ( ptrInputDataList_a != NULL ) {
-        inputDataIter = ptrInputDataList_a->begin();
-    }
-
-    while (((*inputDataIter) != NULL) && (found == false)) {
-        if ((*inputDataIter)->GetLabel() == label) {
-            found = true;
-            ptrReturnData = (*inputDataIter);
-        } else {
-            // Increment the iterator
-            ++inputDataIter;
+        for (inputDataIter = ptrInputDataList_a->begin();
+                (inputDataIter != ptrInputDataList_a->end()) && (ptrReturnData == NULL); ++inputDataIter) {
+            if ((*inputDataIter)->GetLabel() == label) {
+                ptrReturnData = (*inputDataIter);
+            }
         }
     }
 
-    return(*ptrReturnData);
+    return(ptrReturnData);
 }
 
 int
@@ -96,7 +96,15 @@ public:
     string      GetOpeningBlockTag() const;
     string      GetClosingBlockTag() const;
 
-    InputData&   RetrieveInputData(const string &label);
+    /**
+     * Looks up the first InputData with the exact label given.  A label
+     *  that is not present is not an error here, callers which require the
+     *  input check for NULL and report it themselves.
+     *
+     * @param label the full label of the InputData
+     * @return the InputData, NULL if no input has the label
+     */
+    shared_ptr<InputData> RetrieveInputData(const string &label) const;
 
     inline int GetNumberOfIndents() const;
 
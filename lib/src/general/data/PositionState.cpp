@@ -26,6 +26,7 @@
 #include "general/exception/Exception.h"
 #include "general/math/SpaceVector.h"
 #include "general/utility/Constant.h"
+#include "general/utility/ReportWriter.h"
 
 PositionState::PositionState()
     : ptrPosition_a(new SpaceVector()), ptrVelocity_a(new SpaceVector())
@@ -127,6 +128,30 @@ PositionState::PrintPositionState(ofstream &outfile,
 
 /* *************************************************************************** */
 
+void
+PositionState::PrintPositionState(ReportWriter &writer,
+                                  int timeIndex) const
+{
+    SpaceVector positionToPrint = ptrPosition_a->GetOutputSpaceVector(timeIndex);
+    SpaceVector velocityToPrint = ptrVelocity_a->GetOutputSpaceVector(timeIndex);
+    writer.WriteChar(' ');
+    writer.WriteChar(' ');
+    writer.WriteFixed(positionToPrint.GetX(), 15, 3);
+    writer.WriteChar(' ');
+    writer.WriteFixed(positionToPrint.GetY(), 15, 3);
+    writer.WriteChar(' ');
+    writer.WriteFixed(positionToPrint.GetZ(), 15, 3);
+    writer.WriteChar(' ');
+    writer.WriteFixed(velocityToPrint.GetX(), 15, 3);
+    writer.WriteChar(' ');
+    writer.WriteFixed(velocityToPrint.GetY(), 15, 3);
+    writer.WriteChar(' ');
+    writer.WriteFixed(velocityToPrint.GetZ(), 15, 3);
+    return;
+}
+
+/* *************************************************************************** */
+
 SpaceVector
 PositionState::GetPosition(const REFERENCE_FRAME &frame,
                            int timeIndex) const
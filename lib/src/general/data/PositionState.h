@@ -31,6 +31,7 @@
 using namespace std;
 
 class SpaceVector;
+class ReportWriter;
 
 /**
  * PositionState is the class that represents a  a position and a
@@ -65,6 +66,8 @@ public:
 
     void PrintPositionState(ofstream &outfile,
                             int timeIndex) const;
+    void PrintPositionState(ReportWriter &writer,
+                            int timeIndex) const;
 
     SpaceVector GetPosition(const REFERENCE_FRAME &frame,
                             int timeIndex = -1) const;
@@ -23,21 +23,8 @@
 #include "general/math/SimpleMath.h"
 #include "general/time/TimePiece.h"
 
-// Defaults (for now)
-ANGLE_UNIT      UnitData::internalAngleUnits_s = RADIANS;
-DISTANCE_UNIT   UnitData::internalDistanceUnits_s = METERS;
-REFERENCE_FRAME UnitData::internalReferenceFrame_s = EARTH_CENTER_FIXED;
-TIME_UNIT       UnitData::internalTimeUnits_s = TIME_STEPS;
-
-ANGLE_UNIT      UnitData::inputAngleUnits_s = RADIANS;
-DISTANCE_UNIT   UnitData::inputDistanceUnits_s = METERS;
-REFERENCE_FRAME UnitData::inputReferenceFrame_s = EARTH_CENTER_FIXED;
-TIME_UNIT       UnitData::inputTimeUnits_s = TIME_STEPS;
-
-ANGLE_UNIT      UnitData::outputAngleUnits_s = RADIANS;
-DISTANCE_UNIT   UnitData::outputDistanceUnits_s = METERS;
-REFERENCE_FRAME UnitData::outputReferenceFrame_s = EARTH_CENTER_FIXED;
-TIME_UNIT       UnitData::outputTimeUnits_s = TIME_STEPS;
+UnitData::State               UnitData::defaultState_s;
+thread_local UnitData::State *UnitData::ptrBoundState_s = NULL;
 
 UnitData::UnitData()
 {
@@ -49,7 +36,7 @@ UnitData::UnitData()
 void
 UnitData::SetInternalReferenceFrame(const REFERENCE_FRAME &frame)
 {
-    internalReferenceFrame_s = frame;
+    GetState().internalReferenceFrame = frame;
 }
 
 /* ***************************************************************************** */
@@ -57,7 +44,7 @@ UnitData::SetInternalReferenceFrame(const REFERENCE_FRAME &frame)
 void
 UnitData::SetInternalAngleUnits(const ANGLE_UNIT &units)
 {
-    internalAngleUnits_s = units;
+    GetState().internalAngleUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -65,7 +52,7 @@ UnitData::SetInternalAngleUnits(const ANGLE_UNIT &units)
 void
 UnitData::SetInternalDistanceUnits(const DISTANCE_UNIT &units)
 {
-    internalDistanceUnits_s = units;
+    GetState().internalDistanceUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -73,7 +60,7 @@ UnitData::SetInternalDistanceUnits(const DISTANCE_UNIT &units)
 void
 UnitData::SetInternalTimeUnits(const TIME_UNIT &units)
 {
-    internalTimeUnits_s = units;
+    GetState().internalTimeUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -81,7 +68,7 @@ UnitData::SetInternalTimeUnits(const TIME_UNIT &units)
 void
 UnitData::SetInputReferenceFrame(const REFERENCE_FRAME &frame)
 {
-    inputReferenceFrame_s = frame;
+    GetState().inputReferenceFrame = frame;
 }
 
 /* ***************************************************************************** */
@@ -89,7 +76,7 @@ UnitData::SetInputReferenceFrame(const REFERENCE_FRAME &frame)
 void
 UnitData::SetInputAngleUnits(const ANGLE_UNIT &units)
 {
-    inputAngleUnits_s = units;
+    GetState().inputAngleUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -97,7 +84,7 @@ UnitData::SetInputAngleUnits(const ANGLE_UNIT &units)
 void
 UnitData::SetInputDistanceUnits(const DISTANCE_UNIT &units)
 {
-    inputDistanceUnits_s = units;
+    GetState().inputDistanceUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -105,7 +92,7 @@ UnitData::SetInputDistanceUnits(const DISTANCE_UNIT &units)
 void
 UnitData::SetInputTimeUnits(const TIME_UNIT &units)
 {
-    inputTimeUnits_s = units;
+    GetState().inputTimeUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -113,7 +100,7 @@ UnitData::SetInputTimeUnits(const TIME_UNIT &units)
 void
 UnitData::SetOutputReferenceFrame(const REFERENCE_FRAME &frame)
 {
-    outputReferenceFrame_s = frame;
+    GetState().outputReferenceFrame = frame;
 }
 
 /* ***************************************************************************** */
@@ -121,7 +108,7 @@ UnitData::SetOutputReferenceFrame(const REFERENCE_FRAME &frame)
 void
 UnitData::SetOutputAngleUnits(const ANGLE_UNIT &units)
 {
-    outputAngleUnits_s = units;
+    GetState().outputAngleUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -129,7 +116,7 @@ UnitData::SetOutputAngleUnits(const ANGLE_UNIT &units)
 void
 UnitData::SetOutputDistanceUnits(const DISTANCE_UNIT &units)
 {
-    outputDistanceUnits_s = units;
+    GetState().outputDistanceUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -137,7 +124,7 @@ UnitData::SetOutputDistanceUnits(const DISTANCE_UNIT &units)
 void
 UnitData::SetOutputTimeUnits(const TIME_UNIT &units)
 {
-    outputTimeUnits_s = units;
+    GetState().outputTimeUnits = units;
 }
 
 /* ***************************************************************************** */
@@ -145,7 +132,7 @@ UnitData::SetOutputTimeUnits(const TIME_UNIT &units)
 REFERENCE_FRAME
 UnitData::GetOutputReferenceFrame()
 {
-    return(outputReferenceFrame_s);
+    return(GetState().outputReferenceFrame);
 }
 
 /* ***************************************************************************** */
@@ -153,7 +140,7 @@ UnitData::GetOutputReferenceFrame()
 ANGLE_UNIT
 UnitData::GetOutputAngleUnits()
 {
-    return(outputAngleUnits_s);
+    return(GetState().outputAngleUnits);
 }
 
 /* ***************************************************************************** */
@@ -161,7 +148,7 @@ UnitData::GetOutputAngleUnits()
 DISTANCE_UNIT
 UnitData::GetOutputDistanceUnits()
 {
-    return(outputDistanceUnits_s);
+    return(GetState().outputDistanceUnits);
 }
 
 /* ***************************************************************************** */
@@ -169,7 +156,7 @@ UnitData::GetOutputDistanceUnits()
 TIME_UNIT
 UnitData::GetOutputTimeUnits()
 {
-    return(outputTimeUnits_s);
+    return(GetState().outputTimeUnits);
 }
 
 /* ***************************************************************************** */
@@ -177,7 +164,7 @@ UnitData::GetOutputTimeUnits()
 REFERENCE_FRAME
 UnitData::GetInputReferenceFrame()
 {
-    return(inputReferenceFrame_s);
+    return(GetState().inputReferenceFrame);
 }
 
 /* ***************************************************************************** */
@@ -185,7 +172,7 @@ UnitData::GetInputReferenceFrame()
 TIME_UNIT
 UnitData::GetInputTimeUnits()
 {
-    return(inputTimeUnits_s);
+    return(GetState().inputTimeUnits);
 }
 
 /* ***************************************************************************** */
@@ -193,7 +180,7 @@ UnitData::GetInputTimeUnits()
 ANGLE_UNIT
 UnitData::GetInputAngleUnits()
 {
-    return(inputAngleUnits_s);
+    return(GetState().inputAngleUnits);
 }
 
 /* ***************************************************************************** */
@@ -201,7 +188,7 @@ UnitData::GetInputAngleUnits()
 DISTANCE_UNIT
 UnitData::GetInputDistanceUnits()
 {
-    return(inputDistanceUnits_s);
+    return(GetState().inputDistanceUnits);
 }
 
 /* ***************************************************************************** */
@@ -375,7 +362,7 @@ UnitData::GetReferenceFrame(const string &valueString)
 REFERENCE_FRAME
 UnitData::GetInternalReferenceFrame()
 {
-    return(internalReferenceFrame_s);
+    return(GetState().internalReferenceFrame);
 }
 
 /* ***************************************************************************** */
@@ -383,7 +370,7 @@ UnitData::GetInternalReferenceFrame()
 TIME_UNIT
 UnitData::GetInternalTimeUnits()
 {
-    return(internalTimeUnits_s);
+    return(GetState().internalTimeUnits);
 }
 
 /* ***************************************************************************** */
@@ -391,7 +378,7 @@ UnitData::GetInternalTimeUnits()
 ANGLE_UNIT
 UnitData::GetInternalAngleUnits()
 {
-    return(internalAngleUnits_s);
+    return(GetState().internalAngleUnits);
 }
 
 /* ***************************************************************************** */
@@ -399,7 +386,7 @@ UnitData::GetInternalAngleUnits()
 DISTANCE_UNIT
 UnitData::GetInternalDistanceUnits()
 {
-    return(internalDistanceUnits_s);
+    return(GetState().internalDistanceUnits);
 }
 
 /* ***************************************************************************** */
@@ -407,7 +394,7 @@ UnitData::GetInternalDistanceUnits()
 double
 UnitData::GetOutputAngle(double internalAngle)
 {
-    return(SimpleMath::ConvertAngle(internalAngle, UnitData::internalAngleUnits_s, outputAngleUnits_s));
+    return(SimpleMath::ConvertAngle(internalAngle, GetState().internalAngleUnits, GetState().outputAngleUnits));
 }
 
 /* ***************************************************************************** */
@@ -415,7 +402,7 @@ UnitData::GetOutputAngle(double internalAngle)
 double
 UnitData::GetOutputDistance(double internalDistance)
 {
-    return(SimpleMath::ConvertDistance(internalDistance, UnitData::internalDistanceUnits_s, outputDistanceUnits_s));
+    return(SimpleMath::ConvertDistance(internalDistance, GetState().internalDistanceUnits, GetState().outputDistanceUnits));
 }
 
 /* ***************************************************************************** */
@@ -423,7 +410,7 @@ UnitData::GetOutputDistance(double internalDistance)
 double
 UnitData::GetOutputTimeStep(int internalTimeIndex)
 {
-    return(TimePiece::ConvertTime((double)(internalTimeIndex + 1), UnitData::internalTimeUnits_s, outputTimeUnits_s));
+    return(TimePiece::ConvertTime((double)(internalTimeIndex + 1), GetState().internalTimeUnits, GetState().outputTimeUnits));
 }
 
 /* ***************************************************************************** */
@@ -431,7 +418,7 @@ UnitData::GetOutputTimeStep(int internalTimeIndex)
 double
 UnitData::GetOutputTimeDuration(int internalDuration)
 {
-    return(TimePiece::ConvertTime((double)internalDuration, UnitData::internalTimeUnits_s, outputTimeUnits_s));
+    return(TimePiece::ConvertTime((double)internalDuration, GetState().internalTimeUnits, GetState().outputTimeUnits));
 }
 
 /* ***************************************************************************** */
@@ -440,7 +427,7 @@ double
 UnitData::GetInputAngle(double internalAngle)
 {
     return(SimpleMath::ConvertAngle(internalAngle,
-                                    internalAngleUnits_s, inputAngleUnits_s));
+                                    GetState().internalAngleUnits, GetState().inputAngleUnits));
 }
 
 /* ***************************************************************************** */
@@ -449,7 +436,7 @@ double
 UnitData::GetInputDistance(double internalDistance)
 {
     return(SimpleMath::ConvertDistance(internalDistance,
-                                       internalDistanceUnits_s, inputDistanceUnits_s));
+                                       GetState().internalDistanceUnits, GetState().inputDistanceUnits));
 }
 
 /* ***************************************************************************** */
@@ -457,8 +444,8 @@ UnitData::GetInputDistance(double internalDistance)
 double
 UnitData::GetInputTimeInstant(int internalIndex)
 {
-    return(TimePiece::ConvertTime((double)(internalIndex + 1), internalTimeUnits_s,
-                                  inputTimeUnits_s));
+    return(TimePiece::ConvertTime((double)(internalIndex + 1), GetState().internalTimeUnits,
+                                  GetState().inputTimeUnits));
 }
 
 /* ***************************************************************************** */
@@ -466,8 +453,8 @@ UnitData::GetInputTimeInstant(int internalIndex)
 double
 UnitData::GetInputTimeDuration(int internalDuration)
 {
-    return(TimePiece::ConvertTime((double)internalDuration, internalTimeUnits_s,
-                                  inputTimeUnits_s));
+    return(TimePiece::ConvertTime((double)internalDuration, GetState().internalTimeUnits,
+                                  GetState().inputTimeUnits));
 }
 
 /* ***************************************************************************** */
@@ -476,7 +463,7 @@ double
 UnitData::GetInternalAngle(double inputAngle)
 {
     return(SimpleMath::ConvertAngle(inputAngle,
-                                    inputAngleUnits_s, internalAngleUnits_s));
+                                    GetState().inputAngleUnits, GetState().internalAngleUnits));
 }
 
 /* ***************************************************************************** */
@@ -485,7 +472,7 @@ double
 UnitData::GetInternalDistance(double inputDistance)
 {
     return(SimpleMath::ConvertDistance(inputDistance,
-                                       inputDistanceUnits_s, internalDistanceUnits_s));
+                                       GetState().inputDistanceUnits, GetState().internalDistanceUnits));
 }
 
 /* ***************************************************************************** */
@@ -493,8 +480,8 @@ UnitData::GetInternalDistance(double inputDistance)
 int
 UnitData::GetInternalTimeIndex(double inputTimeInstant)
 {
-    return((int)TimePiece::ConvertTime(inputTimeInstant, inputTimeUnits_s,
-                                       internalTimeUnits_s) - 1);
+    return((int)TimePiece::ConvertTime(inputTimeInstant, GetState().inputTimeUnits,
+                                       GetState().internalTimeUnits) - 1);
 }
 
 /* ***************************************************************************** */
@@ -502,8 +489,8 @@ UnitData::GetInternalTimeIndex(double inputTimeInstant)
 int
 UnitData::GetInternalTimeDuration(double inputDuration)
 {
-    return((int)TimePiece::ConvertTime(inputDuration, inputTimeUnits_s,
-                                       internalTimeUnits_s));
+    return((int)TimePiece::ConvertTime(inputDuration, GetState().inputTimeUnits,
+                                       GetState().internalTimeUnits));
 }
 
 /* ***************************************************************************** */
@@ -511,7 +498,7 @@ UnitData::GetInternalTimeDuration(double inputDuration)
 double
 UnitData::GetStoreQuarterCircle()
 {
-    return(SimpleMath::ConvertAngle(HALF_PI, RADIANS, internalAngleUnits_s));
+    return(SimpleMath::ConvertAngle(HALF_PI, RADIANS, GetState().internalAngleUnits));
 }
 
 /* ***************************************************************************** */
@@ -519,7 +506,7 @@ UnitData::GetStoreQuarterCircle()
 double
 UnitData::GetStoreHalfCircle()
 {
-    return(SimpleMath::ConvertAngle(PI, RADIANS, internalAngleUnits_s));
+    return(SimpleMath::ConvertAngle(PI, RADIANS, GetState().internalAngleUnits));
 }
 
 /* ***************************************************************************** */
@@ -527,9 +514,19 @@ UnitData::GetStoreHalfCircle()
 double
 UnitData::GetStoreFullCircle()
 {
-    return(SimpleMath::ConvertAngle(TWO_PI, RADIANS, internalAngleUnits_s));
+    return(SimpleMath::ConvertAngle(TWO_PI, RADIANS, GetState().internalAngleUnits));
 }
 
+UnitData::State*
+UnitData::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
+/* ***************************************************************************** */
+
 /* ***************************************************************************** */
 
 UnitData::~UnitData()
@@ -42,6 +42,36 @@ class UnitData
 {
 public:
 
+    /**
+     * The input, output and internal units of a scenario.  Each ScenarioContext
+     *  holds its own, threads with no context bound share the process wide default.
+     */
+    struct State {
+        REFERENCE_FRAME inputReferenceFrame = EARTH_CENTER_FIXED;
+        ANGLE_UNIT      inputAngleUnits = RADIANS;
+        DISTANCE_UNIT   inputDistanceUnits = METERS;
+        TIME_UNIT       inputTimeUnits = TIME_STEPS;
+
+        REFERENCE_FRAME outputReferenceFrame = EARTH_CENTER_FIXED;
+        ANGLE_UNIT      outputAngleUnits = RADIANS;
+        DISTANCE_UNIT   outputDistanceUnits = METERS;
+        TIME_UNIT       outputTimeUnits = TIME_STEPS;
+
+        ANGLE_UNIT      internalAngleUnits = RADIANS;
+        DISTANCE_UNIT   internalDistanceUnits = METERS;
+        REFERENCE_FRAME internalReferenceFrame = EARTH_CENTER_FIXED;
+        TIME_UNIT       internalTimeUnits = TIME_STEPS;
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     /**
      * Default Constructor
      */
@@ -432,22 +462,19 @@ private:
 
 
 
-    static REFERENCE_FRAME inputReferenceFrame_s;
-    static ANGLE_UNIT      inputAngleUnits_s;
-    static DISTANCE_UNIT   inputDistanceUnits_s;
-    static TIME_UNIT       inputTimeUnits_s;
+    static inline State& GetState();
 
-    static REFERENCE_FRAME outputReferenceFrame_s;
-    static ANGLE_UNIT      outputAngleUnits_s;
-    static DISTANCE_UNIT   outputDistanceUnits_s;
-    static TIME_UNIT       outputTimeUnits_s;
-
-    static ANGLE_UNIT      internalAngleUnits_s;
-    static DISTANCE_UNIT   internalDistanceUnits_s;
-    static REFERENCE_FRAME internalReferenceFrame_s;
-    static TIME_UNIT       internalTimeUnits_s;
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
 };
 
+inline
+UnitData::State&
+UnitData::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
+}
+
 //CPPCHECK_RELATED
 //Removed GetClassName() since it wasn't called in code base
 /*
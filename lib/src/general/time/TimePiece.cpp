@@ -26,18 +26,12 @@
 #include "TimePiece.h"
 #include "general/data/InputData.h"
 #include "general/data/InputDataElement.h"
+#include "general/utility/ReportWriter.h"
 //#include "general/array/ListIterator.h"
 
-int        TimePiece::secondsPerTimeStep_s = 0;
-int         TimePiece::numberOfTimeSteps_s = 0;
-int         TimePiece::dayBoundaryStartTimeSteps_s = -1;
-int         TimePiece::dayBoundaryEndTimeSteps_s = -1;
-int         TimePiece::systemStartSeconds_s = 0;
 const double TimePiece::OF_START_IN_J2000_TIME_s = -883656000.00;
-shared_ptr<Array<int>> TimePiece::ptrLeapSecondsArray_s = NULL;
-shared_ptr<string>      TimePiece::ptrLeapSecondFileName_s = NULL;
-shared_ptr<Calendar>    TimePiece::ptrSimulationStart_s = NULL;
-shared_ptr<Calendar>    TimePiece::ptrSimulationEnd_s = NULL;
+TimePiece::State               TimePiece::defaultState_s;
+thread_local TimePiece::State *TimePiece::ptrBoundState_s = NULL;
 
 //------------------------------------------------------------------------------
 //
@@ -89,33 +83,33 @@ TimePiece::PrintAttributes(ostream &outfile)
     const TIME_UNIT inputTimeUnits = UnitData::GetInputTimeUnits();
     outfile << "<TIME_PIECE_START>" << NEW_LINE;
 
-    if (ptrSimulationStart_s != NULL) {
+    if (GetState().ptrSimulationStart != NULL) {
         outfile << "   Start Date                : ";
-        outfile << ptrSimulationStart_s->GetDateDisplay() << NEW_LINE;
+        outfile << GetState().ptrSimulationStart->GetDateDisplay() << NEW_LINE;
         outfile << "   Start Time                : ";
-        outfile << ptrSimulationStart_s->GetTimeDisplay() << NEW_LINE;
+        outfile << GetState().ptrSimulationStart->GetTimeDisplay() << NEW_LINE;
     }
 
-    if (ptrSimulationEnd_s != NULL) {
+    if (GetState().ptrSimulationEnd != NULL) {
         outfile << "   End Date                  : ";
-        outfile << ptrSimulationEnd_s->GetDateDisplay() << NEW_LINE;
+        outfile << GetState().ptrSimulationEnd->GetDateDisplay() << NEW_LINE;
         outfile << "   End Time                  : ";
-        outfile << ptrSimulationEnd_s->GetTimeDisplay() << NEW_LINE;
+        outfile << GetState().ptrSimulationEnd->GetTimeDisplay() << NEW_LINE;
     }
 
-    outfile << "   Seconds Per Time Step     : " << secondsPerTimeStep_s << NEW_LINE;
+    outfile << "   Seconds Per Time Step     : " << GetState().secondsPerTimeStep << NEW_LINE;
     outfile.unsetf(ios::right);
     outfile.setf(ios::left);
     outfile << "   Day Boundary Offset Start : ";
-    PrintDuration(outfile, dayBoundaryStartTimeSteps_s, inputTimeUnits);
+    PrintDuration(outfile, GetState().dayBoundaryStartTimeSteps, inputTimeUnits);
     outfile << NEW_LINE;
     outfile << "   Day Boundary Offset End   : ";
-    PrintDuration(outfile, dayBoundaryEndTimeSteps_s, inputTimeUnits);
+    PrintDuration(outfile, GetState().dayBoundaryEndTimeSteps, inputTimeUnits);
     outfile << NEW_LINE;
 
-    if (ptrLeapSecondFileName_s != NULL) {
+    if (GetState().ptrLeapSecondFileName != NULL) {
         outfile << "   Leap Second File Name     : ";
-        outfile << *ptrLeapSecondFileName_s << NEW_LINE;
+        outfile << *GetState().ptrLeapSecondFileName << NEW_LINE;
     }
 
     outfile.unsetf(ios::left);
@@ -128,7 +122,7 @@ void
 TimePiece::SetSystemStartTime()
 {
     try {
-        systemStartSeconds_s = GetCurrentSystemSeconds();
+        GetState().systemStartSeconds = GetCurrentSystemSeconds();
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "SetSystemStartTime()");
         throw;
@@ -137,6 +131,37 @@ TimePiece::SetSystemStartTime()
     return;
 }
 
+void
+TimePiece::BuildTimeStepTable()
+{
+    State                             &state = GetState();
+    shared_ptr<vector<TimeStepEntry>>  ptrTimeStepTable(new vector<TimeStepEntry>(state.numberOfTimeSteps));
+    int                                indexTime = 0;
+
+    try {
+        while (indexTime < state.numberOfTimeSteps) {
+            TimeStepEntry &entry = (*ptrTimeStepTable)[indexTime];
+            entry.j2000Time = GetJ2000Time(indexTime);
+            entry.calendar = Calendar(entry.j2000Time);
+            entry.dateDisplay = entry.calendar.GetDateDisplay();
+            entry.timeDisplay = entry.calendar.GetTimeDisplay();
+            entry.dateAndTimeDisplay = entry.calendar.GetDateAndTimeDisplay();
+
+            if (state.ptrLeapSecondsArray != NULL) {
+                entry.ofTime = ConvertJ2000ToOF(entry.j2000Time);
+            }
+
+            ++indexTime;
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "BuildTimeStepTable()");
+        throw;
+    }
+
+    state.ptrTimeStepTable = ptrTimeStepTable;
+    return;
+}
+
 
 
 const int
@@ -163,61 +188,64 @@ TimePiece::ConvertTime(double inputTime,
                        const TIME_UNIT &fromUnits,
                        const TIME_UNIT &toUnits)
 {
-    double returnTime = (double)inputTime;
+    const State &state = GetState();
+    // J2000 time of time step zero, one step before the simulation start
+    const double j2000Offset = state.startJ2000Time - (double)state.secondsPerTimeStep;
+    double       returnTime = (double)inputTime;
 
     if (fromUnits != toUnits) {
         if (fromUnits == TIME_STEPS) {
             if (toUnits == MINUTES) {
-                returnTime *= ((double)secondsPerTimeStep_s * MINUTES_PER_SECOND);
+                returnTime *= ((double)state.secondsPerTimeStep * MINUTES_PER_SECOND);
             } else if (toUnits == HOURS) {
-                returnTime *= ((double)secondsPerTimeStep_s * HOURS_PER_SECOND);
+                returnTime *= ((double)state.secondsPerTimeStep * HOURS_PER_SECOND);
             } else {
-                returnTime *= (double)secondsPerTimeStep_s;
+                returnTime *= (double)state.secondsPerTimeStep;
 
                 if (toUnits == J2000) {
-                    returnTime += (ptrSimulationStart_s->GetJ2000Time() - (double)secondsPerTimeStep_s);
+                    returnTime += j2000Offset;
                 }
             }
         } else if (fromUnits == MINUTES) {
             if (toUnits == TIME_STEPS) {
-                returnTime *= (SECONDS_PER_MINUTE / (double)secondsPerTimeStep_s);
+                returnTime *= (SECONDS_PER_MINUTE / (double)state.secondsPerTimeStep);
             } else if (toUnits == HOURS) {
                 returnTime *= HOURS_PER_MINUTE;
             } else {
                 returnTime *= SECONDS_PER_MINUTE;
 
                 if (toUnits == J2000) {
-                    returnTime += (ptrSimulationStart_s->GetJ2000Time() - (double)secondsPerTimeStep_s);
+                    returnTime += j2000Offset;
                 }
             }
         } else if (fromUnits == HOURS) {
             if (toUnits == TIME_STEPS) {
-                returnTime *= (SECONDS_PER_HOUR / (double)secondsPerTimeStep_s);
+                returnTime *= (SECONDS_PER_HOUR / (double)state.secondsPerTimeStep);
             } else if (toUnits == MINUTES) {
                 returnTime *= MINUTES_PER_HOUR;
             } else {
                 returnTime *= SECONDS_PER_HOUR;
 
                 if (toUnits == J2000) {
-                    returnTime += (ptrSimulationStart_s->GetJ2000Time() - (double)secondsPerTimeStep_s);
+                    returnTime += j2000Offset;
                 }
             }
         } else if (fromUnits == SECONDS) {
             if (toUnits == TIME_STEPS) {
-                returnTime /= (double)secondsPerTimeStep_s;
+                returnTime /= (double)state.secondsPerTimeStep;
             } else if (toUnits == MINUTES) {
                 returnTime *= MINUTES_PER_SECOND;
             } else if (toUnits == HOURS) {
                 returnTime *= HOURS_PER_SECOND;
             } else {
-                returnTime += (ptrSimulationStart_s->GetJ2000Time() - (double)secondsPerTimeStep_s);
+                returnTime += j2000Offset;
             }
         } else if (fromUnits == J2000) {
             // first convert to seconds
-            returnTime -= (ptrSimulationStart_s->GetJ2000Time() - (double)secondsPerTimeStep_s);
+            returnTime -= j2000Offset;
 
             if (toUnits == TIME_STEPS) {
-                returnTime /= (double)secondsPerTimeStep_s;
+                returnTime /= (double)state.secondsPerTimeStep;
             } else if (toUnits == MINUTES) {
                 returnTime *= MINUTES_PER_SECOND;
             } else if (toUnits == HOURS) {
@@ -250,13 +278,13 @@ TimePiece::ConvertToStoreTimeIndex(double inputTimeInstant,
 const double
 TimePiece::GetStartTime(TIME_UNIT toUnits)
 {
-    return(ConvertTime(ptrSimulationStart_s->GetJ2000Time(), J2000, toUnits));
+    return(ConvertTime(GetState().startJ2000Time, J2000, toUnits));
 }
 
 const double
 TimePiece::GetEndTime(TIME_UNIT toUnits)
 {
-    return(ConvertTime(ptrSimulationEnd_s->GetJ2000Time(), J2000, toUnits));
+    return(ConvertTime(GetState().ptrSimulationEnd->GetJ2000Time(), J2000, toUnits));
 }
 
 void
@@ -270,6 +298,17 @@ TimePiece::PrintIndex(ostream &outfile,
     return;
 }
 
+void
+TimePiece::PrintIndex(ReportWriter &writer,
+                      int storeTimeIndex,
+                      TIME_UNIT printUnits)
+{
+    const double printTime = ConvertTime((double)(storeTimeIndex + 1),
+                                         UnitData::GetInternalTimeUnits(), printUnits);
+    PrintTime(writer, printTime, printUnits);
+    return;
+}
+
 void
 TimePiece::PrintDuration(ostream &outfile,
                          int storeTimeDuration,
@@ -302,12 +341,12 @@ TimePiece::PrintPreciseTime(ostream &outfile,
 	int precision = 2;
 
 	if (printUnits == MINUTES) {
-		if ((secondsPerTimeStep_s % (int)SECONDS_PER_MINUTE) != 0) {
+		if ((GetState().secondsPerTimeStep % (int)SECONDS_PER_MINUTE) != 0) {
 			precision = 2;
 		}
 	}
 	else if (printUnits == HOURS) {
-		if ((secondsPerTimeStep_s % (int)SECONDS_PER_HOUR) != 0) {
+		if ((GetState().secondsPerTimeStep % (int)SECONDS_PER_HOUR) != 0) {
 			precision = 4;
 		}
 	}
@@ -327,76 +366,116 @@ TimePiece::PrintTime(ostream &outfile,
 {
     int width = 7;
     int precision = 0;
+    DeterminePrintFormat(printUnits, width, precision);
+
+    if (precision == 0) {
+        outfile << setw(width) << (int)printTime;
+    } else {
+        outfile << setw(width) << setprecision(precision) << printTime;
+    }
+
+    return;
+}
+
+void
+TimePiece::PrintTime(ReportWriter &writer,
+                     double printTime,
+                     const TIME_UNIT &printUnits)
+{
+    int width = 7;
+    int precision = 0;
+    DeterminePrintFormat(printUnits, width, precision);
+
+    if (precision == 0) {
+        writer.WriteInt((int)printTime, width);
+    } else {
+        writer.WriteFixed(printTime, width, precision);
+    }
+
+    return;
+}
+
+void
+TimePiece::DeterminePrintFormat(const TIME_UNIT &printUnits,
+                                int &width,
+                                int &precision)
+{
+    width = 7;
+    precision = 0;
 
     if (printUnits == MINUTES) {
-        if ((secondsPerTimeStep_s % (int)SECONDS_PER_MINUTE) != 0) {
+        if ((GetState().secondsPerTimeStep % (int)SECONDS_PER_MINUTE) != 0) {
             precision = 2;
         }
     } else if (printUnits == HOURS) {
-        if ((secondsPerTimeStep_s % (int)SECONDS_PER_HOUR) != 0) {
+        if ((GetState().secondsPerTimeStep % (int)SECONDS_PER_HOUR) != 0) {
             precision = 4;
         }
     } else if (printUnits == SECONDS) {
         width = 11;
     }
 
-    if (precision == 0) {
-        outfile << setw(width) << (int)printTime;
-    } else {
-        outfile << setw(width) << setprecision(precision) << printTime;
-    }
-
     return;
 }
 
 const double
 TimePiece::ConvertOFToJ2000(double OFTime)
 {
-    int   leapSecondIndex = 0;
-    double returnJ2000Time = OFTime + OF_START_IN_J2000_TIME_s;
-    bool   foundAllLeapSeconds = false;
+    const Array<int> *ptrLeapSecondsArray = GetState().ptrLeapSecondsArray.get();
+    const int         ofSeconds = (int)OFTime;
+    int               lowIndex = 0;
+    int               highIndex = 0;
 
-    if (ptrLeapSecondsArray_s == NULL) {
+    if (ptrLeapSecondsArray == NULL) {
         throw new InputException(GetClassName(), "ConvertOFToJ2000(const double&)",
                                  "Must input Leap Second File for OF time conversions");
     }
 
-    while ( (leapSecondIndex < ptrLeapSecondsArray_s->Size()) &&
-            (foundAllLeapSeconds == false) ) {
-        if ((int)OFTime < ptrLeapSecondsArray_s->ElementAt(leapSecondIndex)) {
-            foundAllLeapSeconds = true;
+    // binary search for the number of leap seconds at or before the OF time
+    highIndex = ptrLeapSecondsArray->Size();
+
+    while (lowIndex < highIndex) {
+        const int middleIndex = (lowIndex + highIndex) / 2;
+
+        if (ofSeconds < ptrLeapSecondsArray->ElementAt(middleIndex)) {
+            highIndex = middleIndex;
         } else {
-            ++leapSecondIndex;
-            returnJ2000Time -= 1.0;
+            lowIndex = middleIndex + 1;
         }
     }
 
-    return(returnJ2000Time);
+    return((OFTime + OF_START_IN_J2000_TIME_s) - (double)lowIndex);
 }
 
 const double
 TimePiece::ConvertJ2000ToOF(double j2000Time)
 {
-    int   leapSecondIndex = 0;
-    double returnOFTime = j2000Time - OF_START_IN_J2000_TIME_s;
-    bool   foundAllLeapSeconds = false;
+    const Array<int> *ptrLeapSecondsArray = GetState().ptrLeapSecondsArray.get();
+    const double      baseOFTime = j2000Time - OF_START_IN_J2000_TIME_s;
+    int               lowIndex = 0;
+    int               highIndex = 0;
 
-    if (ptrLeapSecondsArray_s == NULL) {
+    if (ptrLeapSecondsArray == NULL) {
         throw new InputException(GetClassName(), "ConvertOFToJ2000(const double&)",
                                  "Must input Leap Second File for OF time conversions");
     }
 
-    while ( (leapSecondIndex < ptrLeapSecondsArray_s->Size()) &&
-            (foundAllLeapSeconds == false) ) {
-        if ((int)returnOFTime < ptrLeapSecondsArray_s->ElementAt(leapSecondIndex)) {
-            foundAllLeapSeconds = true;
+    // each leap second passed moves the OF time one second later, so search
+    // for the first leap second still after the shifted time (the leap
+    // seconds are strictly increasing, see SetLeapSecondArray)
+    highIndex = ptrLeapSecondsArray->Size();
+
+    while (lowIndex < highIndex) {
+        const int middleIndex = (lowIndex + highIndex) / 2;
+
+        if ((int)(baseOFTime + (double)middleIndex) < ptrLeapSecondsArray->ElementAt(middleIndex)) {
+            highIndex = middleIndex;
         } else {
-            ++leapSecondIndex;
-            returnOFTime += 1.0;
+            lowIndex = middleIndex + 1;
         }
     }
 
-    return(returnOFTime);
+    return(baseOFTime + (double)lowIndex);
 }
 
 /* ***************************************************************************** */
@@ -404,7 +483,9 @@ TimePiece::ConvertJ2000ToOF(double j2000Time)
 void
 TimePiece::SetSimStartCalendar(Calendar *startCalendar)
 {
-    ptrSimulationStart_s = shared_ptr<Calendar>(startCalendar);
+    GetState().ptrSimulationStart = shared_ptr<Calendar>(startCalendar);
+    GetState().startJ2000Time = (startCalendar != NULL) ? startCalendar->GetJ2000Time() : 0.0;
+    GetState().ptrTimeStepTable = NULL;
 }
 
 /* ***************************************************************************** */
@@ -412,7 +493,7 @@ TimePiece::SetSimStartCalendar(Calendar *startCalendar)
 void
 TimePiece::SetSimEndCalendar(Calendar *endCalendar)
 {
-    ptrSimulationEnd_s =  shared_ptr<Calendar>(endCalendar);
+    GetState().ptrSimulationEnd =  shared_ptr<Calendar>(endCalendar);
 }
 
 /* ***************************************************************************** */
@@ -420,7 +501,8 @@ TimePiece::SetSimEndCalendar(Calendar *endCalendar)
 void
 TimePiece::SetSecondsPerTimeStep(int secondsPerTimestep)
 {
-    secondsPerTimeStep_s = secondsPerTimestep;
+    GetState().secondsPerTimeStep = secondsPerTimestep;
+    GetState().ptrTimeStepTable = NULL;
 }
 
 /* ***************************************************************************** */
@@ -428,7 +510,8 @@ TimePiece::SetSecondsPerTimeStep(int secondsPerTimestep)
 void
 TimePiece::SetNumberOfTimesteps(int numberOfTimesteps)
 {
-    numberOfTimeSteps_s = numberOfTimesteps;
+    GetState().numberOfTimeSteps = numberOfTimesteps;
+    GetState().ptrTimeStepTable = NULL;
 }
 
 /* ***************************************************************************** */
@@ -436,7 +519,7 @@ TimePiece::SetNumberOfTimesteps(int numberOfTimesteps)
 void
 TimePiece::SetDayBoundaryStart(int dayBoundaryStart)
 {
-    dayBoundaryStartTimeSteps_s = dayBoundaryStart;
+    GetState().dayBoundaryStartTimeSteps = dayBoundaryStart;
 }
 
 /* ***************************************************************************** */
@@ -444,7 +527,7 @@ TimePiece::SetDayBoundaryStart(int dayBoundaryStart)
 void
 TimePiece::SetDayBoundaryEnd(int dayBoundaryEnd)
 {
-    dayBoundaryEndTimeSteps_s = dayBoundaryEnd;
+    GetState().dayBoundaryEndTimeSteps = dayBoundaryEnd;
 }
 
 /* ***************************************************************************** */
@@ -452,7 +535,21 @@ TimePiece::SetDayBoundaryEnd(int dayBoundaryEnd)
 void
 TimePiece::SetLeapSecondArray(Array<int>* leapSecondArray)
 {
-    ptrLeapSecondsArray_s =  shared_ptr<Array<int>>(leapSecondArray);
+    int leapSecondIndex = 1;
+
+    // the OF conversions binary search the leap seconds
+    while ((leapSecondArray != NULL) && (leapSecondIndex < leapSecondArray->Size())) {
+        if (leapSecondArray->ElementAt(leapSecondIndex) <= leapSecondArray->ElementAt(leapSecondIndex - 1)) {
+            delete leapSecondArray;
+            throw new InputException(GetClassName(), "SetLeapSecondArray(Array<int>*)",
+                                     "Leap seconds must be in chronological order");
+        }
+
+        ++leapSecondIndex;
+    }
+
+    GetState().ptrLeapSecondsArray =  shared_ptr<Array<int>>(leapSecondArray);
+    GetState().ptrTimeStepTable = NULL;
 }
 
 /* ***************************************************************************** */
@@ -460,7 +557,7 @@ TimePiece::SetLeapSecondArray(Array<int>* leapSecondArray)
 void
 TimePiece::SetLeapSecondFileName(string* leapSecondFileName)
 {
-    ptrLeapSecondFileName_s = shared_ptr<string>( leapSecondFileName);
+    GetState().ptrLeapSecondFileName = shared_ptr<string>( leapSecondFileName);
 }
 
 /* ***************************************************************************** */
@@ -468,7 +565,7 @@ TimePiece::SetLeapSecondFileName(string* leapSecondFileName)
 const int
 TimePiece::GetSecondsPerTimeStep()
 {
-    return(secondsPerTimeStep_s);
+    return(GetState().secondsPerTimeStep);
 }
 
 /* ***************************************************************************** */
@@ -476,7 +573,7 @@ TimePiece::GetSecondsPerTimeStep()
 const int
 TimePiece::GetStartYear()
 {
-    return(ptrSimulationStart_s->GetYear());
+    return(GetState().ptrSimulationStart->GetYear());
 }
 
 /* ***************************************************************************** */
@@ -484,7 +581,7 @@ TimePiece::GetStartYear()
 const int
 TimePiece::GetStartMonth()
 {
-    return(ptrSimulationStart_s->GetMonth());
+    return(GetState().ptrSimulationStart->GetMonth());
 }
 
 /* ***************************************************************************** */
@@ -492,7 +589,7 @@ TimePiece::GetStartMonth()
 const int
 TimePiece::GetStartDay()
 {
-    return(ptrSimulationStart_s->GetDay());
+    return(GetState().ptrSimulationStart->GetDay());
 }
 
 /* ***************************************************************************** */
@@ -500,7 +597,7 @@ TimePiece::GetStartDay()
 const int
 TimePiece::GetEndYear()
 {
-    return(ptrSimulationEnd_s->GetYear());
+    return(GetState().ptrSimulationEnd->GetYear());
 }
 
 /* ***************************************************************************** */
@@ -508,7 +605,7 @@ TimePiece::GetEndYear()
 const int
 TimePiece::GetEndMonth()
 {
-    return(ptrSimulationEnd_s->GetMonth());
+    return(GetState().ptrSimulationEnd->GetMonth());
 }
 
 /* ***************************************************************************** */
@@ -516,7 +613,7 @@ TimePiece::GetEndMonth()
 const int
 TimePiece::GetEndDay()
 {
-    return(ptrSimulationEnd_s->GetDay());
+    return(GetState().ptrSimulationEnd->GetDay());
 }
 
 /* ***************************************************************************** */
@@ -524,7 +621,7 @@ TimePiece::GetEndDay()
 const int
 TimePiece::GetNumberOfTimeSteps()
 {
-    return(numberOfTimeSteps_s);
+    return(GetState().numberOfTimeSteps);
 }
 
 /* ***************************************************************************** */
@@ -532,7 +629,7 @@ TimePiece::GetNumberOfTimeSteps()
 const int
 TimePiece::GetReportStartIndexTime()
 {
-    return(dayBoundaryStartTimeSteps_s);
+    return(GetState().dayBoundaryStartTimeSteps);
 }
 
 /* ***************************************************************************** */
@@ -540,7 +637,7 @@ TimePiece::GetReportStartIndexTime()
 const int
 TimePiece::GetReportEndIndexTime()
 {
-    return(GetEndIndexTime() - dayBoundaryEndTimeSteps_s);
+    return(GetEndIndexTime() - GetState().dayBoundaryEndTimeSteps);
 }
 
 /* ***************************************************************************** */
@@ -556,8 +653,8 @@ TimePiece::GetReportableTimeSteps()
 const double
 TimePiece::GetJ2000Time(int indexTime)
 {
-    return(ptrSimulationStart_s->GetJ2000Time()
-           + (double)(indexTime * secondsPerTimeStep_s));
+    return(GetState().startJ2000Time
+           + (double)(indexTime * GetState().secondsPerTimeStep));
 }
 
 /* ***************************************************************************** */
@@ -565,8 +662,16 @@ TimePiece::GetJ2000Time(int indexTime)
 const double
 TimePiece::GetOFTime(int indexTime)
 {
-    const double j2000Time = GetJ2000Time(indexTime);
-    return(ConvertJ2000ToOF(j2000Time));
+    const TimeStepEntry *ptrEntry = FindTimeStepEntry(indexTime);
+    double               ofTime = 0.0;
+
+    if ((ptrEntry != NULL) && (GetState().ptrLeapSecondsArray != NULL)) {
+        ofTime = ptrEntry->ofTime;
+    } else {
+        ofTime = ConvertJ2000ToOF(GetJ2000Time(indexTime));
+    }
+
+    return(ofTime);
 }
 
 /* ***************************************************************************** */
@@ -574,7 +679,7 @@ TimePiece::GetOFTime(int indexTime)
 const Calendar
 TimePiece::GetStartCalendar()
 {
-    return(*ptrSimulationStart_s);
+    return(*GetState().ptrSimulationStart);
 }
 
 /* ***************************************************************************** */
@@ -582,7 +687,7 @@ TimePiece::GetStartCalendar()
 const Calendar
 TimePiece::GetEndCalendar()
 {
-    return(*ptrSimulationEnd_s);
+    return(*GetState().ptrSimulationEnd);
 }
 
 /* ***************************************************************************** */
@@ -590,8 +695,14 @@ TimePiece::GetEndCalendar()
 const Calendar
 TimePiece::GetCalendar(int indexTime)
 {
-    return(ptrSimulationStart_s->GetJ2000Time()
-           + ((double)indexTime * secondsPerTimeStep_s));
+    const TimeStepEntry *ptrEntry = FindTimeStepEntry(indexTime);
+
+    if (ptrEntry != NULL) {
+        return(ptrEntry->calendar);
+    }
+
+    return(GetState().startJ2000Time
+           + ((double)indexTime * GetState().secondsPerTimeStep));
 }
 
 /* ***************************************************************************** */
@@ -615,7 +726,7 @@ TimePiece::GetStartIndexTime()
 const int
 TimePiece::GetEndIndexTime()
 {
-    return(numberOfTimeSteps_s - 1);
+    return(GetState().numberOfTimeSteps - 1);
 }
 
 /* ***************************************************************************** */
@@ -625,13 +736,13 @@ TimePiece::GetIndexTime(double j2000Seconds)
 {
     int returnTimeStep = 0;
 
-    if ( (j2000Seconds < ptrSimulationStart_s->GetJ2000Time())
-            || (j2000Seconds > ptrSimulationEnd_s->GetJ2000Time()) ) {
+    if ( (j2000Seconds < GetState().startJ2000Time)
+            || (j2000Seconds > GetState().ptrSimulationEnd->GetJ2000Time()) ) {
         throw new TimeException(GetClassName(), "GetIndexTime(const double&)");
     }
 
-    returnTimeStep = (int)((j2000Seconds - ptrSimulationStart_s->GetJ2000Time())
-                           / secondsPerTimeStep_s);
+    returnTimeStep = (int)((j2000Seconds - GetState().startJ2000Time)
+                           / GetState().secondsPerTimeStep);
     return(returnTimeStep);
 }
 
@@ -648,7 +759,7 @@ TimePiece::GetIndexTime(Calendar currentCalendar)
 const string
 TimePiece::GetStartClockTime()
 {
-    return(ptrSimulationStart_s->GetTimeDisplay());
+    return(GetState().ptrSimulationStart->GetTimeDisplay());
 }
 
 /* ***************************************************************************** */
@@ -657,6 +768,12 @@ const string
 TimePiece::GetClockTime(int indexTime,
                         double additionalSeconds)
 {
+    const TimeStepEntry *ptrEntry = FindTimeStepEntry(indexTime);
+
+    if ((ptrEntry != NULL) && (additionalSeconds == 0.0)) {
+        return(ptrEntry->timeDisplay);
+    }
+
     Calendar calendar(GetJ2000Time(indexTime) + additionalSeconds);
     return(calendar.GetTimeDisplay());
 }
@@ -666,7 +783,7 @@ TimePiece::GetClockTime(int indexTime,
 const string
 TimePiece::GetStartDate()
 {
-    return(ptrSimulationStart_s->GetDateDisplay());
+    return(GetState().ptrSimulationStart->GetDateDisplay());
 }
 
 /* ***************************************************************************** */
@@ -675,6 +792,12 @@ const string
 TimePiece::GetDate(int indexTime,
                    double additionalSeconds)
 {
+    const TimeStepEntry *ptrEntry = FindTimeStepEntry(indexTime);
+
+    if ((ptrEntry != NULL) && (additionalSeconds == 0.0)) {
+        return(ptrEntry->dateDisplay);
+    }
+
     Calendar calendar = Calendar(GetJ2000Time(indexTime) + additionalSeconds);
     return(calendar.GetDateDisplay());
 }
@@ -685,6 +808,12 @@ const string
 TimePiece::GetClockTimeAndDate(int indexTime,
                                double additionalSeconds)
 {
+    const TimeStepEntry *ptrEntry = FindTimeStepEntry(indexTime);
+
+    if ((ptrEntry != NULL) && (additionalSeconds == 0.0)) {
+        return(ptrEntry->dateAndTimeDisplay);
+    }
+
     Calendar calendar = Calendar(GetJ2000Time(indexTime) + additionalSeconds);
     return(calendar.GetDateAndTimeDisplay());
 }
@@ -702,7 +831,7 @@ TimePiece::GetSystemCurrentTime()
 const string
 TimePiece::GetSystemStartTime()
 {
-    return(GetSystemTime(systemStartSeconds_s));
+    return(GetSystemTime(GetState().systemStartSeconds));
 }
 
 /* ***************************************************************************** */
@@ -710,10 +839,18 @@ TimePiece::GetSystemStartTime()
 const int
 TimePiece::GetSystemDuration()
 {
-    double duration = (double)(GetCurrentSystemSeconds() - systemStartSeconds_s + 30);
+    double duration = (double)(GetCurrentSystemSeconds() - GetState().systemStartSeconds + 30);
     return((int)(duration * MINUTES_PER_SECOND));
 }
 
+TimePiece::State*
+TimePiece::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 TimePiece::~TimePiece()
 {
     return;
@@ -25,16 +25,23 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "Calendar.h"
 #include "general/exception/TimeException.h"
 #include "general/data/UnitData.h"
 
 class InputDataElement;
+class ReportWriter;
 
 /**
  * MURAL's time class
  *
+ * Once the time period is set, BuildTimeStepTable precomputes the J2000 and
+ * OF times, calendar and display strings of every time index so the per
+ * index accessors (GetCalendar, GetClockTimeAndDate, GetOFTime, ...) are
+ * table lookups.  Times between time steps are still computed on demand.
+ *
  * @author Rob Lowry
  * @author Brian Fowler
  * @date 08/16/11
@@ -43,6 +50,48 @@ class TimePiece
 {
 public:
 
+    /**
+     * The times of one time index (see BuildTimeStepTable), the OF time is
+     *  only set when leap seconds were given
+     */
+    struct TimeStepEntry {
+        double   j2000Time = 0.0;
+        double   ofTime = 0.0;
+        Calendar calendar;
+        string   dateDisplay;
+        string   timeDisplay;
+        string   dateAndTimeDisplay;
+    };
+
+    /**
+     * The time period of a scenario.  Each ScenarioContext holds its own,
+     *  threads with no context bound share the process wide default.
+     */
+    struct State {
+        int                    secondsPerTimeStep = 0;
+        int                    numberOfTimeSteps = 0;
+        int                    dayBoundaryStartTimeSteps = -1;
+        int                    dayBoundaryEndTimeSteps = -1;
+        int                    systemStartSeconds = 0;
+        shared_ptr<string>     ptrLeapSecondFileName;
+        shared_ptr<Array<int>> ptrLeapSecondsArray;
+        shared_ptr<Calendar>   ptrSimulationStart;
+        shared_ptr<Calendar>   ptrSimulationEnd;
+        // J2000 time of the simulation start (sec)
+        double                 startJ2000Time = 0.0;
+        // times of every time index, NULL until BuildTimeStepTable
+        shared_ptr<vector<TimeStepEntry>> ptrTimeStepTable;
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     /**
      *  Constructor for the TimePiece class.  Called from Method: TimePiece();
      */
@@ -57,6 +106,9 @@ public:
     static void         PrintIndex(ostream &outfile,
                                    int storeTimeIndex,
                                    TIME_UNIT printUnits = UnitData::GetOutputTimeUnits());
+    static void         PrintIndex(ReportWriter &writer,
+                                   int storeTimeIndex,
+                                   TIME_UNIT printUnits = UnitData::GetOutputTimeUnits());
     static void         PrintDuration(ostream &outfile,
                                       int storeTimeDuration,
                                       TIME_UNIT printUnits = UnitData::GetOutputTimeUnits());
@@ -66,6 +118,13 @@ public:
 									TIME_UNIT printUnits = UnitData::GetOutputTimeUnits());
     static void         SetSystemStartTime();
 
+    /**
+     * Precomputes the times of every time index.  Called once the time
+     *  period (and any leap seconds) are set; changing any of them discards
+     *  the table until it is built again.
+     */
+    static void         BuildTimeStepTable();
+
     static const double ConvertTime(double inputTime,
                                     const TIME_UNIT &fromUnits,
                                     const TIME_UNIT &toUnits);
@@ -157,9 +216,10 @@ public:
     static void SetDayBoundaryEnd(int dayBoundaryEnd);
 
     /**
-     * Sets the Leap Second Array
+     * Sets the Leap Second Array, the OF times of the leap seconds which
+     * must be in chronological order
      *
-     * @param dayBoundaryEnd day boundary end
+     * @param leapSecondArray the leap second OF times
      */
     static void SetLeapSecondArray(Array<int>* leapSecondArray);
 
@@ -177,6 +237,12 @@ private:
     static void         PrintTime(ostream &outfile,
                                   double printTime,
                                   const TIME_UNIT &printUnits);
+    static void         PrintTime(ReportWriter &writer,
+                                  double printTime,
+                                  const TIME_UNIT &printUnits);
+    static void         DeterminePrintFormat(const TIME_UNIT &printUnits,
+                                             int &width,
+                                             int &precision);
 	//RAGUSA 3/22/2019 - New method to print double precision duration output
 	static void         PrintPreciseTime(ostream &outfile,
 								  double printTime,
@@ -184,6 +250,8 @@ private:
 
     static const int   GetCurrentSystemSeconds();
 
+    static inline const TimeStepEntry* FindTimeStepEntry(int indexTime);
+
     static const string GetSystemTime(int seconds);
 
     /**
@@ -193,18 +261,36 @@ private:
      */
     static inline string GetClassName();
 
-    static int          secondsPerTimeStep_s;
-    static int          numberOfTimeSteps_s;
-    static int          dayBoundaryStartTimeSteps_s;
-    static int          dayBoundaryEndTimeSteps_s;
-    static int          systemStartSeconds_s;
+    static inline State& GetState();
+
     static const double  OF_START_IN_J2000_TIME_s;
-    static shared_ptr<string> ptrLeapSecondFileName_s;
-    static shared_ptr<Array<int>> ptrLeapSecondsArray_s;
-    static shared_ptr<Calendar> ptrSimulationStart_s;
-    static shared_ptr<Calendar> ptrSimulationEnd_s;
+
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
 };
 
+inline
+TimePiece::State&
+TimePiece::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
+}
+
+inline
+const TimePiece::TimeStepEntry*
+TimePiece::FindTimeStepEntry(int indexTime)
+{
+    const TimeStepEntry *ptrEntry = NULL;
+    const State         &state = GetState();
+
+    if ((state.ptrTimeStepTable != NULL) && (indexTime >= 0) &&
+            (indexTime < (int)state.ptrTimeStepTable->size())) {
+        ptrEntry = &((*state.ptrTimeStepTable)[indexTime]);
+    }
+
+    return(ptrEntry);
+}
+
 inline
 string
 TimePiece::GetClassName()
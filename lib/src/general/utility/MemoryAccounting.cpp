@@ -0,0 +1,251 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * MemoryAccounting.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#ifdef WIN64
+#   include <windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#   include <unistd.h>
+#endif
+
+#include "MemoryAccounting.h"
+#include "general/utility/Constant.h"
+
+atomic<size_t>                      MemoryAccounting::bytes_s[NUMBER_OF_SUBSYSTEMS];
+atomic<size_t>                      MemoryAccounting::peakBytes_s[NUMBER_OF_SUBSYSTEMS];
+atomic<size_t>                      MemoryAccounting::boundaryPeakBytes_s[NUMBER_OF_SUBSYSTEMS];
+vector<MemoryAccounting::Boundary>  MemoryAccounting::boundaryList_s;
+mutex                               MemoryAccounting::boundaryMutex_s;
+
+void
+MemoryAccounting::AddBytes(const SUBSYSTEM &subsystem,
+                           size_t numberOfBytes)
+{
+    UpdatePeakBytes(subsystem, (bytes_s[subsystem].fetch_add(numberOfBytes) + numberOfBytes));
+    return;
+}
+
+void
+MemoryAccounting::RemoveBytes(const SUBSYSTEM &subsystem,
+                              size_t numberOfBytes)
+{
+    bytes_s[subsystem].fetch_sub(numberOfBytes);
+    return;
+}
+
+void
+MemoryAccounting::SetBytes(const SUBSYSTEM &subsystem,
+                           size_t numberOfBytes)
+{
+    bytes_s[subsystem].store(numberOfBytes);
+    UpdatePeakBytes(subsystem, numberOfBytes);
+    return;
+}
+
+void
+MemoryAccounting::UpdatePeakBytes(const SUBSYSTEM &subsystem,
+                                  size_t numberOfBytes)
+{
+    size_t peakBytes = peakBytes_s[subsystem].load();
+    size_t boundaryPeakBytes = boundaryPeakBytes_s[subsystem].load();
+
+    while ((numberOfBytes > peakBytes)
+            && (peakBytes_s[subsystem].compare_exchange_weak(peakBytes, numberOfBytes) == false)) {
+        // peakBytes now holds the latest peak, try again
+    }
+
+    while ((numberOfBytes > boundaryPeakBytes)
+            && (boundaryPeakBytes_s[subsystem].compare_exchange_weak(boundaryPeakBytes, numberOfBytes) == false)) {
+        // boundaryPeakBytes now holds the latest peak, try again
+    }
+
+    return;
+}
+
+void
+MemoryAccounting::RecordBoundary(const string &boundaryName)
+{
+    Boundary boundary;
+    int      subsystemIndex = 0;
+    boundary.name = boundaryName;
+    boundary.residentBytes = GetResidentBytes();
+    boundary.peakResidentBytes = GetPeakResidentBytes();
+
+    while (subsystemIndex < NUMBER_OF_SUBSYSTEMS) {
+        // the high water mark since the last boundary, the next interval
+        // starts from what is held now
+        const size_t currentBytes = bytes_s[subsystemIndex].load();
+        boundary.bytes[subsystemIndex] = std::max(currentBytes,
+                                         boundaryPeakBytes_s[subsystemIndex].exchange(currentBytes));
+        ++subsystemIndex;
+    }
+
+    lock_guard<mutex> boundaryLock(boundaryMutex_s);
+    boundaryList_s.push_back(boundary);
+    return;
+}
+
+void
+MemoryAccounting::PrintReport(ostream &outfile,
+                              const string &ownerName)
+{
+    const double                        BYTES_PER_MEGABYTE = 1024.0 * 1024.0;
+    const ios::fmtflags                 saveFlags = outfile.flags();
+    const streamsize                    savePrecision = outfile.precision();
+    vector<Boundary>::const_iterator    boundaryIter;
+    int                                 subsystemIndex = 0;
+    lock_guard<mutex>                   boundaryLock(boundaryMutex_s);
+    outfile << ownerName << ": Memory By Module, Peak Within Each Module (MB)" << NEW_LINE;
+    outfile << ownerName << ":    " << left << setw(32) << "Module" << right;
+
+    while (subsystemIndex < NUMBER_OF_SUBSYSTEMS) {
+        outfile << setw(13) << GetSubsystemString((SUBSYSTEM)subsystemIndex);
+        ++subsystemIndex;
+    }
+
+    outfile << setw(13) << "RESIDENT" << setw(13) << "PEAK" << NEW_LINE;
+    outfile << fixed << setprecision(1);
+
+    for (boundaryIter = boundaryList_s.begin(); boundaryIter != boundaryList_s.end(); ++boundaryIter) {
+        outfile << ownerName << ":    " << left << setw(32) << boundaryIter->name << right;
+        subsystemIndex = 0;
+
+        while (subsystemIndex < NUMBER_OF_SUBSYSTEMS) {
+            outfile << setw(13) << ((double)boundaryIter->bytes[subsystemIndex] / BYTES_PER_MEGABYTE);
+            ++subsystemIndex;
+        }
+
+        outfile << setw(13) << ((double)boundaryIter->residentBytes / BYTES_PER_MEGABYTE)
+                << setw(13) << ((double)boundaryIter->peakResidentBytes / BYTES_PER_MEGABYTE) << NEW_LINE;
+    }
+
+    outfile << ownerName << ":    " << left << setw(32) << "Run Peak" << right;
+    subsystemIndex = 0;
+
+    while (subsystemIndex < NUMBER_OF_SUBSYSTEMS) {
+        outfile << setw(13) << ((double)GetPeakBytes((SUBSYSTEM)subsystemIndex) / BYTES_PER_MEGABYTE);
+        ++subsystemIndex;
+    }
+
+    outfile << setw(13) << ((double)GetResidentBytes() / BYTES_PER_MEGABYTE)
+            << setw(13) << ((double)GetPeakResidentBytes() / BYTES_PER_MEGABYTE) << NEW_LINE;
+    outfile.flags(saveFlags);
+    outfile.precision(savePrecision);
+    return;
+}
+
+void
+MemoryAccounting::Reset()
+{
+    int subsystemIndex = 0;
+
+    while (subsystemIndex < NUMBER_OF_SUBSYSTEMS) {
+        bytes_s[subsystemIndex].store(0);
+        peakBytes_s[subsystemIndex].store(0);
+        boundaryPeakBytes_s[subsystemIndex].store(0);
+        ++subsystemIndex;
+    }
+
+    lock_guard<mutex> boundaryLock(boundaryMutex_s);
+    boundaryList_s.clear();
+    return;
+}
+
+/* ***************************************************************************** */
+
+size_t
+MemoryAccounting::GetResidentBytes()
+{
+    size_t residentBytes = 0;
+#ifdef WIN64
+    PROCESS_MEMORY_COUNTERS memoryCounters;
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)) != 0) {
+        residentBytes = (size_t)memoryCounters.WorkingSetSize;
+    }
+
+#else
+    ifstream statusFile("/proc/self/statm");
+    size_t   totalPages = 0;
+    size_t   residentPages = 0;
+
+    if ((statusFile >> totalPages >> residentPages).fail() == false) {
+        residentBytes = residentPages * (size_t)sysconf(_SC_PAGESIZE);
+    }
+
+#endif
+    return(residentBytes);
+}
+
+/* ***************************************************************************** */
+
+size_t
+MemoryAccounting::GetPeakResidentBytes()
+{
+    size_t peakResidentBytes = 0;
+#ifdef WIN64
+    PROCESS_MEMORY_COUNTERS memoryCounters;
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)) != 0) {
+        peakResidentBytes = (size_t)memoryCounters.PeakWorkingSetSize;
+    }
+
+#else
+    struct rusage resourceUsage;
+
+    // ru_maxrss is reported in kilobytes
+    if (getrusage(RUSAGE_SELF, &resourceUsage) == 0) {
+        peakResidentBytes = (size_t)resourceUsage.ru_maxrss * 1024;
+    }
+
+#endif
+    return(peakResidentBytes);
+}
+
+/* ***************************************************************************** */
+
+string
+MemoryAccounting::GetSubsystemString(const SUBSYSTEM &subsystem)
+{
+    string subsystemString = "UNKNOWN";
+
+    if (subsystem == POSITIONS) {
+        subsystemString = "POSITIONS";
+    } else if (subsystem == LINKS) {
+        subsystemString = "LINKS";
+    } else if (subsystem == TIMELINES) {
+        subsystemString = "TIMELINES";
+    } else if (subsystem == REGIONS) {
+        subsystemString = "REGIONS";
+    } else if (subsystem == REQUIREMENTS) {
+        subsystemString = "REQUIREMENTS";
+    } else if (subsystem == REPORTS) {
+        subsystemString = "REPORTS";
+    }
+
+    return(subsystemString);
+}
@@ -0,0 +1,136 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * MemoryAccounting.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef MEMORY_ACCOUNTING_H
+#define MEMORY_ACCOUNTING_H "MemoryAccounting"
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * MemoryAccounting attributes memory to the subsystems of a run so the
+ *  footprint of a scenario can be broken down and planned for.  The owning
+ *  classes report their own size (e.g. Journey::GetMemoryFootprint), either
+ *  by setting a surveyed total once the owning module is done with the data
+ *  (SetBytes) or by counting allocations as they are made and released
+ *  (AddBytes/RemoveBytes).  The counters are atomic so any thread may report.
+ *
+ * RecordBoundary takes a snapshot of every subsystem along with the process
+ *  resident set (current and peak) and is meant to be called as each module
+ *  finishes.  A subsystem is sampled at its high water mark since the
+ *  previous boundary, so data counted and released inside a module (the
+ *  REPORTS buffers) still shows against it.  PrintReport lists the
+ *  snapshots in the order recorded followed by the peak of each subsystem
+ *  over the whole run.
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * bytes_s                      bytes currently attributed to each subsystem
+ * peakBytes_s                  high water mark of bytes_s for each subsystem
+ * boundaryPeakBytes_s          high water mark of bytes_s since the last boundary
+ * boundaryList_s               snapshots in the order recorded
+ * boundaryMutex_s              guards boundaryList_s
+ */
+class MemoryAccounting
+{
+public:
+
+    enum SUBSYSTEM {
+        POSITIONS = 0,
+        LINKS = 1,
+        TIMELINES = 2,
+        REGIONS = 3,
+        REQUIREMENTS = 4,
+        REPORTS = 5,
+        NUMBER_OF_SUBSYSTEMS = 6
+    };
+
+    static void   AddBytes(const SUBSYSTEM &subsystem,
+                           size_t numberOfBytes);
+    static void   RemoveBytes(const SUBSYSTEM &subsystem,
+                              size_t numberOfBytes);
+    static void   SetBytes(const SUBSYSTEM &subsystem,
+                           size_t numberOfBytes);
+    static void   RecordBoundary(const string &boundaryName);
+    static void   PrintReport(ostream &outfile,
+                              const string &ownerName);
+    static void   Reset();
+
+    static size_t GetResidentBytes();
+    static size_t GetPeakResidentBytes();
+
+    static string GetSubsystemString(const SUBSYSTEM &subsystem);
+
+    static inline size_t GetBytes(const SUBSYSTEM &subsystem);
+    static inline size_t GetPeakBytes(const SUBSYSTEM &subsystem);
+
+protected:
+
+private:
+
+    struct Boundary {
+        string name;
+        size_t bytes[NUMBER_OF_SUBSYSTEMS];
+        size_t residentBytes;
+        size_t peakResidentBytes;
+    };
+
+    static void   UpdatePeakBytes(const SUBSYSTEM &subsystem,
+                                  size_t numberOfBytes);
+
+    static inline string GetClassName();
+
+    static atomic<size_t>    bytes_s[NUMBER_OF_SUBSYSTEMS];
+    static atomic<size_t>    peakBytes_s[NUMBER_OF_SUBSYSTEMS];
+    static atomic<size_t>    boundaryPeakBytes_s[NUMBER_OF_SUBSYSTEMS];
+    static vector<Boundary>  boundaryList_s;
+    static mutex             boundaryMutex_s;
+};
+
+inline
+size_t
+MemoryAccounting::GetBytes(const SUBSYSTEM &subsystem)
+{
+    return(bytes_s[subsystem].load());
+}
+
+inline
+size_t
+MemoryAccounting::GetPeakBytes(const SUBSYSTEM &subsystem)
+{
+    return(peakBytes_s[subsystem].load());
+}
+
+inline
+string
+MemoryAccounting::GetClassName()
+{
+    return(MEMORY_ACCOUNTING_H);
+}
+
+#endif
@@ -0,0 +1,205 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * MemoryArena.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <iomanip>
+#include <new>
+
+#include "MemoryArena.h"
+#include "general/utility/Constant.h"
+
+const size_t             MemoryArena::DEFAULT_BLOCK_SIZE_s = 256 * 1024;
+const size_t             MemoryArena::ALIGNMENT_s          = 16;
+thread_local MemoryArena *MemoryArena::ptrBoundArena_s     = NULL;
+
+namespace
+{
+/**
+ * Prefix written in front of every object allocated through AllocateObject so
+ *  DeallocateObject knows whether the memory came from an arena or the heap.
+ */
+struct ObjectHeader {
+    MemoryArena *ptrOwner;
+    size_t       numberOfBytes;
+};
+}
+
+MemoryArena::Binding::Binding(MemoryArena *ptrArena)
+    : ptrPreviousArena_a(ptrBoundArena_s)
+{
+    ptrBoundArena_s = ptrArena;
+    return;
+}
+
+MemoryArena::Binding::~Binding()
+{
+    ptrBoundArena_s = ptrPreviousArena_a;
+    return;
+}
+
+MemoryArena::MemoryArena(size_t blockSize)
+    : blockSize_a(blockSize), numberOfBlocks_a(0), numberOfAllocations_a(0),
+      numberOfDeallocations_a(0), bytesReserved_a(0), bytesAllocated_a(0),
+      bytesInUse_a(0), peakBytesInUse_a(0), ptrBlockList_a(NULL)
+{
+    return;
+}
+
+void*
+MemoryArena::Allocate(size_t numberOfBytes)
+{
+    const size_t allocateBytes = AlignedSize(numberOfBytes);
+    Block       *ptrBlock = ptrBlockList_a;
+    char        *ptrMemory = NULL;
+
+    if ((ptrBlock == NULL) || ((ptrBlock->capacity - ptrBlock->used) < allocateBytes)) {
+        ptrBlock = AddBlock(allocateBytes);
+    }
+
+    ptrMemory = reinterpret_cast<char*>(ptrBlock) + AlignedSize(sizeof(Block)) + ptrBlock->used;
+    ptrBlock->used += allocateBytes;
+    ++numberOfAllocations_a;
+    bytesAllocated_a += allocateBytes;
+    bytesInUse_a += allocateBytes;
+
+    if (bytesInUse_a > peakBytesInUse_a) {
+        peakBytesInUse_a = bytesInUse_a;
+    }
+
+    return(ptrMemory);
+}
+
+MemoryArena::Block*
+MemoryArena::AddBlock(size_t minimumBytes)
+{
+    size_t capacity = blockSize_a;
+    Block *ptrBlock = NULL;
+
+    // oversized requests get a dedicated block so the current block keeps
+    // serving the small allocations
+    if (minimumBytes > capacity) {
+        capacity = minimumBytes;
+    }
+
+    ptrBlock = static_cast<Block*>(::operator new(AlignedSize(sizeof(Block)) + capacity));
+    ptrBlock->capacity = capacity;
+    ptrBlock->used = 0;
+
+    if ((ptrBlockList_a != NULL) && (capacity > blockSize_a)) {
+        // keep the partially used block at the front of the list
+        ptrBlock->ptrNext = ptrBlockList_a->ptrNext;
+        ptrBlockList_a->ptrNext = ptrBlock;
+    } else {
+        ptrBlock->ptrNext = ptrBlockList_a;
+        ptrBlockList_a = ptrBlock;
+    }
+
+    ++numberOfBlocks_a;
+    bytesReserved_a += AlignedSize(sizeof(Block)) + capacity;
+    return(ptrBlock);
+}
+
+void
+MemoryArena::Deallocate(void *ptrMemory,
+                        size_t numberOfBytes)
+{
+    if (ptrMemory != NULL) {
+        ++numberOfDeallocations_a;
+        bytesInUse_a -= AlignedSize(numberOfBytes);
+    }
+
+    return;
+}
+
+void
+MemoryArena::Release()
+{
+    Block *ptrBlock = ptrBlockList_a;
+
+    while (ptrBlock != NULL) {
+        Block *ptrNextBlock = ptrBlock->ptrNext;
+        ::operator delete(ptrBlock);
+        ptrBlock = ptrNextBlock;
+    }
+
+    ptrBlockList_a = NULL;
+    numberOfBlocks_a = 0;
+    bytesReserved_a = 0;
+    bytesInUse_a = 0;
+    return;
+}
+
+void
+MemoryArena::PrintStatistics(ostream &outfile,
+                             const string &ownerName) const
+{
+    const double     bytesPerKilobyte = 1024.0;
+    const streamsize savePrecision = outfile.precision();
+    outfile << ownerName << ": " << numberOfAllocations_a << " Allocations ("
+            << numberOfDeallocations_a << " Released) In " << numberOfBlocks_a << " Blocks, "
+            << fixed << setprecision(1) << ((double)bytesInUse_a / bytesPerKilobyte) << " KB In Use, "
+            << ((double)peakBytesInUse_a / bytesPerKilobyte) << " KB Peak, "
+            << ((double)bytesReserved_a / bytesPerKilobyte) << " KB Reserved" << NEW_LINE;
+    outfile.unsetf(ios::floatfield);
+    outfile.precision(savePrecision);
+    return;
+}
+
+void*
+MemoryArena::AllocateObject(size_t numberOfBytes)
+{
+    const size_t  headerBytes = AlignedSize(sizeof(ObjectHeader));
+    MemoryArena  *ptrArena = ptrBoundArena_s;
+    char         *ptrMemory = NULL;
+
+    if (ptrArena != NULL) {
+        ptrMemory = static_cast<char*>(ptrArena->Allocate(headerBytes + numberOfBytes));
+    } else {
+        ptrMemory = static_cast<char*>(::operator new(headerBytes + numberOfBytes));
+    }
+
+    reinterpret_cast<ObjectHeader*>(ptrMemory)->ptrOwner = ptrArena;
+    reinterpret_cast<ObjectHeader*>(ptrMemory)->numberOfBytes = headerBytes + numberOfBytes;
+    return(ptrMemory + headerBytes);
+}
+
+void
+MemoryArena::DeallocateObject(void *ptrObject)
+{
+    if (ptrObject != NULL) {
+        char         *ptrMemory = static_cast<char*>(ptrObject) - AlignedSize(sizeof(ObjectHeader));
+        ObjectHeader *ptrHeader = reinterpret_cast<ObjectHeader*>(ptrMemory);
+
+        if (ptrHeader->ptrOwner != NULL) {
+            ptrHeader->ptrOwner->Deallocate(ptrMemory, ptrHeader->numberOfBytes);
+        } else {
+            ::operator delete(ptrMemory);
+        }
+    }
+
+    return;
+}
+
+MemoryArena::~MemoryArena()
+{
+    Release();
+    return;
+}
@@ -0,0 +1,216 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * MemoryArena.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef MEMORY_ARENA_H
+#define MEMORY_ARENA_H "MemoryArena"
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+/**
+ * MemoryArena is a block (bump pointer) allocator used for the large number of
+ *  small, short-lived objects created per time step (e.g. the timeline's
+ *  RegionData and ValueTimelineElement instances).  Memory handed out by the
+ *  arena is never returned individually; it is released in bulk when the arena
+ *  is released or destroyed.  Deallocations are only counted so the statistics
+ *  show how much of the arena is still referenced.
+ *
+ * Classes opt in by routing their operator new/delete through AllocateObject
+ *  and DeallocateObject.  Those allocate from the arena bound to the current
+ *  thread (see MemoryArena::Binding) and fall back to the heap when no arena
+ *  is bound, so objects created outside of a binding behave as before.
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * blockSize_a                  size of each block requested from the heap
+ * numberOfBlocks_a             number of blocks currently held
+ * numberOfAllocations_a        number of allocations made from the arena
+ * numberOfDeallocations_a      number of deallocations returned to the arena
+ * bytesReserved_a              total bytes requested from the heap
+ * bytesAllocated_a             total bytes handed out by the arena
+ * bytesInUse_a                 bytes handed out and not yet deallocated
+ * peakBytesInUse_a             high water mark of bytesInUse_a
+ * ptrBlockList_a*              list of blocks (most recent first)
+ * ptrBoundArena_s*             arena bound to the current thread (if any)
+ */
+class MemoryArena
+{
+public:
+
+    /**
+     * Scoped binding of an arena to the current thread.  The previously bound
+     *  arena (if any) is restored when the binding goes out of scope, including
+     *  when an exception is thrown.
+     */
+    class Binding
+    {
+    public:
+
+        explicit Binding(MemoryArena *ptrArena);
+        ~Binding();
+
+    private:
+
+        Binding(const Binding &copyMe);
+        Binding& operator = (const Binding &copyMe);
+
+        MemoryArena *ptrPreviousArena_a;
+    };
+
+    explicit MemoryArena(size_t blockSize = DEFAULT_BLOCK_SIZE_s);
+    virtual ~MemoryArena();
+
+    void*  Allocate(size_t numberOfBytes);
+    void   Deallocate(void *ptrMemory,
+                      size_t numberOfBytes);
+    void   Release();
+    void   PrintStatistics(ostream &outfile,
+                           const string &ownerName) const;
+
+    static void*  AllocateObject(size_t numberOfBytes);
+    static void   DeallocateObject(void *ptrObject);
+
+    static inline MemoryArena* GetBoundArena();
+
+    inline long   GetNumberOfBlocks() const;
+    inline long   GetNumberOfAllocations() const;
+    inline long   GetNumberOfDeallocations() const;
+
+    inline size_t GetBytesReserved() const;
+    inline size_t GetBytesAllocated() const;
+    inline size_t GetBytesInUse() const;
+    inline size_t GetPeakBytesInUse() const;
+
+    static const size_t DEFAULT_BLOCK_SIZE_s;
+
+protected:
+
+private:
+
+    /**
+     * Header placed at the front of every block.  The usable memory follows
+     *  the header (rounded up to the arena alignment).
+     */
+    struct Block {
+        Block  *ptrNext;
+        size_t  capacity;
+        size_t  used;
+    };
+
+    MemoryArena(const MemoryArena &copyMe);
+    MemoryArena& operator = (const MemoryArena &copyMe);
+
+    Block* AddBlock(size_t minimumBytes);
+
+    static inline size_t AlignedSize(size_t numberOfBytes);
+
+    static inline string GetClassName();
+
+    static const size_t ALIGNMENT_s;
+
+    size_t  blockSize_a;
+    long    numberOfBlocks_a;
+    long    numberOfAllocations_a;
+    long    numberOfDeallocations_a;
+    size_t  bytesReserved_a;
+    size_t  bytesAllocated_a;
+    size_t  bytesInUse_a;
+    size_t  peakBytesInUse_a;
+    Block  *ptrBlockList_a;
+
+    static thread_local MemoryArena *ptrBoundArena_s;
+};
+
+inline
+MemoryArena*
+MemoryArena::GetBoundArena()
+{
+    return(ptrBoundArena_s);
+}
+
+inline
+long
+MemoryArena::GetNumberOfBlocks() const
+{
+    return(numberOfBlocks_a);
+}
+
+inline
+long
+MemoryArena::GetNumberOfAllocations() const
+{
+    return(numberOfAllocations_a);
+}
+
+inline
+long
+MemoryArena::GetNumberOfDeallocations() const
+{
+    return(numberOfDeallocations_a);
+}
+
+inline
+size_t
+MemoryArena::GetBytesReserved() const
+{
+    return(bytesReserved_a);
+}
+
+inline
+size_t
+MemoryArena::GetBytesAllocated() const
+{
+    return(bytesAllocated_a);
+}
+
+inline
+size_t
+MemoryArena::GetBytesInUse() const
+{
+    return(bytesInUse_a);
+}
+
+inline
+size_t
+MemoryArena::GetPeakBytesInUse() const
+{
+    return(peakBytesInUse_a);
+}
+
+inline
+size_t
+MemoryArena::AlignedSize(size_t numberOfBytes)
+{
+    return((numberOfBytes + ALIGNMENT_s - 1) & ~(ALIGNMENT_s - 1));
+}
+
+inline
+string
+MemoryArena::GetClassName()
+{
+    return(MEMORY_ARENA_H);
+}
+
+#endif
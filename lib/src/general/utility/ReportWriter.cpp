@@ -0,0 +1,159 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ReportWriter.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <cstdio>
+#include <cstring>
+
+#include "ReportWriter.h"
+#include "general/utility/MemoryAccounting.h"
+
+ReportWriter::ReportWriter(ostream &outfile,
+                           int bufferSize)
+    : outfile_a(outfile), buffer_a(), bufferUsed_a(0)
+{
+    if (bufferSize < MAXIMUM_NUMBER_SIZE_s) {
+        bufferSize = MAXIMUM_NUMBER_SIZE_s;
+    }
+
+    buffer_a.resize(bufferSize);
+    MemoryAccounting::AddBytes(MemoryAccounting::REPORTS, buffer_a.capacity());
+    return;
+}
+
+void
+ReportWriter::WriteText(const string &text,
+                        int width)
+{
+    const int textSize = (int)text.size();
+
+    if (width > textSize) {
+        WritePadding(width - textSize);
+    }
+
+    if (textSize > (int)buffer_a.size()) {
+        Flush();
+        outfile_a.write(text.data(), textSize);
+    } else {
+        memcpy(ReserveSpace(textSize), text.data(), textSize);
+        bufferUsed_a += textSize;
+    }
+
+    return;
+}
+
+void
+ReportWriter::WriteInt(int value,
+                       int width)
+{
+    // digits are built backwards from the end of a local buffer
+    char         digits[MAXIMUM_NUMBER_SIZE_s];
+    char        *ptrDigit = digits + MAXIMUM_NUMBER_SIZE_s;
+    unsigned int magnitude = (value < 0) ? (0U - (unsigned int)value) : (unsigned int)value;
+    int          numberOfCharacters = 0;
+
+    do {
+        --ptrDigit;
+        *ptrDigit = (char)('0' + (magnitude % 10U));
+        magnitude /= 10U;
+    } while (magnitude > 0U);
+
+    if (value < 0) {
+        --ptrDigit;
+        *ptrDigit = '-';
+    }
+
+    numberOfCharacters = (int)((digits + MAXIMUM_NUMBER_SIZE_s) - ptrDigit);
+
+    if (width > numberOfCharacters) {
+        WritePadding(width - numberOfCharacters);
+    }
+
+    memcpy(ReserveSpace(numberOfCharacters), ptrDigit, numberOfCharacters);
+    bufferUsed_a += numberOfCharacters;
+    return;
+}
+
+void
+ReportWriter::WriteFixed(double value,
+                         int width,
+                         int precision)
+{
+    int available = (int)buffer_a.size() - bufferUsed_a;
+    int numberOfCharacters = 0;
+
+    if (available < MAXIMUM_NUMBER_SIZE_s) {
+        Flush();
+        available = (int)buffer_a.size();
+    }
+
+    // printf's fixed conversion is what the stream uses for ios::fixed
+    numberOfCharacters = snprintf(&buffer_a[0] + bufferUsed_a, available,
+                                  "%*.*f", width, precision, value);
+
+    if (numberOfCharacters >= available) {
+        // only a huge magnitude gets here; format it on its own
+        vector<char> largeNumber(numberOfCharacters + 1);
+        snprintf(&largeNumber[0], largeNumber.size(), "%*.*f", width, precision, value);
+        WriteText(string(&largeNumber[0], numberOfCharacters));
+    } else if (numberOfCharacters > 0) {
+        bufferUsed_a += numberOfCharacters;
+    }
+
+    return;
+}
+
+void
+ReportWriter::WritePadding(int numberOfCharacters)
+{
+    while (numberOfCharacters > 0) {
+        const int available = (int)buffer_a.size() - bufferUsed_a;
+        const int padding = (numberOfCharacters < available) ? numberOfCharacters : available;
+
+        if (padding == 0) {
+            Flush();
+        } else {
+            memset(&buffer_a[0] + bufferUsed_a, ' ', padding);
+            bufferUsed_a += padding;
+            numberOfCharacters -= padding;
+        }
+    }
+
+    return;
+}
+
+void
+ReportWriter::Flush()
+{
+    if (bufferUsed_a > 0) {
+        outfile_a.write(&buffer_a[0], bufferUsed_a);
+        bufferUsed_a = 0;
+    }
+
+    return;
+}
+
+ReportWriter::~ReportWriter()
+{
+    Flush();
+    MemoryAccounting::RemoveBytes(MemoryAccounting::REPORTS, buffer_a.capacity());
+    return;
+}
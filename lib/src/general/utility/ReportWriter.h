@@ -0,0 +1,133 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ReportWriter.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef REPORT_WRITER_H
+#define REPORT_WRITER_H "ReportWriter"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * ReportWriter formats the fixed width report fields into a large buffer in
+ *  front of an output stream and hands the stream whole blocks, instead of
+ *  paying for a setw/setprecision manipulator and a stream sentry on every
+ *  field.  The text written matches what a stream opened through
+ *  ParseUtility::OpenOutputFile (fixed, right justified) produces for the
+ *  same width and precision:
+ *
+ *      outfile << setw(15) << setprecision(3) << value;
+ *      writer.WriteFixed(value, 15, 3);
+ *
+ * Text written straight to the stream while the writer holds data would come
+ *  out of order, so Flush must be called before the stream is used directly
+ *  (the destructor flushes as well).
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * outfile_a                    stream the buffered text is written to
+ * buffer_a                     formatted text not yet written to the stream
+ * bufferUsed_a                 number of characters held in buffer_a
+ */
+class ReportWriter
+{
+public:
+
+    explicit ReportWriter(ostream &outfile,
+                          int bufferSize = DEFAULT_BUFFER_SIZE_s);
+    virtual ~ReportWriter();
+
+    void   WriteText(const string &text,
+                     int width = 0);
+    void   WriteInt(int value,
+                    int width = 0);
+    void   WriteFixed(double value,
+                      int width,
+                      int precision);
+    void   Flush();
+
+    inline void   WriteChar(char character);
+    inline void   WriteText(const char *ptrText);
+
+protected:
+
+private:
+
+    ReportWriter(const ReportWriter &copyMe);
+    ReportWriter& operator = (const ReportWriter &copyMe);
+
+    void   WritePadding(int numberOfCharacters);
+
+    inline char*  ReserveSpace(int numberOfCharacters);
+
+    static inline string GetClassName();
+
+    static const int DEFAULT_BUFFER_SIZE_s = 1 << 20;
+    static const int MAXIMUM_NUMBER_SIZE_s = 64;
+
+    ostream             &outfile_a;
+    vector<char>         buffer_a;
+    int                  bufferUsed_a;
+};
+
+inline
+char*
+ReportWriter::ReserveSpace(int numberOfCharacters)
+{
+    if ((bufferUsed_a + numberOfCharacters) > (int)buffer_a.size()) {
+        Flush();
+    }
+
+    return(&buffer_a[0] + bufferUsed_a);
+}
+
+inline
+void
+ReportWriter::WriteChar(char character)
+{
+    *ReserveSpace(1) = character;
+    ++bufferUsed_a;
+    return;
+}
+
+inline
+void
+ReportWriter::WriteText(const char *ptrText)
+{
+    while (*ptrText != '\0') {
+        WriteChar(*ptrText);
+        ++ptrText;
+    }
+
+    return;
+}
+
+inline
+string
+ReportWriter::GetClassName()
+{
+    return(REPORT_WRITER_H);
+}
+
+#endif
@@ -0,0 +1,212 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * TaskScheduler.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <thread>
+
+#include "TaskScheduler.h"
+#include "general/exception/IndexOutOfBoundsException.h"
+#include "general/utility/Constant.h"
+
+mutex TaskScheduler::outputMutex_s;
+
+TaskScheduler::TaskScheduler(int numberOfThreads)
+    : numberOfThreads_a(numberOfThreads), numberOfCompletedTasks_a(0),
+      numberOfRunningTasks_a(0), ptrFirstError_a(nullptr)
+{
+    if (numberOfThreads_a <= 0) {
+        numberOfThreads_a = std::max(1, (int)thread::hardware_concurrency());
+    }
+
+    return;
+}
+
+int
+TaskScheduler::AddTask(const string &taskName,
+                       const function<void()> &task,
+                       const vector<int> &dependencies)
+{
+    const int                   taskID = (int)taskList_a.size();
+    vector<int>::const_iterator dependencyIter;
+    Task                        newTask;
+    newTask.name = taskName;
+    newTask.work = task;
+    newTask.remainingDependencies = 0;
+    newTask.wallSeconds = 0.0;
+
+    // dependencies must already be added, which also keeps the graph acyclic
+    for (dependencyIter = dependencies.begin(); dependencyIter != dependencies.end(); ++dependencyIter) {
+        if ((*dependencyIter < 0) || (*dependencyIter >= taskID)) {
+            throw new IndexOutOfBoundsException(GetClassName(),
+                                                "AddTask(const string&, const function<void()>&, const vector<int>&)",
+                                                taskID, *dependencyIter);
+        }
+
+        taskList_a[*dependencyIter].dependents.push_back(taskID);
+        ++newTask.remainingDependencies;
+    }
+
+    taskList_a.push_back(newTask);
+    return(taskID);
+}
+
+void
+TaskScheduler::Run()
+{
+    const int      numberOfTasks = (int)taskList_a.size();
+    vector<thread> workerList;
+    exception_ptr  ptrError = nullptr;
+    int            taskID = 0;
+    numberOfCompletedTasks_a = 0;
+    numberOfRunningTasks_a = 0;
+    ptrFirstError_a = nullptr;
+    readyList_a.clear();
+
+    for (taskID = 0; taskID < numberOfTasks; ++taskID) {
+        if (taskList_a[taskID].remainingDependencies == 0) {
+            readyList_a.push_back(taskID);
+        }
+    }
+
+    // the calling thread works too, so only the extra workers are spawned
+    while ((int)workerList.size() < (std::min(numberOfThreads_a, numberOfTasks) - 1)) {
+        workerList.push_back(thread(&TaskScheduler::RunWorker, this));
+    }
+
+    RunWorker();
+
+    for (vector<thread>::iterator workerIter = workerList.begin(); workerIter != workerList.end(); ++workerIter) {
+        workerIter->join();
+    }
+
+    ptrError = ptrFirstError_a;
+    ptrFirstError_a = nullptr;
+
+    if (ptrError != nullptr) {
+        rethrow_exception(ptrError);
+    }
+
+    return;
+}
+
+void
+TaskScheduler::RunWorker()
+{
+    unique_lock<mutex> schedulerLock(schedulerMutex_a);
+
+    while (true) {
+        int           taskID = 0;
+        double        wallSeconds = 0.0;
+        exception_ptr ptrError = nullptr;
+        chrono::steady_clock::time_point startTime;
+
+        while ((ptrFirstError_a == nullptr) && (readyList_a.empty() == true) && (numberOfRunningTasks_a > 0)) {
+            taskReady_a.wait(schedulerLock);
+        }
+
+        if ((ptrFirstError_a != nullptr) || (readyList_a.empty() == true)) {
+            break;
+        }
+
+        taskID = readyList_a.front();
+        readyList_a.erase(readyList_a.begin());
+        ++numberOfRunningTasks_a;
+        schedulerLock.unlock();
+        startTime = chrono::steady_clock::now();
+
+        try {
+            taskList_a[taskID].work();
+        } catch (...) {
+            ptrError = current_exception();
+        }
+
+        wallSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        schedulerLock.lock();
+        --numberOfRunningTasks_a;
+        ++numberOfCompletedTasks_a;
+        taskList_a[taskID].wallSeconds = wallSeconds;
+
+        if (ptrError != nullptr) {
+            if (ptrFirstError_a == nullptr) {
+                ptrFirstError_a = ptrError;
+            } else {
+                // only the first error is reported, release any others
+                try {
+                    rethrow_exception(ptrError);
+                } catch (Exception *ptrLaterError) {
+                    delete ptrLaterError;
+                } catch (...) {
+                }
+            }
+        } else {
+            vector<int>::const_iterator dependentIter;
+
+            for (dependentIter = taskList_a[taskID].dependents.begin();
+                    dependentIter != taskList_a[taskID].dependents.end(); ++dependentIter) {
+                if (--taskList_a[*dependentIter].remainingDependencies == 0) {
+                    // keep ready tasks in the order they were added
+                    readyList_a.insert(lower_bound(readyList_a.begin(), readyList_a.end(), *dependentIter),
+                                       *dependentIter);
+                }
+            }
+        }
+
+        taskReady_a.notify_all();
+    }
+
+    return;
+}
+
+void
+TaskScheduler::PrintTaskTimes(ostream &outfile,
+                              const string &ownerName) const
+{
+    const streamsize              savePrecision = outfile.precision();
+    vector<Task>::const_iterator  taskIter;
+    outfile << ownerName << ": " << numberOfCompletedTasks_a << " Of " << taskList_a.size()
+            << " Tasks Completed On " << numberOfThreads_a << " Threads" << NEW_LINE;
+
+    for (taskIter = taskList_a.begin(); taskIter != taskList_a.end(); ++taskIter) {
+        outfile << ownerName << ":    " << left << setw(40) << taskIter->name << right
+                << fixed << setprecision(3) << setw(10) << taskIter->wallSeconds << " s" << NEW_LINE;
+    }
+
+    outfile.unsetf(ios::floatfield);
+    outfile.precision(savePrecision);
+    return;
+}
+
+void
+TaskScheduler::WriteLine(ostream &outfile,
+                         const string &line)
+{
+    lock_guard<mutex> outputLock(outputMutex_s);
+    outfile << line << NEW_LINE;
+    return;
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    return;
+}
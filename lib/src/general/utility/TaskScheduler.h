@@ -0,0 +1,153 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * TaskScheduler.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H "TaskScheduler"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * TaskScheduler runs a set of tasks on a bounded number of worker threads,
+ *  starting each task as soon as every task it depends on has completed.
+ *  Tasks are added up front (AddTask returns the identifier later tasks use
+ *  as a dependency) and Run blocks until all of them have finished, so Run
+ *  also acts as the barrier for the whole set.
+ *
+ * The first exception thrown by a task (including the library's Exception
+ *  pointers) stops any further tasks from being started and is rethrown from
+ *  Run once the running tasks have finished.  Ready tasks are started in the
+ *  order they were added.
+ *
+ * Tasks report progress through WriteLine, which writes each line whole so
+ *  lines from concurrent tasks do not interleave.
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * numberOfThreads_a            number of worker threads used by Run
+ * numberOfCompletedTasks_a     number of tasks finished during Run
+ * numberOfRunningTasks_a       number of tasks currently executing
+ * taskList_a                   the tasks in the order added
+ * readyList_a                  identifiers of tasks ready to start
+ * ptrFirstError_a              the first exception thrown by a task
+ * schedulerMutex_a             guards the scheduling state above
+ * taskReady_a                  signals a ready task or the end of Run
+ * outputMutex_s                serializes the lines written by WriteLine
+ */
+class TaskScheduler
+{
+public:
+
+    explicit TaskScheduler(int numberOfThreads = 0);
+    virtual ~TaskScheduler();
+
+    int    AddTask(const string &taskName,
+                   const function<void()> &task,
+                   const vector<int> &dependencies = vector<int>());
+    void   Run();
+    void   PrintTaskTimes(ostream &outfile,
+                          const string &ownerName) const;
+
+    static void WriteLine(ostream &outfile,
+                          const string &line);
+
+    inline int    GetNumberOfThreads() const;
+    inline int    GetNumberOfTasks() const;
+
+    inline double GetTaskSeconds(int taskID) const;
+
+    inline const string& GetTaskName(int taskID) const;
+
+protected:
+
+private:
+
+    struct Task {
+        string           name;
+        function<void()> work;
+        vector<int>      dependents;
+        int              remainingDependencies;
+        double           wallSeconds;
+    };
+
+    TaskScheduler(const TaskScheduler &copyMe);
+    TaskScheduler& operator = (const TaskScheduler &copyMe);
+
+    void   RunWorker();
+
+    static inline string GetClassName();
+
+    int                 numberOfThreads_a;
+    int                 numberOfCompletedTasks_a;
+    int                 numberOfRunningTasks_a;
+    vector<Task>        taskList_a;
+    vector<int>         readyList_a;
+    exception_ptr       ptrFirstError_a;
+    mutex               schedulerMutex_a;
+    condition_variable  taskReady_a;
+
+    static mutex        outputMutex_s;
+};
+
+inline
+int
+TaskScheduler::GetNumberOfThreads() const
+{
+    return(numberOfThreads_a);
+}
+
+inline
+int
+TaskScheduler::GetNumberOfTasks() const
+{
+    return((int)taskList_a.size());
+}
+
+inline
+double
+TaskScheduler::GetTaskSeconds(int taskID) const
+{
+    return(taskList_a[taskID].wallSeconds);
+}
+
+inline
+const string&
+TaskScheduler::GetTaskName(int taskID) const
+{
+    return(taskList_a[taskID].name);
+}
+
+inline
+string
+TaskScheduler::GetClassName()
+{
+    return(TASK_SCHEDULER_H);
+}
+
+#endif
@@ -33,13 +33,8 @@
 #include "general/time/TimePiece.h"
 #include "io\FileNames.h"
 
-Array<double>*             Earth::ptrLowestRegionNumberArray_s  = NULL;
-Array<double>*             Earth::ptrHighestRegionNumberArray_s = NULL;
-int                      Earth::latitudeDivisionsPerRegion_s  = 1;
-int                      Earth::longitudeDivisionsPerRegion_s = 1;
-//RAGUSA 11/27/2018 - Adding User Specific Tier Definitions, default input will be 1 (cannot be 0)
-int                       Earth::numberOfServiceTierDefinitions_s = 1;
-ArrayOfLinkLists<Region>* Earth::ptrRegionLatitudeBinList_s = NULL;
+Earth::State               Earth::defaultState_s;
+thread_local Earth::State *Earth::ptrBoundState_s = NULL;
 
 Earth::Earth()
 {
@@ -96,13 +91,13 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
 			ptrInputData = (*inputDataIter);
 
 			if (ptrInputData->LabelContainsString("Number Of Latitude Divisions") == true) {
-				latitudeDivisionsPerRegion_s = ptrInputData->GetIntValue();
+				GetState().latitudeDivisionsPerRegion = ptrInputData->GetIntValue();
 			}
 			else if (ptrInputData->LabelContainsString("Number Of Longitude Divisions") == true) {
-				longitudeDivisionsPerRegion_s = ptrInputData->GetIntValue();
+				GetState().longitudeDivisionsPerRegion = ptrInputData->GetIntValue();
 			}
 
-			if (latitudeDivisionsPerRegion_s <= 0) {
+			if (GetState().latitudeDivisionsPerRegion <= 0) {
 				//CPPCHECK_FIX Error - memory leak
 				delete ptrLatitudeBinArray;
 				ptrLatitudeBinArray = NULL;
@@ -110,11 +105,11 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
 					"Missing/invalid 'Number Of Latitude Divisions' input");
 			}
 
-			if (longitudeDivisionsPerRegion_s <= 0) {
+			if (GetState().longitudeDivisionsPerRegion <= 0) {
 				throw new InputException(GetClassName(), "CreateRegions(InputDataElement*)",
 					"Missing/invalid 'Number Of Longitude Divisions' input");
 			}
-			if (longitudeDivisionsPerRegion_s <= 0) {
+			if (GetState().longitudeDivisionsPerRegion <= 0) {
 				throw new InputException(GetClassName(), "CreateRegions(InputDataElement*)",
 					"Missing/invalid 'Number Of Longitude Divisions' input");
 			}
@@ -127,15 +122,15 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
 		for (inputDataIter = inputDataList->begin(); inputDataIter != inputDataList->end(); ++inputDataIter) {
 			ptrInputData = (*inputDataIter);
 			if (ptrInputData->LabelContainsString("Number Of Service Tier Definitions") == true) {
-				numberOfServiceTierDefinitions_s = ptrInputData->GetIntValue();
+				GetState().numberOfServiceTierDefinitions = ptrInputData->GetIntValue();
 			}
 
-			if (numberOfServiceTierDefinitions_s <= 0) {
+			if (GetState().numberOfServiceTierDefinitions <= 0) {
 				throw new InputException(GetClassName(), "CreateRegions(InputDataElement*)",
 					"Missing/invalid 'Number Of Service Tier Definitions' input");
 			}
 		}
-		accessIndexEnd = accessIndexStart + 2 * numberOfServiceTierDefinitions_s - 1;
+		accessIndexEnd = accessIndexStart + 2 * GetState().numberOfServiceTierDefinitions - 1;
 	//=================================================================================================
 
     ptrLatitudeBinArray->SetOrderToDecreasing();
@@ -153,7 +148,7 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
 
             northLatitude = ptrInputData->GetDoubleValue(northIndex);
             deltaLatitude = (northLatitude - ptrInputData->GetDoubleValue(southIndex))
-                            / (double)latitudeDivisionsPerRegion_s;
+                            / (double)GetState().latitudeDivisionsPerRegion;
 
             if (deltaLatitude <= 0.0) {
                 throw new InputException(GetClassName(), "CreateRegions(InputDataElement*)",
@@ -163,7 +158,7 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
             middleLatitude = northLatitude - (deltaLatitude / 2.0);
             latitudeBin = 0;
 
-            while (latitudeBin < latitudeDivisionsPerRegion_s) {
+            while (latitudeBin < GetState().latitudeDivisionsPerRegion) {
                 ptrLatitudeBinArray->InsertUniqueElement(middleLatitude);
                 middleLatitude -= deltaLatitude;
                 ++latitudeBin;
@@ -191,9 +186,9 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
                                  "No regions were found");
     }
 
-    ptrRegionLatitudeBinList_s = new ArrayOfLinkLists<Region>(numberOfLatitudeBins);
-    ptrLowestRegionNumberArray_s = new Array<double>(numberOfLatitudeBins, FLT_MAX);
-    ptrHighestRegionNumberArray_s = new Array<double>(numberOfLatitudeBins, 0);
+    GetState().ptrRegionLatitudeBinList = new ArrayOfLinkLists<Region>(numberOfLatitudeBins);
+    GetState().ptrLowestRegionNumberArray = new Array<double>(numberOfLatitudeBins, FLT_MAX);
+    GetState().ptrHighestRegionNumberArray = new Array<double>(numberOfLatitudeBins, 0);
 
     for( inputDataIter = inputDataList->begin(); inputDataIter != inputDataList->end(); ++inputDataIter) {
         ptrInputData = (*inputDataIter);
@@ -222,14 +217,14 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
 			}
 			//===============================================================
             deltaLatitude = (northLatitude - ptrInputData->GetDoubleValue(southIndex))
-                            / (double)latitudeDivisionsPerRegion_s;
+                            / (double)GetState().latitudeDivisionsPerRegion;
 
             if (westLongitude < eastLongitude) {
                 deltaLongitude = (eastLongitude - westLongitude)
-                                 / (double)longitudeDivisionsPerRegion_s;
+                                 / (double)GetState().longitudeDivisionsPerRegion;
             } else {
                 deltaLongitude = (360.0 + eastLongitude - westLongitude)
-                                 / (double)longitudeDivisionsPerRegion_s;
+                                 / (double)GetState().longitudeDivisionsPerRegion;
             }
 
             if (deltaLongitude <= 0.0) {
@@ -241,12 +236,12 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
             middleLatitude = northLatitude - (deltaLatitude / 2.0);
             latitudeBin = 0;
 
-            while (latitudeBin < latitudeDivisionsPerRegion_s) {
+            while (latitudeBin < GetState().latitudeDivisionsPerRegion) {
                 southLatitude = northLatitude - deltaLatitude;
                 arrayIndex = ptrLatitudeBinArray->FindIndex(middleLatitude);
                 longitudeBin = 0;
 
-                while (longitudeBin < longitudeDivisionsPerRegion_s) {
+                while (longitudeBin < GetState().longitudeDivisionsPerRegion) {
                     if (usingSubRegions == true) {
                         ++subRegionNumber;
                     }
@@ -270,15 +265,15 @@ Earth::CreateRegions(shared_ptr<InputDataElement> ptrInputDataElement)
                     fullRegionNumber = ptrRegion->GetFullRegionNumber();
                     // Add 180 to the sort value, because the Append function on the LinkList can
                     // not sort negative values
-                    ptrRegionLatitudeBinList_s->AddObject(ptrRegion, arrayIndex, (int)(westLongitude + 180.0));
+                    GetState().ptrRegionLatitudeBinList->AddObject(ptrRegion, arrayIndex, (int)(westLongitude + 180.0));
                     ptrRegion = NULL;
 
-                    if (fullRegionNumber < ptrLowestRegionNumberArray_s->ElementAt(arrayIndex)) {
-                        (*ptrLowestRegionNumberArray_s)[arrayIndex] = fullRegionNumber;
+                    if (fullRegionNumber < GetState().ptrLowestRegionNumberArray->ElementAt(arrayIndex)) {
+                        (*GetState().ptrLowestRegionNumberArray)[arrayIndex] = fullRegionNumber;
                     }
 
-                    if (fullRegionNumber > ptrHighestRegionNumberArray_s->ElementAt(arrayIndex)) {
-                        (*ptrHighestRegionNumberArray_s)[arrayIndex] = fullRegionNumber;
+                    if (fullRegionNumber > GetState().ptrHighestRegionNumberArray->ElementAt(arrayIndex)) {
+                        (*GetState().ptrHighestRegionNumberArray)[arrayIndex] = fullRegionNumber;
                     }
 
                     ++longitudeBin;
@@ -316,7 +311,7 @@ Earth::AddRegions(LinkList<Region> *ptrRegionList,
                   double maximumEarthAngle)
 {
     int        latitudeBin = 0;
-    const int  numberOfLatitudeBins = ptrRegionLatitudeBinList_s->Size();
+    const int  numberOfLatitudeBins = GetState().ptrRegionLatitudeBinList->Size();
     bool        withinLatitudeRange = false;
     bool        foundViableRegion = false;
     bool        firstRegionIsViable = false;
@@ -324,9 +319,9 @@ Earth::AddRegions(LinkList<Region> *ptrRegionList,
     Region     *ptrFirstRegion = NULL;
 
     while (latitudeBin < numberOfLatitudeBins) {
-        if ( ((ptrRegionLatitudeBinList_s->GetFirstObject(latitudeBin))->GetSouthernLatitude() <= upperLatitude) &&
-                ((ptrRegionLatitudeBinList_s->GetFirstObject(latitudeBin))->GetNorthernLatitude() >= lowerLatitude) ) {
-            ListIterator<Region> regionListIter(ptrRegionLatitudeBinList_s->LinkListAt(latitudeBin));
+        if ( ((GetState().ptrRegionLatitudeBinList->GetFirstObject(latitudeBin))->GetSouthernLatitude() <= upperLatitude) &&
+                ((GetState().ptrRegionLatitudeBinList->GetFirstObject(latitudeBin))->GetNorthernLatitude() >= lowerLatitude) ) {
+            ListIterator<Region> regionListIter(GetState().ptrRegionLatitudeBinList->LinkListAt(latitudeBin));
             ptrFirstRegion = regionListIter.First();
             withinLatitudeRange = true;
             foundViableRegion = false;
@@ -385,12 +380,12 @@ Earth::AddAllRegions(LinkList<Region> *ptrRegionList,
                      double lowerLatitude)
 {
     int        latitudeBin = 0;
-    const int  numberOfLatitudeBins = ptrRegionLatitudeBinList_s->Size();
+    const int  numberOfLatitudeBins = GetState().ptrRegionLatitudeBinList->Size();
     bool        withinLatitudeRange = false;
     Region     *ptrRegion = NULL;
 
     while (latitudeBin < numberOfLatitudeBins) {
-        ListIterator<Region> regionListIter(ptrRegionLatitudeBinList_s->LinkListAt(latitudeBin));
+        ListIterator<Region> regionListIter(GetState().ptrRegionLatitudeBinList->LinkListAt(latitudeBin));
         ptrRegion = regionListIter.First();
 
         if ( (ptrRegion->GetSouthernLatitude() <= upperLatitude) &&
@@ -442,14 +437,14 @@ Region*
 Earth::GetRegion(double fullRegionNumber)
 {
     int        latitudeBin = 0;
-    const int  numberOfLatitudeBins = ptrRegionLatitudeBinList_s->Size();
+    const int  numberOfLatitudeBins = GetState().ptrRegionLatitudeBinList->Size();
     bool        foundRegion = false;
     Region     *ptrRegion = NULL;
 
     while ((latitudeBin < numberOfLatitudeBins) && (foundRegion == false)) {
-        if ( (fullRegionNumber >= ptrLowestRegionNumberArray_s->ElementAt(latitudeBin)) &&
-                (fullRegionNumber <= ptrHighestRegionNumberArray_s->ElementAt(latitudeBin)) ) {
-            ListIterator<Region> regionListIter(ptrRegionLatitudeBinList_s->LinkListAt(latitudeBin));
+        if ( (fullRegionNumber >= GetState().ptrLowestRegionNumberArray->ElementAt(latitudeBin)) &&
+                (fullRegionNumber <= GetState().ptrHighestRegionNumberArray->ElementAt(latitudeBin)) ) {
+            ListIterator<Region> regionListIter(GetState().ptrRegionLatitudeBinList->LinkListAt(latitudeBin));
             ptrRegion = regionListIter.First();
 
             while ((ptrRegion != NULL) && (foundRegion == false)) {
@@ -550,9 +545,9 @@ Earth::GetRegionLatitudeBinList(int index)
 {
     const LinkList<Region> *ptrReturnList = NULL;
 
-    if (ptrRegionLatitudeBinList_s != NULL) {
-        if (index < ptrRegionLatitudeBinList_s->Size()) {
-            ptrReturnList = ptrRegionLatitudeBinList_s->LinkListAt(index);
+    if (GetState().ptrRegionLatitudeBinList != NULL) {
+        if (index < GetState().ptrRegionLatitudeBinList->Size()) {
+            ptrReturnList = GetState().ptrRegionLatitudeBinList->LinkListAt(index);
         }
     }
 
@@ -563,13 +558,13 @@ const LinkList<Region>*
 Earth::GetRegionLatitudeList(double latitude)
 {
     int                    latitudeBin = 0;
-    const int              numberOfLatitudeBins = ptrRegionLatitudeBinList_s->Size();
+    const int              numberOfLatitudeBins = GetState().ptrRegionLatitudeBinList->Size();
     const LinkList<Region> *ptrReturnList = NULL;
 
     while ((latitudeBin < numberOfLatitudeBins) && (ptrReturnList == NULL)) {
-        if ( (latitude <= (ptrRegionLatitudeBinList_s->GetFirstObject(latitudeBin))->GetNorthernLatitude()) &&
-                (latitude >= (ptrRegionLatitudeBinList_s->GetFirstObject(latitudeBin))->GetSouthernLatitude()) ) {
-            ptrReturnList = ptrRegionLatitudeBinList_s->LinkListAt(latitudeBin);
+        if ( (latitude <= (GetState().ptrRegionLatitudeBinList->GetFirstObject(latitudeBin))->GetNorthernLatitude()) &&
+                (latitude >= (GetState().ptrRegionLatitudeBinList->GetFirstObject(latitudeBin))->GetSouthernLatitude()) ) {
+            ptrReturnList = GetState().ptrRegionLatitudeBinList->LinkListAt(latitudeBin);
         } else {
             ++latitudeBin;
         }
@@ -581,26 +576,34 @@ Earth::GetRegionLatitudeList(double latitude)
 void
 Earth::DestroyRegions()
 {
-    if (ptrRegionLatitudeBinList_s != NULL) {
-        ptrRegionLatitudeBinList_s->Delete();
-        delete ptrRegionLatitudeBinList_s;
-        ptrRegionLatitudeBinList_s = NULL;
+    if (GetState().ptrRegionLatitudeBinList != NULL) {
+        GetState().ptrRegionLatitudeBinList->Delete();
+        delete GetState().ptrRegionLatitudeBinList;
+        GetState().ptrRegionLatitudeBinList = NULL;
     }
 
-    if (ptrLowestRegionNumberArray_s != NULL) {
-        delete ptrLowestRegionNumberArray_s;
-        ptrLowestRegionNumberArray_s = NULL;
+    if (GetState().ptrLowestRegionNumberArray != NULL) {
+        delete GetState().ptrLowestRegionNumberArray;
+        GetState().ptrLowestRegionNumberArray = NULL;
     }
 
-    if (ptrHighestRegionNumberArray_s != NULL) {
-        delete ptrHighestRegionNumberArray_s;
-        ptrHighestRegionNumberArray_s = NULL;
+    if (GetState().ptrHighestRegionNumberArray != NULL) {
+        delete GetState().ptrHighestRegionNumberArray;
+        GetState().ptrHighestRegionNumberArray = NULL;
     }
 
     Region::DestroyRegion();
     return;
 }
 
+Earth::State*
+Earth::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 Earth::~Earth()
 {
     return;
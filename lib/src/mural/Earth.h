@@ -43,19 +43,22 @@ class SpaceVector;
  *
  * Name                           Description (units)
  * -------------                  ----------------------------------------------
- * ptrLowestRegionNumberArray_s*  array of the lowest region number in each
- *                                  latitude bin in ptrRegionLatitudeBinList_a
- * ptrHighestRegionNumberArray_s* array of the highest region number in each
- *                                  latitude bin in ptrRegionLatitudeBinList_a
- * latitudeDivisionsPerRegion_s   used to define WAC (0), ATC (5), or WTM (20)
+ * State::
+ *  ptrLowestRegionNumberArray*   array of the lowest region number in each
+ *                                  latitude bin in ptrRegionLatitudeBinList
+ *  ptrHighestRegionNumberArray*  array of the highest region number in each
+ *                                  latitude bin in ptrRegionLatitudeBinList
+ *  latitudeDivisionsPerRegion    used to define WAC (0), ATC (5), or WTM (20)
  *                                  level
- * longitudeDivisionsPerRegion_s  used to define WAC (0), ATC (5), or WTM (20)
+ *  longitudeDivisionsPerRegion   used to define WAC (0), ATC (5), or WTM (20)
  *                                  level
+ *  ptrRegionLatitudeBinList*     array by number of latitude bins of lists of
+ *                                  instances of Region
  * RADIUS_NMI_s                   radius of the earth in nautical miles
  * MU_NMI_SEC_s                   earth's gravitational constant
  * PERIOD_SEC_s                   period of the earth's rotation
- * ptrRegionLatitudeBinList_s*    array by number of latitude bins of lists of
- *                                  instances of Region
+ * defaultState_s                 region tables used when no scenario is bound
+ * ptrBoundState_s*               region tables bound to the current thread
  *
  * @author Brian Fowler
  * @date 09/01/11
@@ -64,6 +67,30 @@ class Earth
 {
 public:
 
+    /**
+     * The region tables of a scenario (released by DestroyRegions).  Each
+     *  ScenarioContext holds its own, threads with no context bound share the
+     *  process wide default.
+     */
+    struct State {
+        Array<double>            *ptrLowestRegionNumberArray = NULL;
+        Array<double>            *ptrHighestRegionNumberArray = NULL;
+        int                       latitudeDivisionsPerRegion = 1;
+        int                       longitudeDivisionsPerRegion = 1;
+        //RAGUSA 11/27/2018 - Adding User Specific Tier Definitions, default input will be 1 (cannot be 0)
+        int                       numberOfServiceTierDefinitions = 1;
+        ArrayOfLinkLists<Region> *ptrRegionLatitudeBinList = NULL;
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     virtual ~Earth();
 
     /**
@@ -130,26 +157,24 @@ private:
 
     static inline string GetClassName();
 
-    static Array<double>             *ptrLowestRegionNumberArray_s;
-    static Array<double>             *ptrHighestRegionNumberArray_s;
-    static int                      latitudeDivisionsPerRegion_s;
-    static int                      longitudeDivisionsPerRegion_s;
-	static int                      numberOfServiceTierDefinitions_s;
-    static ArrayOfLinkLists<Region> *ptrRegionLatitudeBinList_s;
+    static inline State& GetState();
+
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
 };
 
 inline
 int
 Earth::GetLatitudeDivisionsPerRegion()
 {
-    return(latitudeDivisionsPerRegion_s);
+    return(GetState().latitudeDivisionsPerRegion);
 }
 
 inline
 int
 Earth::GetLongitudeDivisionsPerRegion()
 {
-    return(longitudeDivisionsPerRegion_s);
+    return(GetState().longitudeDivisionsPerRegion);
 }
 
 //RAGUSA 11/27/2018
@@ -157,14 +182,14 @@ inline
 int
 Earth::GetNumberOfServiceTierDefinitions()
 {
-	return(numberOfServiceTierDefinitions_s);
+	return(GetState().numberOfServiceTierDefinitions);
 }
 
 inline
 int
 Earth::GetSubRegionsPerRegion()
 {
-    return(latitudeDivisionsPerRegion_s * longitudeDivisionsPerRegion_s);
+    return(GetState().latitudeDivisionsPerRegion * GetState().longitudeDivisionsPerRegion);
 }
 
 inline
@@ -194,8 +219,8 @@ Earth::GetNumberOfLatitudeBins()
 {
     int numberOfLatitudeBins = 0;
 
-    if (ptrRegionLatitudeBinList_s != NULL) {
-        numberOfLatitudeBins = ptrRegionLatitudeBinList_s->Size();
+    if (GetState().ptrRegionLatitudeBinList != NULL) {
+        numberOfLatitudeBins = GetState().ptrRegionLatitudeBinList->Size();
     }
 
     return(numberOfLatitudeBins);
@@ -205,7 +230,14 @@ inline
 ArrayOfLinkLists<Region>*
 Earth::GetRegionLatitudeBinListArray()
 {
-    return(ptrRegionLatitudeBinList_s);
+    return(GetState().ptrRegionLatitudeBinList);
+}
+
+inline
+Earth::State&
+Earth::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
 }
 
 inline
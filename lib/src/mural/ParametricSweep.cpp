@@ -0,0 +1,450 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ParametricSweep.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+//RAGUSA 4/30/2018 - Improving MURAL to 64-bit processing
+#ifdef WIN64
+#   include <direct.h>
+#else
+#   include <sys/stat.h>
+#endif
+
+#include "ParametricSweep.h"
+#include "mural/MURALTypes.h"
+#include "mural/ScenarioContext.h"
+#include "mural/element/DataProvider.h"
+#include "mural/element/DataProviderCollection.h"
+#include "mural/io/FileNames.h"
+#include "mural/io/ModuleCheckpoint.h"
+#include "mural/io/MURALInputProcessor.h"
+#include "mural/io/OutputGenerator.h"
+#include "mural/modules/pg/PositionGenerator.h"
+#include "mural/modules/lg/LinksGenerator.h"
+#include "mural/modules/vtg/ValueTimelineGenerator.h"
+
+#include "general/data/InputDataElement.h"
+#include "general/exception/InputException.h"
+#include "general/exception/OutputFileException.h"
+#include "general/parse/ParseUtility.h"
+#include "general/time/TimePiece.h"
+#include "general/utility/Constant.h"
+#include "general/utility/StringEditor.h"
+#include "general/utility/TaskScheduler.h"
+
+const char   ParametricSweep::OVERRIDE_SEPARATOR_s = '|';
+const string ParametricSweep::POSITION_BLOCK_TAGS_s[] = {"POSITION_GENERATION",
+                                                         "TIME_PIECE",
+                                                         "INPUT_PARAMETERS"
+                                                        };
+const int    ParametricSweep::NUMBER_OF_POSITION_BLOCK_TAGS_s = 3;
+
+ParametricSweep::ParametricSweep(const string &sweepFileName)
+    : baseInputSeconds_a(0.0), basePositionSeconds_a(0.0)
+{
+    try {
+        ExtractVariants(sweepFileName);
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "ParametricSweep(const string&)");
+        throw;
+    }
+
+    return;
+}
+
+void
+ParametricSweep::Run(const string &mainInputFileName,
+                     const string &executableName)
+{
+    ScenarioContext                            baseContext;
+    ScenarioContext::Binding                   baseBinding(&baseContext);
+    // declared after the binding so the inputs are released in the base scenario
+    shared_ptr<MURALInputProcessor>            ptrInputProcessor = NULL;
+    shared_ptr<DataProviderCollection>         ptrBaseCollection = NULL;
+    shared_ptr<PositionGenerator>              ptrPositionGenerator = NULL;
+    shared_ptr<MURALTypes::DataProviderVector> ptrDataProviderList = NULL;
+    MURALTypes::DataProviderVector::iterator   dataProviderIter;
+    vector<Variant>::iterator                  variantIter;
+    TaskScheduler                              positionScheduler;
+    chrono::steady_clock::time_point           startTime;
+
+    try {
+        startTime = chrono::steady_clock::now();
+        TimePiece::SetSystemStartTime();
+        ptrInputProcessor = shared_ptr<MURALInputProcessor>(new MURALInputProcessor(mainInputFileName));
+        ptrBaseCollection = ptrInputProcessor->CreateDataProviderList();
+        baseInputSeconds_a = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        startTime = chrono::steady_clock::now();
+        ptrPositionGenerator = shared_ptr<PositionGenerator>(new PositionGenerator());
+        ptrDataProviderList = ptrBaseCollection->GetDataProviderListPtr();
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            shared_ptr<DataProvider> ptrDataProvider = (*dataProviderIter);
+            positionScheduler.AddTask(("Positions " + ptrDataProvider->GetDesignator()),
+            ScenarioContext::BindTask([ptrPositionGenerator, ptrDataProvider]() {
+                ptrPositionGenerator->GenerateProviderPositions(ptrDataProvider);
+            }));
+        }
+
+        positionScheduler.Run();
+        positionScheduler.PrintTaskTimes(cout, "ParametricSweep");
+        basePositionSeconds_a = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+        for (variantIter = variantList_a.begin(); variantIter != variantList_a.end(); ++variantIter) {
+            RunVariant((*variantIter), ptrInputProcessor.get(), ptrBaseCollection,
+                       mainInputFileName, executableName);
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "Run(const string&, const string&)");
+        throw;
+    }
+
+    return;
+}
+
+void
+ParametricSweep::RunVariant(Variant &variant,
+                            MURALInputProcessor *ptrInputProcessor,
+                            const shared_ptr<DataProviderCollection> &ptrBaseCollection,
+                            const string &mainInputFileName,
+                            const string &executableName)
+{
+    ScenarioContext                          variantContext;
+    ScenarioContext::Binding                 variantBinding(&variantContext);
+    MURALInputProcessor::OverriddenInputList overriddenInputList;
+    shared_ptr<DataProviderCollection>       ptrDataProviderCollection = NULL;
+    vector<InputOverride>::const_iterator    overrideIter;
+    const chrono::steady_clock::time_point   startTime = chrono::steady_clock::now();
+    cout << "ParametricSweep: Running Variant " << variant.name << NEW_LINE;
+
+    try {
+        TimePiece::SetSystemStartTime();
+        FileNames::SetFileName(FileNames::MAIN_INPUT_FILE, mainInputFileName);
+
+        for (overrideIter = variant.overrideList.begin(); overrideIter != variant.overrideList.end(); ++overrideIter) {
+            if (ptrInputProcessor->OverrideInputData(overrideIter->designator, overrideIter->blockTag,
+                    overrideIter->label, overrideIter->value, overriddenInputList) == 0) {
+                throw new InputException(GetClassName(),
+                                         "RunVariant(Variant&, MURALInputProcessor*, const shared_ptr<DataProviderCollection>&, const string&, const string&)",
+                                         ("Override of '" + overrideIter->label + "' in variant " + variant.name
+                                          + " does not match any input"));
+            }
+        }
+
+        // the overrides stay in place until the final output has echoed the inputs
+        ptrInputProcessor->ReprocessInputData();
+        CreateOutputDirectory(variant.outputDirectory);
+        FileNames::MoveOutputFiles(variant.outputDirectory);
+        ptrDataProviderCollection = ptrInputProcessor->CreateDataProviderList();
+
+        if (variant.sharedPositions == true) {
+            variant.sharedPositions = ModuleCheckpoint::CopyPositions(ptrBaseCollection, ptrDataProviderCollection);
+
+            if (variant.sharedPositions == false) {
+                cout << "ParametricSweep: Variant " << variant.name
+                     << " Does Not Match The Base Positions, Generating Its Own" << NEW_LINE;
+            }
+        }
+
+        RunModules(ptrDataProviderCollection, ("ParametricSweep " + variant.name), executableName);
+    } catch (Exception *ptrError) {
+        MURALInputProcessor::RestoreInputData(overriddenInputList);
+        ptrError->AddMethod(GetClassName(),
+                            "RunVariant(Variant&, MURALInputProcessor*, const shared_ptr<DataProviderCollection>&, const string&, const string&)");
+        throw;
+    }
+
+    MURALInputProcessor::RestoreInputData(overriddenInputList);
+    variant.wallSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+    return;
+}
+
+void
+ParametricSweep::RunModules(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                            const string &ownerName,
+                            const string &executableName)
+{
+    shared_ptr<OutputGenerator>                ptrOutputGenerator(new OutputGenerator(ptrDataProviderCollection));
+    shared_ptr<PositionGenerator>              ptrPositionGenerator(new PositionGenerator());
+    shared_ptr<LinksGenerator>                 ptrLinksGenerator = NULL;
+    shared_ptr<ValueTimelineGenerator>         ptrTimelineGenerator = NULL;
+    shared_ptr<MURALTypes::DataProviderVector> ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
+    MURALTypes::DataProviderVector::iterator   dataProviderIter;
+    TaskScheduler                              moduleScheduler;
+    vector<int>                                positionTasks;
+    vector<int>                                timelineDependencies;
+    int                                        orbitOutputTask = 0;
+    int                                        linksTask = 0;
+    int                                        linkOutputTask = 0;
+    int                                        timelinesTask = 0;
+
+    try {
+        // journeys holding copied positions only have their revolutions determined
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            shared_ptr<DataProvider> ptrDataProvider = (*dataProviderIter);
+            positionTasks.push_back(moduleScheduler.AddTask(("Positions " + ptrDataProvider->GetDesignator()),
+            ScenarioContext::BindTask([ptrPositionGenerator, ptrDataProvider]() {
+                ptrPositionGenerator->GenerateProviderPositions(ptrDataProvider);
+            })));
+        }
+
+        orbitOutputTask = moduleScheduler.AddTask("Orbit Output", ScenarioContext::BindTask([ptrOutputGenerator]() {
+            ptrOutputGenerator->GenerateOrbitOutput();
+        }), positionTasks);
+
+        if (MURALInputProcessor::RunLinkPathGenerator() == true) {
+            ptrLinksGenerator = shared_ptr<LinksGenerator>(new LinksGenerator());
+            linksTask = moduleScheduler.AddTask("Links", ScenarioContext::BindTask([ptrLinksGenerator, ptrDataProviderCollection]() {
+                ptrLinksGenerator->GenerateLinks(ptrDataProviderCollection);
+            }), positionTasks);
+            linkOutputTask = moduleScheduler.AddTask("Link Output", ScenarioContext::BindTask([ptrOutputGenerator]() {
+                ptrOutputGenerator->GenerateLinkOutput();
+            }), vector<int>(1, linksTask));
+
+            if (MURALInputProcessor::RunTimelineGenerator() == true) {
+                ptrTimelineGenerator = shared_ptr<ValueTimelineGenerator>(new ValueTimelineGenerator());
+                // the timelines update the vehicles, so wait for the orbit output as well
+                timelineDependencies.push_back(orbitOutputTask);
+                timelineDependencies.push_back(linkOutputTask);
+                timelinesTask = moduleScheduler.AddTask("Timelines", ScenarioContext::BindTask([ptrTimelineGenerator, ptrDataProviderCollection]() {
+                    ptrTimelineGenerator->GenerateValueTimelines(ptrDataProviderCollection);
+                }), timelineDependencies);
+                moduleScheduler.AddTask("Timeline Output", ScenarioContext::BindTask([ptrOutputGenerator]() {
+                    ptrOutputGenerator->GenerateValueTimelineOutput();
+                }), vector<int>(1, timelinesTask));
+            }
+        }
+
+        moduleScheduler.Run();
+        moduleScheduler.PrintTaskTimes(cout, ownerName);
+        ptrOutputGenerator->GenerateFinalOutput(executableName);
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(),
+                            "RunModules(const shared_ptr<DataProviderCollection>&, const string&, const string&)");
+        throw;
+    }
+
+    return;
+}
+
+void
+ParametricSweep::PrintSweepTimes(ostream &outfile) const
+{
+    const streamsize                savePrecision = outfile.precision();
+    double                          sweepSeconds = baseInputSeconds_a + basePositionSeconds_a;
+    double                          independentSeconds = 0.0;
+    vector<Variant>::const_iterator variantIter;
+    outfile << fixed << setprecision(3);
+    outfile << "ParametricSweep: " << variantList_a.size() << " Variants, Base Inputs "
+            << baseInputSeconds_a << " s, Base Positions " << basePositionSeconds_a << " s" << NEW_LINE;
+
+    for (variantIter = variantList_a.begin(); variantIter != variantList_a.end(); ++variantIter) {
+        // an independent run reads the inputs and generates the positions itself
+        independentSeconds += (baseInputSeconds_a + variantIter->wallSeconds);
+
+        if (variantIter->sharedPositions == true) {
+            independentSeconds += basePositionSeconds_a;
+        }
+
+        sweepSeconds += variantIter->wallSeconds;
+        outfile << "ParametricSweep:    " << left << setw(40) << variantIter->name << right
+                << setw(10) << variantIter->wallSeconds << " s"
+                << ((variantIter->sharedPositions == true) ? "" : " (own positions)") << NEW_LINE;
+    }
+
+    outfile << "ParametricSweep: Sweep " << sweepSeconds << " s, Independent Runs (estimated) "
+            << independentSeconds << " s, Saved " << (independentSeconds - sweepSeconds) << " s" << NEW_LINE;
+    outfile.unsetf(ios::floatfield);
+    outfile.precision(savePrecision);
+    return;
+}
+
+void
+ParametricSweep::ExtractVariants(const string &sweepFileName)
+{
+    bool                      inVariant = false;
+    string                    line = "";
+    string                    label = "";
+    string                    errorString = "";
+    ifstream                  sweepFile;
+    Variant                   variant;
+    vector<Variant>::iterator variantIter;
+
+    try {
+        ParseUtility::OpenInputFile(sweepFile, sweepFileName);
+
+        while (getline(sweepFile, line, NEW_LINE) && (errorString.size() == 0)) {
+            StringEditor::TrimBlankSpaces(line);
+
+            if ((line.size() > 0) && (line.find("#") == string::npos)) {
+                if (line.find("<SWEEP_VARIANT_START>") != string::npos) {
+                    if (inVariant == true) {
+                        errorString = "Nested START block tag '" + line + "' found!";
+                    }
+
+                    variant = Variant();
+                    inVariant = true;
+                } else if (line.find("<SWEEP_VARIANT_END>") != string::npos) {
+                    if (inVariant == false) {
+                        errorString = "Unexpected closing block tag '" + line + "' found!";
+                    } else if (variant.name.size() == 0) {
+                        errorString = "Missing 'Variant Name' input in SWEEP_VARIANT block";
+                    } else {
+                        if (variant.outputDirectory.size() == 0) {
+                            variant.outputDirectory = variant.name;
+                        }
+
+                        for (variantIter = variantList_a.begin(); variantIter != variantList_a.end(); ++variantIter) {
+                            if ((variantIter->name == variant.name) ||
+                                    (variantIter->outputDirectory == variant.outputDirectory)) {
+                                errorString = "Variant " + variant.name + " repeats the name or output directory of "
+                                              + variantIter->name;
+                            }
+                        }
+
+                        variantList_a.push_back(variant);
+                    }
+
+                    inVariant = false;
+                } else if (inVariant == false) {
+                    errorString = "Input '" + line + "' found outside of a SWEEP_VARIANT block!";
+                } else {
+                    label = InputDataElement::StripOffLabel(line, ":");
+
+                    if (label == "Variant Name") {
+                        variant.name = InputDataElement::StripOffValue(line, ":");
+                    } else if (label == "Output Directory") {
+                        variant.outputDirectory = InputDataElement::StripOffValue(line, ":");
+                    } else if (label == "Override") {
+                        variant.overrideList.push_back(ExtractOverride(InputDataElement::StripOffValue(line, ":")));
+
+                        if (ChangesPositions(variant.overrideList.back()) == true) {
+                            variant.sharedPositions = false;
+                        }
+                    } else {
+                        errorString = "Unknown input '" + line + "' found!";
+                    }
+                }
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "ExtractVariants(const string&)");
+        throw;
+    }
+
+    if ((errorString.size() == 0) && (inVariant == true)) {
+        errorString = "Expected closing block tag '<SWEEP_VARIANT_END>' was not found!";
+    }
+
+    if ((errorString.size() == 0) && (variantList_a.size() == 0)) {
+        errorString = "Did not find any SWEEP_VARIANT blocks in " + sweepFileName;
+    }
+
+    if (errorString.size() > 0) {
+        throw new InputException(GetClassName(), "ExtractVariants(const string&)", errorString);
+    }
+
+    return;
+}
+
+ParametricSweep::InputOverride
+ParametricSweep::ExtractOverride(const string &valueString)
+{
+    const string      constellationTag = "ACTIVE_CONSTELLATION";
+    string            fieldString = "";
+    vector<string>    fieldList;
+    InputOverride     inputOverride;
+    string::size_type startPosition = 0;
+    string::size_type endPosition = 0;
+
+    while (endPosition != string::npos) {
+        endPosition = valueString.find(OVERRIDE_SEPARATOR_s, startPosition);
+        fieldString = valueString.substr(startPosition, (endPosition == string::npos) ? string::npos
+                                         : (endPosition - startPosition));
+        StringEditor::TrimBlankSpaces(fieldString);
+        fieldList.push_back(fieldString);
+        startPosition = endPosition + 1;
+    }
+
+    if ((fieldList.size() != 4) || (fieldList[0].size() == 0) || (fieldList[1].size() == 0) ||
+            (fieldList[2].size() == 0) || (fieldList[3].size() == 0)) {
+        throw new InputException(GetClassName(), "ExtractOverride(const string&)",
+                                 ("Override '" + valueString + "' must be 'designator | block tag | label | value'"));
+    }
+
+    inputOverride.designator = fieldList[0];
+    inputOverride.blockTag = fieldList[1];
+
+    // the tag may be given as it appears in the input file (<TIME_PIECE_START>),
+    // the input parser matches tags verbatim so no case is folded
+    if (inputOverride.blockTag.find('<') != string::npos) {
+        inputOverride.blockTag = InputDataElement::StripOutBlockName(inputOverride.blockTag);
+    }
+    inputOverride.label = fieldList[2];
+    inputOverride.value = fieldList[3];
+
+    // every variant shares the base scenario's data providers
+    if (inputOverride.blockTag == constellationTag) {
+        throw new InputException(GetClassName(), "ExtractOverride(const string&)",
+                                 ("Override '" + valueString + "' can not change the ACTIVE_CONSTELLATION block"));
+    }
+
+    return(inputOverride);
+}
+
+bool
+ParametricSweep::ChangesPositions(const InputOverride &inputOverride)
+{
+    bool changesPositions = false;
+    int  tagIndex = 0;
+
+    while ((tagIndex < NUMBER_OF_POSITION_BLOCK_TAGS_s) && (changesPositions == false)) {
+        changesPositions = (inputOverride.blockTag == POSITION_BLOCK_TAGS_s[tagIndex]);
+        ++tagIndex;
+    }
+
+    return(changesPositions);
+}
+
+void
+ParametricSweep::CreateOutputDirectory(const string &directoryName)
+{
+#ifdef WIN64
+    const int status = _mkdir(directoryName.c_str());
+#else
+    const int status = mkdir(directoryName.c_str(), 0755);
+#endif
+
+    if ((status != 0) && (errno != EEXIST)) {
+        throw new OutputFileException(GetClassName(), "CreateOutputDirectory(const string&)", directoryName);
+    }
+
+    return;
+}
+
+ParametricSweep::~ParametricSweep()
+{
+    return;
+}
@@ -0,0 +1,143 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ParametricSweep.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef PARAMETRIC_SWEEP_H
+#define PARAMETRIC_SWEEP_H "ParametricSweep"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class DataProviderCollection;
+class MURALInputProcessor;
+
+/**
+ * Runs a base scenario under a list of input variants (a trade study over
+ *  link constraints, timeline criteria, ...).  The inputs are read and the
+ *  data provider positions are generated once, for the base scenario; each
+ *  variant then gets its own ScenarioContext, applies its input overrides to
+ *  the inputs already read, copies the base positions and runs the links,
+ *  timelines and output into its own directory.  A variant whose overrides
+ *  could change the positions (POSITION_BLOCK_TAGS_s) generates its own.
+ *
+ * The sweep file lists the variants, each override naming the data provider
+ *  (or ALL_DESIGNATORS_s), the block tag (the whole tag, RECEIVE_FACILITY_ANTENNA
+ *  or <RECEIVE_FACILITY_ANTENNA_BEGIN>) and the full label of the inputs to replace:
+ *
+ * <SWEEP_VARIANT_START>
+ *    Variant Name     : minElevation10
+ *    Output Directory : minElevation10
+ *    Override         : Ground1 | RECEIVE_FACILITY_ANTENNA | Default Minimum Elevation Angle | 10.0
+ * <SWEEP_VARIANT_END>
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * variantList_a                variants in the order they are run
+ * baseInputSeconds_a           wall time to read the base inputs (sec)
+ * basePositionSeconds_a        wall time to generate the base positions (sec)
+ * OVERRIDE_SEPARATOR_s         separates the fields of an override
+ * POSITION_BLOCK_TAGS_s        blocks whose overrides may change positions
+ */
+class ParametricSweep
+{
+public:
+
+    explicit ParametricSweep(const string &sweepFileName);
+    virtual ~ParametricSweep();
+
+    /**
+     * Generates the base scenario's positions and runs every variant
+     *
+     * @param &mainInputFileName the main input file of the base scenario
+     * @param &executableName the executable name (for the final output)
+     */
+    void   Run(const string &mainInputFileName,
+               const string &executableName);
+
+    /**
+     * Prints the wall time of each variant and the time saved versus
+     *  running every variant as an independent MURAL execution
+     *
+     * @param &outfile the stream to print to
+     */
+    void   PrintSweepTimes(ostream &outfile) const;
+
+    static const char   OVERRIDE_SEPARATOR_s;
+    static const string POSITION_BLOCK_TAGS_s[];
+    static const int    NUMBER_OF_POSITION_BLOCK_TAGS_s;
+
+protected:
+
+private:
+
+    struct InputOverride {
+        string designator;
+        string blockTag;
+        string label;
+        string value;
+    };
+
+    struct Variant {
+        string                name;
+        string                outputDirectory;
+        vector<InputOverride> overrideList;
+        bool                  sharedPositions = true;
+        double                wallSeconds = 0.0;
+    };
+
+    ParametricSweep(const ParametricSweep &copyMe);
+    ParametricSweep& operator = (const ParametricSweep &copyMe);
+
+    void   ExtractVariants(const string &sweepFileName);
+    void   RunVariant(Variant &variant,
+                      MURALInputProcessor *ptrInputProcessor,
+                      const shared_ptr<DataProviderCollection> &ptrBaseCollection,
+                      const string &mainInputFileName,
+                      const string &executableName);
+
+    static void   RunModules(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                             const string &ownerName,
+                             const string &executableName);
+
+    static bool   ChangesPositions(const InputOverride &inputOverride);
+    static void   CreateOutputDirectory(const string &directoryName);
+
+    static InputOverride ExtractOverride(const string &valueString);
+
+    static inline string GetClassName();
+
+    vector<Variant> variantList_a;
+    double          baseInputSeconds_a;
+    double          basePositionSeconds_a;
+};
+
+inline
+string
+ParametricSweep::GetClassName()
+{
+    return(PARAMETRIC_SWEEP_H);
+}
+
+#endif
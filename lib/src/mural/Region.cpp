@@ -30,13 +30,12 @@
 #include "general/array/Array2D.h"
 #include "general/math/SpaceVector.h"
 #include "general/utility/StringEditor.h"
+#include "general/utility/ReportWriter.h"
 
-int             Region::numberOfRegions_s        = 0;
 const int       Region::SUB_REGION_DIVIDER_s     = 1000;
-bool            Region::usingSubRegions_s        = false;
-Array<int>*     Region::ptrAccessLevelArray_s    = NULL;
 //Array<int>*   Region::ptrAreaOfInterestArray_s = NULL;
-Array<string>*  Region::ptrGeoRegionLabelArray_s = NULL;
+Region::State               Region::defaultState_s;
+thread_local Region::State *Region::ptrBoundState_s = NULL;
 
 Region::Region()
 	: regionNumber_a(LONG_ZERO), subRegionNumber_a(SHORT_ZERO),
@@ -79,7 +78,7 @@ Region::Region(int regionNumber,
                                  ("Illegal region number " + StringEditor::ConvertToString(regionNumber_a)));
     }
 
-    if ((usingSubRegions_s == true) && (subRegionNumber_a <= 0)) {
+    if ((GetState().usingSubRegions == true) && (subRegionNumber_a <= 0)) {
         throw new InputException(GetClassName(),
                                  "Region(int, const double&, const double&, ...)",
                                  ("Illegal sub-region number " + StringEditor::ConvertToString(subRegionNumber_a)));
@@ -126,26 +125,26 @@ Region::Region(int regionNumber,
 		}
 	}
 	//=========================================================================
-    if (regionNumber_a > numberOfRegions_s) {
-        numberOfRegions_s = regionNumber_a;
+    if (regionNumber_a > GetState().numberOfRegions) {
+        GetState().numberOfRegions = regionNumber_a;
     }
 
 	//RAGUSA 11/28/2018 - Create new way to store access level lists (for all definitions)
 	for (int definition = 1; definition <= numberOfServiceDefinitions; ++definition) {
 		if (GetRegionAccessLevel(definition) > 0) {
-			if (ptrAccessLevelArray_s == NULL) {
-				ptrAccessLevelArray_s = new Array<int>();
+			if (GetState().ptrAccessLevelArray == NULL) {
+				GetState().ptrAccessLevelArray = new Array<int>();
 			}
-			ptrAccessLevelArray_s->InsertUniqueElement(GetRegionAccessLevel(definition));
+			GetState().ptrAccessLevelArray->InsertUniqueElement(GetRegionAccessLevel(definition));
 		}
 	}
 
     if (geoRegionLabel.size() > 0) {
-        if (ptrGeoRegionLabelArray_s == NULL) {
-            ptrGeoRegionLabelArray_s = new Array<string>();
+        if (GetState().ptrGeoRegionLabelArray == NULL) {
+            GetState().ptrGeoRegionLabelArray = new Array<string>();
         }
 
-        ptrGeoRegionLabelArray_s->AddUniqueElement(geoRegionLabel);
+        GetState().ptrGeoRegionLabelArray->AddUniqueElement(geoRegionLabel);
     }
 
     return;
@@ -318,7 +317,7 @@ void
 Region::PrintRegionNumber(ostream &outfile,
                           double regionNumber)
 {
-    if (usingSubRegions_s == false) {
+    if (GetState().usingSubRegions == false) {
         outfile << setw(4) << (int)regionNumber;
     } else {
         outfile << setw(8) << setprecision(3) << regionNumber;
@@ -327,13 +326,26 @@ Region::PrintRegionNumber(ostream &outfile,
     return;
 }
 
+void
+Region::PrintRegionNumber(ReportWriter &writer,
+                          double regionNumber)
+{
+    if (GetState().usingSubRegions == false) {
+        writer.WriteInt((int)regionNumber, 4);
+    } else {
+        writer.WriteFixed(regionNumber, 8, 3);
+    }
+
+    return;
+}
+
 void
 Region::PrintFixedWidthRegionNumber(ostream &outfile,
                                     double regionNumber)
 {
     outfile << setw(8);
 
-    if (usingSubRegions_s == false) {
+    if (GetState().usingSubRegions == false) {
         outfile << (int)regionNumber;
     } else {
         outfile << setprecision(3) << regionNumber;
@@ -345,7 +357,7 @@ Region::PrintFixedWidthRegionNumber(ostream &outfile,
 void
 Region::PrintRegionNumber(ostream &outfile) const
 {
-    if (usingSubRegions_s == false) {
+    if (GetState().usingSubRegions == false) {
         outfile << setw(4) << regionNumber_a;
     } else {
         outfile << setw(8) << setprecision(3) << GetFullRegionNumber();
@@ -359,7 +371,7 @@ Region::PrintFixedWidthRegionNumber(ostream &outfile) const
 {
     outfile << setw(8);
 
-    if (usingSubRegions_s == false) {
+    if (GetState().usingSubRegions == false) {
         outfile << regionNumber_a;
     } else {
         outfile << setprecision(3) << GetFullRegionNumber();
@@ -371,9 +383,9 @@ Region::PrintFixedWidthRegionNumber(ostream &outfile) const
 void
 Region::DestroyRegion()
 {
-    if (ptrAccessLevelArray_s != NULL) {
-        delete ptrAccessLevelArray_s;
-        ptrAccessLevelArray_s = NULL;
+    if (GetState().ptrAccessLevelArray != NULL) {
+        delete GetState().ptrAccessLevelArray;
+        GetState().ptrAccessLevelArray = NULL;
     }
 	/*RAGUSA 11/27/2018 - Don't need 
     if (ptrAreaOfInterestArray_s != NULL) {
@@ -381,16 +393,24 @@ Region::DestroyRegion()
         ptrAreaOfInterestArray_s = NULL;
     }
     */
-    if (ptrGeoRegionLabelArray_s != NULL) {
-        delete ptrGeoRegionLabelArray_s;
-        ptrGeoRegionLabelArray_s = NULL;
+    if (GetState().ptrGeoRegionLabelArray != NULL) {
+        delete GetState().ptrGeoRegionLabelArray;
+        GetState().ptrGeoRegionLabelArray = NULL;
     }
 
     return;
 }
 
+Region::State*
+Region::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 Region::~Region()
 {
-    --numberOfRegions_s;
+    --GetState().numberOfRegions;
     return;
 }
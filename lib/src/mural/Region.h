@@ -35,6 +35,7 @@
 using namespace std;
 
 class SpaceVector;
+class ReportWriter;
 
 /**
  * Class which represents a rectangular region on the the Earth.  Typically this is a WAC, but
@@ -50,12 +51,12 @@ class SpaceVector;
  * SUB_REGION_DIVIDER_s            value used to calculate the sub-region (only
  *                                   if used) as a fractional value (i.e. 7.011
  *                                   is Region 7, Sub-region 11)
- * usingSubRegions_s               indicates if sub-regions (i.e. ATCs or WTMs)
+ * State::usingSubRegions         indicates if sub-regions (i.e. ATCs or WTMs)
  *                                   are being used
  * ptrAreaOfInterestArray_s*       array of AOI region numbers - DEPRECATED
  * ptrAccessDefintionsArray_s*     array of serivce tier definitions for this region (including AOIs)
- * ptrAccessLevelArray_s*          array of the access level(s)
- * ptrGeoRegionLabelArray_s*       array of geo-region designators
+ * State::ptrAccessLevelArray*    array of the access level(s)
+ * State::ptrGeoRegionLabelArray* array of geo-region designators
  * regionNumber_a                  number of this region (i.e. WAC)
  * subRegionNumber_a               sub-region (i.e. ATC) of the region (if used)
  * northernLatitude_a              upper latitude of this region
@@ -79,6 +80,27 @@ class Region
 {
 public:
 
+    /**
+     * The region numbering, access levels and geo-regions of a scenario
+     *  (released by DestroyRegion).  Each ScenarioContext holds its own,
+     *  threads with no context bound share the process wide default.
+     */
+    struct State {
+        int            numberOfRegions = 0;
+        bool           usingSubRegions = false;
+        Array<int>    *ptrAccessLevelArray = NULL;
+        Array<string> *ptrGeoRegionLabelArray = NULL;
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     Region();
     Region(int regionNumber,
            int subRegionNumber,
@@ -101,6 +123,8 @@ public:
     static void  DestroyRegion();
     static void  PrintRegionNumber(ostream &outfile,
                                    double regionNumber);
+    static void  PrintRegionNumber(ReportWriter &writer,
+                                   double regionNumber);
     static void  PrintFixedWidthRegionNumber(ostream &outfile,
             double regionNumber);
 
@@ -189,16 +213,17 @@ private:
 
     static inline string GetClassName();
 
-    static int               numberOfRegions_s;
-    static bool              usingSubRegions_s;
-    static Array<int>       *ptrAccessLevelArray_s;
+    static inline State& GetState();
+
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
+
 	//RAGUSA 11/27/2018 - Each Region has an array of defintions
     Array<int>              *ptrAccessTierArray_a;
 	Array<int>              *ptrAccessAOIArray_a;
     //static Array<int>     *ptrAreaOfInterestArray_s;
 	//int                   accessLevel_a;
 	//========================================================
-    static Array<string>    *ptrGeoRegionLabelArray_s;
     int                     subRegionNumber_a;
     int                     regionNumber_a;
     double                  northernLatitude_a;
@@ -216,8 +241,8 @@ Region::GetAccessLevel(int accessLevelIndex)
 {
     int accessLevel = 0;
 
-    if (ptrAccessLevelArray_s != NULL) {
-        accessLevel = ptrAccessLevelArray_s->ElementAt(accessLevelIndex);
+    if (GetState().ptrAccessLevelArray != NULL) {
+        accessLevel = GetState().ptrAccessLevelArray->ElementAt(accessLevelIndex);
     }
 
     return(accessLevel);
@@ -229,8 +254,8 @@ Region::GetAccessLevelIndex(int accessLevel)
 {
     int accessLevelIndex = -1;
 
-    if (ptrAccessLevelArray_s != NULL) {
-        accessLevelIndex = ptrAccessLevelArray_s->FindIndex(accessLevel);
+    if (GetState().ptrAccessLevelArray != NULL) {
+        accessLevelIndex = GetState().ptrAccessLevelArray->FindIndex(accessLevel);
     }
 
     return(accessLevelIndex);
@@ -242,8 +267,8 @@ Region::GetNumberOfAccessLevels()
 {
     int numberOfAccessLevels = 0;
 
-    if (ptrAccessLevelArray_s != NULL) {
-        numberOfAccessLevels = ptrAccessLevelArray_s->Size();
+    if (GetState().ptrAccessLevelArray != NULL) {
+        numberOfAccessLevels = GetState().ptrAccessLevelArray->Size();
     }
 
     return(numberOfAccessLevels);
@@ -253,7 +278,7 @@ inline
 int
 Region::GetNumberOfRegions()
 {
-    return(numberOfRegions_s);
+    return(GetState().numberOfRegions);
 }
 
 inline
@@ -262,8 +287,8 @@ Region::GetNumberOfGeoRegions()
 {
     int numberOfGeoRegions = 0;
 
-    if (ptrGeoRegionLabelArray_s != NULL) {
-        numberOfGeoRegions = ptrGeoRegionLabelArray_s->Size();
+    if (GetState().ptrGeoRegionLabelArray != NULL) {
+        numberOfGeoRegions = GetState().ptrGeoRegionLabelArray->Size();
     }
 
     return(numberOfGeoRegions);
@@ -275,10 +300,10 @@ Region::GetGeoRegionLabel(int geoRegionIndex)
 {
     string geoRegionLabel = "";
 
-    if (ptrGeoRegionLabelArray_s != NULL) {
+    if (GetState().ptrGeoRegionLabelArray != NULL) {
         if ( (geoRegionIndex >= 0) &&
-                (geoRegionIndex < ptrGeoRegionLabelArray_s->Size()) ) {
-            geoRegionLabel = ptrGeoRegionLabelArray_s->ElementAt(geoRegionIndex);
+                (geoRegionIndex < GetState().ptrGeoRegionLabelArray->Size()) ) {
+            geoRegionLabel = GetState().ptrGeoRegionLabelArray->ElementAt(geoRegionIndex);
         }
     }
 
@@ -302,7 +327,7 @@ inline
 void
 Region::SetUsingSubRegions(const bool &usingSubRegions)
 {
-    usingSubRegions_s = usingSubRegions;
+    GetState().usingSubRegions = usingSubRegions;
 }
 
 inline
@@ -319,7 +344,7 @@ Region::GetFullRegionNumber(int regionNumber,
 {
     double fullRegionNumber = (double)regionNumber;
 
-    if ((usingSubRegions_s == true) && (subRegionNumber > 0)) {
+    if ((GetState().usingSubRegions == true) && (subRegionNumber > 0)) {
         fullRegionNumber += (double)subRegionNumber / SUB_REGION_DIVIDER_s;
     }
 
@@ -330,7 +355,7 @@ inline
 bool
 Region::UsingSubRegions()
 {
-    return(usingSubRegions_s);
+    return(GetState().usingSubRegions);
 }
 
 //RAGUSA 11/27/2018 - Reimplemented method to determine if this region is an AOI
@@ -378,8 +403,8 @@ Region::GetGeoRegionIndex() const
 {
     int geoRegionIndex = -1;
 
-    if (ptrGeoRegionLabelArray_s != NULL) {
-        geoRegionIndex = ptrGeoRegionLabelArray_s->FindIndex(geoRegionLabel_a);
+    if (GetState().ptrGeoRegionLabelArray != NULL) {
+        geoRegionIndex = GetState().ptrGeoRegionLabelArray->FindIndex(geoRegionLabel_a);
     }
 
     return(geoRegionIndex);
@@ -547,6 +572,13 @@ Region::SetEasternLongitude(double newValue)
     easternLongitude_a = newValue;
 }
 
+inline
+Region::State&
+Region::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
+}
+
 inline
 string
 Region::GetClassName()
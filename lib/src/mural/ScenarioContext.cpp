@@ -0,0 +1,93 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ScenarioContext.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include "ScenarioContext.h"
+
+thread_local ScenarioContext *ScenarioContext::ptrBoundContext_s = NULL;
+
+ScenarioContext::Binding::Binding(ScenarioContext *ptrContext)
+    : ptrPreviousContext_a(ptrBoundContext_s)
+{
+    BindStates(ptrContext);
+    return;
+}
+
+ScenarioContext::Binding::~Binding()
+{
+    BindStates(ptrPreviousContext_a);
+    return;
+}
+
+ScenarioContext::ScenarioContext()
+{
+    return;
+}
+
+function<void()>
+ScenarioContext::BindTask(const function<void()> &task)
+{
+    ScenarioContext *ptrContext = ptrBoundContext_s;
+    return([ptrContext, task]() {
+        Binding binding(ptrContext);
+        task();
+    });
+}
+
+void
+ScenarioContext::BindStates(ScenarioContext *ptrContext)
+{
+    ptrBoundContext_s = ptrContext;
+
+    if (ptrContext != NULL) {
+        TimePiece::BindState(&(ptrContext->timePieceState_a));
+        UnitData::BindState(&(ptrContext->unitDataState_a));
+        FileNames::BindState(&(ptrContext->fileNamesState_a));
+        Earth::BindState(&(ptrContext->earthState_a));
+        Region::BindState(&(ptrContext->regionState_a));
+        TargetDeck::BindState(&(ptrContext->targetDeckState_a));
+        MURALInputProcessor::BindState(&(ptrContext->inputProcessorState_a));
+        LinksGenerator::BindState(&(ptrContext->linksGeneratorState_a));
+        Journey::BindState(&(ptrContext->journeyState_a));
+    } else {
+        TimePiece::BindState(NULL);
+        UnitData::BindState(NULL);
+        FileNames::BindState(NULL);
+        Earth::BindState(NULL);
+        Region::BindState(NULL);
+        TargetDeck::BindState(NULL);
+        MURALInputProcessor::BindState(NULL);
+        LinksGenerator::BindState(NULL);
+        Journey::BindState(NULL);
+    }
+
+    return;
+}
+
+ScenarioContext::~ScenarioContext()
+{
+    // release the region tables and target deck this scenario created
+    // (both are safe to release twice)
+    Binding binding(this);
+    Earth::DestroyRegions();
+    TargetDeck::DestroyTargetDeck();
+    return;
+}
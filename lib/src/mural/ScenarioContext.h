@@ -0,0 +1,145 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ScenarioContext.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef SCENARIO_CONTEXT_H
+#define SCENARIO_CONTEXT_H "ScenarioContext"
+
+#include <functional>
+#include <string>
+
+#include "mural/Earth.h"
+#include "mural/Region.h"
+#include "mural/io/FileNames.h"
+#include "mural/io/MURALInputProcessor.h"
+#include "mural/modules/lg/LinksGenerator.h"
+#include "mural/modules/pg/Journey.h"
+#include "mural/modules/ts/TargetDeck.h"
+
+#include "general/data/UnitData.h"
+#include "general/time/TimePiece.h"
+
+using namespace std;
+
+/**
+ * The run wide state of one scenario: the time period (TimePiece), units
+ *  (UnitData), file names (FileNames), region tables (Earth, Region), target
+ *  deck settings (TargetDeck), run control (MURALInputProcessor) and link and
+ *  interpolation settings (LinksGenerator, Journey).
+ *
+ * Those classes keep their static accessors; each reads the State bound to
+ *  the calling thread and falls back to a process wide default when none is
+ *  bound, so a single scenario run needs no context at all.  To evaluate
+ *  several scenarios in one process, give each its own context and bind it
+ *  (ScenarioContext::Binding) on the thread that reads the inputs and runs
+ *  the generators.  Work handed to other threads (e.g. a TaskScheduler) is
+ *  wrapped with BindTask so it runs against the same scenario.
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * timePieceState_a             time period of the scenario
+ * unitDataState_a              input, output and internal units
+ * fileNamesState_a             input, output and debug file names
+ * earthState_a                 region tables
+ * regionState_a                region numbering, access levels, geo-regions
+ * targetDeckState_a            target deck settings
+ * inputProcessorState_a        run control (modules to run)
+ * linksGeneratorState_a        link generation settings
+ * journeyState_a               interpolation settings
+ * ptrBoundContext_s*           context bound to the current thread (if any)
+ */
+class ScenarioContext
+{
+public:
+
+    /**
+     * Scoped binding of a context to the current thread.  The previously
+     *  bound context (NULL for the process wide default) is restored when the
+     *  binding goes out of scope, including when an exception is thrown.
+     */
+    class Binding
+    {
+    public:
+
+        explicit Binding(ScenarioContext *ptrContext);
+        ~Binding();
+
+    private:
+
+        Binding(const Binding &copyMe);
+        Binding& operator = (const Binding &copyMe);
+
+        ScenarioContext *ptrPreviousContext_a;
+    };
+
+    ScenarioContext();
+    virtual ~ScenarioContext();
+
+    /**
+     * Wraps a task so it runs with the calling thread's current context bound
+     *  on whichever thread executes it
+     *
+     * @param &task the task to wrap
+     * @return function<void()> the wrapped task
+     */
+    static function<void()> BindTask(const function<void()> &task);
+
+    static inline ScenarioContext* GetBoundContext();
+
+protected:
+
+private:
+
+    ScenarioContext(const ScenarioContext &copyMe);
+    ScenarioContext& operator = (const ScenarioContext &copyMe);
+
+    static void   BindStates(ScenarioContext *ptrContext);
+
+    static inline string GetClassName();
+
+    TimePiece::State           timePieceState_a;
+    UnitData::State            unitDataState_a;
+    FileNames::State           fileNamesState_a;
+    Earth::State               earthState_a;
+    Region::State              regionState_a;
+    TargetDeck::State          targetDeckState_a;
+    MURALInputProcessor::State inputProcessorState_a;
+    LinksGenerator::State      linksGeneratorState_a;
+    Journey::State             journeyState_a;
+
+    static thread_local ScenarioContext *ptrBoundContext_s;
+};
+
+inline
+ScenarioContext*
+ScenarioContext::GetBoundContext()
+{
+    return(ptrBoundContext_s);
+}
+
+inline
+string
+ScenarioContext::GetClassName()
+{
+    return(SCENARIO_CONTEXT_H);
+}
+
+#endif
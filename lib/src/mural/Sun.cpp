@@ -26,6 +26,8 @@
 #include "general/math/SpaceVector.h"
 #include "general/time/TimePiece.h"
 
+#include "constants.h"
+
 const double Sun::RADIUS_NMI_s = 751664.00;
 
 Sun::Sun()
@@ -72,6 +74,26 @@ Sun::GetPosition(int timeIndex)
 SpaceVector
 Sun::GetPosition(int timeIndex,
                  const REFERENCE_FRAME &returnFrame)
+{
+    return(DetermineEciPosition(TimePiece::GetJ2000Time(timeIndex)).ConvertTo(returnFrame, timeIndex));
+}
+
+SpaceVector
+Sun::GetInterimPosition(int timeIndex,
+                        double additionalSeconds)
+{
+    const double j2000Time = TimePiece::GetJ2000Time(timeIndex) + additionalSeconds;
+    return(DetermineEciPosition(j2000Time).ConvertTo(UnitData::GetInternalReferenceFrame(), j2000Time));
+}
+
+double
+Sun::GetStoreRadius()
+{
+    return(SimpleMath::ConvertDistance(A3::SUN_RADIUS_NMI, NAUTICAL_MILES, UnitData::GetInternalDistanceUnits()));
+}
+
+SpaceVector
+Sun::DetermineEciPosition(double j2000Time)
 {
     double meanLongitude;
     double       meanAnomaly = 0.0;
@@ -81,7 +103,7 @@ Sun::GetPosition(int timeIndex,
     double       sineOfDeclination = 0.0;
     double       cosineOfDeclination = 0.0;
     double       rightAscension = 0.0;
-    const double day = TimePiece::GetJ2000Time(timeIndex) * DAYS_PER_SECOND;
+    const double day = j2000Time * DAYS_PER_SECOND;
     const double earthRadius = Earth::GetStoreRadius();
     const double fullCircle = UnitData::GetStoreFullCircle();
     SpaceVector  positionVector;
@@ -109,7 +131,7 @@ Sun::GetPosition(int timeIndex,
     positionVector = SpaceVector((cosineOfDeclination * cos(rightAscension) * magnitude),
                                  (cosineOfDeclination * sin(rightAscension) * magnitude),
                                  (sineOfDeclination * magnitude), EARTH_CENTER_INERTIAL);
-    return(positionVector.ConvertTo(returnFrame, timeIndex));
+    return(positionVector);
 }
 
 bool
@@ -55,12 +55,34 @@ public:
     static SpaceVector GetPosition(int timeIndex,
                                    const REFERENCE_FRAME &returnFrame);
 
+    /**
+     * Gets the position (internal reference frame) at the given seconds past
+     * the time index, evaluating the analytic model at that instant rather
+     * than interpolating between time steps.
+     *
+     * @param timeIndex the time index
+     * @param additionalSeconds seconds past the time index
+     * @return SpaceVector the position
+     */
+    static SpaceVector GetInterimPosition(int timeIndex,
+                                          double additionalSeconds);
+
+    /**
+     * Gets the radius of the Sun (A3::SUN_RADIUS_NMI) in the internal
+     * distance units
+     *
+     * @return double the radius
+     */
+    static double      GetStoreRadius();
+
 protected:
 
 private:
 
     Sun();
 
+    static SpaceVector DetermineEciPosition(double j2000Time);
+
     static inline string GetClassName();
 
     static const double RADIUS_NMI_s;
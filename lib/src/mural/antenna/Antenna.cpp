@@ -135,6 +135,8 @@ Antenna::operator = (const Antenna &copyMe)
                                     );
     }
 
+    elevationMaskTable_a = copyMe.elevationMaskTable_a;
+
     if (copyMe.ptrLinkConstraintData_a != NULL) {
         ptrLinkConstraintData_a = unique_ptr<DefaultedData<MURALTypes::LinkConstraintDataPtr>>(
                                       new DefaultedData<MURALTypes::LinkConstraintDataPtr>(*copyMe.ptrLinkConstraintData_a)
@@ -461,38 +463,46 @@ Antenna::GetAzimuthBasedElevationAngles(double azimuthAngle,
                                         double &minimumElevationAngle,
                                         double &maximumElevationAngle) const
 {
-    string											errorString = "";
-    shared_ptr<AzimuthAngleData>					ptrLowerAzimuthAngleData = NULL;
-    shared_ptr<AzimuthAngleData>					ptrAzimuthAngleData = NULL;
-    MURALTypes::AzimuthAngleDataVector::iterator	azimuthDataIter;
+    const double fullCircle = UnitData::GetStoreFullCircle();
+    double       lookupAzimuth = azimuthAngle;
+    string       errorString = "";
     minimumElevationAngle = UNDEFINED_ANGLE;
     maximumElevationAngle = UNDEFINED_ANGLE;
 
-    for(azimuthDataIter = ptrAzimuthAngleDataList_a->begin(); (azimuthDataIter != ptrAzimuthAngleDataList_a->end()) && (minimumElevationAngle == UNDEFINED_ANGLE); ++azimuthDataIter) {
-        ptrAzimuthAngleData = (*azimuthDataIter);
-
-        if (ptrAzimuthAngleData->GetAzimuthAngle() > azimuthAngle) {
-            ptrLowerAzimuthAngleData = *(azimuthDataIter - 1); // Previous
-            minimumElevationAngle = SimpleMath::Interpolate(
-                                        ptrLowerAzimuthAngleData->GetAzimuthAngle(),
-                                        ptrAzimuthAngleData->GetAzimuthAngle(),
-                                        azimuthAngle,
-                                        ptrLowerAzimuthAngleData->GetMinimumElevationAngle(),
-                                        ptrAzimuthAngleData->GetMinimumElevationAngle()
-                                    );
-            maximumElevationAngle = SimpleMath::Interpolate(
-                                        ptrLowerAzimuthAngleData->GetAzimuthAngle(),
-                                        ptrAzimuthAngleData->GetAzimuthAngle(),
-                                        azimuthAngle,
-                                        ptrLowerAzimuthAngleData->GetMaximumElevationAngle(),
-                                        ptrAzimuthAngleData->GetMaximumElevationAngle()
-                                    );
-        } else if (ptrAzimuthAngleData->GetAzimuthAngle() == azimuthAngle) {
-            minimumElevationAngle = ptrAzimuthAngleData->GetMinimumElevationAngle();
-            maximumElevationAngle = ptrAzimuthAngleData->GetMaximumElevationAngle();
+    if (elevationMaskTable_a.empty() == false) {
+        const ElevationMaskPoint &firstPoint = elevationMaskTable_a.front();
+        const ElevationMaskPoint &lastPoint = elevationMaskTable_a.back();
+
+        // an azimuth given a full circle away from the mask's range maps onto it
+        if ((lookupAzimuth < firstPoint.azimuth) && ((lookupAzimuth + fullCircle) <= lastPoint.azimuth)) {
+            lookupAzimuth += fullCircle;
+        } else if ((lookupAzimuth > lastPoint.azimuth) && ((lookupAzimuth - fullCircle) >= firstPoint.azimuth)) {
+            lookupAzimuth -= fullCircle;
+        }
+
+        if ((lookupAzimuth >= firstPoint.azimuth) && (lookupAzimuth <= lastPoint.azimuth)) {
+            // first mask azimuth at or past the lookup azimuth
+            vector<ElevationMaskPoint>::const_iterator upperIter = std::lower_bound(
+                        elevationMaskTable_a.begin(), elevationMaskTable_a.end(), lookupAzimuth,
+            [](const ElevationMaskPoint & maskPoint, double value) {
+                return(maskPoint.azimuth < value);
+            });
+
+            if (upperIter->azimuth == lookupAzimuth) {
+                minimumElevationAngle = upperIter->minimumElevation;
+                maximumElevationAngle = upperIter->maximumElevation;
+            } else {
+                vector<ElevationMaskPoint>::const_iterator lowerIter = upperIter - 1;
+                minimumElevationAngle = SimpleMath::Interpolate(lowerIter->azimuth, upperIter->azimuth, lookupAzimuth,
+                                        lowerIter->minimumElevation, upperIter->minimumElevation);
+                maximumElevationAngle = SimpleMath::Interpolate(lowerIter->azimuth, upperIter->azimuth, lookupAzimuth,
+                                        lowerIter->maximumElevation, upperIter->maximumElevation);
+            }
         }
     }
 
+    // an azimuth outside the mask (a mask that does not cover the full circle)
+    // is an input error, the gap is not interpolated
     if (minimumElevationAngle == UNDEFINED_ANGLE) {
         errorString = "Could not find range for azimuth angle " +
                       StringEditor::ConvertToString(UnitData::GetInputAngle(azimuthAngle));
@@ -506,6 +516,28 @@ Antenna::GetAzimuthBasedElevationAngles(double azimuthAngle,
     return;
 }
 
+void
+Antenna::CompileElevationMask()
+{
+    MURALTypes::AzimuthAngleDataVector::const_iterator azimuthDataIter;
+    elevationMaskTable_a.clear();
+
+    if (ptrAzimuthAngleDataList_a != NULL) {
+        elevationMaskTable_a.reserve(ptrAzimuthAngleDataList_a->size());
+
+        for (azimuthDataIter = ptrAzimuthAngleDataList_a->begin();
+                azimuthDataIter != ptrAzimuthAngleDataList_a->end(); ++azimuthDataIter) {
+            ElevationMaskPoint maskPoint;
+            maskPoint.azimuth = (*azimuthDataIter)->GetAzimuthAngle();
+            maskPoint.minimumElevation = (*azimuthDataIter)->GetMinimumElevationAngle();
+            maskPoint.maximumElevation = (*azimuthDataIter)->GetMaximumElevationAngle();
+            elevationMaskTable_a.push_back(maskPoint);
+        }
+    }
+
+    return;
+}
+
 double
 Antenna::GetMaximumElevationAngle(const string &designator) const
 {
@@ -1464,9 +1496,233 @@ Antenna::GetMultiLinksArray() const
     return(ptrMultiLinkArray);
 }
 
+/**
+ * Assigns each allocation on this antenna to a capacity slot.  The links'
+ * allocations are collapsed once into per asset runs, which are swept in
+ * start time (then link list) order onto the lowest slot free since before
+ * the run started.  This is the same assignment the slot by slot time step
+ * scan makes: a slot always takes the earliest starting run it can, and a
+ * run is never split across slots.  When an asset is allocated by more than
+ * one link at the same time step the runs are ambiguous, so the time step
+ * scan is used instead.
+ *
+ * The switch threshold only lets the time step scan skip time steps without
+ * any allocation, so it never changes the sweep's assignments.
+ */
 void
 Antenna::MakeBestFitAllocatedAssetAssignments(bool assetIsTransmitter,
         int switchThreshold)
+{
+    const int                  ZERO = 0;
+    const int                  numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    vector<AllocationInterval> intervalList;
+    vector<AssetRun>           runList;
+
+    if ((ptrLinksList_a == NULL) || (ptrLinksList_a->Size() == 0)) {
+        return;
+    }
+
+    BuildAllocationIntervals(assetIsTransmitter, intervalList);
+
+    if (BuildAssetRuns(intervalList, runList) == false) {
+        MakeTimeStepAllocatedAssetAssignments(assetIsTransmitter, switchThreshold);
+        return;
+    }
+
+    vector<int>                          allocationCount(numberOfTimeSteps + 1, ZERO);
+    vector<int>                          slotEndTime(capacity_a, -1);
+    vector<AllocationInterval>::iterator intervalIter;
+    vector<AssetRun>::iterator           runIter;
+    int                                  timeIndex = 0;
+    int                                  runningCount = 0;
+    if (ptrAllocatedAssetArray_a != NULL) {
+        delete ptrAllocatedAssetArray_a;
+    }
+
+    ptrAllocatedAssetArray_a = new Array2D<int>(numberOfTimeSteps, capacity_a, ZERO);
+
+    for (intervalIter = intervalList.begin(); intervalIter != intervalList.end(); ++intervalIter) {
+        ++allocationCount[intervalIter->startTime];
+        --allocationCount[intervalIter->endTime + 1];
+    }
+
+    while (timeIndex < numberOfTimeSteps) {
+        runningCount += allocationCount[timeIndex];
+
+        if (GetCapacity(timeIndex) < runningCount) {
+            cout << "Antenna:  ERROR  Allocated asset(s) exceeds capcity at time step "
+                 << TimePiece::GetTimeStep(timeIndex) << " on "
+                 << GetDataProviderDesignator() << NEW_LINE;
+        }
+
+        ++timeIndex;
+    }
+
+    std::sort(runList.begin(), runList.end(), SortRunByStart);
+
+    for (runIter = runList.begin(); runIter != runList.end(); ++runIter) {
+        int capacityCount = 0;
+
+        while ((capacityCount < capacity_a) && (slotEndTime[capacityCount] >= runIter->startTime)) {
+            ++capacityCount;
+        }
+
+        // no slot free for the whole run, it stays unassigned
+        if (capacityCount < capacity_a) {
+            int intervalIndex = runIter->firstInterval;
+
+            while (intervalIndex <= runIter->lastInterval) {
+                const AllocationInterval &interval = intervalList[intervalIndex];
+                timeIndex = interval.startTime;
+
+                while (timeIndex <= interval.endTime) {
+                    (*ptrAllocatedAssetArray_a)[timeIndex][capacityCount] = interval.assetNumber;
+                    ++timeIndex;
+                }
+
+                ++intervalIndex;
+            }
+
+            slotEndTime[capacityCount] = runIter->endTime;
+        }
+    }
+
+    return;
+}
+
+void
+Antenna::BuildAllocationIntervals(bool assetIsTransmitter,
+                                  vector<AllocationInterval> &intervalList) const
+{
+    const int          numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    ListIterator<Link> linksListIter(ptrLinksList_a);
+    Link              *ptrLink = linksListIter.First();
+    int                linkIndex = 0;
+
+    while (ptrLink != NULL) {
+        AllocationInterval interval;
+        int                assetNumber = 0;
+        int                timeAssetNumber = 0;
+        int                timeIndex = 0;
+
+        if (assetIsTransmitter == false) {
+            assetNumber = ptrLink->GetTransmitNumber();
+        } else {
+            assetNumber = ptrLink->GetReceiveNumber();
+        }
+
+        interval.linkIndex = linkIndex;
+
+        while (timeIndex < numberOfTimeSteps) {
+            timeAssetNumber = 0;
+
+            if (ptrLink->IsAcquiringOrDroplinking(timeIndex) == true) {
+                timeAssetNumber = -assetNumber;
+            } else if ((ptrLink->IsAllocatedMission(timeIndex) == true) ||
+                       (ptrLink->IsAllocatedBuffer(timeIndex) == true) ||
+                       (ptrLink->IsAllocatedStateOfHealth(timeIndex) == true) ||
+                       (ptrLink->IsAllocatedOverhead(timeIndex) == true) ||
+                       ((ptrLink->IsAllocatedReceivePrep(timeIndex) == true) && (assetIsTransmitter == false)) ||
+                       ((ptrLink->IsAllocatedTransmitPrep(timeIndex) == true) && (assetIsTransmitter == true))) {
+                timeAssetNumber = assetNumber;
+            }
+
+            if (timeAssetNumber != interval.assetNumber) {
+                if (interval.assetNumber != 0) {
+                    interval.endTime = timeIndex - 1;
+                    intervalList.push_back(interval);
+                }
+
+                interval.startTime = timeIndex;
+                interval.assetNumber = timeAssetNumber;
+            }
+
+            ++timeIndex;
+        }
+
+        if (interval.assetNumber != 0) {
+            interval.endTime = numberOfTimeSteps - 1;
+            intervalList.push_back(interval);
+        }
+
+        ++linkIndex;
+        ptrLink = linksListIter.Next();
+    }
+
+    return;
+}
+
+bool
+Antenna::BuildAssetRuns(vector<AllocationInterval> &intervalList,
+                        vector<AssetRun> &runList) const
+{
+    const int numberOfIntervals = (int)intervalList.size();
+    int       intervalIndex = 0;
+
+    std::sort(intervalList.begin(), intervalList.end(), SortIntervalByAsset);
+
+    while (intervalIndex < numberOfIntervals) {
+        const AllocationInterval &interval = intervalList[intervalIndex];
+        const bool                sameAsset = (runList.empty() == false)
+                                              && (abs(interval.assetNumber)
+                                                  == abs(intervalList[runList.back().lastInterval].assetNumber));
+
+        if ((sameAsset == true) && (interval.startTime <= runList.back().endTime)) {
+            // the asset is allocated twice at the same time step
+            return(false);
+        }
+
+        if ((sameAsset == true) && (interval.startTime == (runList.back().endTime + 1))) {
+            runList.back().endTime = interval.endTime;
+            runList.back().lastInterval = intervalIndex;
+        } else {
+            AssetRun run;
+            run.startTime = interval.startTime;
+            run.endTime = interval.endTime;
+            run.linkIndex = interval.linkIndex;
+            run.firstInterval = intervalIndex;
+            run.lastInterval = intervalIndex;
+            runList.push_back(run);
+        }
+
+        ++intervalIndex;
+    }
+
+    return(true);
+}
+
+bool
+Antenna::SortIntervalByAsset(const AllocationInterval &intervalI,
+                             const AllocationInterval &intervalJ)
+{
+    const int assetI = abs(intervalI.assetNumber);
+    const int assetJ = abs(intervalJ.assetNumber);
+
+    if (assetI != assetJ) {
+        return(assetI < assetJ);
+    }
+
+    if (intervalI.startTime != intervalJ.startTime) {
+        return(intervalI.startTime < intervalJ.startTime);
+    }
+
+    return(intervalI.linkIndex < intervalJ.linkIndex);
+}
+
+bool
+Antenna::SortRunByStart(const AssetRun &runI,
+                        const AssetRun &runJ)
+{
+    if (runI.startTime != runJ.startTime) {
+        return(runI.startTime < runJ.startTime);
+    }
+
+    return(runI.linkIndex < runJ.linkIndex);
+}
+
+void
+Antenna::MakeTimeStepAllocatedAssetAssignments(bool assetIsTransmitter,
+        int switchThreshold)
 {
     const int        ZERO = 0;
     const int         numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
@@ -1514,6 +1770,10 @@ Antenna::MakeBestFitAllocatedAssetAssignments(bool assetIsTransmitter,
             ptrLink = linksListIter.Next();
         }
 
+        if (ptrAllocatedAssetArray_a != NULL) {
+            delete ptrAllocatedAssetArray_a;
+        }
+
         ptrAllocatedAssetArray_a = new Array2D<int>(numberOfTimeSteps, capacity_a, ZERO);
         timeIndex = 0;
 
@@ -1840,6 +2100,8 @@ void
 Antenna::SetAzimuthAngleDataList(const shared_ptr<MURALTypes::AzimuthAngleDataVector> &ptrAzimuthAngleDataList)
 {
     ptrAzimuthAngleDataList_a = ptrAzimuthAngleDataList;
+    // the extractor sorts the list by azimuth before setting it
+    CompileElevationMask();
 }
 
 /* *************************************************************************************** */
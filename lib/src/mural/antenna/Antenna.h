@@ -25,6 +25,7 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "AntennaBase.h"
 #include "mural/modules/lg/Link.h"
@@ -88,6 +89,8 @@ class Element;
  * ptrDedicatedTransmitterArray_a   array of dedicated tranmsitter designators
  * ptrPrecludedReceiverArray_a      array of precluded receiver designators
  * ptrAzimuthAngleDataList_a        link list of AzimuthAngleData instances
+ * elevationMaskTable_a             AzimuthAngleData list flattened (in azimuth
+ *                                    order) for the elevation mask lookups
  * ptrLinksList_a*                  link list of Link instances
  * ptrOutageTimePeriodList_a        link list of OutageTimePeriod instances
  *
@@ -143,6 +146,14 @@ public:
     void   MakeBestFitAllocatedAssetAssignments(bool assetIsTransmitter = false,
             int switchThreshold = 0);
 
+    /**
+     * Slot by slot time step scan, used by MakeBestFitAllocatedAssetAssignments
+     * when an asset's runs are ambiguous and as the reference it is checked
+     * against
+     */
+    void   MakeTimeStepAllocatedAssetAssignments(bool assetIsTransmitter,
+            int switchThreshold);
+
     void   PrintAttributes(ostream &outfile) const;
 
     bool   CheckCapacityEmpty(int timeIndex) const;
@@ -360,9 +371,58 @@ protected:
 
 private:
 
+    /**
+     * Run of consecutive time steps a single link holds the same (signed)
+     * asset number on this antenna (negative while acquiring/droplinking)
+     */
+    struct AllocationInterval {
+        int startTime = 0;
+        int endTime = 0;
+        int assetNumber = 0;
+        int linkIndex = 0;
+    };
+
+    /**
+     * Maximal run of consecutive time steps an asset is allocated on this
+     * antenna, made of one or more adjacent AllocationIntervals (indices
+     * firstInterval through lastInterval of the sorted interval list)
+     */
+    struct AssetRun {
+        int startTime = 0;
+        int endTime = 0;
+        int linkIndex = 0;
+        int firstInterval = 0;
+        int lastInterval = 0;
+    };
+
+    void   BuildAllocationIntervals(bool assetIsTransmitter,
+                                    vector<AllocationInterval> &intervalList) const;
+
+    bool   BuildAssetRuns(vector<AllocationInterval> &intervalList,
+                          vector<AssetRun> &runList) const;
+
+    /**
+     * Elevation limits at one azimuth of the azimuth based elevation mask
+     * (stored units)
+     */
+    struct ElevationMaskPoint {
+        double azimuth = 0.0;
+        double minimumElevation = 0.0;
+        double maximumElevation = 0.0;
+    };
+
+    void   CompileElevationMask();
+
+    static bool SortIntervalByAsset(const AllocationInterval &intervalI,
+                                    const AllocationInterval &intervalJ);
+    static bool SortRunByStart(const AssetRun &runI,
+                               const AssetRun &runJ);
+
     static inline string GetClassName();
 
     static const char             ASSIGNMENT_INTERVAL_ID_s;
+
+    vector<ElevationMaskPoint>    elevationMaskTable_a;
 };
 
 inline
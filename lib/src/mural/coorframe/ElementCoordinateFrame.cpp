@@ -225,10 +225,28 @@ ElementCoordinateFrame::GetGroundCoordinateFrame(const Element &element,
         int timeIndex,
         double additionalSeconds)
 {
-    const shared_ptr<Journey> ptrJourney      = element.GetJourney();
+    const shared_ptr<Journey>               ptrJourney = element.GetJourney();
+    const shared_ptr<const CoordinateFrame> ptrTopocentricFrame = ptrJourney->GetTopocentricFrame();
+    shared_ptr<CoordinateFrame>             ptrGroundFrame = NULL;
+
+    if (ptrTopocentricFrame != NULL) {
+        // callers rotate the frame they are handed, so each gets its own copy
+        ptrGroundFrame = shared_ptr<CoordinateFrame>(new CoordinateFrame(*ptrTopocentricFrame));
+    } else {
+        ptrGroundFrame = DetermineGroundCoordinateFrame(ptrJourney->GetInterimPosition(timeIndex, additionalSeconds));
+    }
+
+    return(ptrGroundFrame);
+}
+
+/* ****************************************************************************************** */
+
+shared_ptr<CoordinateFrame>
+ElementCoordinateFrame::DetermineGroundCoordinateFrame(const SpaceVector &groundPosition)
+{
     const SpaceVector northVector = SpaceVector(0.0, 0.0, Earth::GetStoreRadius());
     // Z-axis is pointing over head
-    const SpaceVector groundAxisZ = ptrJourney->GetInterimPosition(timeIndex, additionalSeconds);
+    const SpaceVector groundAxisZ = groundPosition;
     // Y-axis is pointing west
     const SpaceVector groundAxisY = groundAxisZ.CrossProduct(northVector);
     // X-axis is pointing north
@@ -92,6 +92,14 @@ public:
             double additionalSeconds = 0.0,
             double regionNumber = 0.0);
 
+    /**
+     * Returns the GroundCoordinateFrame (X north, Y west, Z overhead) at a
+     * ground position
+     *
+     * @param groundPosition the ground position (internal reference frame)
+     */
+    static shared_ptr<CoordinateFrame> DetermineGroundCoordinateFrame(const SpaceVector &groundPosition);
+
 protected:
 
 private:
@@ -121,7 +129,8 @@ private:
             double additionalSeconds = 0.0);
 
     /**
-     * Returns the fixed GroundCoordinateFrame at the given instance in time
+     * Returns the fixed GroundCoordinateFrame at the given instance in time, a
+     * copy of the journey's topocentric frame when the ground is stationary
      *
      * @param element the reference to the element to get pos/vel data
      * @param timeIndex the time index to get the coordainte frame
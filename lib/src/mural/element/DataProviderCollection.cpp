@@ -26,6 +26,15 @@
 #include "mural/element/UserVehicle.h"
 #include "mural/element/RelaySatellite.h"
 #include "mural/element/GroundStation.h"
+#include "mural/antenna/GroundPointingAntenna.h"
+#include "mural/antenna/ReceiveFacilityAntenna.h"
+#include "mural/antenna/RelayPointingAntenna.h"
+#include "mural/antenna/UserPointingAntenna.h"
+#include "mural/modules/lg/Link.h"
+#include "mural/modules/pg/Journey.h"
+#include "mural/modules/vtg/ValueTimeline.h"
+#include "general/array/LinkList.h"
+#include "general/array/ListIterator.h"
 #include "general\utility\Utility.h"
 
 DataProviderCollection::DataProviderCollection()
@@ -350,6 +359,119 @@ DataProviderCollection::FindDataProvider(const string &designator)
 
 /* ******************************************************************************* */
 
+size_t
+DataProviderCollection::GetPositionsMemoryFootprint()
+{
+    size_t                                   footprint = 0;
+    MURALTypes::DataProviderVector::iterator providerIter;
+
+    for (providerIter = ptrDataProviderList_a->begin(); providerIter != ptrDataProviderList_a->end(); ++providerIter) {
+        if ((*providerIter)->GetJourney() != NULL) {
+            footprint += (*providerIter)->GetJourney()->GetMemoryFootprint();
+        }
+    }
+
+    return(footprint);
+}
+
+/* ******************************************************************************* */
+
+size_t
+DataProviderCollection::GetLinksMemoryFootprint()
+{
+    size_t                           footprint = 0;
+    set<const Link*>                 countedLinks;
+    MURALTypes::UserVector::iterator userIter;
+    MURALTypes::RelayVector::iterator relayIter;
+    MURALTypes::GroundVector::iterator groundIter;
+
+    // the user transmit links cover the crosslinks, direct downlinks and self relay links
+    for (userIter = ptrUserVehicleList_a->begin(); userIter != ptrUserVehicleList_a->end(); ++userIter) {
+        LinkList<Link> *ptrTransmitLinksList = (*userIter)->GetAllTransmitLinks();
+        footprint += GetLinksMemoryFootprint(ptrTransmitLinksList, countedLinks);
+        ptrTransmitLinksList->RemoveAll();
+        delete ptrTransmitLinksList;
+        ptrTransmitLinksList = NULL;
+    }
+
+    for (relayIter = ptrRelaySatelliteList_a->begin(); relayIter != ptrRelaySatelliteList_a->end(); ++relayIter) {
+        shared_ptr<MURALTypes::GPAVector> ptrGPAList = (*relayIter)->GetGroundPointingAntennaList();
+        shared_ptr<MURALTypes::RPAVector> ptrRPAList = (*relayIter)->GetRelayPointingAntennaList();
+        MURALTypes::GPAVector::iterator   gpaIter;
+        MURALTypes::RPAVector::iterator   rpaIter;
+
+        if (ptrGPAList != NULL) {
+            for (gpaIter = ptrGPAList->begin(); gpaIter != ptrGPAList->end(); ++gpaIter) {
+                footprint += GetLinksMemoryFootprint((*gpaIter)->GetLinksList(), countedLinks);
+            }
+        }
+
+        if (ptrRPAList != NULL) {
+            for (rpaIter = ptrRPAList->begin(); rpaIter != ptrRPAList->end(); ++rpaIter) {
+                footprint += GetLinksMemoryFootprint((*rpaIter)->GetLinksList(), countedLinks);
+            }
+        }
+    }
+
+    for (groundIter = ptrGroundStationList_a->begin(); groundIter != ptrGroundStationList_a->end(); ++groundIter) {
+        shared_ptr<MURALTypes::RFAVector> ptrRFList = (*groundIter)->GetRFList();
+        MURALTypes::RFAVector::iterator   rfIter;
+
+        if (ptrRFList != NULL) {
+            for (rfIter = ptrRFList->begin(); rfIter != ptrRFList->end(); ++rfIter) {
+                footprint += GetLinksMemoryFootprint((*rfIter)->GetLinksList(), countedLinks);
+            }
+        }
+    }
+
+    return(footprint);
+}
+
+/* ******************************************************************************* */
+
+size_t
+DataProviderCollection::GetLinksMemoryFootprint(const LinkList<Link> *ptrLinksList,
+        set<const Link*> &countedLinks)
+{
+    size_t             footprint = 0;
+    ListIterator<Link> linksListIter(ptrLinksList);
+    Link              *ptrLink = linksListIter.First();
+
+    while (ptrLink != NULL) {
+        if (countedLinks.insert(ptrLink).second == true) {
+            footprint += ptrLink->GetMemoryFootprint();
+        }
+
+        ptrLink = linksListIter.Next();
+    }
+
+    return(footprint);
+}
+
+/* ******************************************************************************* */
+
+size_t
+DataProviderCollection::GetTimelinesMemoryFootprint(size_t &regionDataBytes)
+{
+    size_t                           footprint = 0;
+    MURALTypes::UserVector::iterator userIter;
+    regionDataBytes = 0;
+
+    for (userIter = ptrUserVehicleList_a->begin(); userIter != ptrUserVehicleList_a->end(); ++userIter) {
+        shared_ptr<ValueTimeline> ptrValueTimeline = (*userIter)->GetValueTimeline();
+
+        if (ptrValueTimeline != NULL) {
+            size_t userRegionDataBytes = 0;
+            footprint += ptrValueTimeline->GetMemoryFootprint(userRegionDataBytes);
+            regionDataBytes += userRegionDataBytes;
+        }
+    }
+
+    return(footprint);
+}
+
+/* ******************************************************************************* */
+
 DataProviderCollection::~DataProviderCollection()
 {
     return;
@@ -26,6 +26,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <set>
 
 #include "mural/MURALTypes.h"
 
@@ -35,6 +36,8 @@ class UserVehicle;
 class RelaySatellite;
 class GroundStation;
 class DataProvider;
+class Link;
+template<class Type> class LinkList;
 
 /**
  * A collection class which contains lists of all the users/relays/ground in
@@ -113,10 +116,23 @@ public:
     shared_ptr<MURALTypes::UserVector>           GetTypeUserListPtr(const string& typeDesignator);
     shared_ptr<MURALTypes::UserVector>           GetSystemUserListPtr(const string& systemDesignator);
 
+    /**
+     * Methods to estimate the bytes held by each subsystem of the providers
+     * (see MemoryAccounting).  Each link is counted once, although it is
+     * held by both its transmit and receive antenna.  The timeline footprint
+     * excludes the region data, which is returned separately.
+     */
+    size_t GetPositionsMemoryFootprint();
+    size_t GetLinksMemoryFootprint();
+    size_t GetTimelinesMemoryFootprint(size_t &regionDataBytes);
+
 protected:
 
 private:
 
+    static size_t GetLinksMemoryFootprint(const LinkList<Link> *ptrLinksList,
+                                          set<const Link*> &countedLinks);
+
 
 
 
@@ -505,6 +505,16 @@ UserVehicle::AddValueTimelineElement(const int &timeIndex,
     return;
 }
 
+MemoryArena*
+UserVehicle::GetTimelineArena()
+{
+    if (ptrValueTimeline_a == NULL) {
+        ptrValueTimeline_a = shared_ptr<ValueTimeline>(new ValueTimeline());
+    }
+
+    return(ptrValueTimeline_a->GetArena());
+}
+
 
 double
 UserVehicle::CalculateElevationAngle(const int &timeIndex,
@@ -37,6 +37,7 @@ using namespace std;
 
 class CollectionElement;
 class CoordinateFrame;
+class MemoryArena;
 class RegionData;
 class RelaySatellite;
 class ValueTimeline;
@@ -291,6 +292,8 @@ public:
 
     ValueTimelineElement* GetValueTimelineElement(const int &timeIndex) const;
 
+    MemoryArena*       GetTimelineArena();
+
     RegionData*        GetTimelineMostValuableRegionData(const int &timeIndex) const;
 
     LinkList<Link>*    GetAllTransmitLinks() const;
@@ -31,9 +31,8 @@
 #include "general/exception/Exception.h"
 #include "general\utility\Utility.h"
 
-// Init the static file Maps
-shared_ptr<FileNames::FileMap>     FileNames::ptrFileNameMap_s = shared_ptr<FileNames::FileMap>(new FileNames::FileMap() );
-shared_ptr<FileNames::FileListMap> FileNames::ptrFileListMap_s = shared_ptr<FileNames::FileListMap>(new FileNames::FileListMap() );
+FileNames::State               FileNames::defaultState_s;
+thread_local FileNames::State *FileNames::ptrBoundState_s = NULL;
 
 FileNames::FileNames()
 {
@@ -46,7 +45,7 @@ FileNames::HasFileNameDefined(const FILE_TAG &fileTag)
 {
     bool requestsExist = false;
 
-    if ( ptrFileNameMap_s->find(fileTag) != ptrFileNameMap_s->end()) {
+    if ( GetState().ptrFileNameMap->find(fileTag) != GetState().ptrFileNameMap->end()) {
         requestsExist = true;
     }
 
@@ -60,8 +59,8 @@ FileNames::GetFileName(const FILE_TAG &fileTag)
 {
     string fileName = "";
 
-    if ( ptrFileNameMap_s->find(fileTag) != ptrFileNameMap_s->end()) {
-        fileName = *(ptrFileNameMap_s->find(fileTag)->second);
+    if ( GetState().ptrFileNameMap->find(fileTag) != GetState().ptrFileNameMap->end()) {
+        fileName = *(GetState().ptrFileNameMap->find(fileTag)->second);
     }
 
     return ( fileName );
@@ -72,9 +71,9 @@ FileNames::GetFileName(const FILE_TAG &fileTag)
 void
 FileNames::SetFileName(const FILE_TAG &fileTag, const string &fileName)
 {
-    if ( ptrFileNameMap_s->find(fileTag) == ptrFileNameMap_s->end()) {
+    if ( GetState().ptrFileNameMap->find(fileTag) == GetState().ptrFileNameMap->end()) {
         shared_ptr<string> fileNamePtr = shared_ptr<string>(new string(fileName));
-        ptrFileNameMap_s->insert(std::pair<FILE_TAG, shared_ptr<string>>(fileTag, fileNamePtr));
+        GetState().ptrFileNameMap->insert(std::pair<FILE_TAG, shared_ptr<string>>(fileTag, fileNamePtr));
     } else {
         throw new UpdateException(GetClassName(), "SetFileName(...)", "Duplicate File Name Path in file map");
     }
@@ -102,8 +101,8 @@ FileNames::GetFileList(const FILE_TAG &fileTag)
 {
     shared_ptr<MURALTypes::FileList> ptrFileList = NULL;
 
-    if ( ptrFileListMap_s->find(fileTag) != ptrFileListMap_s->end()) {
-        ptrFileList = ptrFileListMap_s->find(fileTag)->second;
+    if ( GetState().ptrFileListMap->find(fileTag) != GetState().ptrFileListMap->end()) {
+        ptrFileList = GetState().ptrFileListMap->find(fileTag)->second;
     }
 
     return ptrFileList;
@@ -161,7 +160,7 @@ FileNames::AddFileToList(const FILE_TAG &fileTag, const string &fileName)
     // If the list does not exist in the map, create it and add it to the map
     if ( ptrFileList == NULL ) {
         ptrFileList = shared_ptr<MURALTypes::FileList>(new MURALTypes::FileList());
-        ptrFileListMap_s->insert(std::pair<FILE_TAG, shared_ptr<MURALTypes::FileList>>(fileTag, ptrFileList));
+        GetState().ptrFileListMap->insert(std::pair<FILE_TAG, shared_ptr<MURALTypes::FileList>>(fileTag, ptrFileList));
     }
 
     // Add the file to the list (uniquely)
@@ -179,6 +178,36 @@ FileNames::AddFileToList(const FILE_TAG &fileTag, const string &fileName)
     }
 }
 
+/* ************************************************************************************** */
+
+void
+FileNames::MoveOutputFiles(const string &directoryName)
+{
+    FileMap::iterator fileIter;
+
+    for (fileIter = GetState().ptrFileNameMap->begin(); fileIter != GetState().ptrFileNameMap->end(); ++fileIter) {
+        if ((fileIter->first >= MAIN_MRL_OUTPUTFILE) && (fileIter->first < REQUIREMENT_DECK)) {
+            const string           &fileName = *(fileIter->second);
+            const string::size_type separatorIndex = fileName.find_last_of("/\\");
+            string                  baseName = fileName;
+
+            if (separatorIndex != string::npos) {
+                baseName = fileName.substr(separatorIndex + 1);
+            }
+
+            fileIter->second = shared_ptr<string>(new string(directoryName + "/" + baseName));
+        }
+    }
+}
+
+FileNames::State*
+FileNames::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 /* ************************************************************************************** */
 /**
  * Destructor
@@ -96,6 +96,8 @@ public:
         ACCESS_METRICS_OUTPUTFILE       = 222,
         SATSIM_OUTPUTFILE               = 223,
         TARGET_SUMMARY_OUTPUTFILE       = 224,
+        POSITION_CHECKPOINTFILE         = 225,
+        LINK_CHECKPOINTDIRECTORY        = 226,
 
         // Debug File Tags
         FOR_REGIONS_INVIEW_DEBUGFILE    = 300,
@@ -113,6 +115,7 @@ public:
         COLLECTION_DEBUGFILE            = 312,
         PROB_MATRIX_DEBUGFILE           = 313,
         PROB_DEBUGFILE                  = 314,
+        LINK_METHOD_DEBUGFILE           = 315,
 
         // Multiple List File Tags
         REQUIREMENT_DECK                = 400
@@ -121,6 +124,26 @@ public:
     typedef map<FILE_TAG, shared_ptr<string>> FileMap;
     typedef map<FILE_TAG, shared_ptr<MURALTypes::FileList>> FileListMap;
 
+    /**
+     * The file names of a scenario.  Each ScenarioContext holds its own,
+     *  threads with no context bound share the process wide default.
+     */
+    struct State {
+        // Map to hold the FILE_TAG to file name path string
+        shared_ptr<FileMap>     ptrFileNameMap = shared_ptr<FileMap>(new FileMap());
+        // Map to hold the FILE_TAG to list of file name paths
+        shared_ptr<FileListMap> ptrFileListMap = shared_ptr<FileListMap>(new FileListMap());
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     FileNames();
     ~FileNames();
 
@@ -188,20 +211,35 @@ public:
      */
     static void AddFileToList(const FILE_TAG &fileTag, const string &fileName);
 
+    /**
+     * Moves every output and debug file into the given directory, keeping
+     * each file's own name (a parametric sweep writes each variant's files to
+     * its own directory)
+     *
+     * @param directoryName the directory to write the files to
+     */
+    static void MoveOutputFiles(const string &directoryName);
+
 
 
 protected:
 
 private:
-    // Map to hold the FILE_TAG to file name path string
-    static shared_ptr<FileMap> ptrFileNameMap_s;
+    static inline State& GetState();
 
-    // Map to hold the FILE_TAG to list of file name paths
-    static shared_ptr<FileListMap> ptrFileListMap_s;
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
 
     static inline string GetClassName();
 };
 
+inline
+FileNames::State&
+FileNames::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
+}
+
 inline
 string
 FileNames::GetClassName()
@@ -153,6 +153,37 @@ InputProcessor::PrintAttributes(ostream &outfile)
     return;
 }
 
+void
+InputProcessor::GetInputDataFileNames(vector<string> &fileNameList)
+{
+    InputDataElement::InputDataList::iterator inputDataIter;
+
+    if (ptrInputDataFileNameElement_s != NULL) {
+        shared_ptr<InputDataElement::InputDataList> inputDataList = ptrInputDataFileNameElement_s->GetInputDataList();
+
+        for (inputDataIter = inputDataList->begin(); inputDataIter != inputDataList->end(); ++inputDataIter) {
+            fileNameList.push_back((*inputDataIter)->GetStringValue());
+        }
+    }
+
+    return;
+}
+
+void
+InputProcessor::PrintInputDataElements(ostream &outfile)
+{
+    InputDataElement::InputDataElementList::iterator inputDataElementIter;
+
+    if (ptrInputDataElementList_s != NULL) {
+        for (inputDataElementIter = ptrInputDataElementList_s->begin();
+                inputDataElementIter != ptrInputDataElementList_s->end(); ++inputDataElementIter) {
+            (*inputDataElementIter)->PrintInputDataElement(outfile);
+        }
+    }
+
+    return;
+}
+
 void
 InputProcessor::RetrieveFileNameElements()
 {
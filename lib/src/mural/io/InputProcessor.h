@@ -24,6 +24,7 @@
 #define INPUT_PROCESSOR_H "InputProcessor"
 
 #include <fstream>
+#include <vector>
 
 
 #include "general/data/InputDataElement.h"
@@ -67,6 +68,22 @@ public:
 
     static void   PrintAttributes(ostream &outfile);
 
+    /**
+     * Appends the names of the input data files listed in the main input
+     *  file (miscellaneous, ground station, relay, user, region, ...)
+     *
+     * @param &fileNameList (return) the input data file names
+     */
+    static void   GetInputDataFileNames(vector<string> &fileNameList);
+
+    /**
+     * Prints every parsed input data block with its current values, which
+     *  includes any values overridden after parsing (see ParametricSweep)
+     *
+     * @param &outfile the stream to print to
+     */
+    static void   PrintInputDataElements(ostream &outfile);
+
 protected:
 
     static shared_ptr<InputDataElement>                        ptrInputDataFileNameElement_s;
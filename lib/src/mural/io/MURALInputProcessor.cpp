@@ -49,8 +49,9 @@
 // From geneng
 #include "GenUtility.h"
 
-bool                  MURALInputProcessor::jplHeaderDefined_s = false;
-MURALInputProcessor::RUN_MODULE MURALInputProcessor::lastModuleToComplete_s = UNKNOWN_RUN_MODULE;
+const string                             MURALInputProcessor::ALL_DESIGNATORS_s = "*";
+MURALInputProcessor::State               MURALInputProcessor::defaultState_s;
+thread_local MURALInputProcessor::State *MURALInputProcessor::ptrBoundState_s = NULL;
 
 //------------------------------------------------------------------------------
 //
@@ -117,24 +118,7 @@ MURALInputProcessor::MURALInputProcessor(const string &mainInputFileName)
     }
 
     try {
-        // need to extract active constellation and input parameters first
-        ExtractInputRunVariables();
-        // now set the rest of the static (miscellaneous) data
-        ExtractGlobalRunVariables();
-
-        if (ptrInputFileNameElement_s != NULL) {
-            SetInputFileNames();
-        }
-
-        if (ptrOutputFileNameElement_s != NULL) {
-            OutputGenerator::SetOutputFileNames(ptrOutputFileNameElement_s);
-        }
-
-        if (ptrDebugFileNameElement_s != NULL) {
-            if ( ptrDebugFileNameElement_s->GetNumberOfInputData() > 0 ) {
-                SetDebugFileNames();
-            }
-        }
+        ProcessInputData(true);
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "MURALInputProcessor(const string*)");
         throw;
@@ -162,15 +146,140 @@ MURALInputProcessor::operator == (const MURALInputProcessor &compareMe) const
     return(InputProcessor::operator == (compareMe));
 }
 
+void
+MURALInputProcessor::ReprocessInputData()
+{
+    try {
+        // crisis areas are not part of a scenario's state, so start over
+        CrisisData::DestroyCrisisData();
+        ProcessInputData(false);
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "ReprocessInputData()");
+        throw;
+    }
+
+    return;
+}
+
+int
+MURALInputProcessor::OverrideInputData(const string &designator,
+                                       const string &blockTag,
+                                       const string &label,
+                                       const string &value,
+                                       OverriddenInputList &overriddenInputList) const
+{
+    int                          numberOfOverrides = 0;
+    shared_ptr<InputDataElement> ptrInputDataElement = NULL;
+    InputDataElement::InputDataElementList::iterator inputDataElementIter;
+
+    try {
+        for( inputDataElementIter = ptrInputDataElementList_s->begin(); inputDataElementIter != ptrInputDataElementList_s->end(); ++inputDataElementIter) {
+            ptrInputDataElement = (*inputDataElementIter);
+
+            if ((designator == ALL_DESIGNATORS_s) || ((ptrInputDataElement->GetNumberOfInputData() > 0) &&
+                    (FindDesignatorString(ptrInputDataElement) == designator))) {
+                numberOfOverrides += OverrideElementInputData(ptrInputDataElement, blockTag, label,
+                                     value, overriddenInputList);
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(),
+                            "OverrideInputData(const string&, const string&, const string&, const string&, OverriddenInputList&)");
+        throw;
+    }
+
+    return(numberOfOverrides);
+}
+
+void
+MURALInputProcessor::RestoreInputData(OverriddenInputList &overriddenInputList)
+{
+    OverriddenInputList::reverse_iterator overriddenIter;
+
+    // undo in reverse so an input overridden twice gets its original value back
+    for (overriddenIter = overriddenInputList.rbegin(); overriddenIter != overriddenInputList.rend(); ++overriddenIter) {
+        *(overriddenIter->first) = overriddenIter->second;
+    }
+
+    overriddenInputList.clear();
+    return;
+}
+
+int
+MURALInputProcessor::OverrideElementInputData(const shared_ptr<InputDataElement> &ptrInputDataElement,
+        const string &blockTag,
+        const string &label,
+        const string &value,
+        OverriddenInputList &overriddenInputList)
+{
+    int numberOfOverrides = 0;
+
+    if ((*(ptrInputDataElement->GetBlockTag()) == blockTag) &&
+            (ptrInputDataElement->GetNumberOfInputData() > 0)) {
+        shared_ptr<InputDataElement::InputDataList> inputDataList = ptrInputDataElement->GetInputDataList();
+        InputDataElement::InputDataList::iterator inputDataIter;
+
+        for( inputDataIter = inputDataList->begin(); inputDataIter != inputDataList->end(); ++inputDataIter) {
+            if ((*inputDataIter)->GetLabel() == label) {
+                overriddenInputList.push_back(make_pair((*inputDataIter), *(*inputDataIter)));
+                *(*inputDataIter) = InputData(label, value);
+                ++numberOfOverrides;
+            }
+        }
+    }
+
+    if (ptrInputDataElement->GetNumberOfInputDataElements() > 0) {
+        shared_ptr<InputDataElement::InputDataElementList> subElementList = ptrInputDataElement->GetInputDataElementList();
+        InputDataElement::InputDataElementList::iterator subElementIter;
+
+        for( subElementIter = subElementList->begin(); subElementIter != subElementList->end(); ++subElementIter) {
+            numberOfOverrides += OverrideElementInputData((*subElementIter), blockTag, label,
+                                 value, overriddenInputList);
+        }
+    }
+
+    return(numberOfOverrides);
+}
+
+void
+MURALInputProcessor::ProcessInputData(bool extractSharedInputs)
+{
+    try {
+        // need to extract active constellation and input parameters first
+        ExtractInputRunVariables(extractSharedInputs);
+        // now set the rest of the static (miscellaneous) data
+        ExtractGlobalRunVariables();
+
+        if (ptrInputFileNameElement_s != NULL) {
+            SetInputFileNames(extractSharedInputs);
+        }
+
+        if (ptrOutputFileNameElement_s != NULL) {
+            OutputGenerator::SetOutputFileNames(ptrOutputFileNameElement_s);
+        }
+
+        if (ptrDebugFileNameElement_s != NULL) {
+            if ( ptrDebugFileNameElement_s->GetNumberOfInputData() > 0 ) {
+                SetDebugFileNames();
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "ProcessInputData(bool)");
+        throw;
+    }
+
+    return;
+}
+
 void
 MURALInputProcessor::PrintAttributes(ostream &outfile)
 {
     outfile << "<INPUT_PARAMETERS_START>" << NEW_LINE;
     outfile << "   Last Module To Complete (PG/LPG/VTG) : ";
 
-    if (lastModuleToComplete_s == POSITION_GENERATOR) {
+    if (GetState().lastModuleToComplete == POSITION_GENERATOR) {
         outfile << "PG" << NEW_LINE;
-    } else if (lastModuleToComplete_s == LINK_PATH_GENERATOR) {
+    } else if (GetState().lastModuleToComplete == LINK_PATH_GENERATOR) {
         outfile << "LPG" << NEW_LINE;
     } else {
         outfile << "VTG" << NEW_LINE;
@@ -191,7 +300,7 @@ MURALInputProcessor::PrintAttributes(ostream &outfile)
 }
 
 void
-MURALInputProcessor::ExtractInputRunVariables()
+MURALInputProcessor::ExtractInputRunVariables(bool extractConstellation)
 {
     bool                            sortDataProviders = false;
     string                          errorString = "";
@@ -202,7 +311,7 @@ MURALInputProcessor::ExtractInputRunVariables()
     for( inputDataElementIter = ptrInputDataElementList_s->begin(); inputDataElementIter != ptrInputDataElementList_s->end(); ++inputDataElementIter) {
         ptrInputDataElement = (*inputDataElementIter);
 
-        if (ptrInputDataElement->BlockTagContainsString("ACTIVE_CONSTELLATION") == true) {
+        if ((extractConstellation == true) && (ptrInputDataElement->BlockTagContainsString("ACTIVE_CONSTELLATION") == true)) {
             shared_ptr<InputDataElement::InputDataList> inputDataList = ptrInputDataElement->GetInputDataList();
             InputDataElement::InputDataList::iterator inputDataIter;
 
@@ -227,7 +336,7 @@ MURALInputProcessor::ExtractInputRunVariables()
                 ptrInputData = (*inputDataIter);
 
                 if (ptrInputData->LabelContainsString("Last Module To Complete") == true) {
-                    lastModuleToComplete_s = GetRunModule(ptrInputData->GetStringValue());
+                    GetState().lastModuleToComplete = GetRunModule(ptrInputData->GetStringValue());
                 } else if (ptrInputData->LabelContainsString("Use Sub Regions For Requirements") == true) {
                     Region::SetUsingSubRegions(ptrInputData->GetBoolValue());
                 } else if (ptrInputData->LabelContainsString("Input Angle Units") == true) {
@@ -255,7 +364,7 @@ MURALInputProcessor::ExtractInputRunVariables()
         errorString += "Missing/invalid 'Ground Stations' input in ACTIVE_CONSTELLATION block";
     }
 
-    if (lastModuleToComplete_s == UNKNOWN_RUN_MODULE) {
+    if (GetState().lastModuleToComplete == UNKNOWN_RUN_MODULE) {
         if (errorString.size() > 0) {
             errorString += "\n        ";
         }
@@ -296,7 +405,7 @@ MURALInputProcessor::ExtractInputRunVariables()
     }
 
     if (errorString.size() > 0) {
-        throw new InputException(GetClassName(), "ExtractInputRunVariables()", errorString);
+        throw new InputException(GetClassName(), "ExtractInputRunVariables(bool)", errorString);
     }
 
     if(sortDataProviders == true) {
@@ -309,7 +418,7 @@ MURALInputProcessor::ExtractInputRunVariables()
 }
 
 void
-MURALInputProcessor::SetInputFileNames()
+MURALInputProcessor::SetInputFileNames(bool extractSharedInputs)
 {
     shared_ptr<InputDataElement::InputDataList> inputDataList = ptrInputFileNameElement_s->GetInputDataList();
     InputDataElement::InputDataList::iterator inputDataIter;
@@ -356,8 +465,11 @@ MURALInputProcessor::SetInputFileNames()
                     FileNames::SetFileName(FileNames::TIMELINE_INPUTFILE, ptrInputData->GetStringValue());
                 }
             } else if (ptrInputData->LabelContainsString("OPS State Vector Input File") == true) {
-                OPSStateVectorParser::InitStateVectorParser(ptrInputData->GetStringValue());
-                OPSStateVectorParser::GetStateVectorParser()->ParseStateVectorFile();
+                // the parsed state vectors are shared by every scenario in the process
+                if (extractSharedInputs == true) {
+                    OPSStateVectorParser::InitStateVectorParser(ptrInputData->GetStringValue());
+                    OPSStateVectorParser::GetStateVectorParser()->ParseStateVectorFile();
+                }
             } else if (ptrInputData->LabelContainsString("JPL Supporting File Directory") == true) {
                 string basePath = ptrInputData->GetValueString();
                 string headerPath = basePath + "\\header.421e";
@@ -367,12 +479,15 @@ MURALInputProcessor::SetInputFileNames()
                 // Verify the JPL Bin file (method throws exception if not)
                 ParseUtility::VerifyInputFile(&bin421Path);
                 // If it exists then flag it and tell gen engineering about the path
-                MURALInputProcessor::jplHeaderDefined_s = true;
-                A3::addCustomPath( basePath );
+                GetState().jplHeaderDefined = true;
+
+                if (extractSharedInputs == true) {
+                    A3::addCustomPath( basePath );
+                }
             }
         }
     } catch (Exception *ptrError) {
-        ptrError->AddMethod(GetClassName(), "SetInputFileNames()");
+        ptrError->AddMethod(GetClassName(), "SetInputFileNames(bool)");
         throw;
     }
 
@@ -396,6 +511,10 @@ MURALInputProcessor::SetDebugFileNames()
                 if (RunLinkPathGenerator() == true) {
                     FileNames::SetFileName(FileNames::LINKS_DEBUGFILE, ptrInputData->GetStringValue());
                 }
+            } else if (ptrInputData->LabelContainsString("Link Method Comparison Debug File") == true) {
+                if (RunLinkPathGenerator() == true) {
+                    FileNames::SetFileName(FileNames::LINK_METHOD_DEBUGFILE, ptrInputData->GetStringValue());
+                }
             } else if (ptrInputData->LabelContainsString("Conjunction Debug File") == true) {
                 if (RunLinkPathGenerator() == true) {
                     FileNames::SetFileName(FileNames::CONJ_DEBUGFILE, ptrInputData->GetStringValue());
@@ -1005,6 +1124,14 @@ MURALInputProcessor::ValidDataProvider(const string &providerDesignator)
     return(validProvider);
 }
 
+MURALInputProcessor::State*
+MURALInputProcessor::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 MURALInputProcessor::~MURALInputProcessor()
 {
     Earth::DestroyRegions();
@@ -23,6 +23,7 @@
 #ifndef MURAL_INPUT_PROCESSOR_H
 #define MURAL_INPUT_PROCESSOR_H "MURALInputProcessor"
 
+#include <utility>
 #include <vector>
 
 #include "mural/io/InputProcessor.h"
@@ -43,7 +44,8 @@ class UserVehicle;
  *
  * Name                        Description (units)
  * -------------               -------------------------------------------------
- * lastModuleToComplete_s      The last RUN_MODULE to complete
+ * State::lastModuleToComplete  The last RUN_MODULE to complete
+ * ALL_DESIGNATORS_s            designator of an override applied to every block
  *
  * @author Brian Fowler
  * @date 12/20/2011
@@ -62,6 +64,29 @@ public:
         TARGET_SCHEDULER  = 5
     };
 
+    /**
+     * The run control of a scenario.  Each ScenarioContext holds its own,
+     *  threads with no context bound share the process wide default.
+     */
+    struct State {
+        bool       jplHeaderDefined = false;
+        RUN_MODULE lastModuleToComplete = UNKNOWN_RUN_MODULE;
+    };
+
+    /**
+     * Inputs replaced by OverrideInputData, paired with their original value
+     */
+    typedef vector<pair<shared_ptr<InputData>, InputData>> OverriddenInputList;
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     MURALInputProcessor();
 
 
@@ -92,6 +117,43 @@ public:
 
     shared_ptr<DataProviderCollection> CreateDataProviderList();
 
+    /**
+     * Extracts the run variables again, into the scenario bound to the
+     *  calling thread, from the input data already read by this processor
+     *  (e.g. after OverrideInputData).  The active constellation, the OPS
+     *  state vectors and the JPL file path are shared by every scenario in
+     *  the process and are not extracted again.
+     */
+    void   ReprocessInputData();
+
+    /**
+     * Replaces the value of every input labeled 'label' (the full label,
+     *  including any bracketed specifics) in a block whose tag is
+     *  'blockTag'.  A designator other than ALL_DESIGNATORS_s limits the
+     *  override to that data provider's object.  The replaced inputs are
+     *  appended to overriddenInputList for RestoreInputData.
+     *
+     * @param &designator the data provider to override (or ALL_DESIGNATORS_s)
+     * @param &blockTag the tag of the blocks to override
+     * @param &label the label of the inputs to override
+     * @param &value the new value string
+     * @param &overriddenInputList the replaced inputs
+     * @return int the number of inputs overridden
+     */
+    int    OverrideInputData(const string &designator,
+                             const string &blockTag,
+                             const string &label,
+                             const string &value,
+                             OverriddenInputList &overriddenInputList) const;
+
+    /**
+     * Puts back the original value of every input in overriddenInputList
+     *  (and empties it)
+     *
+     * @param &overriddenInputList the inputs replaced by OverrideInputData
+     */
+    static void   RestoreInputData(OverriddenInputList &overriddenInputList);
+
     static inline bool   JPLFilePathDefined();
     static inline bool   RunModule(const RUN_MODULE &module);
     static inline bool   RunPositionGenerator();
@@ -100,14 +162,23 @@ public:
 
     static inline RUN_MODULE      GetLastModuleToComplete();
 
+    static const string ALL_DESIGNATORS_s;
+
 protected:
 
 private:
 
     static RUN_MODULE GetRunModule(const string &valueString);
 
-    void   ExtractInputRunVariables();
-    void   SetInputFileNames();
+    static int OverrideElementInputData(const shared_ptr<InputDataElement> &ptrInputDataElement,
+                                        const string &blockTag,
+                                        const string &label,
+                                        const string &value,
+                                        OverriddenInputList &overriddenInputList);
+
+    void   ProcessInputData(bool extractSharedInputs);
+    void   ExtractInputRunVariables(bool extractConstellation);
+    void   SetInputFileNames(bool extractSharedInputs);
     void   SetDebugFileNames();
     void   ExtractGlobalRunVariables();
 
@@ -121,22 +192,24 @@ private:
 
     static inline string GetClassName();
 
-    static bool                  jplHeaderDefined_s;
-    static RUN_MODULE            lastModuleToComplete_s;
+    static inline State& GetState();
+
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
 };
 
 inline
 bool
 MURALInputProcessor::JPLFilePathDefined()
 {
-    return(jplHeaderDefined_s);
+    return(GetState().jplHeaderDefined);
 }
 
 inline
 bool
 MURALInputProcessor::RunModule(const RUN_MODULE &module)
 {
-    return(module <= lastModuleToComplete_s);
+    return(module <= GetState().lastModuleToComplete);
 }
 
 inline
@@ -164,7 +237,14 @@ inline
 MURALInputProcessor::RUN_MODULE
 MURALInputProcessor::GetLastModuleToComplete()
 {
-    return(lastModuleToComplete_s);
+    return(GetState().lastModuleToComplete);
+}
+
+inline
+MURALInputProcessor::State&
+MURALInputProcessor::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
 }
 
 inline
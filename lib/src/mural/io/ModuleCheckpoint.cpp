@@ -0,0 +1,442 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ModuleCheckpoint.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <cstring>
+#include <sstream>
+
+#include "ModuleCheckpoint.h"
+#include "mural/MURALTypes.h"
+#include "mural/element/DataProvider.h"
+#include "mural/element/DataProviderCollection.h"
+#include "mural/element/UserVehicle.h"
+#include "mural/io/FileNames.h"
+#include "mural/io/MURALInputProcessor.h"
+#include "mural/modules/pg/Journey.h"
+#include "mural/modules/pg/Trek.h"
+
+#include "general/data/PositionState.h"
+#include "general/data/UnitData.h"
+#include "general/exception/OutputFileException.h"
+#include "general/math/SpaceVector.h"
+#include "general/time/TimePiece.h"
+#include "general/utility/Constant.h"
+
+const char ModuleCheckpoint::MAGIC_s[8]         = {'M', 'U', 'R', 'A', 'L', 'C', 'K', 'P'};
+const int  ModuleCheckpoint::FORMAT_VERSION_s   = 2;
+const int  ModuleCheckpoint::POSITION_MODULE_s  = MURALInputProcessor::POSITION_GENERATOR;
+
+void
+ModuleCheckpoint::WritePositions(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                                 const string &checkpointFileName)
+{
+    ofstream      checkpointFile;
+    JourneyVector journeyList;
+    JourneyVector::iterator journeyIter;
+
+    try {
+        CollectJourneys(ptrDataProviderCollection, journeyList);
+        checkpointFile.open(checkpointFileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+        if (!checkpointFile) {
+            throw new OutputFileException(GetClassName(),
+                                          "WritePositions(const shared_ptr<DataProviderCollection>&, const string&)",
+                                          checkpointFileName);
+        }
+
+        WriteHeader(checkpointFile, POSITION_MODULE_s, journeyList);
+
+        for (journeyIter = journeyList.begin(); journeyIter != journeyList.end(); ++journeyIter) {
+            const string              &designator = journeyIter->first;
+            const shared_ptr<Journey> &ptrJourney = journeyIter->second;
+            const int                  designatorSize = (int)designator.size();
+            const int                  numberOfStates = ptrJourney->GetNumberOfPositionStates();
+            int                        stateIndex = 0;
+            WriteValue(checkpointFile, designatorSize);
+            checkpointFile.write(designator.c_str(), designatorSize);
+            WriteValue(checkpointFile, (int)ptrJourney->GetGenerationMethod());
+            WriteValue(checkpointFile, numberOfStates);
+
+            while (stateIndex < numberOfStates) {
+                const shared_ptr<PositionState> ptrPositionState = ptrJourney->GetPositionStateAt(stateIndex);
+                const SpaceVector *ptrPosition = ptrPositionState->GetPosition();
+                const SpaceVector *ptrVelocity = ptrPositionState->GetVelocity();
+                WriteValue(checkpointFile, (int)ptrPosition->GetReferenceFrame());
+                WriteValue(checkpointFile, ptrPosition->GetX());
+                WriteValue(checkpointFile, ptrPosition->GetY());
+                WriteValue(checkpointFile, ptrPosition->GetZ());
+                WriteValue(checkpointFile, ptrVelocity->GetX());
+                WriteValue(checkpointFile, ptrVelocity->GetY());
+                WriteValue(checkpointFile, ptrVelocity->GetZ());
+                ++stateIndex;
+            }
+        }
+
+        checkpointFile.close();
+
+        if (!checkpointFile) {
+            throw new OutputFileException(GetClassName(),
+                                          "WritePositions(const shared_ptr<DataProviderCollection>&, const string&)",
+                                          checkpointFileName);
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(),
+                            "WritePositions(const shared_ptr<DataProviderCollection>&, const string&)");
+        throw;
+    }
+
+    cout << "ModuleCheckpoint: Wrote Position Checkpoint " << checkpointFileName << NEW_LINE;
+    return;
+}
+
+bool
+ModuleCheckpoint::RestorePositions(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                                   const string &checkpointFileName)
+{
+    bool          restored = false;
+    string        mismatchString = "";
+    ifstream      checkpointFile(checkpointFileName.c_str(), ios::in | ios::binary);
+    JourneyVector journeyList;
+    JourneyVector::iterator journeyIter;
+    vector<shared_ptr<PositionState>> stateList;
+    vector<shared_ptr<PositionState>>::iterator stateIter;
+
+    try {
+        CollectJourneys(ptrDataProviderCollection, journeyList);
+
+        if (!checkpointFile) {
+            mismatchString = "file not found";
+        } else if (ReadHeader(checkpointFile, POSITION_MODULE_s, journeyList, mismatchString) == true) {
+            // read every journey before changing any of them so a truncated
+            // or mismatched file leaves the data providers untouched
+            vector<vector<shared_ptr<PositionState>>> journeyStates(journeyList.size());
+            int journeyIndex = 0;
+
+            for (journeyIter = journeyList.begin();
+                    (journeyIter != journeyList.end()) && (mismatchString.size() == 0); ++journeyIter) {
+                int    designatorSize = 0;
+                int    generationMethod = 0;
+                int    numberOfStates = 0;
+                string designator = "";
+                ReadValue(checkpointFile, designatorSize);
+
+                if ((checkpointFile) && (designatorSize >= 0) && (designatorSize < 4096)) {
+                    designator.resize(designatorSize);
+
+                    if (designatorSize > 0) {
+                        checkpointFile.read(&designator[0], designatorSize);
+                    }
+                }
+
+                ReadValue(checkpointFile, generationMethod);
+                ReadValue(checkpointFile, numberOfStates);
+
+                if ((!checkpointFile) || (designator != journeyIter->first) ||
+                        (generationMethod != (int)journeyIter->second->GetGenerationMethod()) ||
+                        (numberOfStates <= 0) || (numberOfStates > TimePiece::GetNumberOfTimeSteps())) {
+                    mismatchString = "journey for " + journeyIter->first + " does not match";
+                } else {
+                    int stateIndex = 0;
+
+                    while ((stateIndex < numberOfStates) && (checkpointFile)) {
+                        int    frame = 0;
+                        double state[6];
+                        ReadValue(checkpointFile, frame);
+                        checkpointFile.read(reinterpret_cast<char*>(state), sizeof(state));
+                        journeyStates[journeyIndex].push_back(shared_ptr<PositionState>(
+                                new PositionState(state[0], state[1], state[2], state[3], state[4], state[5],
+                                                  (REFERENCE_FRAME)frame)));
+                        ++stateIndex;
+                    }
+
+                    if (!checkpointFile) {
+                        mismatchString = "file is truncated";
+                    }
+                }
+
+                ++journeyIndex;
+            }
+
+            if (mismatchString.size() == 0) {
+                journeyIndex = 0;
+
+                for (journeyIter = journeyList.begin(); journeyIter != journeyList.end(); ++journeyIter) {
+                    int stateIndex = 0;
+
+                    for (stateIter = journeyStates[journeyIndex].begin();
+                            stateIter != journeyStates[journeyIndex].end(); ++stateIter) {
+                        journeyIter->second->SetPositionState(stateIndex, *stateIter);
+                        ++stateIndex;
+                    }
+
+                    ++journeyIndex;
+                }
+
+                restored = true;
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(),
+                            "RestorePositions(const shared_ptr<DataProviderCollection>&, const string&)");
+        throw;
+    }
+
+    if (restored == true) {
+        cout << "ModuleCheckpoint: Restored Positions From " << checkpointFileName << NEW_LINE;
+    } else {
+        cout << "ModuleCheckpoint: Ignoring Position Checkpoint " << checkpointFileName
+             << " (" << mismatchString << ")" << NEW_LINE;
+    }
+
+    return(restored);
+}
+
+bool
+ModuleCheckpoint::CopyPositions(const shared_ptr<DataProviderCollection> &ptrSourceCollection,
+                                const shared_ptr<DataProviderCollection> &ptrDataProviderCollection)
+{
+    bool          copied = false;
+    JourneyVector sourceList;
+    JourneyVector journeyList;
+    JourneyVector::iterator sourceIter;
+    JourneyVector::iterator journeyIter;
+
+    try {
+        CollectJourneys(ptrSourceCollection, sourceList);
+        CollectJourneys(ptrDataProviderCollection, journeyList);
+        copied = (sourceList.size() == journeyList.size());
+
+        for (sourceIter = sourceList.begin(), journeyIter = journeyList.begin();
+                (sourceIter != sourceList.end()) && (copied == true); ++sourceIter, ++journeyIter) {
+            copied = ((sourceIter->first == journeyIter->first) &&
+                      (sourceIter->second->GetGenerationMethod() == journeyIter->second->GetGenerationMethod()) &&
+                      (sourceIter->second->GetNumberOfPositionStates() > 0) &&
+                      (journeyIter->second->GetNumberOfPositionStates() == 0));
+        }
+
+        if (copied == true) {
+            for (sourceIter = sourceList.begin(), journeyIter = journeyList.begin();
+                    sourceIter != sourceList.end(); ++sourceIter, ++journeyIter) {
+                const int numberOfStates = sourceIter->second->GetNumberOfPositionStates();
+                int       stateIndex = 0;
+
+                // each scenario gets its own states, later modules may update them
+                while (stateIndex < numberOfStates) {
+                    journeyIter->second->SetPositionState(stateIndex, shared_ptr<PositionState>(
+                            new PositionState(*(sourceIter->second->GetPositionStateAt(stateIndex)))));
+                    ++stateIndex;
+                }
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(),
+                            "CopyPositions(const shared_ptr<DataProviderCollection>&, const shared_ptr<DataProviderCollection>&)");
+        throw;
+    }
+
+    return(copied);
+}
+
+unsigned long long
+ModuleCheckpoint::DetermineInputHash(const JourneyVector &journeyList)
+{
+    // FNV-1a 64 bit offset basis
+    unsigned long long hashValue = 14695981039346656037ULL;
+    const FileNames::FILE_TAG inputTags[] = {FileNames::MAIN_INPUT_FILE,
+                                             FileNames::POSITION_INPUTFILE,
+                                             FileNames::POSITION_P470_INPUTFILE,
+                                             FileNames::CROSSLINK_INPUTFILE,
+                                             FileNames::DIRECTDOWNLINK_INPUTFILE,
+                                             FileNames::SELFRELAY_INPUTFILE,
+                                             FileNames::DOWNLINK_INPUTFILE,
+                                             FileNames::MULTIHOP_INPUTFILE,
+                                             FileNames::UPA_CONJ_INPUTFILE,
+                                             FileNames::RF_CONJ_INPUTFILE,
+                                             FileNames::OPS_REQUEST_INPUTFILE,
+                                             FileNames::OPS_WORTH_INPUTFILE,
+                                             FileNames::MURAL_REQUEST_INPUTFILE,
+                                             FileNames::TIMELINE_INPUTFILE,
+                                             FileNames::INITPLAN_INPUTFILE
+                                            };
+    const int                numberOfTags = (int)(sizeof(inputTags) / sizeof(inputTags[0]));
+    int                      tagIndex = 0;
+    vector<string>           inputDataFileList;
+    vector<string>::iterator fileNameIter;
+    ostringstream            parsedInputData;
+    string                   parsedString = "";
+
+    while (tagIndex < numberOfTags) {
+        if (FileNames::HasFileNameDefined(inputTags[tagIndex]) == true) {
+            HashFile(FileNames::GetFileName(inputTags[tagIndex]), hashValue);
+        }
+
+        ++tagIndex;
+    }
+
+    // the misc/gs/rs/uv/region files hold the orbits, treks and link inputs
+    InputProcessor::GetInputDataFileNames(inputDataFileList);
+
+    for (fileNameIter = inputDataFileList.begin(); fileNameIter != inputDataFileList.end(); ++fileNameIter) {
+        HashFile(*fileNameIter, hashValue);
+    }
+
+    // the parsed values, so values overridden after parsing are covered too
+    InputProcessor::PrintInputDataElements(parsedInputData);
+    parsedString = parsedInputData.str();
+    HashBytes(parsedString.data(), parsedString.size(), hashValue);
+
+    if (FileNames::GetFileListSize(FileNames::REQUIREMENT_DECK) > 0) {
+        shared_ptr<MURALTypes::FileList> ptrDeckList = FileNames::GetFileList(FileNames::REQUIREMENT_DECK);
+
+        for (MURALTypes::FileList::const_iterator deckIter = ptrDeckList->begin(); deckIter != ptrDeckList->end(); ++deckIter) {
+            HashFile(**deckIter, hashValue);
+        }
+    }
+
+    for (JourneyVector::const_iterator journeyIter = journeyList.begin(); journeyIter != journeyList.end(); ++journeyIter) {
+        shared_ptr<Trek> ptrTrek(dynamic_pointer_cast<Trek>(journeyIter->second));
+
+        if ((ptrTrek != NULL) && (ptrTrek->GetTrekFileName() != NULL)) {
+            HashFile(*(ptrTrek->GetTrekFileName()), hashValue);
+        }
+    }
+
+    return(hashValue);
+}
+
+void
+ModuleCheckpoint::HashFile(const string &fileName,
+                           unsigned long long &hashValue)
+{
+    ifstream     inputFile(fileName.c_str(), ios::in | ios::binary);
+    vector<char> buffer(64 * 1024);
+
+    while (inputFile) {
+        inputFile.read(&buffer[0], buffer.size());
+        HashBytes(&buffer[0], (size_t)inputFile.gcount(), hashValue);
+    }
+
+    return;
+}
+
+void
+ModuleCheckpoint::HashBytes(const char *ptrBytes,
+                            size_t numberOfBytes,
+                            unsigned long long &hashValue)
+{
+    const unsigned long long fnvPrime = 1099511628211ULL;
+    size_t                   byteIndex = 0;
+
+    while (byteIndex < numberOfBytes) {
+        hashValue ^= (unsigned char)ptrBytes[byteIndex];
+        hashValue *= fnvPrime;
+        ++byteIndex;
+    }
+
+    return;
+}
+
+void
+ModuleCheckpoint::CollectJourneys(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                                  JourneyVector &journeyList)
+{
+    shared_ptr<MURALTypes::DataProviderVector> ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
+    MURALTypes::DataProviderVector::iterator   dataProviderIter;
+
+    for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+        shared_ptr<UserVehicle> ptrUserVehicle(dynamic_pointer_cast<UserVehicle>(*dataProviderIter));
+        journeyList.push_back(make_pair((*dataProviderIter)->GetDesignator(), (*dataProviderIter)->GetJourney()));
+
+        if ((ptrUserVehicle != NULL) && (ptrUserVehicle->GetTrailVehicle() != NULL)) {
+            journeyList.push_back(make_pair(ptrUserVehicle->GetTrailVehicle()->GetDesignator(),
+                                            ptrUserVehicle->GetTrailVehicle()->GetJourney()));
+        }
+    }
+
+    return;
+}
+
+void
+ModuleCheckpoint::WriteHeader(ofstream &checkpointFile,
+                              int module,
+                              const JourneyVector &journeyList)
+{
+    checkpointFile.write(MAGIC_s, sizeof(MAGIC_s));
+    WriteValue(checkpointFile, FORMAT_VERSION_s);
+    WriteValue(checkpointFile, module);
+    WriteValue(checkpointFile, DetermineInputHash(journeyList));
+    WriteValue(checkpointFile, TimePiece::GetNumberOfTimeSteps());
+    WriteValue(checkpointFile, TimePiece::GetSecondsPerTimeStep());
+    WriteValue(checkpointFile, TimePiece::GetStartTime(J2000));
+    WriteValue(checkpointFile, (int)UnitData::GetInternalReferenceFrame());
+    WriteValue(checkpointFile, (int)UnitData::GetInternalDistanceUnits());
+    WriteValue(checkpointFile, (int)journeyList.size());
+    return;
+}
+
+bool
+ModuleCheckpoint::ReadHeader(ifstream &checkpointFile,
+                             int module,
+                             const JourneyVector &journeyList,
+                             string &mismatchString)
+{
+    char               magic[sizeof(MAGIC_s)];
+    int                formatVersion = 0;
+    int                fileModule = 0;
+    unsigned long long inputHash = 0;
+    int                numberOfTimeSteps = 0;
+    int                secondsPerTimeStep = 0;
+    double             startTime = 0.0;
+    int                referenceFrame = 0;
+    int                distanceUnits = 0;
+    int                fileJourneys = 0;
+    checkpointFile.read(magic, sizeof(magic));
+    ReadValue(checkpointFile, formatVersion);
+    ReadValue(checkpointFile, fileModule);
+    ReadValue(checkpointFile, inputHash);
+    ReadValue(checkpointFile, numberOfTimeSteps);
+    ReadValue(checkpointFile, secondsPerTimeStep);
+    ReadValue(checkpointFile, startTime);
+    ReadValue(checkpointFile, referenceFrame);
+    ReadValue(checkpointFile, distanceUnits);
+    ReadValue(checkpointFile, fileJourneys);
+
+    if ((!checkpointFile) || (memcmp(magic, MAGIC_s, sizeof(MAGIC_s)) != 0)) {
+        mismatchString = "not a checkpoint file";
+    } else if (formatVersion != FORMAT_VERSION_s) {
+        mismatchString = "unsupported format version";
+    } else if (fileModule != module) {
+        mismatchString = "written by a different module";
+    } else if (inputHash != DetermineInputHash(journeyList)) {
+        mismatchString = "input files have changed";
+    } else if ((numberOfTimeSteps != TimePiece::GetNumberOfTimeSteps()) ||
+               (secondsPerTimeStep != TimePiece::GetSecondsPerTimeStep()) ||
+               (startTime != TimePiece::GetStartTime(J2000))) {
+        mismatchString = "time period has changed";
+    } else if ((referenceFrame != (int)UnitData::GetInternalReferenceFrame()) ||
+               (distanceUnits != (int)UnitData::GetInternalDistanceUnits())) {
+        mismatchString = "internal units have changed";
+    } else if (fileJourneys != (int)journeyList.size()) {
+        mismatchString = "data providers have changed";
+    }
+
+    return(mismatchString.size() == 0);
+}
@@ -0,0 +1,170 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ModuleCheckpoint.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef MODULE_CHECKPOINT_H
+#define MODULE_CHECKPOINT_H "ModuleCheckpoint"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class DataProviderCollection;
+class Journey;
+
+/**
+ * Versioned binary checkpoint of a module's in-memory results so a run can
+ *  be resumed (MURAL --resume) without repeating the completed module.  The
+ *  file starts with a header identifying the format version, the module and
+ *  a hash of the input files the results were derived from; a checkpoint
+ *  whose header does not match the current run is ignored and the module is
+ *  run as usual.
+ *
+ * The position checkpoint holds every journey's PositionState array exactly
+ *  as stored (internal frame and units), so a restored run produces the same
+ *  output as an uninterrupted one.  CopyPositions hands the same states from
+ *  one scenario to another in memory (see ParametricSweep).
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * FORMAT_VERSION_s             version written to (and required from) files
+ * POSITION_MODULE_s            module identifier of the position checkpoint
+ */
+class ModuleCheckpoint
+{
+public:
+
+    typedef vector<pair<string, shared_ptr<Journey>>> JourneyVector;
+
+    /**
+     * Writes the positions of every data provider (and trail vehicle)
+     *
+     * @param &ptrDataProviderCollection the data providers to write
+     * @param &checkpointFileName the checkpoint file to (over)write
+     */
+    static void   WritePositions(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                                 const string &checkpointFileName);
+
+    /**
+     * Restores the positions written by WritePositions.  Nothing is restored
+     *  (and false is returned) when the file is missing or was written for a
+     *  different format version, time period, internal units or inputs.
+     *
+     * @param &ptrDataProviderCollection the data providers to restore
+     * @param &checkpointFileName the checkpoint file to read
+     * @return bool true if the positions were restored
+     */
+    static bool   RestorePositions(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                                   const string &checkpointFileName);
+
+    /**
+     * Copies the positions of every data provider (and trail vehicle) of a
+     *  generated scenario into a scenario read from the same position inputs.
+     *  Nothing is copied (and false is returned) when the journeys do not
+     *  match.
+     *
+     * @param &ptrSourceCollection the data providers with generated positions
+     * @param &ptrDataProviderCollection the data providers to copy them to
+     * @return bool true if the positions were copied
+     */
+    static bool   CopyPositions(const shared_ptr<DataProviderCollection> &ptrSourceCollection,
+                                const shared_ptr<DataProviderCollection> &ptrDataProviderCollection);
+
+    /**
+     * Hashes (64 bit FNV-1a) everything the checkpointed results are read or
+     *  derived from so stale checkpoints are detected: the main input file,
+     *  every input data file it lists (miscellaneous, ground station, relay,
+     *  user, region, ...), the parsed input values (which carry any
+     *  overridden values), the other input files (position, link, timeline),
+     *  the requirement decks and any trek files.
+     *
+     * @param &journeyList the journeys being checkpointed
+     */
+    static unsigned long long DetermineInputHash(const JourneyVector &journeyList);
+
+    static const int FORMAT_VERSION_s;
+    static const int POSITION_MODULE_s;
+
+protected:
+
+private:
+
+    static void   CollectJourneys(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection,
+                                  JourneyVector &journeyList);
+    static void   WriteHeader(ofstream &checkpointFile,
+                              int module,
+                              const JourneyVector &journeyList);
+    static bool   ReadHeader(ifstream &checkpointFile,
+                             int module,
+                             const JourneyVector &journeyList,
+                             string &mismatchString);
+
+    static void   HashFile(const string &fileName,
+                           unsigned long long &hashValue);
+    static void   HashBytes(const char *ptrBytes,
+                            size_t numberOfBytes,
+                            unsigned long long &hashValue);
+
+    template<class Type>
+    static inline void WriteValue(ofstream &checkpointFile,
+                                  const Type &value);
+
+    template<class Type>
+    static inline void ReadValue(ifstream &checkpointFile,
+                                 Type &value);
+
+    static inline string GetClassName();
+
+    static const char MAGIC_s[8];
+};
+
+template<class Type>
+inline
+void
+ModuleCheckpoint::WriteValue(ofstream &checkpointFile,
+                             const Type &value)
+{
+    checkpointFile.write(reinterpret_cast<const char*>(&value), sizeof(Type));
+    return;
+}
+
+template<class Type>
+inline
+void
+ModuleCheckpoint::ReadValue(ifstream &checkpointFile,
+                            Type &value)
+{
+    checkpointFile.read(reinterpret_cast<char*>(&value), sizeof(Type));
+    return;
+}
+
+inline
+string
+ModuleCheckpoint::GetClassName()
+{
+    return(MODULE_CHECKPOINT_H);
+}
+
+#endif
@@ -27,6 +27,7 @@
 #include "mural/Earth.h"
 #include "mural/Sun.h"
 #include "mural/Region.h"
+#include "mural/ScenarioContext.h"
 #include "mural/antenna/GroundPointingAntenna.h"
 #include "mural/antenna/RelayPointingAntenna.h"
 #include "mural/sensor/Sensor.h"
@@ -51,10 +52,13 @@
 #include "general/math/SpaceVector.h"
 #include "general/utility/StringEditor.h"
 #include "general/utility/Utility.h"
+#include "general/utility/TaskScheduler.h"
 #include "general/parse/ParseUtility.h"
 #include "general/exception/OutputFileException.h"
 #include "general\utility\Utility.h"
 
+int OutputGenerator::numberOfOutputThreads_s = 0;
+
 //------------------------------------------------------------------------------
 //
 //  Method Name: OutputGenerator::OutputGenerator
@@ -223,6 +227,8 @@ OutputGenerator::ExtractOutputParameterInfo(const shared_ptr<InputDataElement> &
             UnitData::SetOutputReferenceFrame(
                 UnitData::GetReferenceFrame(ptrInputData->GetStringValue())
             );
+        } else if (ptrInputData->LabelContainsString("Number Of Output Threads") == true) {
+            numberOfOutputThreads_s = ptrInputData->GetIntValue();
         }
     }
 
@@ -250,6 +256,14 @@ OutputGenerator::ExtractOutputParameterInfo(const shared_ptr<InputDataElement> &
         errorString += "Missing/invalid 'Output Time Units' input in OUTPUT_PARAMETERS block";
     }
 
+    if (numberOfOutputThreads_s < 0) {
+        if (errorString.size() > 0) {
+            errorString += "\n        ";
+        }
+
+        errorString += "Invalid 'Number Of Output Threads' input in OUTPUT_PARAMETERS block";
+    }
+
     if (UnitData::GetOutputReferenceFrame() == UNKNOWN_FRAME) {
         if (errorString.size() > 0) {
             errorString += "\n        ";
@@ -292,6 +306,10 @@ OutputGenerator::SetOutputFileNames(const shared_ptr<InputDataElement> &ptrInput
             FileNames::SetFileName(FileNames::REV_GPL_OUTPUTFILE, ptrInputData->GetStringValue());
         } else if (ptrInputData->LabelContainsString("Updated Orbit Parameters Output File") == true) {
             FileNames::SetFileName(FileNames::UPDATE_ORBIT_OUTPUTFILE, ptrInputData->GetStringValue());
+        } else if (ptrInputData->LabelContainsString("Position Checkpoint File") == true) {
+            FileNames::SetFileName(FileNames::POSITION_CHECKPOINTFILE, ptrInputData->GetStringValue());
+        } else if (ptrInputData->LabelContainsString("Link Checkpoint Directory") == true) {
+            FileNames::SetFileName(FileNames::LINK_CHECKPOINTDIRECTORY, ptrInputData->GetStringValue());
         } else if (ptrInputData->LabelContainsString("Crosslink Output File") == true) {
             FileNames::SetFileName(FileNames::CROSSLINK_OUTPUTFILE, ptrInputData->GetStringValue());
         } else if (ptrInputData->LabelContainsString("Downlink Output File") == true) {
@@ -337,6 +355,10 @@ OutputGenerator::PrintAttributes(ofstream &outfile)
     outfile << "   Output Reference Frame (ECF/ECI/LLA)       : ";
     outfile << UnitData::GetReferenceFrameString(UnitData::GetOutputReferenceFrame()) << NEW_LINE;
 
+    if (numberOfOutputThreads_s > 0) {
+        outfile << "   Number Of Output Threads                   : " << numberOfOutputThreads_s << NEW_LINE;
+    }
+
     outfile << "<OUTPUT_PARAMETERS_END>" << NEW_LINE;
     outfile << NEW_LINE;
     return;
@@ -367,6 +389,14 @@ OutputGenerator::PrintOutputFiles(ofstream &outfile)
         outfile << "  Updated Orbit Parameters Output File  : " << FileNames::GetFileName(FileNames::UPDATE_ORBIT_OUTPUTFILE) << NEW_LINE;
     }
 
+    if (FileNames::HasFileNameDefined(FileNames::POSITION_CHECKPOINTFILE) == true ) {
+        outfile << "  Position Checkpoint File              : " << FileNames::GetFileName(FileNames::POSITION_CHECKPOINTFILE) << NEW_LINE;
+    }
+
+    if (FileNames::HasFileNameDefined(FileNames::LINK_CHECKPOINTDIRECTORY) == true ) {
+        outfile << "  Link Checkpoint Directory             : " << FileNames::GetFileName(FileNames::LINK_CHECKPOINTDIRECTORY) << NEW_LINE;
+    }
+
     if (FileNames::HasFileNameDefined(FileNames::CROSSLINK_OUTPUTFILE) == true ) {
         outfile << "  Crosslink Output File                 : " << FileNames::GetFileName(FileNames::CROSSLINK_OUTPUTFILE) << NEW_LINE;
     }
@@ -412,10 +442,42 @@ OutputGenerator::PrintOutputFiles(ofstream &outfile)
 void
 OutputGenerator::GenerateOrbitOutput()
 {
-    GenerateVehiclePositionOutputFile();
-    GenerateRevolutionTimeOutputFile();
-    GenerateUpdatedOrbitOutputFile();
+    vector<pair<string, function<void()>>> reportList;
+    reportList.push_back(make_pair(string("Vehicle Position"), function<void()>([this]() {
+        GenerateVehiclePositionOutputFile();
+    })));
+    reportList.push_back(make_pair(string("Revolution Time"), function<void()>([this]() {
+        GenerateRevolutionTimeOutputFile();
+    })));
+    reportList.push_back(make_pair(string("Updated Orbit"), function<void()>([this]() {
+        GenerateUpdatedOrbitOutputFile();
+    })));
+    GenerateReports("Orbit Output", reportList);
+    return;
+}
 
+/* *************************************************************************************** */
+
+void
+OutputGenerator::GenerateReports(const string &groupName,
+                                 const vector<pair<string, function<void()>>> &reportList)
+{
+    TaskScheduler reportScheduler(numberOfOutputThreads_s);
+    vector<pair<string, function<void()>>>::const_iterator reportIter;
+
+    try {
+        for (reportIter = reportList.begin(); reportIter != reportList.end(); ++reportIter) {
+            reportScheduler.AddTask(reportIter->first, ScenarioContext::BindTask(reportIter->second));
+        }
+
+        // Run returns once every report of the group has been written
+        reportScheduler.Run();
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "GenerateReports(const string&, const vector&)");
+        throw;
+    }
+
+    reportScheduler.PrintTaskTimes(cout, groupName);
     return;
 }
 
@@ -525,13 +587,29 @@ OutputGenerator::GenerateUpdatedOrbitOutputFile()
 void
 OutputGenerator::GenerateLinkOutput()
 {
-    GenerateCrosslinkOutputFile();
-    GenerateDownlinkOutputFile();
-    GenerateDirectDownlinkOutputFile();
-    GenerateMultihopLinkOutputFile();
-    GenerateSelfRelayLinkOutputFile();
-    GenerateUPAConjunctionOutputFile();
-    GenerateRFConjunctionOutputFile();
+    vector<pair<string, function<void()>>> reportList;
+    reportList.push_back(make_pair(string("Crosslink"), function<void()>([this]() {
+        GenerateCrosslinkOutputFile();
+    })));
+    reportList.push_back(make_pair(string("Downlink"), function<void()>([this]() {
+        GenerateDownlinkOutputFile();
+    })));
+    reportList.push_back(make_pair(string("Direct Downlink"), function<void()>([this]() {
+        GenerateDirectDownlinkOutputFile();
+    })));
+    reportList.push_back(make_pair(string("Multihop Link"), function<void()>([this]() {
+        GenerateMultihopLinkOutputFile();
+    })));
+    reportList.push_back(make_pair(string("Self Relay Link"), function<void()>([this]() {
+        GenerateSelfRelayLinkOutputFile();
+    })));
+    reportList.push_back(make_pair(string("UPA Conjunction"), function<void()>([this]() {
+        GenerateUPAConjunctionOutputFile();
+    })));
+    reportList.push_back(make_pair(string("RF Conjunction"), function<void()>([this]() {
+        GenerateRFConjunctionOutputFile();
+    })));
+    GenerateReports("Link Output", reportList);
     return;
 }
 
@@ -683,6 +761,20 @@ OutputGenerator::GenerateMainOutput(const string &executableName)
     return;
 } //END: OutputGenerator::GenerateMainOutput
 
+void
+OutputGenerator::GenerateFinalOutput(const string &executableName)
+{
+    vector<pair<string, function<void()>>> reportList;
+    reportList.push_back(make_pair(string("Main Output"), function<void()>([this, executableName]() {
+        GenerateMainOutput(executableName);
+    })));
+    reportList.push_back(make_pair(string("Regions In View"), function<void()>([this]() {
+        GenerateRegionsInViewOutputFile();
+    })));
+    GenerateReports("Final Output", reportList);
+    return;
+}
+
 void
 OutputGenerator::PrintCrisisData(ofstream &outfile,MURALTypes::UserVector &printUserList,
 	                             int userVehicleCount)
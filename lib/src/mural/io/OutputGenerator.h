@@ -24,8 +24,10 @@
 #define OUTPUT_GENERATOR_H "OutputGenerator"
 
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #include "mural/io/satsim/SATSIMData.h"
@@ -51,6 +53,11 @@ class ElementCollection;
  * Class which handles the writing of output.  The methods on this class use the "report"
  * classes to write out output to text.
  *
+ * Each report writes its own file from model state that is no longer being
+ * changed, so the reports of a group (orbit, link and final output) are run
+ * concurrently on at most numberOfOutputThreads_s threads (zero uses one per
+ * hardware thread) and the group returns once every report is written.
+ *
  * @author Brian Fowler
  * @date 12/20/2011
  */
@@ -89,12 +96,15 @@ public:
     void   GenerateValueTimelineOutput();
     void   GenerateMainOutput(const string &executableName);
     void   GenerateRegionsInViewOutputFile();
+    void   GenerateFinalOutput(const string &executableName);
 
     static void   PrintAttributes(ofstream &outfile);
 
     static inline char    GetUserCharacter(int userNumber, int minimumPrintUserNumber = 1, int maximumPrintUserNumber = MRLReport::MAXIMUM_PRINT_USERS_s);
     static inline char    GetRelayCharacter(int relayNumber);
 
+    static inline int     GetNumberOfOutputThreads();
+
 protected:
 
 private:
@@ -115,14 +125,26 @@ private:
 
     void  SetupDataProviderLists(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection);
 
+    void  GenerateReports(const string &groupName,
+                          const vector<pair<string, function<void()>>> &reportList);
+
     static inline string GetClassName();
 
+    static int numberOfOutputThreads_s;
+
     shared_ptr<MURALTypes::ElementCollectionVector> ptrUserGroupList_a;
     shared_ptr<MURALTypes::ElementCollectionVector> ptrUserTypeList_a;
     shared_ptr<MURALTypes::ElementCollectionVector> ptrUserSystemList_a;
     shared_ptr<DataProviderCollection> ptrDataProviderCollection_a;
 };
 
+inline
+int
+OutputGenerator::GetNumberOfOutputThreads()
+{
+    return(numberOfOutputThreads_s);
+}
+
 inline
 char
 OutputGenerator::GetUserCharacter(int userNumber, int minimumPrintUserNumber, int maximumPrintUserNumber)
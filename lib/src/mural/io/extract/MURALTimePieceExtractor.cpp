@@ -187,6 +187,8 @@ MURALTimePieceExtractor::ExtractTimePieceInfo(shared_ptr<InputDataElement> ptrIn
                                  errorString);
     }
 
+    // precompute the per time step calendar/display table used by the reports
+    TimePiece::BuildTimeStepTable();
     return;
 }
 
@@ -37,7 +37,7 @@
 #include "general/parse/ParseUtility.h"
 
 ConjunctionReport::ConjunctionReport(const std::string &outFile ) :
-    outputFileName_a(outFile)
+    outputFileName_a(outFile), writer_a(outfileStream_a)
 {
     return;
 }
@@ -57,6 +57,7 @@ ConjunctionReport::CreateUPAConjReport(const shared_ptr<MURALTypes::RelayVector>
         PrintConjunctionPeriods(ptrRelay);
     }
 
+    writer_a.Flush();
     outfileStream_a.close();
     return;
 }
@@ -76,6 +77,7 @@ ConjunctionReport::CreateRFConjReport(const shared_ptr<MURALTypes::GroundVector>
         PrintConjunctionPeriods(ptrGround);
     }
 
+    writer_a.Flush();
     outfileStream_a.close();
     return;
 }
@@ -92,7 +94,8 @@ ConjunctionReport::PrintConjunctionPeriods(const shared_ptr<DataProvider> &ptrDa
 
     while (ptrConjunctionPeriod != NULL) {
         PrintConjunctionPeriod(*ptrConjunctionPeriod);
-        outfileStream_a << "     NB" << NEW_LINE;
+        writer_a.WriteText("     NB");
+        writer_a.WriteChar(NEW_LINE);
         ptrConjunctionPeriod = conjunctionNBListIter.Next();
     }
 
@@ -100,7 +103,8 @@ ConjunctionReport::PrintConjunctionPeriods(const shared_ptr<DataProvider> &ptrDa
 
     while (ptrConjunctionPeriod != NULL) {
         PrintConjunctionPeriod(*ptrConjunctionPeriod);
-        outfileStream_a << "     WB" << NEW_LINE;
+        writer_a.WriteText("     WB");
+        writer_a.WriteChar(NEW_LINE);
         ptrConjunctionPeriod = conjunctionWBListIter.Next();
     }
 
@@ -112,13 +116,17 @@ ConjunctionReport::PrintConjunctionPeriods(const shared_ptr<DataProvider> &ptrDa
 void
 ConjunctionReport::PrintConjunctionPeriod(const ConjunctionPeriod &period)
 {
-    outfileStream_a << setw(8) << period.GetReceiverDesignator() << " ";
-    outfileStream_a << setw(8) << period.GetSender1Designator() << " ";
-    outfileStream_a << setw(8) << period.GetSender2Designator() << " ";
-    TimePiece::PrintIndex(outfileStream_a, period.GetStartTime());
-    outfileStream_a << " ";
-    TimePiece::PrintIndex(outfileStream_a, period.GetEndTime());
-    outfileStream_a << " " << setw(8) << period.GetNumberOfSimultaneousSenders();
+    writer_a.WriteText(period.GetReceiverDesignator(), 8);
+    writer_a.WriteChar(' ');
+    writer_a.WriteText(period.GetSender1Designator(), 8);
+    writer_a.WriteChar(' ');
+    writer_a.WriteText(period.GetSender2Designator(), 8);
+    writer_a.WriteChar(' ');
+    TimePiece::PrintIndex(writer_a, period.GetStartTime());
+    writer_a.WriteChar(' ');
+    TimePiece::PrintIndex(writer_a, period.GetEndTime());
+    writer_a.WriteChar(' ');
+    writer_a.WriteInt(period.GetNumberOfSimultaneousSenders(), 8);
     return;
 }
 
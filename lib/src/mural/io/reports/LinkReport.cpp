@@ -39,7 +39,7 @@
 #include "general/parse/ParseUtility.h"
 
 LinkReport::LinkReport(const std::string &outFile ) :
-    outputFileName_a(outFile)
+    outputFileName_a(outFile), writer_a(outfileStream_a)
 {
     return;
 }
@@ -86,6 +86,8 @@ LinkReport::CreateCrosslinkReport(const shared_ptr<MURALTypes::UserVector> &ptrU
         }
     }
 
+    writer_a.Flush();
+
     if (openedFile == true) {
         outfileStream_a.close();
     }
@@ -130,6 +132,8 @@ LinkReport::CreateDirectDownlinkReport(const shared_ptr<MURALTypes::UserVector>
         }
     }
 
+    writer_a.Flush();
+
     if (openedFile == true) {
         outfile.close();
     }
@@ -166,6 +170,8 @@ LinkReport::CreateDownlinkReport(const shared_ptr<MURALTypes::RelayVector> &ptrR
         }
     }
 
+    writer_a.Flush();
+
     if (openedFile == true) {
         outfileStream_a.close();
     }
@@ -203,6 +209,8 @@ LinkReport::CreateRelayMultiHopReport(const shared_ptr<MURALTypes::RelayVector>
         }
     }
 
+    writer_a.Flush();
+
     if (openedFile == true) {
         outfile.close();
     }
@@ -261,6 +269,8 @@ LinkReport::CreateUserSelfRelayReport(const shared_ptr<MURALTypes::UserVector> &
         }
     }
 
+    writer_a.Flush();
+
     if (openedFile == true) {
         outfile.close();
     }
@@ -294,10 +304,18 @@ LinkReport::PrintLinks(const shared_ptr<Antenna> &antenna)
             timeIndex = 0;
 
             while (timeIndex < numberOfTimeSteps) {
-                outfileStream_a << setw(8) << fromDesignator << " " << setw(8) << fromAntennaDesignator << " ";
-                outfileStream_a << setw(8) << toDesignator << " " << setw(8) << toAntennaDesignator << " ";
-                TimePiece::PrintIndex(outfileStream_a, timeIndex);
-                outfileStream_a << " " << setw(4) << ptrLink->GetLinkStatusNumber(timeIndex) << NEW_LINE;
+                writer_a.WriteText(fromDesignator, 8);
+                writer_a.WriteChar(' ');
+                writer_a.WriteText(fromAntennaDesignator, 8);
+                writer_a.WriteChar(' ');
+                writer_a.WriteText(toDesignator, 8);
+                writer_a.WriteChar(' ');
+                writer_a.WriteText(toAntennaDesignator, 8);
+                writer_a.WriteChar(' ');
+                TimePiece::PrintIndex(writer_a, timeIndex);
+                writer_a.WriteChar(' ');
+                writer_a.WriteInt(ptrLink->GetLinkStatusNumber(timeIndex), 4);
+                writer_a.WriteChar(NEW_LINE);
                 ++timeIndex;
             }
         }
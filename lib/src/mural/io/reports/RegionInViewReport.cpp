@@ -43,7 +43,7 @@
 
 RegionInViewReport::RegionInViewReport(const string &outFile,
                                        const shared_ptr<MURALTypes::UserVector> &ptrUserList) :
-    outputFileName_a(outFile), ptrUserList_a(ptrUserList)
+    outputFileName_a(outFile), ptrUserList_a(ptrUserList), writer_a(outfileStream_a)
 {
     return;
 }
@@ -81,6 +81,7 @@ RegionInViewReport::CreateReport()
     //    }
     //}
 
+    writer_a.Flush();
     outfileStream_a.close();
 }
 
@@ -403,26 +404,26 @@ RegionInViewReport::PrintRegionsInView(const string &userDesignator,
 
     try {
         int regionIndex = 0;
-        outfileStream_a << setw(8) << userDesignator;
-        outfileStream_a << " ";
-        TimePiece::PrintIndex(outfileStream_a, timeIndex);
-        outfileStream_a << " ";
-        outfileStream_a << setw(4) << sensorString;
-        outfileStream_a << " ";
-        outfileStream_a << setw(6) << modeString;
-        outfileStream_a << " ";
-        outfileStream_a << setw(6) << typeString;
-        outfileStream_a << " ";
-        Region::PrintRegionNumber(outfileStream_a, ptrRegionNumbers->ElementAt(regionIndex));
+        writer_a.WriteText(userDesignator, 8);
+        writer_a.WriteChar(' ');
+        TimePiece::PrintIndex(writer_a, timeIndex);
+        writer_a.WriteChar(' ');
+        writer_a.WriteText(sensorString, 4);
+        writer_a.WriteChar(' ');
+        writer_a.WriteText(modeString, 6);
+        writer_a.WriteChar(' ');
+        writer_a.WriteText(typeString, 6);
+        writer_a.WriteChar(' ');
+        Region::PrintRegionNumber(writer_a, ptrRegionNumbers->ElementAt(regionIndex));
         ++regionIndex;
 
         while (regionIndex < numberOfRegions) {
-            outfileStream_a << ", ";
-            Region::PrintRegionNumber(outfileStream_a, ptrRegionNumbers->ElementAt(regionIndex));
+            writer_a.WriteText(", ");
+            Region::PrintRegionNumber(writer_a, ptrRegionNumbers->ElementAt(regionIndex));
             ++regionIndex;
         }
 
-        outfileStream_a << NEW_LINE;
+        writer_a.WriteChar(NEW_LINE);
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(),
                             "PrintRegionsInView(ofstream&, const string&, ...)");
@@ -440,18 +441,18 @@ RegionInViewReport::PrintMostValuableRegion(const string &userDesignator,
         const string &typeString,
         const double &regionNumber)
 {
-    outfileStream_a << setw(8) << userDesignator;
-    outfileStream_a << " ";
-    TimePiece::PrintIndex(outfileStream_a, timeIndex);
-    outfileStream_a << " ";
-    outfileStream_a << setw(4) << sensorString;
-    outfileStream_a << " ";
-    outfileStream_a << setw(6) << modeString;
-    outfileStream_a << " ";
-    outfileStream_a << setw(6) << typeString;
-    outfileStream_a << " ";
-    Region::PrintRegionNumber(outfileStream_a, regionNumber);
-    outfileStream_a << NEW_LINE;
+    writer_a.WriteText(userDesignator, 8);
+    writer_a.WriteChar(' ');
+    TimePiece::PrintIndex(writer_a, timeIndex);
+    writer_a.WriteChar(' ');
+    writer_a.WriteText(sensorString, 4);
+    writer_a.WriteChar(' ');
+    writer_a.WriteText(modeString, 6);
+    writer_a.WriteChar(' ');
+    writer_a.WriteText(typeString, 6);
+    writer_a.WriteChar(' ');
+    Region::PrintRegionNumber(writer_a, regionNumber);
+    writer_a.WriteChar(NEW_LINE);
     return;
 }
 
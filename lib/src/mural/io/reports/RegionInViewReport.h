@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "mural/MURALTypes.h"
+#include "general/utility/ReportWriter.h"
 
 using namespace std;
 
@@ -117,6 +118,7 @@ private:
 
     string outputFileName_a;
     ofstream outfileStream_a;
+    ReportWriter writer_a;
 };
 
 inline
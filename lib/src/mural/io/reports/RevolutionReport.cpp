@@ -24,6 +24,7 @@
 
 #include "RevolutionReport.h"
 #include "mural/element/UserVehicle.h"
+#include "mural/modules/pg/EclipseTimeline.h"
 #include "mural/modules/pg/Journey.h"
 #include "mural/modules/pg/Orbit.h"
 #include "mural/modules/pg/Revolution.h"
@@ -52,7 +53,7 @@ RevolutionReport::CreateReport()
     shared_ptr<UserVehicle> ptrTrailVehicle = NULL;
     MURALTypes::UserVector::iterator userIter;
     ParseUtility::OpenOutputFile(outfileStream_a, outputFileName_a);
-    outfileStream_a << "    USER   START     END  REV  ZERO CRS" << NEW_LINE;
+    outfileStream_a << "    USER   START     END  REV  ZERO CRS    UMBRA PENUMBRA" << NEW_LINE;
 
     for( userIter = ptrUserList_a->begin(); userIter != ptrUserList_a->end(); ++userIter) {
         ptrUser = (*userIter);
@@ -158,10 +159,11 @@ RevolutionReport::PrintRevTimesFile(const UserVehicle &user)
     if ( ptrOrbit != NULL ) {
         ListIterator<Revolution> revolutionListIter(ptrOrbit->GetRevolutionList());
         Revolution              *ptrRevolution = revolutionListIter.First();
+        const EclipseTimeline   &eclipseTimeline = ptrOrbit->GetEclipseTimeline();
 
         while (ptrRevolution != NULL) {
             outfileStream_a << setw(8) << user.GetDesignator() << " ";
-            PrintRevolution(*ptrRevolution);
+            PrintRevolution(*ptrRevolution, eclipseTimeline);
             ptrRevolution = revolutionListIter.Next();
         }
     }
@@ -172,7 +174,8 @@ RevolutionReport::PrintRevTimesFile(const UserVehicle &user)
 /* ************************************************************************** */
 
 void
-RevolutionReport::PrintRevolution(const Revolution &revolution)
+RevolutionReport::PrintRevolution(const Revolution &revolution,
+                                  const EclipseTimeline &eclipseTimeline)
 {
     TimePiece::PrintIndex(outfileStream_a, revolution.GetStartTime());
     outfileStream_a << " ";
@@ -180,7 +183,11 @@ RevolutionReport::PrintRevolution(const Revolution &revolution)
     outfileStream_a << " ";
     outfileStream_a << setw(4) << revolution.GetRevNumber() << " ";
     outfileStream_a << setw(9) << setprecision(2)
-                    << UnitData::GetOutputAngle(revolution.GetAscendingZeroCrossingLongitude()) << NEW_LINE;
+                    << UnitData::GetOutputAngle(revolution.GetAscendingZeroCrossingLongitude()) << " ";
+    outfileStream_a << setw(8) << setprecision(1)
+                    << eclipseTimeline.GetUmbraSeconds(revolution.GetStartTime(), revolution.GetEndTime()) << " ";
+    outfileStream_a << setw(8) << setprecision(1)
+                    << eclipseTimeline.GetPenumbraSeconds(revolution.GetStartTime(), revolution.GetEndTime()) << NEW_LINE;
     return;
 }
 
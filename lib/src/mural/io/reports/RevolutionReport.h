@@ -36,14 +36,20 @@ template<class Type> class Array;
 
 class UserVehicle;
 class Revolution;
+class EclipseTimeline;
 
 using namespace std;
 
 /**
  * Creates the Revolution report detailing the time periods for the calculated revs
+ * and the seconds spent in the Earth's umbra and (partial) penumbra during each
  *
  * Example Header:
- *     USER   START     END  REV  ZERO CRS
+ *     USER   START     END  REV  ZERO CRS    UMBRA PENUMBRA
+ *
+ * UMBRA and PENUMBRA are accumulated from the shadow crossings found between
+ * adjacent time steps (see EclipseTimeline), so an eclipse that begins and
+ * ends within a single time step (a grazing pass) is not counted.
  *
  * @author Brian Fowler
  * @date 11/18/11
@@ -77,7 +83,8 @@ private:
 
     void PrintRevGPLFile(const UserVehicle &user);
     void PrintRevTimesFile(const UserVehicle &user);
-    void PrintRevolution(const Revolution &revolution);
+    void PrintRevolution(const Revolution &revolution,
+                         const EclipseTimeline &eclipseTimeline);
 
     shared_ptr<MURALTypes::UserVector> ptrUserList_a;
 
@@ -37,7 +37,7 @@
 
 TimelineReport::TimelineReport(const std::string &outFile,
                                const shared_ptr<MURALTypes::UserVector> &ptrUserList ) :
-    outputFileName_a(outFile), ptrUserList_a(ptrUserList)
+    outputFileName_a(outFile), ptrUserList_a(ptrUserList), writer_a(outfileStream_a)
 {
     return;
 }
@@ -56,6 +56,7 @@ TimelineReport::CreateReport()
         PrintValueTimeline(*ptrUser);
     }
 
+    writer_a.Flush();
     outfileStream_a.close();
 }
 
@@ -71,22 +72,22 @@ TimelineReport::PrintValueTimeline(const UserVehicle &user)
     const int        numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
     const bool        usingSubRegions = Region::UsingSubRegions();
     ValueTimelineElement *ptrElement = user.GetValueTimelineElement(timeIndex);
-    outfileStream_a << "    USER    TIME";
+    writer_a.WriteText("    USER    TIME");
 
     if (usingSubRegions == true) {
-        outfileStream_a << "    ";
+        writer_a.WriteText("    ");
     }
 
-    outfileStream_a << "  OVER         SCORE CRI";
+    writer_a.WriteText("  OVER         SCORE CRI");
     numberOfResources = ptrElement->GetNumberOfImagedRegions();
     resourceIndex = 0;
 
     while (resourceIndex < numberOfResources) {
         if (usingSubRegions == true) {
-            outfileStream_a << "    ";
+            writer_a.WriteText("    ");
         }
 
-        outfileStream_a << "  IMAG";
+        writer_a.WriteText("  IMAG");
         ++resourceIndex;
     }
 
@@ -94,7 +95,7 @@ TimelineReport::PrintValueTimeline(const UserVehicle &user)
     resourceIndex = 0;
 
     while (resourceIndex < numberOfResources) {
-        outfileStream_a << " SEN";
+        writer_a.WriteText(" SEN");
         ++resourceIndex;
     }
 
@@ -102,7 +103,7 @@ TimelineReport::PrintValueTimeline(const UserVehicle &user)
     resourceIndex = 0;
 
     while (resourceIndex < numberOfResources) {
-        outfileStream_a << " MSN";
+        writer_a.WriteText(" MSN");
         ++resourceIndex;
     }
 
@@ -110,7 +111,7 @@ TimelineReport::PrintValueTimeline(const UserVehicle &user)
     resourceIndex = 0;
 
     while (resourceIndex < numberOfResources) {
-        outfileStream_a << "      TTC";
+        writer_a.WriteText("      TTC");
         ++resourceIndex;
     }
 
@@ -118,7 +119,7 @@ TimelineReport::PrintValueTimeline(const UserVehicle &user)
     resourceIndex = 0;
 
     while (resourceIndex < numberOfResources) {
-        outfileStream_a << "      BITS";
+        writer_a.WriteText("      BITS");
         ++resourceIndex;
     }
 
@@ -126,7 +127,7 @@ TimelineReport::PrintValueTimeline(const UserVehicle &user)
     resourceIndex = 0;
 
     while (resourceIndex < numberOfResources) {
-        outfileStream_a << " SUB";
+        writer_a.WriteText(" SUB");
         ++resourceIndex;
     }
 
@@ -134,18 +135,19 @@ TimelineReport::PrintValueTimeline(const UserVehicle &user)
     resourceIndex = 0;
 
     while (resourceIndex < numberOfResources) {
-        outfileStream_a << " FACTOR";
+        writer_a.WriteText(" FACTOR");
         ++resourceIndex;
     }
 
-    outfileStream_a << NEW_LINE;
+    writer_a.WriteChar(NEW_LINE);
 
     while (timeIndex < numberOfTimeSteps) {
-        outfileStream_a << setw(8) << user.GetDesignator() << " ";
-        TimePiece::PrintIndex(outfileStream_a, timeIndex);
+        writer_a.WriteText(user.GetDesignator(), 8);
+        writer_a.WriteChar(' ');
+        TimePiece::PrintIndex(writer_a, timeIndex);
         // print the element
         PrintElement(*(user.GetValueTimelineElement(timeIndex)));
-        outfileStream_a << NEW_LINE;
+        writer_a.WriteChar(NEW_LINE);
         ++timeIndex;
     }
 
@@ -159,52 +161,57 @@ TimelineReport::PrintElement(const ValueTimelineElement &element)
 {
     int       resourceIndex = 0;
     int numberOfResources = element.GetNumberOfResourceFactors();
-    outfileStream_a << "  ";
-    Region::PrintRegionNumber(outfileStream_a, element.GetOverflownRegion());
-    outfileStream_a << " " << setw(13) << setprecision(3) << element.GetCollectionScore();
-    outfileStream_a << " " << setw(3) << element.GetCrisisLevel();
+    writer_a.WriteText("  ");
+    Region::PrintRegionNumber(writer_a, element.GetOverflownRegion());
+    writer_a.WriteChar(' ');
+    writer_a.WriteFixed(element.GetCollectionScore(), 13, 3);
+    writer_a.WriteChar(' ');
+    writer_a.WriteInt(element.GetCrisisLevel(), 3);
     resourceIndex = 0;
 
     while (resourceIndex <= numberOfResources) {
-        outfileStream_a << "  ";
-        Region::PrintRegionNumber(outfileStream_a, element.GetImagedRegion(resourceIndex));
+        writer_a.WriteText("  ");
+        Region::PrintRegionNumber(writer_a, element.GetImagedRegion(resourceIndex));
         ++resourceIndex;
     }
 
     resourceIndex = 0;
 
     while (resourceIndex <= numberOfResources) {
-        outfileStream_a << " " << setw(3) << element.GetSensorNumber(resourceIndex);
+        writer_a.WriteChar(' ');
+        writer_a.WriteInt(element.GetSensorNumber(resourceIndex), 3);
         ++resourceIndex;
     }
 
     resourceIndex = 0;
 
     while (resourceIndex <= numberOfResources) {
-        outfileStream_a << " " << setw(3) << element.GetMissionNumber(resourceIndex);
+        writer_a.WriteChar(' ');
+        writer_a.WriteInt(element.GetMissionNumber(resourceIndex), 3);
         ++resourceIndex;
     }
 
     resourceIndex = 0;
 
     while (resourceIndex <= numberOfResources) {
-        outfileStream_a << " " << setw(8) << setprecision(2)
-                        << element.GetCollectionTime(resourceIndex);
+        writer_a.WriteChar(' ');
+        writer_a.WriteFixed(element.GetCollectionTime(resourceIndex), 8, 2);
         ++resourceIndex;
     }
 
     resourceIndex = 0;
 
     while (resourceIndex <= numberOfResources) {
-        outfileStream_a << " " << setw(9) << setprecision(2)
-                        << element.GetMaxPossibleBitsCollected(resourceIndex);
+        writer_a.WriteChar(' ');
+        writer_a.WriteFixed(element.GetMaxPossibleBitsCollected(resourceIndex), 9, 2);
         ++resourceIndex;
     }
 
     resourceIndex = 0;
 
     while (resourceIndex <= numberOfResources) {
-        outfileStream_a << " " << setw(3) << element.GetSubPriorityLevel(resourceIndex);
+        writer_a.WriteChar(' ');
+        writer_a.WriteInt(element.GetSubPriorityLevel(resourceIndex), 3);
         ++resourceIndex;
     }
 
@@ -212,8 +219,8 @@ TimelineReport::PrintElement(const ValueTimelineElement &element)
         resourceIndex = 0;
 
         while (resourceIndex <= numberOfResources) {
-            outfileStream_a << " " << setw(6) << setprecision(4)
-                            << element.GetResourceFactor(resourceIndex);
+            writer_a.WriteChar(' ');
+            writer_a.WriteFixed(element.GetResourceFactor(resourceIndex), 6, 4);
             ++resourceIndex;
         }
     }
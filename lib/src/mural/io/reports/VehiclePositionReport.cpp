@@ -39,7 +39,7 @@
 
 VehiclePositionReport::VehiclePositionReport(const std::string &outFile,
         const shared_ptr<MURALTypes::ElementVector> &ptrElementList ) :
-    outputFileName_a(outFile), ptrElementList_a(ptrElementList)
+    outputFileName_a(outFile), ptrElementList_a(ptrElementList), writer_a(outfileStream_a)
 {
     return;
 }
@@ -62,7 +62,8 @@ VehiclePositionReport::CreateReport()
         }
     }
 
-    // Print the Sun
+    // Print the Sun (straight to the stream, so empty the writer first)
+    writer_a.Flush();
     Sun::PrintPositionFile(outfileStream_a);
     outfileStream_a.close();
 }
@@ -91,23 +92,26 @@ VehiclePositionReport::PrintPositions(const Element &element)
 
         while (timeIndex < numberOfTimeSteps) {
             ptrPositionState = new PositionState(positionVector, velocityVector);
-            outfileStream_a << setw(8) << designator << " ";
-            TimePiece::PrintIndex(outfileStream_a, timeIndex);
-            ptrPositionState->PrintPositionState(outfileStream_a, timeIndex);
-            outfileStream_a << " " << TimePiece::GetClockTimeAndDate(timeIndex);
-            outfileStream_a << NEW_LINE;
+            writer_a.WriteText(designator, 8);
+            writer_a.WriteChar(' ');
+            TimePiece::PrintIndex(writer_a, timeIndex);
+            ptrPositionState->PrintPositionState(writer_a, timeIndex);
+            writer_a.WriteChar(' ');
+            writer_a.WriteText(TimePiece::GetClockTimeAndDate(timeIndex));
+            writer_a.WriteChar(NEW_LINE);
             delete ptrPositionState;
             ptrPositionState = NULL;
             ++timeIndex;
         }
     } else {
         while (timeIndex < numberOfStates) {
-            outfileStream_a << setw(8) << designator;
-            outfileStream_a << " ";
-            TimePiece::PrintIndex(outfileStream_a, timeIndex);
-            (ptrJourney->GetPositionStateAt(timeIndex))->PrintPositionState(outfileStream_a, timeIndex);
-            outfileStream_a << " " << TimePiece::GetClockTimeAndDate(timeIndex);
-            outfileStream_a << NEW_LINE;
+            writer_a.WriteText(designator, 8);
+            writer_a.WriteChar(' ');
+            TimePiece::PrintIndex(writer_a, timeIndex);
+            (ptrJourney->GetPositionStateAt(timeIndex))->PrintPositionState(writer_a, timeIndex);
+            writer_a.WriteChar(' ');
+            writer_a.WriteText(TimePiece::GetClockTimeAndDate(timeIndex));
+            writer_a.WriteChar(NEW_LINE);
             ++timeIndex;
         }
     }
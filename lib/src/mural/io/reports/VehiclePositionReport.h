@@ -30,6 +30,7 @@
 #include <memory>
 
 #include "mural/modules/pg/Journey.h"
+#include "general/utility/ReportWriter.h"
 
 template<class Type> class LinkList;
 template<class Type> class Array;
@@ -79,6 +80,7 @@ private:
 
     std::string outputFileName_a;
     std::ofstream outfileStream_a;
+    ReportWriter  writer_a;
 };
 
 inline
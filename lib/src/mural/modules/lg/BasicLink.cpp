@@ -481,6 +481,20 @@ BasicLink::GetLinkStatusString(const LINK_STATUS &status)
 
 /* ************************************************************************************* */
 
+size_t
+BasicLink::GetMemoryFootprint() const
+{
+    size_t footprint = sizeof(*this);
+
+    if (ptrInviewStatus_a != NULL) {
+        footprint += (ptrInviewStatus_a->capacity() * sizeof(int));
+    }
+
+    return(footprint);
+}
+
+/* ************************************************************************************* */
+
 BasicLink::~BasicLink()
 {
     return;
@@ -194,6 +194,13 @@ public:
      */
     SpaceVector   GetLineOfSightVector(int timeIndex) const;
 
+    /**
+     * Estimates the bytes held by this link (its status arrays)
+     *
+     * @return the footprint (bytes)
+     */
+    virtual size_t GetMemoryFootprint() const;
+
 protected:
 
     shared_ptr<Antenna>       ptrTransmitAntenna_a;
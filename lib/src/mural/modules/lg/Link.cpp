@@ -226,6 +226,24 @@ Link::SetPrecludedReceiver(const string &receiverDesignator)
     ptrTransmitAntenna_a->SetPrecludedReceiver(receiverDesignator);
 }
 
+void
+Link::SetAllocationStatus(int timeIndex,
+                          const ALLOCATION_STATUS &status)
+{
+    if (ptrAllocationStatus_a == NULL) {
+        ptrAllocationStatus_a = new Array<int>(TimePiece::GetNumberOfTimeSteps(), NO_ALLOCATION);
+    }
+
+    try {
+        ptrAllocationStatus_a->ResetValue(timeIndex, status);
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "SetAllocationStatus(int, ALLOCATION_STATUS)");
+        throw;
+    }
+
+    return;
+}
+
 int
 Link::GetTransmitPreparationTime() const
 {
@@ -524,6 +542,28 @@ Link::GetWidebandTransmissionString(const WIDEBAND_TRANSMISSION &transmit)
     return(transmissionString);
 }
 
+size_t
+Link::GetMemoryFootprint() const
+{
+    const Array<int> *ptrStatusArrays[] = {ptrAllocationStatus_a, ptrOverlapTransmitTimeStepIndex_a,
+                                           ptrOverlapReceiveTimeStepIndex_a, ptrNetworkMissionIndexArray_a,
+                                           ptrNetworkNarrowbandIndexArray_a
+                                          };
+    const int         numberOfArrays = (int)(sizeof(ptrStatusArrays) / sizeof(ptrStatusArrays[0]));
+    size_t            footprint = BasicLink::GetMemoryFootprint() + (sizeof(*this) - sizeof(BasicLink));
+    int               arrayIndex = 0;
+
+    while (arrayIndex < numberOfArrays) {
+        if (ptrStatusArrays[arrayIndex] != NULL) {
+            footprint += (sizeof(Array<int>) + (ptrStatusArrays[arrayIndex]->Size() * sizeof(int)));
+        }
+
+        ++arrayIndex;
+    }
+
+    return(footprint);
+}
+
 Link::~Link()
 {
     if (ptrAllocationStatus_a != NULL) {
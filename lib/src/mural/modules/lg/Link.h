@@ -132,6 +132,11 @@ public:
 
 	void   SetPrecludedReceiver(const string &receiverDesignator);
 
+    void   SetAllocationStatus(int timeIndex,
+                               const ALLOCATION_STATUS &status);
+
+    size_t GetMemoryFootprint() const;
+
     int  GetTransmitNumber() const;
     int  GetReceiveNumber() const;
     int  GetAllocatedCapacity(int timeIndex) const;
@@ -0,0 +1,197 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * LinkCache.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "LinkCache.h"
+
+#include "general/time/TimePiece.h"
+#include "general/utility/Constant.h"
+
+const char               LinkCache::MAGIC_s[8]        = {'M', 'U', 'R', 'A', 'L', 'L', 'N', 'K'};
+const int                LinkCache::FORMAT_VERSION_s  = 1;
+const unsigned long long LinkCache::OFFSET_BASIS_s    = 14695981039346656037ULL;
+
+LinkCache::LinkCache(const string &cacheDirectory,
+                     const string &cacheName)
+    : cacheDirectory_a(cacheDirectory), cacheName_a(cacheName), hits_a(0), misses_a(0), stores_a(0),
+      storeFailures_a(0)
+{
+    return;
+}
+
+bool
+LinkCache::Retrieve(unsigned long long key,
+                    Array<int>* &ptrStatusArray)
+{
+    char               magic[sizeof(MAGIC_s)];
+    int                formatVersion = 0;
+    int                numberOfTimeSteps = 0;
+    unsigned long long fileKey = 0;
+    ifstream           cacheFile(DetermineFileName(key).c_str(), ios::in | ios::binary);
+    ptrStatusArray = NULL;
+
+    if (cacheFile) {
+        cacheFile.read(magic, sizeof(magic));
+        cacheFile.read(reinterpret_cast<char*>(&formatVersion), sizeof(formatVersion));
+        cacheFile.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey));
+        cacheFile.read(reinterpret_cast<char*>(&numberOfTimeSteps), sizeof(numberOfTimeSteps));
+
+        if ((cacheFile) && (memcmp(magic, MAGIC_s, sizeof(MAGIC_s)) == 0) &&
+                (formatVersion == FORMAT_VERSION_s) && (fileKey == key) &&
+                (numberOfTimeSteps == TimePiece::GetNumberOfTimeSteps())) {
+            int timeIndex = 0;
+            int status = 0;
+            ptrStatusArray = new Array<int>(numberOfTimeSteps, 0);
+
+            while ((timeIndex < numberOfTimeSteps) && (cacheFile)) {
+                cacheFile.read(reinterpret_cast<char*>(&status), sizeof(status));
+                (*ptrStatusArray)[timeIndex] = status;
+                ++timeIndex;
+            }
+
+            if (!cacheFile) {
+                // truncated file, recompute the link
+                delete ptrStatusArray;
+                ptrStatusArray = NULL;
+            }
+        }
+    }
+
+    if (ptrStatusArray != NULL) {
+        ++hits_a;
+    } else {
+        ++misses_a;
+    }
+
+    return(ptrStatusArray != NULL);
+}
+
+void
+LinkCache::Store(unsigned long long key,
+                 const Array<int> *ptrStatusArray)
+{
+    const string fileName = DetermineFileName(key);
+    const string temporaryFileName = fileName + ".tmp";
+    const int    numberOfTimeSteps = ptrStatusArray->Size();
+    int          timeIndex = 0;
+    ofstream     cacheFile(temporaryFileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+    if (cacheFile) {
+        cacheFile.write(MAGIC_s, sizeof(MAGIC_s));
+        cacheFile.write(reinterpret_cast<const char*>(&FORMAT_VERSION_s), sizeof(FORMAT_VERSION_s));
+        cacheFile.write(reinterpret_cast<const char*>(&key), sizeof(key));
+        cacheFile.write(reinterpret_cast<const char*>(&numberOfTimeSteps), sizeof(numberOfTimeSteps));
+
+        while (timeIndex < numberOfTimeSteps) {
+            const int status = ptrStatusArray->ElementAt(timeIndex);
+            cacheFile.write(reinterpret_cast<const char*>(&status), sizeof(status));
+            ++timeIndex;
+        }
+
+        cacheFile.close();
+    }
+
+    // write then rename so an interrupted run never leaves a partial entry
+    // (rename does not replace an existing file on every platform)
+    if (cacheFile) {
+        remove(fileName.c_str());
+    }
+
+    if ((!cacheFile) || (rename(temporaryFileName.c_str(), fileName.c_str()) != 0)) {
+        remove(temporaryFileName.c_str());
+        ++storeFailures_a;
+    } else {
+        ++stores_a;
+    }
+
+    return;
+}
+
+void
+LinkCache::PrintStatistics(ostream &outfile) const
+{
+    const int           lookups = hits_a + misses_a;
+    const ios::fmtflags saveFlags = outfile.flags();
+    const streamsize    savePrecision = outfile.precision();
+    outfile << cacheName_a << ": " << hits_a << " Hits, " << misses_a << " Misses";
+
+    if (lookups > 0) {
+        outfile << " (" << fixed << setprecision(1)
+                << (100.0 * (double)hits_a / (double)lookups) << "% Hit Rate)";
+    }
+
+    outfile << ", " << stores_a << " Stored";
+
+    if (storeFailures_a > 0) {
+        outfile << ", " << storeFailures_a << " Could Not Be Written To " << cacheDirectory_a;
+    }
+
+    outfile << NEW_LINE;
+    outfile.flags(saveFlags);
+    outfile.precision(savePrecision);
+    return;
+}
+
+void
+LinkCache::HashBytes(const void *ptrBytes,
+                     size_t numberOfBytes,
+                     unsigned long long &hashValue)
+{
+    const unsigned long long fnvPrime = 1099511628211ULL;
+    const unsigned char     *ptrByte = static_cast<const unsigned char*>(ptrBytes);
+    size_t                   byteIndex = 0;
+
+    while (byteIndex < numberOfBytes) {
+        hashValue ^= ptrByte[byteIndex];
+        hashValue *= fnvPrime;
+        ++byteIndex;
+    }
+
+    return;
+}
+
+void
+LinkCache::HashString(const string &value,
+                      unsigned long long &hashValue)
+{
+    // the length keeps adjacent strings from running together
+    HashValue(value.size(), hashValue);
+    HashBytes(value.c_str(), value.size(), hashValue);
+    return;
+}
+
+string
+LinkCache::DetermineFileName(unsigned long long key) const
+{
+    ostringstream fileName;
+    fileName << cacheDirectory_a << "/" << hex << setw(16) << setfill('0') << key << ".link";
+    return(fileName.str());
+}
+
+LinkCache::~LinkCache()
+{
+    return;
+}
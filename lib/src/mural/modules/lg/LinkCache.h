@@ -0,0 +1,136 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * LinkCache.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef LINK_CACHE_H
+#define LINK_CACHE_H "LinkCache"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "general/array/Array.h"
+
+using namespace std;
+
+/**
+ * Persistent, content addressed store of link status arrays.  Each link is
+ *  saved in its own file named after a 64 bit FNV-1a key of everything the
+ *  status array is derived from (the key is built by the LinksGenerator),
+ *  so a re-run with unchanged endpoints loads the array instead of
+ *  recomputing it while any change to an endpoint simply produces a new key.
+ *  Reading and writing problems are never fatal: a file that can not be
+ *  read is a miss and a file that can not be written is counted and skipped.
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * cacheDirectory_a             directory holding the cached link files
+ * cacheName_a                  name the statistics are printed under
+ * hits_a                       links loaded from the cache
+ * misses_a                     links not found (or unreadable) in the cache
+ * stores_a                     links written to the cache
+ * storeFailures_a              links which could not be written
+ * FORMAT_VERSION_s             version written to (and required from) files
+ */
+class LinkCache
+{
+public:
+
+    explicit LinkCache(const string &cacheDirectory,
+                       const string &cacheName = "LinkCache");
+    virtual ~LinkCache();
+
+    /**
+     * Loads the status array stored under key
+     *
+     * @param key the content key of the link
+     * @param *&ptrStatusArray (return) the loaded array (caller owns) or NULL
+     * @return bool true on a cache hit
+     */
+    bool   Retrieve(unsigned long long key,
+                    Array<int>* &ptrStatusArray);
+
+    /**
+     * Stores the status array under key
+     *
+     * @param key the content key of the link
+     * @param *ptrStatusArray the status array to store
+     */
+    void   Store(unsigned long long key,
+                 const Array<int> *ptrStatusArray);
+
+    void   PrintStatistics(ostream &outfile) const;
+
+    /**
+     * FNV-1a 64 bit hash accumulation, start from OFFSET_BASIS_s
+     */
+    static void HashBytes(const void *ptrBytes,
+                          size_t numberOfBytes,
+                          unsigned long long &hashValue);
+    static void HashString(const string &value,
+                           unsigned long long &hashValue);
+
+    template<class Type>
+    static inline void HashValue(const Type &value,
+                                 unsigned long long &hashValue);
+
+    static const unsigned long long OFFSET_BASIS_s;
+    static const int                FORMAT_VERSION_s;
+
+protected:
+
+private:
+
+    LinkCache(const LinkCache &copyMe);
+    LinkCache& operator = (const LinkCache &copyMe);
+
+    string DetermineFileName(unsigned long long key) const;
+
+    static inline string GetClassName();
+
+    static const char MAGIC_s[8];
+
+    string cacheDirectory_a;
+    string cacheName_a;
+    int    hits_a;
+    int    misses_a;
+    int    stores_a;
+    int    storeFailures_a;
+};
+
+template<class Type>
+inline
+void
+LinkCache::HashValue(const Type &value,
+                     unsigned long long &hashValue)
+{
+    HashBytes(&value, sizeof(Type), hashValue);
+    return;
+}
+
+inline
+string
+LinkCache::GetClassName()
+{
+    return(LINK_CACHE_H);
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "LinksGenerator.h"
 #include "AzimuthAngleData.h"
 #include "ConjunctionPeriod.h"
+#include "LinkCache.h"
 #include "mural/io/MURALInputProcessor.h"
 #include "mural/io/FileNames.h"
 #include "mural/antenna/GroundPointingAntenna.h"
@@ -40,26 +41,51 @@
 #include "mural/element/GroundStation.h"
 #include "mural/element/DataProviderCollection.h"
 #include "mural/modules/pg/PositionGenerator.h"
+#include "mural/modules/pg/Journey.h"
 #include "mural/modules/pg/PositionUtility.h"
 
 #include "general/array/Array3D.h"
 #include "general/array/ListIterator.h"
 #include "general/data/UnitData.h"
 #include "general/parse/ParseUtility.h"
+#include "general/math/CoordinateFrame.h"
 #include "general/math/SimpleMath.h"
 #include "general/math/SpaceVector.h"
 #include "general/utility/StringEditor.h"
 
-double  LinksGenerator::additionalCheckSeconds_s         = INVALID_SECONDS;
+LinksGenerator::State               LinksGenerator::defaultState_s;
+thread_local LinksGenerator::State *LinksGenerator::ptrBoundState_s = NULL;
+
+const double LinksGenerator::ROOT_TOLERANCE_SECONDS_s    = 1.0e-3;
+const int    LinksGenerator::MAXIMUM_ROOT_ITERATIONS_s   = 60;
+const int    LinksGenerator::NUMBER_OF_ROOT_CONSTRAINTS_s = 12;
+
+// geometric constraints in the order DetermineGeometryStatus checks them
+const Link::LINK_STATUS LinksGenerator::ROOT_CONSTRAINTS_s[] = {
+    Link::MIN_GRAZING_ALTITUDE,
+    Link::MAX_RANGE_TRANSMIT,
+    Link::MIN_RANGE_TRANSMIT,
+    Link::MAX_SUN_SEPARATION_TRANSMIT,
+    Link::MIN_SUN_SEPARATION_TRANSMIT,
+    Link::MAX_SUN_SEPARATION_RECEIVE,
+    Link::MIN_SUN_SEPARATION_RECEIVE,
+    Link::MAX_ELEVATION_RECEIVE,
+    Link::MIN_ELEVATION_RECEIVE,
+    Link::MAX_ELEVATION_TRANSMIT,
+    Link::MIN_ELEVATION_TRANSMIT,
+    Link::MIN_SOLAR_INTRUSION
+};
 
 LinksGenerator::LinksGenerator()
-    : ptrDataProviderCollection_a(NULL)
+    : ptrDataProviderCollection_a(NULL), ptrLinkCache_a(NULL),
+      ptrLinkCheckpoint_a(NULL), ptrGeometryCache_a(NULL)
 {
     return;
 }
 
 LinksGenerator::LinksGenerator(const LinksGenerator &copyMe)
-    : ptrDataProviderCollection_a(copyMe.ptrDataProviderCollection_a)
+    : ptrDataProviderCollection_a(copyMe.ptrDataProviderCollection_a), ptrLinkCache_a(NULL),
+      ptrLinkCheckpoint_a(NULL), ptrGeometryCache_a(NULL)
 {
     return;
 }
@@ -90,7 +116,17 @@ LinksGenerator::ExtractLinksGeneratorInfo(const shared_ptr<InputDataElement> &pt
                 ptrInputData = (*inputDataIter);
 
                 if (ptrInputData->LabelContainsString("Additional Check Seconds") == true) {
-                    additionalCheckSeconds_s = ptrInputData->GetDoubleValue();
+                    GetState().additionalCheckSeconds = ptrInputData->GetDoubleValue();
+                } else if (ptrInputData->LabelContainsString("Interim Method") == true) {
+                    Journey::SetInterimMethod(Journey::ConvertInterimMethod(ptrInputData->GetStringValue()));
+                } else if (ptrInputData->LabelContainsString("Maximum Interim Position Error") == true) {
+                    GetState().maximumInterimError = ptrInputData->GetDoubleValue();
+                } else if (ptrInputData->LabelContainsString("Link Evaluation Method") == true) {
+                    GetState().linkMethod = ConvertLinkMethod(ptrInputData->GetStringValue());
+                } else if (ptrInputData->LabelContainsString("Root Bracket Seconds") == true) {
+                    GetState().rootBracketSeconds = ptrInputData->GetDoubleValue();
+                } else if (ptrInputData->LabelContainsString("Link Cache Directory") == true) {
+                    GetState().linkCacheDirectory = ptrInputData->GetStringValue();
                 }
             }
         }
@@ -99,20 +135,62 @@ LinksGenerator::ExtractLinksGeneratorInfo(const shared_ptr<InputDataElement> &pt
         throw;
     }
 
-    if (additionalCheckSeconds_s <= 0.0) {
+    if (GetState().additionalCheckSeconds <= 0.0) {
         throw new InputException(GetClassName(),
                                  "ExtractLinksGeneratorInfo(InputDataElement*)",
                                  "Invalid 'Additional Check Seconds' input");
     }
 
+    if (GetState().rootBracketSeconds < 0.0) {
+        throw new InputException(GetClassName(),
+                                 "ExtractLinksGeneratorInfo(InputDataElement*)",
+                                 "Invalid 'Root Bracket Seconds' input");
+    }
+
     return;
 }
 
+LinksGenerator::LINK_METHOD
+LinksGenerator::ConvertLinkMethod(const string &inputString)
+{
+    LINK_METHOD linkMethod = SAMPLED;
+
+    if (inputString == "ROOT_FINDING") {
+        linkMethod = ROOT_FINDING;
+    } else if (inputString != "SAMPLED") {
+        throw new InputException(GetClassName(), "ConvertLinkMethod(const string&)",
+                                 "Invalid 'Link Evaluation Method' input: " + inputString);
+    }
+
+    return(linkMethod);
+}
+
 void
 LinksGenerator::PrintAttributes(ofstream &outfile)
 {
     outfile << "<LINK_GENERATION_START>" << NEW_LINE;
-    outfile << "   Additional Check Seconds  : " << additionalCheckSeconds_s << NEW_LINE;
+    outfile << "   Additional Check Seconds  : " << GetState().additionalCheckSeconds << NEW_LINE;
+
+    if (Journey::GetInterimMethod() == Journey::HERMITE) {
+        outfile << "   Interim Method            : HERMITE" << NEW_LINE;
+    }
+
+    if (GetState().maximumInterimError > 0.0) {
+        outfile << "   Maximum Interim Position Error : " << GetState().maximumInterimError << NEW_LINE;
+    }
+
+    if (GetState().linkMethod == ROOT_FINDING) {
+        outfile << "   Link Evaluation Method    : ROOT_FINDING" << NEW_LINE;
+
+        if (GetState().rootBracketSeconds > 0.0) {
+            outfile << "   Root Bracket Seconds      : " << GetState().rootBracketSeconds << NEW_LINE;
+        }
+    }
+
+    if (GetState().linkCacheDirectory.size() > 0) {
+        outfile << "   Link Cache Directory      : " << GetState().linkCacheDirectory << NEW_LINE;
+    }
+
     outfile << "<LINK_GENERATION_END>" << NEW_LINE;
     return;
 }
@@ -139,6 +217,32 @@ LinksGenerator::GenerateLinks(const shared_ptr<DataProviderCollection> &ptrDataP
             detailedConjFile << "   TIME  RECEIVR  SENDER1  SENDER2  TYPE   ANGLE    CONJ   TIME" << NEW_LINE;
         }
 
+        if ((GetState().linkMethod == ROOT_FINDING) &&
+                (FileNames::HasFileNameDefined(FileNames::LINK_METHOD_DEBUGFILE) == true)) {
+            ParseUtility::OpenOutputFile(linkMethodFile_a, FileNames::GetFileName(FileNames::LINK_METHOD_DEBUGFILE));
+            linkMethodFile_a << "   TIME    SEND   RECV  SAMPLED STATUS              ";
+            linkMethodFile_a << "ROOT FINDING STATUS         CROSSING" << NEW_LINE;
+        }
+
+        if (GetState().linkCacheDirectory.size() > 0) {
+            ptrLinkCache_a = shared_ptr<LinkCache>(new LinkCache(GetState().linkCacheDirectory));
+        }
+
+        if (FileNames::HasFileNameDefined(FileNames::LINK_CHECKPOINTDIRECTORY) == true) {
+            ptrLinkCheckpoint_a = shared_ptr<LinkCache>(new LinkCache(
+                                      FileNames::GetFileName(FileNames::LINK_CHECKPOINTDIRECTORY), "LinkCheckpoint"));
+        }
+
+        // the antenna pairs of a provider pair share its geometry at each sample
+        if (GetState().linkMethod == ROOT_FINDING) {
+            ptrGeometryCache_a = shared_ptr<ProviderGeometryCache>(new ProviderGeometryCache(
+                                     DetermineRootBracketSeconds(), ProviderGeometryCache::DEFAULT_MAXIMUM_BYTES_s));
+        } else {
+            ptrGeometryCache_a = shared_ptr<ProviderGeometryCache>(new ProviderGeometryCache(
+                                     GetState().additionalCheckSeconds, ProviderGeometryCache::DEFAULT_MAXIMUM_BYTES_s));
+        }
+
+        PrepareInterimInterpolation();
         // Need to get downlinks before determining crosslinks
         DetermineRelayLinks(detailedLinksFile);
         DetermineUserLinks(detailedLinksFile);
@@ -155,6 +259,23 @@ LinksGenerator::GenerateLinks(const shared_ptr<DataProviderCollection> &ptrDataP
         if (FileNames::HasFileNameDefined(FileNames::CONJ_DEBUGFILE) == true) {
             detailedConjFile.close();
         }
+
+        if (linkMethodFile_a.is_open() == true) {
+            linkMethodFile_a.close();
+        }
+
+        if (ptrLinkCache_a != NULL) {
+            ptrLinkCache_a->PrintStatistics(cout);
+            ptrLinkCache_a = NULL;
+        }
+
+        if (ptrLinkCheckpoint_a != NULL) {
+            ptrLinkCheckpoint_a->PrintStatistics(cout);
+            ptrLinkCheckpoint_a = NULL;
+        }
+
+        ptrGeometryCache_a->PrintStatistics(cout);
+        ptrGeometryCache_a = NULL;
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(),"GenerateLinks(LinkList<DataProvider>*)");
         throw;
@@ -163,6 +284,51 @@ LinksGenerator::GenerateLinks(const shared_ptr<DataProviderCollection> &ptrDataP
     return;
 }
 
+void
+LinksGenerator::PrepareInterimInterpolation() const
+{
+    shared_ptr<MURALTypes::DataProviderVector> ptrProviderList = ptrDataProviderCollection_a->GetDataProviderListPtr();
+    MURALTypes::DataProviderVector::iterator   providerIter;
+    shared_ptr<Journey>                        ptrJourney = NULL;
+    string                                     limitingDesignator = "";
+    double                                     maximumTimeStep = INVALID_SECONDS;
+
+    if (Journey::GetInterimMethod() != Journey::HERMITE) {
+        return;
+    }
+
+    try {
+        for (providerIter = ptrProviderList->begin(); providerIter != ptrProviderList->end(); ++providerIter) {
+            ptrJourney = (*providerIter)->GetJourney();
+
+            if (ptrJourney->IsStationaryPosition() == false) {
+                // build the interval coefficients once, up front
+                ptrJourney->BuildHermiteCoefficients();
+
+                if (GetState().maximumInterimError > 0.0) {
+                    const double timeStep = ptrJourney->DetermineMaximumTimeStep(GetState().maximumInterimError);
+
+                    if ((limitingDesignator.size() == 0) || (timeStep < maximumTimeStep)) {
+                        maximumTimeStep = timeStep;
+                        limitingDesignator = (*providerIter)->GetDesignator();
+                    }
+                }
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "PrepareInterimInterpolation()");
+        throw;
+    }
+
+    if (limitingDesignator.size() > 0) {
+        cout << "LinksGenerator: Largest time step meeting interim position error "
+             << GetState().maximumInterimError << " is " << maximumTimeStep
+             << " seconds (limited by " << limitingDesignator << ")" << NEW_LINE;
+    }
+
+    return;
+}
+
 void
 LinksGenerator::DetermineUserLinks(ofstream &detailedLinksFile)
 {
@@ -1341,73 +1507,254 @@ LinksGenerator::DetermineLinkStatusArray(const shared_ptr<DataProvider> &ptrFrom
         bool checkToDownlinkSupport,
         const shared_ptr<UserVehicle> &ptrClusterUser)
 {
-    int              timeIndex = 0;
-    const int        numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
-    const int        endIndexTime = TimePiece::GetEndIndexTime();
-    Array<int>     *ptrStatusArray = new Array<int>(numberOfTimeSteps, Link::NO_LINK);
-    double            elevationAngleFrom = 0.0;
-    double            elevationAngleTo = 0.0;
-    double            grazingAltitude = 0.0;
-    double            range = 0.0;
-    double            separationAngle = 0.0;
-    double            sunAngleFrom = 0.0;
-    double            sunAngleTo = 0.0;
-    double            azimuthFrom = UNDEFINED_ANGLE;
-    double            azimuthTo = UNDEFINED_ANGLE;
-    double            minimumAzimuthFrom = UNDEFINED_ANGLE;
-    double            maximumAzimuthFrom = -UNDEFINED_ANGLE;
-    double            minimumAzimuthTo = UNDEFINED_ANGLE;
-    double            maximumAzimuthTo = -UNDEFINED_ANGLE;
-    double            minimumElevationFrom = UNDEFINED_ANGLE;
-    double            maximumElevationFrom = -UNDEFINED_ANGLE;
-    double            minimumElevationTo = UNDEFINED_ANGLE;
-    double            maximumElevationTo = -UNDEFINED_ANGLE;
-    double            solarIntrusionAngle = UNDEFINED_ANGLE;
-    const string      fromDesignator = ptrFromProvider->GetDesignator();
-    const string      toDesignator = ptrToProvider->GetDesignator();
-    double            minElevationFrom = -UNDEFINED_ANGLE;
-    double            maxElevationFrom = UNDEFINED_ANGLE;
-    double            minElevationTo = -UNDEFINED_ANGLE;
-    double            maxElevationTo = UNDEFINED_ANGLE;
-    const double      secondsPerTimeStep = (double)TimePiece::GetSecondsPerTimeStep();
-    const double      quarterCircle = UnitData::GetStoreQuarterCircle();
-    const double      earthRadius = Earth::GetStoreRadius();
-    const double      minGrazing = std::min(ptrFromAntenna->GetMinimumGrazingAltitude(toDesignator),
-                                            ptrToAntenna->GetMinimumGrazingAltitude(fromDesignator));
-    const double      maxRange = ptrFromAntenna->GetMaximumRange(toDesignator);
-    const double      minRange = ptrFromAntenna->GetMinimumRange(toDesignator);
-    const double      maxSunFrom = ptrFromAntenna->GetMaximumSunSeparationAngle(toDesignator);
-    const double      minSunFrom = ptrFromAntenna->GetMinimumSunSeparationAngle(toDesignator);
-    const double      maxSunTo = ptrToAntenna->GetMaximumSunSeparationAngle(fromDesignator);
-    const double      minSunTo = ptrToAntenna->GetMinimumSunSeparationAngle(fromDesignator);
-    const double      minICCLSolarAngle = ptrFromProvider->GetMinimumICCLSolarIntrusionAngle();
-    bool              fromAzimuthBasedAngles = false;
-    bool              toAzimuthBasedAngles = false;
+    int               timeIndex = 0;
+    const int         numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    const bool        printDetails = FileNames::HasFileNameDefined(FileNames::LINKS_DEBUGFILE);
+    const bool        compareMethods = ((GetState().linkMethod == ROOT_FINDING) && (linkMethodFile_a.is_open() == true));
+    Array<int>       *ptrStatusArray = NULL;
+    unsigned long long cacheKey = 0;
+    double            crossingSeconds = 0.0;
     Link::LINK_STATUS linkStatus = Link::NO_LINK;
-    SpaceVector       fromVehiclePosition;
-    SpaceVector       toVehiclePosition;
-    SpaceVector       lineOfSight;
-    SpaceVector       lineOfSightNegated;
-    SpaceVector       interimSunPosition;
-    SpaceVector       sunPosition;
-    SpaceVector       fromVehicleToSun;
-    SpaceVector       toVehicleToSun;
-    SpaceVector       clusterLOS;
-    shared_ptr<UserVehicle>      ptrFromUser = dynamic_pointer_cast<UserVehicle>(ptrFromProvider);
-    shared_ptr<RelaySatellite>   ptrToRelay = NULL;
+    Link::LINK_STATUS sampledStatus = Link::NO_LINK;
+    LinkConstraints   constraints;
+    LinkGeometry      minimumGeometry;
+    LinkGeometry      maximumGeometry;
+    LinkGeometry      unusedGeometry;
+
+    DetermineLinkConstraints(ptrFromProvider, ptrFromAntenna, ptrToProvider, ptrToAntenna,
+                             ptrClusterUser, constraints);
 
     if (checkToDownlinkSupport == true) {
-        ptrToRelay = dynamic_pointer_cast<RelaySatellite>(ptrToProvider);
+        constraints.ptrToRelay = dynamic_pointer_cast<RelaySatellite>(ptrToProvider);
+    }
+
+    if ((ptrLinkCache_a != NULL) || (ptrLinkCheckpoint_a != NULL)) {
+        cacheKey = DetermineLinkCacheKey(constraints);
+
+        // the debug files need every sample, so those runs only refresh the
+        // cache and the checkpoint
+        if ((printDetails == false) && (compareMethods == false)) {
+            if ((ptrLinkCheckpoint_a != NULL) && (GetState().resumeFromCheckpoint == true) &&
+                    (ptrLinkCheckpoint_a->Retrieve(cacheKey, ptrStatusArray) == true)) {
+                return(ptrStatusArray);
+            }
+
+            if ((ptrLinkCache_a != NULL) && (ptrLinkCache_a->Retrieve(cacheKey, ptrStatusArray) == true)) {
+                if (ptrLinkCheckpoint_a != NULL) {
+                    ptrLinkCheckpoint_a->Store(cacheKey, ptrStatusArray);
+                }
+
+                return(ptrStatusArray);
+            }
+        }
+    }
+
+    ptrStatusArray = new Array<int>(numberOfTimeSteps, Link::NO_LINK);
+    minimumGeometry.azimuthFrom = UNDEFINED_ANGLE;
+    minimumGeometry.azimuthTo = UNDEFINED_ANGLE;
+    minimumGeometry.elevationAngleFrom = UNDEFINED_ANGLE;
+    minimumGeometry.elevationAngleTo = UNDEFINED_ANGLE;
+    maximumGeometry.azimuthFrom = -UNDEFINED_ANGLE;
+    maximumGeometry.azimuthTo = -UNDEFINED_ANGLE;
+    maximumGeometry.elevationAngleFrom = -UNDEFINED_ANGLE;
+    maximumGeometry.elevationAngleTo = -UNDEFINED_ANGLE;
+
+    while (timeIndex < numberOfTimeSteps) {
+        if (GetState().linkMethod == ROOT_FINDING) {
+            linkStatus = DetermineRootFindingLinkStatus(constraints, timeIndex, detailedLinksFile,
+                         printDetails, minimumGeometry, maximumGeometry,
+                         crossingSeconds);
+
+            if (compareMethods == true) {
+                sampledStatus = DetermineSampledLinkStatus(constraints, timeIndex, detailedLinksFile,
+                                false, unusedGeometry, unusedGeometry);
+
+                if (sampledStatus != linkStatus) {
+                    PrintLinkMethodDifference(constraints, timeIndex, sampledStatus,
+                                              linkStatus, crossingSeconds);
+                }
+            }
+        } else {
+            linkStatus = DetermineSampledLinkStatus(constraints, timeIndex, detailedLinksFile,
+                                                    printDetails, minimumGeometry, maximumGeometry);
+        }
+
+        (*ptrStatusArray)[timeIndex] = linkStatus;
+        ++timeIndex;
+    }
+
+    if (printDetails == true) {
+        detailedLinksFile << "Minimum Angles :         ";
+        PrintOutputAngle(detailedLinksFile, minimumGeometry.azimuthFrom);
+        PrintOutputAngle(detailedLinksFile, minimumGeometry.azimuthTo);
+        PrintOutputAngle(detailedLinksFile, minimumGeometry.elevationAngleFrom);
+        PrintOutputAngle(detailedLinksFile, minimumGeometry.elevationAngleTo);
+        detailedLinksFile << NEW_LINE;
+        detailedLinksFile << "Maximum Angles :         ";
+        PrintOutputAngle(detailedLinksFile, maximumGeometry.azimuthFrom);
+        PrintOutputAngle(detailedLinksFile, maximumGeometry.azimuthTo);
+        PrintOutputAngle(detailedLinksFile, maximumGeometry.elevationAngleFrom);
+        PrintOutputAngle(detailedLinksFile, maximumGeometry.elevationAngleTo);
+        detailedLinksFile << NEW_LINE;
     }
 
+    if (ptrLinkCache_a != NULL) {
+        ptrLinkCache_a->Store(cacheKey, ptrStatusArray);
+    }
+
+    if (ptrLinkCheckpoint_a != NULL) {
+        ptrLinkCheckpoint_a->Store(cacheKey, ptrStatusArray);
+    }
+
+    return(ptrStatusArray);
+}
+
+unsigned long long
+LinksGenerator::DetermineLinkCacheKey(const LinkConstraints &constraints) const
+{
+    int                timeIndex = 0;
+    const int          numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    unsigned long long hashValue = LinkCache::OFFSET_BASIS_s;
+    ostringstream      antennaAttributes;
+    shared_ptr<MURALTypes::AzimuthAngleDataVector> ptrAzimuthList = NULL;
+    MURALTypes::AzimuthAngleDataVector::const_iterator azimuthIter;
+    // how the link is evaluated
+    LinkCache::HashValue(LinkCache::FORMAT_VERSION_s, hashValue);
+    LinkCache::HashValue((int)GetState().linkMethod, hashValue);
+    LinkCache::HashValue(GetState().additionalCheckSeconds, hashValue);
+    LinkCache::HashValue(GetState().rootBracketSeconds, hashValue);
+    LinkCache::HashValue(GetState().maximumInterimError, hashValue);
+    LinkCache::HashValue((int)Journey::GetInterimMethod(), hashValue);
+    LinkCache::HashValue(numberOfTimeSteps, hashValue);
+    LinkCache::HashValue(TimePiece::GetSecondsPerTimeStep(), hashValue);
+    LinkCache::HashValue(TimePiece::GetStartTime(J2000), hashValue);
+    LinkCache::HashValue((int)UnitData::GetInternalReferenceFrame(), hashValue);
+    LinkCache::HashValue((int)UnitData::GetInternalDistanceUnits(), hashValue);
+    // the endpoints and their constraint data (link constraints, azimuth based
+    // elevation angles, dedicated transmitters, ...)
+    LinkCache::HashString(constraints.fromDesignator, hashValue);
+    LinkCache::HashString(constraints.toDesignator, hashValue);
+    LinkCache::HashString(constraints.ptrFromAntenna->GetAntennaDesignator(), hashValue);
+    LinkCache::HashString(constraints.ptrToAntenna->GetAntennaDesignator(), hashValue);
+    LinkCache::HashValue(constraints.minGrazing, hashValue);
+    LinkCache::HashValue(constraints.maxRange, hashValue);
+    LinkCache::HashValue(constraints.minRange, hashValue);
+    LinkCache::HashValue(constraints.maxSunFrom, hashValue);
+    LinkCache::HashValue(constraints.minSunFrom, hashValue);
+    LinkCache::HashValue(constraints.maxSunTo, hashValue);
+    LinkCache::HashValue(constraints.minSunTo, hashValue);
+    LinkCache::HashValue(constraints.minICCLSolarAngle, hashValue);
+    LinkCache::HashValue(constraints.minElevationFrom, hashValue);
+    LinkCache::HashValue(constraints.maxElevationFrom, hashValue);
+    LinkCache::HashValue(constraints.minElevationTo, hashValue);
+    LinkCache::HashValue(constraints.maxElevationTo, hashValue);
+    LinkCache::HashValue(constraints.fromAzimuthBasedAngles, hashValue);
+    LinkCache::HashValue(constraints.toAzimuthBasedAngles, hashValue);
+    LinkCache::HashValue(constraints.ptrClusterUser != NULL, hashValue);
+    LinkCache::HashValue(constraints.ptrToRelay != NULL, hashValue);
+    antennaAttributes << setprecision(17);
+    constraints.ptrFromAntenna->PrintAttributes(antennaAttributes);
+    constraints.ptrToAntenna->PrintAttributes(antennaAttributes);
+    LinkCache::HashString(antennaAttributes.str(), hashValue);
+
+    for (int antennaIndex = 0; antennaIndex < 2; ++antennaIndex) {
+        ptrAzimuthList = (antennaIndex == 0) ? constraints.ptrFromAntenna->GetAzimuthAngleDataList()
+                         : constraints.ptrToAntenna->GetAzimuthAngleDataList();
+
+        if (ptrAzimuthList != NULL) {
+            for (azimuthIter = ptrAzimuthList->begin(); azimuthIter != ptrAzimuthList->end(); ++azimuthIter) {
+                LinkCache::HashValue((*azimuthIter)->GetMinimumAzimuthAngle(), hashValue);
+                LinkCache::HashValue((*azimuthIter)->GetMaximumAzimuthAngle(), hashValue);
+                LinkCache::HashValue((*azimuthIter)->GetMinimumElevationAngle(), hashValue);
+                LinkCache::HashValue((*azimuthIter)->GetMaximumElevationAngle(), hashValue);
+            }
+        }
+    }
+
+    // the ephemeris, the antenna attitude and the per time step checks
+    while (timeIndex < numberOfTimeSteps) {
+        HashLinkCacheVector(constraints.ptrFromProvider->GetPosition(timeIndex), hashValue);
+        HashLinkCacheVector(constraints.ptrFromProvider->GetVelocity(timeIndex), hashValue);
+        HashLinkCacheVector(constraints.ptrToProvider->GetPosition(timeIndex), hashValue);
+        HashLinkCacheVector(constraints.ptrToProvider->GetVelocity(timeIndex), hashValue);
+        HashLinkCacheVector(Sun::GetPosition(timeIndex), hashValue);
+
+        if (constraints.ptrClusterUser != NULL) {
+            HashLinkCacheVector(constraints.ptrClusterUser->GetPosition(timeIndex), hashValue);
+        }
+
+        HashLinkCacheFrame(constraints.ptrFromAntenna->GetAntennaCoordinateFrame(timeIndex, 0.0), hashValue);
+        HashLinkCacheFrame(constraints.ptrToAntenna->GetAntennaCoordinateFrame(timeIndex, 0.0), hashValue);
+        LinkCache::HashValue(DetermineTimeStepStatus(constraints, timeIndex), hashValue);
+        ++timeIndex;
+    }
+
+    return(hashValue);
+}
+
+void
+LinksGenerator::HashLinkCacheVector(const SpaceVector &spaceVector,
+                                    unsigned long long &hashValue) const
+{
+    LinkCache::HashValue(spaceVector.GetX(), hashValue);
+    LinkCache::HashValue(spaceVector.GetY(), hashValue);
+    LinkCache::HashValue(spaceVector.GetZ(), hashValue);
+    return;
+}
+
+void
+LinksGenerator::HashLinkCacheFrame(const shared_ptr<CoordinateFrame> &ptrFrame,
+                                   unsigned long long &hashValue) const
+{
+    if (ptrFrame != NULL) {
+        HashLinkCacheVector(ptrFrame->GetXAxis(), hashValue);
+        HashLinkCacheVector(ptrFrame->GetYAxis(), hashValue);
+        HashLinkCacheVector(ptrFrame->GetZAxis(), hashValue);
+    }
+
+    return;
+}
+
+void
+LinksGenerator::DetermineLinkConstraints(const shared_ptr<DataProvider> &ptrFromProvider,
+        const shared_ptr<Antenna> &ptrFromAntenna,
+        const shared_ptr<DataProvider> &ptrToProvider,
+        const shared_ptr<Antenna> &ptrToAntenna,
+        const shared_ptr<UserVehicle> &ptrClusterUser,
+        LinkConstraints &constraints) const
+{
+    constraints.ptrFromProvider = ptrFromProvider;
+    constraints.ptrFromAntenna = ptrFromAntenna;
+    constraints.ptrToProvider = ptrToProvider;
+    constraints.ptrToAntenna = ptrToAntenna;
+    constraints.ptrClusterUser = ptrClusterUser;
+    constraints.ptrToRelay = NULL;
+    constraints.fromDesignator = ptrFromProvider->GetDesignator();
+    constraints.toDesignator = ptrToProvider->GetDesignator();
+    constraints.minGrazing = std::min(ptrFromAntenna->GetMinimumGrazingAltitude(constraints.toDesignator),
+                                      ptrToAntenna->GetMinimumGrazingAltitude(constraints.fromDesignator));
+    constraints.maxRange = ptrFromAntenna->GetMaximumRange(constraints.toDesignator);
+    constraints.minRange = ptrFromAntenna->GetMinimumRange(constraints.toDesignator);
+    constraints.maxSunFrom = ptrFromAntenna->GetMaximumSunSeparationAngle(constraints.toDesignator);
+    constraints.minSunFrom = ptrFromAntenna->GetMinimumSunSeparationAngle(constraints.toDesignator);
+    constraints.maxSunTo = ptrToAntenna->GetMaximumSunSeparationAngle(constraints.fromDesignator);
+    constraints.minSunTo = ptrToAntenna->GetMinimumSunSeparationAngle(constraints.fromDesignator);
+    constraints.minICCLSolarAngle = ptrFromProvider->GetMinimumICCLSolarIntrusionAngle();
+    constraints.minElevationFrom = -UNDEFINED_ANGLE;
+    constraints.maxElevationFrom = UNDEFINED_ANGLE;
+    constraints.minElevationTo = -UNDEFINED_ANGLE;
+    constraints.maxElevationTo = UNDEFINED_ANGLE;
+    constraints.fromAzimuthBasedAngles = false;
+    constraints.toAzimuthBasedAngles = false;
+
     // if the body does not tilt for collection, then use the appropriate min and
     // max elevation angles to check for link status
     if (ptrFromProvider->BodyTiltsForCollection() == false) {
         if (ptrFromAntenna->HasAzimuthBasedElevationAngles() == false) {
-            minElevationFrom = ptrFromAntenna->GetMinimumElevationAngle(toDesignator);
-            maxElevationFrom = ptrFromAntenna->GetMaximumElevationAngle(toDesignator);
+            constraints.minElevationFrom = ptrFromAntenna->GetMinimumElevationAngle(constraints.toDesignator);
+            constraints.maxElevationFrom = ptrFromAntenna->GetMaximumElevationAngle(constraints.toDesignator);
         } else {
-            fromAzimuthBasedAngles = true;
+            constraints.fromAzimuthBasedAngles = true;
         }
     }
 
@@ -1415,175 +1762,534 @@ LinksGenerator::DetermineLinkStatusArray(const shared_ptr<DataProvider> &ptrFrom
     // max elevation angles to check for link status
     if (ptrToProvider->BodyTiltsForCollection() == false) {
         if (ptrToAntenna->HasAzimuthBasedElevationAngles() == false) {
-            minElevationTo = ptrToAntenna->GetMinimumElevationAngle(fromDesignator);
-            maxElevationTo = ptrToAntenna->GetMaximumElevationAngle(fromDesignator);
+            constraints.minElevationTo = ptrToAntenna->GetMinimumElevationAngle(constraints.fromDesignator);
+            constraints.maxElevationTo = ptrToAntenna->GetMaximumElevationAngle(constraints.fromDesignator);
         } else {
-            toAzimuthBasedAngles = true;
+            constraints.toAzimuthBasedAngles = true;
         }
     }
 
-    while (timeIndex < numberOfTimeSteps) {
-        double additionalSeconds;
-        additionalSeconds = 0.0;
-        linkStatus = Link::LINK;
-        sunPosition = Sun::GetPosition(timeIndex);
-
-        while ((additionalSeconds < secondsPerTimeStep) && (linkStatus == Link::LINK)) {
-            fromVehiclePosition = ptrFromProvider->GetInterimPosition(timeIndex, additionalSeconds);
-            toVehiclePosition = ptrToProvider->GetInterimPosition(timeIndex, additionalSeconds);
-            lineOfSight = toVehiclePosition - fromVehiclePosition;
-            lineOfSightNegated = lineOfSight.Negate();
-            ptrFromAntenna->DetermineAzElAngles(timeIndex, lineOfSight, additionalSeconds,
-                                                azimuthFrom, elevationAngleFrom);
-
-            if (fromAzimuthBasedAngles == true) {
-                ptrFromAntenna->GetAzimuthBasedElevationAngles(azimuthFrom, toDesignator,
-                        minElevationFrom, maxElevationFrom);
-            }
+    return;
+}
 
-            ptrToAntenna->DetermineAzElAngles(timeIndex, lineOfSightNegated, additionalSeconds,
-                                              azimuthTo, elevationAngleTo);
+void
+LinksGenerator::DetermineLinkGeometry(const LinkConstraints &constraints,
+                                      int timeIndex,
+                                      double additionalSeconds,
+                                      LinkGeometry &geometry) const
+{
+    ProviderGeometryCache::Geometry providerGeometry;
+    DetermineProviderGeometry(constraints, timeIndex, additionalSeconds, providerGeometry);
+    const SpaceVector lineOfSight(providerGeometry.lineOfSightX, providerGeometry.lineOfSightY,
+                                  providerGeometry.lineOfSightZ);
+    geometry.minElevationFrom = constraints.minElevationFrom;
+    geometry.maxElevationFrom = constraints.maxElevationFrom;
+    geometry.minElevationTo = constraints.minElevationTo;
+    geometry.maxElevationTo = constraints.maxElevationTo;
+    geometry.grazingAltitude = providerGeometry.grazingAltitude;
+    geometry.range = providerGeometry.range;
+    geometry.sunAngleFrom = providerGeometry.sunAngleFrom;
+    geometry.sunAngleTo = providerGeometry.sunAngleTo;
+    geometry.solarIntrusionAngle = providerGeometry.solarIntrusionAngle;
+    constraints.ptrFromAntenna->DetermineAzElAngles(timeIndex, lineOfSight, additionalSeconds,
+            geometry.azimuthFrom, geometry.elevationAngleFrom);
+
+    if (constraints.fromAzimuthBasedAngles == true) {
+        constraints.ptrFromAntenna->GetAzimuthBasedElevationAngles(geometry.azimuthFrom, constraints.toDesignator,
+                geometry.minElevationFrom, geometry.maxElevationFrom);
+    }
 
-            if (toAzimuthBasedAngles == true) {
-                ptrToAntenna->GetAzimuthBasedElevationAngles(azimuthTo, fromDesignator,
-                        minElevationTo, maxElevationTo);
-            }
+    constraints.ptrToAntenna->DetermineAzElAngles(timeIndex, lineOfSight.Negate(), additionalSeconds,
+            geometry.azimuthTo, geometry.elevationAngleTo);
 
-            if (fromVehiclePosition.GetMagnitude() <= toVehiclePosition.GetMagnitude()) {
-                separationAngle = lineOfSight.GetSeparationAngle(fromVehiclePosition.Negate());
+    if (constraints.toAzimuthBasedAngles == true) {
+        constraints.ptrToAntenna->GetAzimuthBasedElevationAngles(geometry.azimuthTo, constraints.fromDesignator,
+                geometry.minElevationTo, geometry.maxElevationTo);
+    }
 
-                if (separationAngle < quarterCircle) {
-                    grazingAltitude = SimpleMath::Abs(fromVehiclePosition.GetMagnitude() * sin(separationAngle));
-                } else {
-                    grazingAltitude = fromVehiclePosition.GetMagnitude();
-                }
-            } else {
-                separationAngle = lineOfSightNegated.GetSeparationAngle(toVehiclePosition.Negate());
+    return;
+}
 
-                if (separationAngle < quarterCircle) {
-                    grazingAltitude = SimpleMath::Abs(toVehiclePosition.GetMagnitude() * sin(separationAngle));
-                } else {
-                    grazingAltitude = toVehiclePosition.GetMagnitude();
-                }
-            }
+void
+LinksGenerator::DetermineProviderGeometry(const LinkConstraints &constraints,
+        int timeIndex,
+        double additionalSeconds,
+        ProviderGeometryCache::Geometry &providerGeometry) const
+{
+    ProviderGeometryCache::Geometry *ptrCachedGeometry = NULL;
+
+    if (ptrGeometryCache_a != NULL) {
+        ptrCachedGeometry = ptrGeometryCache_a->Find(constraints.ptrFromProvider.get(),
+                            constraints.ptrToProvider.get(), constraints.ptrClusterUser.get(),
+                            timeIndex, additionalSeconds);
+    }
 
-            grazingAltitude -= earthRadius;
-            range = lineOfSight.GetMagnitude();
+    if ((ptrCachedGeometry != NULL) && (ptrCachedGeometry->range >= 0.0)) {
+        providerGeometry = *ptrCachedGeometry;
+    } else {
+        const double quarterCircle = UnitData::GetStoreQuarterCircle();
+        const double earthRadius = Earth::GetStoreRadius();
+        double       separationAngle = 0.0;
+        SpaceVector  fromVehiclePosition = constraints.ptrFromProvider->GetInterimPosition(timeIndex, additionalSeconds);
+        SpaceVector  toVehiclePosition = constraints.ptrToProvider->GetInterimPosition(timeIndex, additionalSeconds);
+        SpaceVector  lineOfSight = toVehiclePosition - fromVehiclePosition;
+        SpaceVector  lineOfSightNegated = lineOfSight.Negate();
+        SpaceVector  sunPosition = Sun::GetPosition(timeIndex);
+        SpaceVector  fromVehicleToSun;
+        SpaceVector  toVehicleToSun;
+        SpaceVector  clusterLOS;
+        providerGeometry.lineOfSightX = lineOfSight.GetX();
+        providerGeometry.lineOfSightY = lineOfSight.GetY();
+        providerGeometry.lineOfSightZ = lineOfSight.GetZ();
+        providerGeometry.solarIntrusionAngle = UNDEFINED_ANGLE;
+
+        if (fromVehiclePosition.GetMagnitude() <= toVehiclePosition.GetMagnitude()) {
+            separationAngle = lineOfSight.GetSeparationAngle(fromVehiclePosition.Negate());
+
+            if (separationAngle < quarterCircle) {
+                providerGeometry.grazingAltitude = SimpleMath::Abs(fromVehiclePosition.GetMagnitude() * sin(separationAngle));
+            } else {
+                providerGeometry.grazingAltitude = fromVehiclePosition.GetMagnitude();
+            }
+        } else {
+            separationAngle = lineOfSightNegated.GetSeparationAngle(toVehiclePosition.Negate());
 
-            if (additionalSeconds == 0.0) {
-                interimSunPosition = sunPosition;
+            if (separationAngle < quarterCircle) {
+                providerGeometry.grazingAltitude = SimpleMath::Abs(toVehiclePosition.GetMagnitude() * sin(separationAngle));
             } else {
-                interimSunPosition = PositionUtility::DetermineInterimPosition(sunPosition, Sun::GetPosition(timeIndex + 1),
-                                     secondsPerTimeStep, additionalSeconds);
+                providerGeometry.grazingAltitude = toVehiclePosition.GetMagnitude();
             }
+        }
 
-            fromVehicleToSun = interimSunPosition - fromVehiclePosition;
-            toVehicleToSun = interimSunPosition - toVehiclePosition;
-            sunAngleFrom = fromVehicleToSun.GetSeparationAngle(lineOfSight);
-            sunAngleTo = toVehicleToSun.GetSeparationAngle(lineOfSightNegated);
+        providerGeometry.grazingAltitude -= earthRadius;
+        providerGeometry.range = lineOfSight.GetMagnitude();
 
-            if ((ptrClusterUser != NULL) && (minICCLSolarAngle != UNDEFINED_ANGLE)) {
-                clusterLOS = ptrClusterUser->GetInterimPosition(timeIndex, additionalSeconds) - fromVehiclePosition;
-                solarIntrusionAngle = clusterLOS.GetSeparationAngle(fromVehicleToSun);
+        if (additionalSeconds != 0.0) {
+            sunPosition = PositionUtility::DetermineInterimPosition(sunPosition, Sun::GetPosition(timeIndex + 1),
+                          (double)TimePiece::GetSecondsPerTimeStep(), additionalSeconds);
+        }
+
+        fromVehicleToSun = sunPosition - fromVehiclePosition;
+        toVehicleToSun = sunPosition - toVehiclePosition;
+        providerGeometry.sunAngleFrom = fromVehicleToSun.GetSeparationAngle(lineOfSight);
+        providerGeometry.sunAngleTo = toVehicleToSun.GetSeparationAngle(lineOfSightNegated);
+
+        if ((constraints.ptrClusterUser != NULL) && (constraints.minICCLSolarAngle != UNDEFINED_ANGLE)) {
+            clusterLOS = constraints.ptrClusterUser->GetInterimPosition(timeIndex, additionalSeconds) - fromVehiclePosition;
+            providerGeometry.solarIntrusionAngle = clusterLOS.GetSeparationAngle(fromVehicleToSun);
+        }
+
+        if (ptrGeometryCache_a != NULL) {
+            ptrGeometryCache_a->CountEvaluation(ptrCachedGeometry);
+
+            if (ptrCachedGeometry != NULL) {
+                *ptrCachedGeometry = providerGeometry;
             }
+        }
+    }
+
+    return;
+}
+
+Link::LINK_STATUS
+LinksGenerator::DetermineGeometryStatus(const LinkConstraints &constraints,
+                                        const LinkGeometry &geometry) const
+{
+    Link::LINK_STATUS linkStatus = Link::LINK;
+
+    if ((constraints.minGrazing != UNDEFINED_DISTANCE) && (geometry.grazingAltitude < constraints.minGrazing)) {
+        linkStatus = Link::MIN_GRAZING_ALTITUDE;
+    } else if ((constraints.maxRange != UNDEFINED_DISTANCE) && (geometry.range > constraints.maxRange)) {
+        linkStatus = Link::MAX_RANGE_TRANSMIT;
+    } else if ((constraints.minRange != UNDEFINED_DISTANCE) && (geometry.range < constraints.minRange)) {
+        linkStatus = Link::MIN_RANGE_TRANSMIT;
+    } else if ((constraints.maxSunFrom != UNDEFINED_ANGLE) && (geometry.sunAngleFrom > constraints.maxSunFrom)) {
+        linkStatus = Link::MAX_SUN_SEPARATION_TRANSMIT;
+    } else if ((constraints.minSunFrom != UNDEFINED_ANGLE) && (geometry.sunAngleFrom < constraints.minSunFrom)) {
+        linkStatus = Link::MIN_SUN_SEPARATION_TRANSMIT;
+    } else if ((constraints.maxSunTo != UNDEFINED_ANGLE) && (geometry.sunAngleTo > constraints.maxSunTo)) {
+        linkStatus = Link::MAX_SUN_SEPARATION_RECEIVE;
+    } else if ((constraints.minSunTo != UNDEFINED_ANGLE) && (geometry.sunAngleTo < constraints.minSunTo)) {
+        linkStatus = Link::MIN_SUN_SEPARATION_RECEIVE;
+    } else if ((geometry.maxElevationTo != UNDEFINED_ANGLE) && (geometry.elevationAngleTo > geometry.maxElevationTo)) {
+        linkStatus = Link::MAX_ELEVATION_RECEIVE;
+    } else if ((geometry.minElevationTo != UNDEFINED_ANGLE) && (geometry.elevationAngleTo < geometry.minElevationTo)) {
+        linkStatus = Link::MIN_ELEVATION_RECEIVE;
+    } else if ((geometry.maxElevationFrom != UNDEFINED_ANGLE) && (geometry.elevationAngleFrom > geometry.maxElevationFrom)) {
+        linkStatus = Link::MAX_ELEVATION_TRANSMIT;
+    } else if ((geometry.minElevationFrom != UNDEFINED_ANGLE) && (geometry.elevationAngleFrom < geometry.minElevationFrom)) {
+        linkStatus = Link::MIN_ELEVATION_TRANSMIT;
+    } else if ((constraints.minICCLSolarAngle != UNDEFINED_ANGLE) && (geometry.solarIntrusionAngle < constraints.minICCLSolarAngle)) {
+        linkStatus = Link::MIN_SOLAR_INTRUSION;
+    }
+
+    return(linkStatus);
+}
+
+Link::LINK_STATUS
+LinksGenerator::DetermineTimeStepStatus(const LinkConstraints &constraints,
+                                        int timeIndex) const
+{
+    Link::LINK_STATUS linkStatus = Link::LINK;
+
+    if ( (constraints.ptrToAntenna->IsAnOutageTimeStep(timeIndex, constraints.fromDesignator) == true) ||
+            (constraints.ptrFromAntenna->IsAnOutageTimeStep(timeIndex, constraints.toDesignator) == true) ) {
+        linkStatus = Link::OUTAGE_TIME_STEP;
+    } else if (constraints.ptrToAntenna->IsNonFullyDedicatedTransmitter(timeIndex, constraints.fromDesignator) == true) {
+        linkStatus = Link::FULLY_DEDICATED_TIME_STEP;
+    } else if (MissingRequiredDownlink(constraints.ptrToRelay, timeIndex) == true) {
+        linkStatus = Link::NO_SUPPORTING_DOWNLINK;
+    }
+
+    return(linkStatus);
+}
+
+double
+LinksGenerator::DetermineConstraintMargin(Link::LINK_STATUS constraint,
+        const LinkConstraints &constraints,
+        const LinkGeometry &geometry) const
+{
+    double margin = 0.0;
+
+    // each margin is negative exactly when DetermineGeometryStatus reports the constraint
+    if ((constraint == Link::MIN_GRAZING_ALTITUDE) && (constraints.minGrazing != UNDEFINED_DISTANCE)) {
+        margin = geometry.grazingAltitude - constraints.minGrazing;
+    } else if ((constraint == Link::MAX_RANGE_TRANSMIT) && (constraints.maxRange != UNDEFINED_DISTANCE)) {
+        margin = constraints.maxRange - geometry.range;
+    } else if ((constraint == Link::MIN_RANGE_TRANSMIT) && (constraints.minRange != UNDEFINED_DISTANCE)) {
+        margin = geometry.range - constraints.minRange;
+    } else if ((constraint == Link::MAX_SUN_SEPARATION_TRANSMIT) && (constraints.maxSunFrom != UNDEFINED_ANGLE)) {
+        margin = constraints.maxSunFrom - geometry.sunAngleFrom;
+    } else if ((constraint == Link::MIN_SUN_SEPARATION_TRANSMIT) && (constraints.minSunFrom != UNDEFINED_ANGLE)) {
+        margin = geometry.sunAngleFrom - constraints.minSunFrom;
+    } else if ((constraint == Link::MAX_SUN_SEPARATION_RECEIVE) && (constraints.maxSunTo != UNDEFINED_ANGLE)) {
+        margin = constraints.maxSunTo - geometry.sunAngleTo;
+    } else if ((constraint == Link::MIN_SUN_SEPARATION_RECEIVE) && (constraints.minSunTo != UNDEFINED_ANGLE)) {
+        margin = geometry.sunAngleTo - constraints.minSunTo;
+    } else if ((constraint == Link::MAX_ELEVATION_RECEIVE) && (geometry.maxElevationTo != UNDEFINED_ANGLE)) {
+        margin = geometry.maxElevationTo - geometry.elevationAngleTo;
+    } else if ((constraint == Link::MIN_ELEVATION_RECEIVE) && (geometry.minElevationTo != UNDEFINED_ANGLE)) {
+        margin = geometry.elevationAngleTo - geometry.minElevationTo;
+    } else if ((constraint == Link::MAX_ELEVATION_TRANSMIT) && (geometry.maxElevationFrom != UNDEFINED_ANGLE)) {
+        margin = geometry.maxElevationFrom - geometry.elevationAngleFrom;
+    } else if ((constraint == Link::MIN_ELEVATION_TRANSMIT) && (geometry.minElevationFrom != UNDEFINED_ANGLE)) {
+        margin = geometry.elevationAngleFrom - geometry.minElevationFrom;
+    } else if ((constraint == Link::MIN_SOLAR_INTRUSION) && (constraints.minICCLSolarAngle != UNDEFINED_ANGLE)) {
+        margin = geometry.solarIntrusionAngle - constraints.minICCLSolarAngle;
+    }
+
+    return(margin);
+}
+
+Link::LINK_STATUS
+LinksGenerator::DetermineSampledLinkStatus(const LinkConstraints &constraints,
+        int timeIndex,
+        ofstream &detailedLinksFile,
+        bool printDetails,
+        LinkGeometry &minimumGeometry,
+        LinkGeometry &maximumGeometry) const
+{
+    const int         endIndexTime = TimePiece::GetEndIndexTime();
+    const double      secondsPerTimeStep = (double)TimePiece::GetSecondsPerTimeStep();
+    double            additionalSeconds = 0.0;
+    Link::LINK_STATUS linkStatus = Link::LINK;
+    LinkGeometry      geometry;
+
+    while ((additionalSeconds < secondsPerTimeStep) && (linkStatus == Link::LINK)) {
+        DetermineLinkGeometry(constraints, timeIndex, additionalSeconds, geometry);
+        linkStatus = DetermineGeometryStatus(constraints, geometry);
+
+        if ((linkStatus == Link::LINK) && (additionalSeconds == 0.0)) {
+            linkStatus = DetermineTimeStepStatus(constraints, timeIndex);
+        }
+
+        if (printDetails == true) {
+            PrintLinkGeometry(detailedLinksFile, constraints, timeIndex, additionalSeconds,
+                              geometry, linkStatus, minimumGeometry, maximumGeometry);
+        }
+
+        if (timeIndex < endIndexTime) {
+            additionalSeconds += GetState().additionalCheckSeconds;
+        } else {
+            additionalSeconds += secondsPerTimeStep;
+        }
+    }
+
+    return(linkStatus);
+}
+
+Link::LINK_STATUS
+LinksGenerator::DetermineRootFindingLinkStatus(const LinkConstraints &constraints,
+        int timeIndex,
+        ofstream &detailedLinksFile,
+        bool printDetails,
+        LinkGeometry &minimumGeometry,
+        LinkGeometry &maximumGeometry,
+        double &crossingSeconds) const
+{
+    const double      secondsPerTimeStep = (double)TimePiece::GetSecondsPerTimeStep();
+    const double      bracketSeconds = DetermineRootBracketSeconds();
+    double            lowerSeconds = 0.0;
+    double            upperSeconds = 0.0;
+    Link::LINK_STATUS linkStatus = Link::LINK;
+    Link::LINK_STATUS upperStatus = Link::LINK;
+    LinkGeometry      lowerGeometry;
+    LinkGeometry      upperGeometry;
+    crossingSeconds = INVALID_SECONDS;
+    // the start of the time step decides the step wide checks, as in the sampled method
+    DetermineLinkGeometry(constraints, timeIndex, lowerSeconds, lowerGeometry);
+    linkStatus = DetermineGeometryStatus(constraints, lowerGeometry);
+
+    if (linkStatus == Link::LINK) {
+        linkStatus = DetermineTimeStepStatus(constraints, timeIndex);
+    }
+
+    if (printDetails == true) {
+        PrintLinkGeometry(detailedLinksFile, constraints, timeIndex, lowerSeconds,
+                          lowerGeometry, linkStatus, minimumGeometry, maximumGeometry);
+    }
 
-            if ((minGrazing != UNDEFINED_DISTANCE) && (grazingAltitude < minGrazing)) {
-                linkStatus = Link::MIN_GRAZING_ALTITUDE;
-            } else if ((maxRange != UNDEFINED_DISTANCE) && (range > maxRange)) {
-                linkStatus = Link::MAX_RANGE_TRANSMIT;
-            } else if ((minRange != UNDEFINED_DISTANCE) && (range < minRange)) {
-                linkStatus = Link::MIN_RANGE_TRANSMIT;
-            } else if ((maxSunFrom != UNDEFINED_ANGLE) && (sunAngleFrom > maxSunFrom)) {
-                linkStatus = Link::MAX_SUN_SEPARATION_TRANSMIT;
-            } else if ((minSunFrom != UNDEFINED_ANGLE) && (sunAngleFrom < minSunFrom)) {
-                linkStatus = Link::MIN_SUN_SEPARATION_TRANSMIT;
-            } else if ((maxSunTo != UNDEFINED_ANGLE) && (sunAngleTo > maxSunTo)) {
-                linkStatus = Link::MAX_SUN_SEPARATION_RECEIVE;
-            } else if ((minSunTo != UNDEFINED_ANGLE) && (sunAngleTo < minSunTo)) {
-                linkStatus = Link::MIN_SUN_SEPARATION_RECEIVE;
-            } else if ((maxElevationTo != UNDEFINED_ANGLE) && (elevationAngleTo > maxElevationTo)) {
-                linkStatus = Link::MAX_ELEVATION_RECEIVE;
-            } else if ((minElevationTo != UNDEFINED_ANGLE) && (elevationAngleTo < minElevationTo)) {
-                linkStatus = Link::MIN_ELEVATION_RECEIVE;
-            } else if ((maxElevationFrom != UNDEFINED_ANGLE) && (elevationAngleFrom > maxElevationFrom)) {
-                linkStatus = Link::MAX_ELEVATION_TRANSMIT;
-            } else if ((minElevationFrom != UNDEFINED_ANGLE) && (elevationAngleFrom < minElevationFrom)) {
-                linkStatus = Link::MIN_ELEVATION_TRANSMIT;
-            } else if ((minICCLSolarAngle != UNDEFINED_ANGLE) && (solarIntrusionAngle < minICCLSolarAngle)) {
-                linkStatus = Link::MIN_SOLAR_INTRUSION;
-            } else if (additionalSeconds == 0.0) {
-                if ( (ptrToAntenna->IsAnOutageTimeStep(timeIndex, fromDesignator) == true) ||
-                        (ptrFromAntenna->IsAnOutageTimeStep(timeIndex, toDesignator) == true) ) {
-                    linkStatus = Link::OUTAGE_TIME_STEP;
-                } else if (ptrToAntenna->IsNonFullyDedicatedTransmitter(timeIndex, fromDesignator) == true) {
-                    linkStatus = Link::FULLY_DEDICATED_TIME_STEP;
-                } else if (MissingRequiredDownlink(ptrToRelay, timeIndex) == true) {
-                    linkStatus = Link::NO_SUPPORTING_DOWNLINK;
+    if (linkStatus != Link::LINK) {
+        crossingSeconds = lowerSeconds;
+    }
+
+    // the last time step only has its start time (there is no following state to interpolate to)
+    while ((linkStatus == Link::LINK) && (timeIndex < TimePiece::GetEndIndexTime()) &&
+            (lowerSeconds < secondsPerTimeStep)) {
+        upperSeconds = std::min((lowerSeconds + bracketSeconds), secondsPerTimeStep);
+        DetermineLinkGeometry(constraints, timeIndex, upperSeconds, upperGeometry);
+        upperStatus = DetermineGeometryStatus(constraints, upperGeometry);
+
+        if (upperStatus != Link::LINK) {
+            int    constraintIndex = 0;
+            double constraintCrossing = 0.0;
+            crossingSeconds = upperSeconds;
+
+            // every constraint violated at the end of the bracket crossed somewhere in it,
+            // the link status comes from the earliest crossing
+            while (constraintIndex < NUMBER_OF_ROOT_CONSTRAINTS_s) {
+                const Link::LINK_STATUS constraint = ROOT_CONSTRAINTS_s[constraintIndex];
+                const double upperMargin = DetermineConstraintMargin(constraint, constraints, upperGeometry);
+
+                if (upperMargin < 0.0) {
+                    constraintCrossing = FindConstraintCrossing(constraints, constraint, timeIndex,
+                                         lowerSeconds, DetermineConstraintMargin(constraint, constraints, lowerGeometry),
+                                         upperSeconds, upperMargin);
+                    crossingSeconds = std::min(crossingSeconds, constraintCrossing);
                 }
+
+                ++constraintIndex;
             }
 
-            if (FileNames::HasFileNameDefined(FileNames::LINKS_DEBUGFILE) == true) {
-                if (additionalSeconds == 0.0) {
-                    TimePiece::PrintIndex(detailedLinksFile, timeIndex);
-                    detailedLinksFile << " " << setw(8) << fromDesignator;
-                    detailedLinksFile << " " << setw(8) << toDesignator;
-                } else {
-                    detailedLinksFile << "                         ";
+            if (crossingSeconds < secondsPerTimeStep) {
+                DetermineLinkGeometry(constraints, timeIndex, crossingSeconds, upperGeometry);
+                linkStatus = DetermineGeometryStatus(constraints, upperGeometry);
+
+                if (linkStatus == Link::LINK) {
+                    // only a rounding difference from the bracket end, report what failed there
+                    linkStatus = upperStatus;
                 }
 
-                PrintOutputAngle(detailedLinksFile, azimuthFrom);
-                PrintOutputAngle(detailedLinksFile, azimuthTo);
-                PrintOutputAngle(detailedLinksFile, elevationAngleFrom);
-                PrintOutputAngle(detailedLinksFile, elevationAngleTo);
-                detailedLinksFile << " " << setw(9) << setprecision(2)
-                                  << UnitData::GetOutputDistance(grazingAltitude);
-                detailedLinksFile << " " << setw(10) << setprecision(2)
-                                  << UnitData::GetOutputDistance(range);
-                PrintOutputAngle(detailedLinksFile, sunAngleFrom);
-                PrintOutputAngle(detailedLinksFile, sunAngleTo);
-                detailedLinksFile << "  " << TimePiece::GetClockTime(timeIndex, additionalSeconds);
-                detailedLinksFile << "  " << Link::GetLinkStatusString(linkStatus) << NEW_LINE;
-
-                if ( (linkStatus != Link::MIN_GRAZING_ALTITUDE) &&
-                        (linkStatus != Link::NO_SUPPORTING_DOWNLINK) ) {
-                    minimumAzimuthFrom = std::min(minimumAzimuthFrom, azimuthFrom);
-                    maximumAzimuthFrom = std::max(maximumAzimuthFrom, azimuthFrom);
-                    minimumElevationFrom = std::min(minimumElevationFrom, elevationAngleFrom);
-                    maximumElevationFrom = std::max(maximumElevationFrom, elevationAngleFrom);
-                    minimumAzimuthTo = std::min(minimumAzimuthTo, azimuthTo);
-                    maximumAzimuthTo = std::max(maximumAzimuthTo, azimuthTo);
-                    minimumElevationTo = std::min(minimumElevationTo, elevationAngleTo);
-                    maximumElevationTo = std::max(maximumElevationTo, elevationAngleTo);
+                if (printDetails == true) {
+                    PrintLinkGeometry(detailedLinksFile, constraints, timeIndex, crossingSeconds,
+                                      upperGeometry, linkStatus, minimumGeometry, maximumGeometry);
                 }
+            } else {
+                // the link is only lost at the start of the next time step
+                crossingSeconds = INVALID_SECONDS;
+            }
+        }
+
+        lowerSeconds = upperSeconds;
+        lowerGeometry = upperGeometry;
+    }
+
+    return(linkStatus);
+}
+
+double
+LinksGenerator::DetermineRootBracketSeconds()
+{
+    const double secondsPerTimeStep = (double)TimePiece::GetSecondsPerTimeStep();
+    // without an explicit bracket, bracket at the sampled method's check times
+    // so every sample the sampled method looks at is also a bracket end
+    double       bracketSeconds = GetState().additionalCheckSeconds;
+
+    if (GetState().rootBracketSeconds > 0.0) {
+        bracketSeconds = GetState().rootBracketSeconds;
+    }
+
+    if ((bracketSeconds <= 0.0) || (bracketSeconds > secondsPerTimeStep)) {
+        bracketSeconds = secondsPerTimeStep;
+    }
+
+    return(bracketSeconds);
+}
+
+double
+LinksGenerator::FindConstraintCrossing(const LinkConstraints &constraints,
+                                       Link::LINK_STATUS constraint,
+                                       int timeIndex,
+                                       double passSeconds,
+                                       double passMargin,
+                                       double failSeconds,
+                                       double failMargin) const
+{
+    // Brent's method on the constraint margin, [b, c] always brackets the crossing
+    // (the margin is satisfied on one end and violated on the other)
+    int          iteration = 0;
+    double       a = passSeconds;
+    double       b = failSeconds;
+    double       c = failSeconds;
+    double       fa = passMargin;
+    double       fb = failMargin;
+    double       fc = failMargin;
+    double       d = b - a;
+    double       e = d;
+    double       halfTolerance = 0.5 * ROOT_TOLERANCE_SECONDS_s;
+    double       midpoint = 0.0;
+    LinkGeometry geometry;
+
+    while (iteration < MAXIMUM_ROOT_ITERATIONS_s) {
+        if ((fb < 0.0) == (fc < 0.0)) {
+            c = a;
+            fc = fa;
+            d = b - a;
+            e = d;
+        }
+
+        if (fabs(fc) < fabs(fb)) {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        midpoint = 0.5 * (c - b);
+
+        if (fabs(midpoint) <= halfTolerance) {
+            break;
+        }
+
+        if ((fabs(e) >= halfTolerance) && (fabs(fa) > fabs(fb))) {
+            // inverse quadratic interpolation (secant when only two points are known)
+            double p = 0.0;
+            double q = 0.0;
+            const double s = fb / fa;
+
+            if (a == c) {
+                p = 2.0 * midpoint * s;
+                q = 1.0 - s;
+            } else {
+                const double r = fb / fc;
+                q = fa / fc;
+                p = s * (2.0 * midpoint * q * (q - r) - (b - a) * (r - 1.0));
+                q = (q - 1.0) * (r - 1.0) * (s - 1.0);
             }
 
-            if (timeIndex < endIndexTime) {
-                additionalSeconds += additionalCheckSeconds_s;
+            if (p > 0.0) {
+                q = -q;
+            }
+
+            p = fabs(p);
+
+            if ((2.0 * p) < std::min((3.0 * midpoint * q - fabs(halfTolerance * q)), fabs(e * q))) {
+                e = d;
+                d = p / q;
             } else {
-                additionalSeconds += secondsPerTimeStep;
+                d = midpoint;
+                e = d;
             }
+        } else {
+            d = midpoint;
+            e = d;
         }
 
-        (*ptrStatusArray)[timeIndex] = linkStatus;
-        ++timeIndex;
+        a = b;
+        fa = fb;
+
+        if (fabs(d) > halfTolerance) {
+            b += d;
+        } else {
+            b += (midpoint > 0.0) ? halfTolerance : -halfTolerance;
+        }
+
+        DetermineLinkGeometry(constraints, timeIndex, b, geometry);
+        fb = DetermineConstraintMargin(constraint, constraints, geometry);
+        ++iteration;
     }
 
-    if (FileNames::HasFileNameDefined(FileNames::LINKS_DEBUGFILE) == true) {
-        detailedLinksFile << "Minimum Angles :         ";
-        PrintOutputAngle(detailedLinksFile, minimumAzimuthFrom);
-        PrintOutputAngle(detailedLinksFile, minimumAzimuthTo);
-        PrintOutputAngle(detailedLinksFile, minimumElevationFrom);
-        PrintOutputAngle(detailedLinksFile, minimumElevationTo);
-        detailedLinksFile << NEW_LINE;
-        detailedLinksFile << "Maximum Angles :         ";
-        PrintOutputAngle(detailedLinksFile, maximumAzimuthFrom);
-        PrintOutputAngle(detailedLinksFile, maximumAzimuthTo);
-        PrintOutputAngle(detailedLinksFile, maximumElevationFrom);
-        PrintOutputAngle(detailedLinksFile, maximumElevationTo);
-        detailedLinksFile << NEW_LINE;
+    // return the violated side so the status there reports the constraint
+    return((fb < 0.0) ? b : c);
+}
+
+void
+LinksGenerator::PrintLinkGeometry(ofstream &detailedLinksFile,
+                                  const LinkConstraints &constraints,
+                                  int timeIndex,
+                                  double additionalSeconds,
+                                  const LinkGeometry &geometry,
+                                  Link::LINK_STATUS linkStatus,
+                                  LinkGeometry &minimumGeometry,
+                                  LinkGeometry &maximumGeometry) const
+{
+    if (additionalSeconds == 0.0) {
+        TimePiece::PrintIndex(detailedLinksFile, timeIndex);
+        detailedLinksFile << " " << setw(8) << constraints.fromDesignator;
+        detailedLinksFile << " " << setw(8) << constraints.toDesignator;
+    } else {
+        detailedLinksFile << "                         ";
     }
 
-    return(ptrStatusArray);
+    PrintOutputAngle(detailedLinksFile, geometry.azimuthFrom);
+    PrintOutputAngle(detailedLinksFile, geometry.azimuthTo);
+    PrintOutputAngle(detailedLinksFile, geometry.elevationAngleFrom);
+    PrintOutputAngle(detailedLinksFile, geometry.elevationAngleTo);
+    detailedLinksFile << " " << setw(9) << setprecision(2)
+                      << UnitData::GetOutputDistance(geometry.grazingAltitude);
+    detailedLinksFile << " " << setw(10) << setprecision(2)
+                      << UnitData::GetOutputDistance(geometry.range);
+    PrintOutputAngle(detailedLinksFile, geometry.sunAngleFrom);
+    PrintOutputAngle(detailedLinksFile, geometry.sunAngleTo);
+    detailedLinksFile << "  " << TimePiece::GetClockTime(timeIndex, additionalSeconds);
+    detailedLinksFile << "  " << Link::GetLinkStatusString(linkStatus) << NEW_LINE;
+
+    if ( (linkStatus != Link::MIN_GRAZING_ALTITUDE) &&
+            (linkStatus != Link::NO_SUPPORTING_DOWNLINK) ) {
+        minimumGeometry.azimuthFrom = std::min(minimumGeometry.azimuthFrom, geometry.azimuthFrom);
+        maximumGeometry.azimuthFrom = std::max(maximumGeometry.azimuthFrom, geometry.azimuthFrom);
+        minimumGeometry.elevationAngleFrom = std::min(minimumGeometry.elevationAngleFrom, geometry.elevationAngleFrom);
+        maximumGeometry.elevationAngleFrom = std::max(maximumGeometry.elevationAngleFrom, geometry.elevationAngleFrom);
+        minimumGeometry.azimuthTo = std::min(minimumGeometry.azimuthTo, geometry.azimuthTo);
+        maximumGeometry.azimuthTo = std::max(maximumGeometry.azimuthTo, geometry.azimuthTo);
+        minimumGeometry.elevationAngleTo = std::min(minimumGeometry.elevationAngleTo, geometry.elevationAngleTo);
+        maximumGeometry.elevationAngleTo = std::max(maximumGeometry.elevationAngleTo, geometry.elevationAngleTo);
+    }
+
+    return;
+}
+
+void
+LinksGenerator::PrintLinkMethodDifference(const LinkConstraints &constraints,
+        int timeIndex,
+        Link::LINK_STATUS sampledStatus,
+        Link::LINK_STATUS rootFindingStatus,
+        double crossingSeconds)
+{
+    TimePiece::PrintIndex(linkMethodFile_a, timeIndex);
+    linkMethodFile_a << " " << setw(8) << constraints.fromDesignator;
+    linkMethodFile_a << " " << setw(8) << constraints.toDesignator;
+    linkMethodFile_a << "  " << left << setw(28) << Link::GetLinkStatusString(sampledStatus);
+    linkMethodFile_a << setw(28) << Link::GetLinkStatusString(rootFindingStatus) << right;
+
+    if (crossingSeconds != INVALID_SECONDS) {
+        linkMethodFile_a << TimePiece::GetClockTime(timeIndex, crossingSeconds);
+    }
+
+    linkMethodFile_a << NEW_LINE;
+    return;
 }
 
 void
@@ -2043,7 +2749,7 @@ LinksGenerator::DetermineConjunction(shared_ptr<DataProvider> ptrReceiver,
                             }
 
                             if (timeIndex < endIndexTime) {
-                                additionalSeconds += additionalCheckSeconds_s;
+                                additionalSeconds += GetState().additionalCheckSeconds;
                             } else {
                                 additionalSeconds = secondsPerTimeStep;
                             }
@@ -2087,7 +2793,7 @@ LinksGenerator::DetermineConjunction(shared_ptr<DataProvider> ptrReceiver,
                             }
 
                             if (timeIndex < endIndexTime) {
-                                additionalSeconds += additionalCheckSeconds_s;
+                                additionalSeconds += GetState().additionalCheckSeconds;
                             } else {
                                 additionalSeconds = secondsPerTimeStep;
                             }
@@ -2155,7 +2861,7 @@ LinksGenerator::CalculateGrazingAltitude(const SpaceVector &fromVehiclePosition,
 bool
 LinksGenerator::CheckAdditionalSeconds()
 {
-    return(additionalCheckSeconds_s < INVALID_SECONDS);
+    return(GetState().additionalCheckSeconds < INVALID_SECONDS);
 }
 
 bool
@@ -2179,6 +2885,14 @@ LinksGenerator::MissingRequiredDownlink(const shared_ptr<RelaySatellite> &ptrToR
     return(missingRequiredDownlink);
 }
 
+LinksGenerator::State*
+LinksGenerator::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 LinksGenerator::~LinksGenerator()
 {
     return;
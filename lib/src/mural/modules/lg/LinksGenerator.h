@@ -28,16 +28,19 @@
 
 #include "mural/modules/lg/ConjunctionPeriod.h"
 #include "mural/modules/lg/Link.h"
+#include "mural/modules/lg/ProviderGeometryCache.h"
 #include "mural/Sun.h"
 
 #include "general/array/LinkList.h"
 #include "general/array/Array.h"
 
 class Antenna;
+class CoordinateFrame;
 class DataProvider;
 class EarthBoundVehicle;
 class GroundPointingAntenna;
 class GroundStation;
+class LinkCache;
 class Region;
 class RelaySatellite;
 class Satellite;
@@ -59,6 +62,33 @@ class LinksGenerator
 {
 public:
 
+    enum LINK_METHOD {
+        SAMPLED = 0,
+        ROOT_FINDING = 1
+    };
+
+    /**
+     * The link generation settings of a scenario.  Each ScenarioContext holds
+     *  its own, threads with no context bound share the process wide default.
+     */
+    struct State {
+        double      additionalCheckSeconds = INVALID_SECONDS;
+        double      maximumInterimError = 0.0;
+        double      rootBracketSeconds = 0.0;
+        LINK_METHOD linkMethod = SAMPLED;
+        string      linkCacheDirectory = "";
+        bool        resumeFromCheckpoint = false;
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     LinksGenerator();
     LinksGenerator(const LinksGenerator &copyMe);
     virtual ~LinksGenerator();
@@ -71,12 +101,74 @@ public:
 
     static bool CheckAdditionalSeconds();
 
+    static LINK_METHOD ConvertLinkMethod(const string &inputString);
+
+    /**
+     * Sets whether link status arrays are read back from the 'Link Checkpoint
+     *  Directory' (MURAL --resume).  Without it the arrays are only written
+     *  there, so a later resumed run can skip evaluating them.
+     *
+     * @param resumeFromCheckpoint true to read the link checkpoint
+     */
+    static inline void SetResumeFromCheckpoint(bool resumeFromCheckpoint);
+
     void GenerateLinks(const shared_ptr<DataProviderCollection> &ptrDataProvdierCollection);
 
 protected:
 
 private:
 
+    /**
+     * Limits checked on a single link, resolved once per provider/antenna pair.
+     * Elevation limits default to never failing and are replaced per sample when
+     * the antenna uses azimuth based elevation angles.
+     */
+    struct LinkConstraints {
+        shared_ptr<DataProvider>   ptrFromProvider;
+        shared_ptr<Antenna>        ptrFromAntenna;
+        shared_ptr<DataProvider>   ptrToProvider;
+        shared_ptr<Antenna>        ptrToAntenna;
+        shared_ptr<UserVehicle>    ptrClusterUser;
+        shared_ptr<RelaySatellite> ptrToRelay;
+        string                     fromDesignator;
+        string                     toDesignator;
+        double                     minGrazing;
+        double                     maxRange;
+        double                     minRange;
+        double                     maxSunFrom;
+        double                     minSunFrom;
+        double                     maxSunTo;
+        double                     minSunTo;
+        double                     minICCLSolarAngle;
+        double                     minElevationFrom;
+        double                     maxElevationFrom;
+        double                     minElevationTo;
+        double                     maxElevationTo;
+        bool                       fromAzimuthBasedAngles;
+        bool                       toAzimuthBasedAngles;
+    };
+
+    /**
+     * Geometry of a link at one instant (stored units), along with the
+     * elevation limits which apply at that instant's azimuths.
+     */
+    struct LinkGeometry {
+        double azimuthFrom;
+        double azimuthTo;
+        double elevationAngleFrom;
+        double elevationAngleTo;
+        double grazingAltitude;
+        double range;
+        double sunAngleFrom;
+        double sunAngleTo;
+        double solarIntrusionAngle;
+        double minElevationFrom;
+        double maxElevationFrom;
+        double minElevationTo;
+        double maxElevationTo;
+    };
+
+    void   PrepareInterimInterpolation() const;
     void   DetermineConjunctionUPA(ofstream &detailedConjFile);
     void   DetermineConjunctionRF(ofstream &detailedConjFile);
     void   DetermineConjunction(shared_ptr<DataProvider> ptrReceiver,
@@ -139,13 +231,135 @@ private:
                                          bool checkToDownlinkSupport = false,
                                          const shared_ptr<UserVehicle> &ptrClusterUser = nullptr);
 
+    void   DetermineLinkConstraints(const shared_ptr<DataProvider> &ptrFromProvider,
+                                    const shared_ptr<Antenna> &ptrFromAntenna,
+                                    const shared_ptr<DataProvider> &ptrToProvider,
+                                    const shared_ptr<Antenna> &ptrToAntenna,
+                                    const shared_ptr<UserVehicle> &ptrClusterUser,
+                                    LinkConstraints &constraints) const;
+    void   DetermineLinkGeometry(const LinkConstraints &constraints,
+                                 int timeIndex,
+                                 double additionalSeconds,
+                                 LinkGeometry &geometry) const;
+
+    /**
+     * Geometry of the provider pair which does not depend on the antennas,
+     * served from the ProviderGeometryCache when the instant is on its grid
+     */
+    void   DetermineProviderGeometry(const LinkConstraints &constraints,
+                                     int timeIndex,
+                                     double additionalSeconds,
+                                     ProviderGeometryCache::Geometry &providerGeometry) const;
+    void   PrintLinkGeometry(ofstream &detailedLinksFile,
+                             const LinkConstraints &constraints,
+                             int timeIndex,
+                             double additionalSeconds,
+                             const LinkGeometry &geometry,
+                             Link::LINK_STATUS linkStatus,
+                             LinkGeometry &minimumGeometry,
+                             LinkGeometry &maximumGeometry) const;
+    void   PrintLinkMethodDifference(const LinkConstraints &constraints,
+                                     int timeIndex,
+                                     Link::LINK_STATUS sampledStatus,
+                                     Link::LINK_STATUS rootFindingStatus,
+                                     double crossingSeconds);
+
+    /**
+     * Margin of a single geometric constraint, negative exactly when
+     * DetermineGeometryStatus would report that constraint (stored units)
+     */
+    double DetermineConstraintMargin(Link::LINK_STATUS constraint,
+                                     const LinkConstraints &constraints,
+                                     const LinkGeometry &geometry) const;
+
+    /**
+     * Brent's method for the time (seconds into the time step) at which a
+     * constraint starts to fail, returns a time at which it has failed
+     */
+    double FindConstraintCrossing(const LinkConstraints &constraints,
+                                  Link::LINK_STATUS constraint,
+                                  int timeIndex,
+                                  double passSeconds,
+                                  double passMargin,
+                                  double failSeconds,
+                                  double failMargin) const;
+
+    /**
+     * Content key of a link status array for the LinkCache: the evaluation
+     * settings, the time period, both endpoints' constraint data, and per time
+     * step the ephemeris, antenna attitude and outage/dedicated/downlink checks
+     */
+    unsigned long long DetermineLinkCacheKey(const LinkConstraints &constraints) const;
+    void   HashLinkCacheVector(const SpaceVector &spaceVector,
+                               unsigned long long &hashValue) const;
+    void   HashLinkCacheFrame(const shared_ptr<CoordinateFrame> &ptrFrame,
+                              unsigned long long &hashValue) const;
+
+    Link::LINK_STATUS DetermineGeometryStatus(const LinkConstraints &constraints,
+            const LinkGeometry &geometry) const;
+    Link::LINK_STATUS DetermineTimeStepStatus(const LinkConstraints &constraints,
+            int timeIndex) const;
+    Link::LINK_STATUS DetermineSampledLinkStatus(const LinkConstraints &constraints,
+            int timeIndex,
+            ofstream &detailedLinksFile,
+            bool printDetails,
+            LinkGeometry &minimumGeometry,
+            LinkGeometry &maximumGeometry) const;
+
+    /**
+     * Spacing of the root finding brackets: 'Root Bracket Seconds' when
+     * given, otherwise 'Additional Check Seconds' (at most the time step)
+     */
+    static double DetermineRootBracketSeconds();
+
+    /**
+     * Brackets the time step every 'Root Bracket Seconds' and refines the
+     * first failing bracket to the earliest constraint crossing.  A constraint
+     * that fails and recovers between two bracket ends is not seen, the same
+     * as between two samples of the sampled method.
+     */
+    Link::LINK_STATUS DetermineRootFindingLinkStatus(const LinkConstraints &constraints,
+            int timeIndex,
+            ofstream &detailedLinksFile,
+            bool printDetails,
+            LinkGeometry &minimumGeometry,
+            LinkGeometry &maximumGeometry,
+            double &crossingSeconds) const;
+
     static inline string GetClassName();
 
-    static double          additionalCheckSeconds_s;
+    static inline State& GetState();
+
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
+
+    static const double    ROOT_TOLERANCE_SECONDS_s;
+    static const int       MAXIMUM_ROOT_ITERATIONS_s;
+    static const int       NUMBER_OF_ROOT_CONSTRAINTS_s;
+    static const Link::LINK_STATUS ROOT_CONSTRAINTS_s[];
 
     shared_ptr<DataProviderCollection> ptrDataProviderCollection_a;
+
+    shared_ptr<LinkCache>              ptrLinkCache_a;
+    shared_ptr<LinkCache>              ptrLinkCheckpoint_a;
+    shared_ptr<ProviderGeometryCache>  ptrGeometryCache_a;
+    ofstream                           linkMethodFile_a;
 };
 
+inline
+LinksGenerator::State&
+LinksGenerator::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
+}
+
+inline
+void
+LinksGenerator::SetResumeFromCheckpoint(bool resumeFromCheckpoint)
+{
+    GetState().resumeFromCheckpoint = resumeFromCheckpoint;
+}
+
 inline
 string
 LinksGenerator::GetClassName()
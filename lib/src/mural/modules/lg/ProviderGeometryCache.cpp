@@ -0,0 +1,186 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ProviderGeometryCache.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "ProviderGeometryCache.h"
+
+#include "general/time/TimePiece.h"
+#include "general/utility/Constant.h"
+
+const size_t ProviderGeometryCache::DEFAULT_MAXIMUM_BYTES_s = 256 * 1024 * 1024;
+
+ProviderGeometryCache::ProviderGeometryCache(double sampleSeconds,
+        size_t maximumBytes)
+    : ptrFromProvider_a(NULL), sampleSeconds_a(sampleSeconds), samplesPerTimeStep_a(2),
+      maximumPairs_a(1), evaluations_a(0), reuses_a(0), uncachedEvaluations_a(0)
+{
+    const double secondsPerTimeStep = (double)TimePiece::GetSecondsPerTimeStep();
+    size_t       pairBytes = 0;
+
+    if ((sampleSeconds_a <= 0.0) || (sampleSeconds_a > secondsPerTimeStep)) {
+        sampleSeconds_a = secondsPerTimeStep;
+    }
+
+    // the samples inside the time step plus the end of the time step
+    samplesPerTimeStep_a = (int)ceil(secondsPerTimeStep / sampleSeconds_a) + 1;
+    pairBytes = (size_t)TimePiece::GetNumberOfTimeSteps() * (size_t)samplesPerTimeStep_a * sizeof(Geometry);
+
+    if (pairBytes > 0) {
+        maximumPairs_a = std::max((size_t)1, (maximumBytes / pairBytes));
+    }
+
+    return;
+}
+
+/* ************************************************************************** */
+
+ProviderGeometryCache::Geometry*
+ProviderGeometryCache::Find(const DataProvider *ptrFromProvider,
+                            const DataProvider *ptrToProvider,
+                            const DataProvider *ptrClusterUser,
+                            int timeIndex,
+                            double additionalSeconds)
+{
+    const int sampleIndex = DetermineSampleIndex(additionalSeconds);
+    Geometry *ptrGeometry = NULL;
+
+    // the link loops finish a transmitting provider before moving on
+    if (ptrFromProvider != ptrFromProvider_a) {
+        Clear();
+        ptrFromProvider_a = ptrFromProvider;
+    }
+
+    if (sampleIndex >= 0) {
+        const PairKey key = {{ptrFromProvider, ptrToProvider, ptrClusterUser}};
+        map<PairKey, shared_ptr<vector<Geometry>>>::iterator pairIter;
+        pairIter = pairGeometryMap_a.find(key);
+
+        if (pairIter == pairGeometryMap_a.end()) {
+            Geometry undefinedGeometry;
+            undefinedGeometry.lineOfSightX = 0.0;
+            undefinedGeometry.lineOfSightY = 0.0;
+            undefinedGeometry.lineOfSightZ = 0.0;
+            undefinedGeometry.grazingAltitude = 0.0;
+            undefinedGeometry.range = -1.0;
+            undefinedGeometry.sunAngleFrom = 0.0;
+            undefinedGeometry.sunAngleTo = 0.0;
+            undefinedGeometry.solarIntrusionAngle = 0.0;
+
+            if (pairGeometryMap_a.size() >= maximumPairs_a) {
+                pairGeometryMap_a.erase(pairOrderList_a.front());
+                pairOrderList_a.pop_front();
+            }
+
+            pairIter = pairGeometryMap_a.insert(make_pair(key, shared_ptr<vector<Geometry>>(
+                                                    new vector<Geometry>((size_t)TimePiece::GetNumberOfTimeSteps()
+                                                            * (size_t)samplesPerTimeStep_a, undefinedGeometry)))).first;
+            pairOrderList_a.push_back(key);
+        }
+
+        ptrGeometry = &((*(pairIter->second))[((size_t)timeIndex * (size_t)samplesPerTimeStep_a) + sampleIndex]);
+
+        if (ptrGeometry->range >= 0.0) {
+            ++reuses_a;
+        }
+    }
+
+    return(ptrGeometry);
+}
+
+/* ************************************************************************** */
+
+void
+ProviderGeometryCache::CountEvaluation(const Geometry *ptrGeometry)
+{
+    if (ptrGeometry != NULL) {
+        ++evaluations_a;
+    } else {
+        ++uncachedEvaluations_a;
+    }
+
+    return;
+}
+
+/* ************************************************************************** */
+
+void
+ProviderGeometryCache::Clear()
+{
+    pairGeometryMap_a.clear();
+    pairOrderList_a.clear();
+    ptrFromProvider_a = NULL;
+    return;
+}
+
+/* ************************************************************************** */
+
+int
+ProviderGeometryCache::DetermineSampleIndex(double additionalSeconds) const
+{
+    const double secondsPerTimeStep = (double)TimePiece::GetSecondsPerTimeStep();
+    int          sampleIndex = -1;
+
+    if (additionalSeconds == secondsPerTimeStep) {
+        sampleIndex = samplesPerTimeStep_a - 1;
+    } else if ((additionalSeconds >= 0.0) && (additionalSeconds < secondsPerTimeStep)) {
+        // the sampled method accumulates its offsets, so allow for the rounding
+        const int gridIndex = (int)floor((additionalSeconds / sampleSeconds_a) + 0.5);
+
+        if ((gridIndex < (samplesPerTimeStep_a - 1)) &&
+                (fabs(additionalSeconds - ((double)gridIndex * sampleSeconds_a)) <= (1.0e-9 * sampleSeconds_a))) {
+            sampleIndex = gridIndex;
+        }
+    }
+
+    return(sampleIndex);
+}
+
+/* ************************************************************************** */
+
+void
+ProviderGeometryCache::PrintStatistics(ostream &outfile) const
+{
+    const long long     gridSamples = evaluations_a + reuses_a;
+    const ios::fmtflags saveFlags = outfile.flags();
+    const streamsize    savePrecision = outfile.precision();
+    outfile << "ProviderGeometryCache: " << evaluations_a << " Evaluated, " << reuses_a << " Reused";
+
+    if (gridSamples > 0) {
+        outfile << " (" << fixed << setprecision(1)
+                << (100.0 * (double)reuses_a / (double)gridSamples) << "% Of Grid Samples)";
+    }
+
+    outfile << ", " << uncachedEvaluations_a << " Off Grid" << NEW_LINE;
+    outfile.flags(saveFlags);
+    outfile.precision(savePrecision);
+    return;
+}
+
+/* ************************************************************************** */
+
+ProviderGeometryCache::~ProviderGeometryCache()
+{
+    return;
+}
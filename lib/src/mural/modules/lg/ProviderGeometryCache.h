@@ -0,0 +1,152 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ProviderGeometryCache.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef PROVIDER_GEOMETRY_CACHE_H
+#define PROVIDER_GEOMETRY_CACHE_H "ProviderGeometryCache"
+
+#include <array>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class DataProvider;
+
+/**
+ * Holds the provider level geometry of the provider pairs being linked (the
+ *  line of sight, range, grazing altitude, Sun separation and ICCL solar
+ *  intrusion angles), which is the same for every antenna pair of the two
+ *  providers.  Each pair keeps one slot per sample of the time step grid
+ *  (every 'sampleSeconds' into the time step and the end of the time step);
+ *  instants off that grid (root finding refinements) are not cached.  The
+ *  pairs are dropped when the transmitting provider changes and, oldest
+ *  first, whenever the slots would exceed the byte limit.
+ *
+ * Name                         Description (units)
+ * -------------                ------------------------------------------
+ * pairGeometryMap_a            geometry slots of each cached provider pair
+ * pairOrderList_a              cached provider pairs, oldest first
+ * ptrFromProvider_a*           transmitting provider of the cached pairs
+ * sampleSeconds_a              spacing of the cached samples (seconds)
+ * samplesPerTimeStep_a         cached samples in each time step
+ * maximumPairs_a               provider pairs that fit in the byte limit
+ * evaluations_a                samples evaluated and cached
+ * reuses_a                     samples served from the cache
+ * uncachedEvaluations_a        samples evaluated off the sample grid
+ */
+class ProviderGeometryCache
+{
+public:
+
+    /**
+     * Provider level geometry of a provider pair at one instant (stored
+     * units), the range is negative until the slot is evaluated
+     */
+    struct Geometry {
+        double lineOfSightX;
+        double lineOfSightY;
+        double lineOfSightZ;
+        double grazingAltitude;
+        double range;
+        double sunAngleFrom;
+        double sunAngleTo;
+        double solarIntrusionAngle;
+    };
+
+    /**
+     * Constructor
+     *
+     * @param sampleSeconds spacing of the cached samples (seconds)
+     * @param maximumBytes limit on the bytes held by the geometry slots
+     */
+    ProviderGeometryCache(double sampleSeconds,
+                          size_t maximumBytes);
+    virtual ~ProviderGeometryCache();
+
+    /**
+     * Finds the geometry slot of the provider pair at the instant
+     *
+     * @param *ptrFromProvider the transmitting provider
+     * @param *ptrToProvider the receiving provider
+     * @param *ptrClusterUser the cluster user of the ICCL check (or NULL)
+     * @param timeIndex the time index
+     * @param additionalSeconds seconds past the time index
+     * @return Geometry* the slot (evaluated when its range is not negative)
+     *  or NULL when the instant is off the sample grid
+     */
+    Geometry* Find(const DataProvider *ptrFromProvider,
+                   const DataProvider *ptrToProvider,
+                   const DataProvider *ptrClusterUser,
+                   int timeIndex,
+                   double additionalSeconds);
+
+    /**
+     * Counts a sample evaluated for a slot returned by Find (or off the
+     * sample grid when the slot is NULL)
+     *
+     * @param *ptrGeometry the slot, or NULL
+     */
+    void   CountEvaluation(const Geometry *ptrGeometry);
+
+    void   Clear();
+
+    void   PrintStatistics(ostream &outfile) const;
+
+    static const size_t DEFAULT_MAXIMUM_BYTES_s;
+
+protected:
+
+private:
+
+    // (from, to, cluster user), a fixed size key so a lookup does not allocate
+    typedef std::array<const DataProvider*, 3> PairKey;
+
+    ProviderGeometryCache(const ProviderGeometryCache &copyMe);
+    ProviderGeometryCache& operator = (const ProviderGeometryCache &copyMe);
+
+    int    DetermineSampleIndex(double additionalSeconds) const;
+
+    static inline string GetClassName();
+
+    map<PairKey, shared_ptr<vector<Geometry>>> pairGeometryMap_a;
+    list<PairKey>                              pairOrderList_a;
+    const DataProvider                        *ptrFromProvider_a;
+    double                                     sampleSeconds_a;
+    int                                        samplesPerTimeStep_a;
+    size_t                                     maximumPairs_a;
+    long long                                  evaluations_a;
+    long long                                  reuses_a;
+    long long                                  uncachedEvaluations_a;
+};
+
+inline
+string
+ProviderGeometryCache::GetClassName()
+{
+    return(PROVIDER_GEOMETRY_CACHE_H);
+}
+
+#endif
@@ -0,0 +1,344 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * EclipseTimeline.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#include <algorithm>
+#include <cmath>
+
+#include "EclipseTimeline.h"
+#include "Journey.h"
+#include "mural/Earth.h"
+#include "mural/Sun.h"
+
+#include "general/math/SpaceVector.h"
+#include "general/time/TimePiece.h"
+
+const double EclipseTimeline::CROSSING_TOLERANCE_s = 1.0e-3;
+const int    EclipseTimeline::MAXIMUM_ITERATIONS_s = 100;
+
+EclipseTimeline::EclipseTimeline()
+    : boundaryIntervals_a(NUMBER_OF_BOUNDARIES)
+{
+    return;
+}
+
+EclipseTimeline::EclipseTimeline(const Journey &journey)
+    : boundaryIntervals_a(NUMBER_OF_BOUNDARIES)
+{
+    try {
+        DetermineIntervals(journey);
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "EclipseTimeline(const Journey&)");
+        throw;
+    }
+
+    return;
+}
+
+EclipseTimeline::EclipseTimeline(const EclipseTimeline &copyMe)
+    : boundaryIntervals_a(copyMe.boundaryIntervals_a)
+{
+    return;
+}
+
+EclipseTimeline&
+EclipseTimeline::operator = (const EclipseTimeline &copyMe)
+{
+    boundaryIntervals_a = copyMe.boundaryIntervals_a;
+    return(*this);
+}
+
+bool
+EclipseTimeline::operator == (const EclipseTimeline &compareMe) const
+{
+    int  boundary = 0;
+    bool equal = true;
+
+    while ((equal == true) && (boundary < NUMBER_OF_BOUNDARIES)) {
+        const vector<Interval> &intervals = boundaryIntervals_a[boundary];
+        const vector<Interval> &compareIntervals = compareMe.boundaryIntervals_a[boundary];
+        equal = (intervals.size() == compareIntervals.size());
+
+        for (size_t index = 0; (equal == true) && (index < intervals.size()); ++index) {
+            equal = ((intervals[index].entryTime == compareIntervals[index].entryTime) &&
+                     (intervals[index].exitTime == compareIntervals[index].exitTime));
+        }
+
+        ++boundary;
+    }
+
+    return(equal);
+}
+
+/* ************************************************************************************************** */
+
+bool
+EclipseTimeline::IsInLight(int timeIndex) const
+{
+    return(IsInside(boundaryIntervals_a[CENTER_BOUNDARY], (double)timeIndex) == false);
+}
+
+/* ************************************************************************************************** */
+
+EclipseTimeline::SHADOW
+EclipseTimeline::GetShadow(int timeIndex) const
+{
+    const double time = (double)timeIndex;
+    SHADOW       shadow = SUNLIGHT;
+
+    if (IsInside(boundaryIntervals_a[UMBRA_BOUNDARY], time) == true) {
+        shadow = UMBRA;
+    } else if (IsInside(boundaryIntervals_a[PENUMBRA_BOUNDARY], time) == true) {
+        shadow = PENUMBRA;
+    }
+
+    return(shadow);
+}
+
+/* ************************************************************************************************** */
+
+double
+EclipseTimeline::GetUmbraSeconds(int startTime,
+                                 int endTime) const
+{
+    return(DetermineOverlap(boundaryIntervals_a[UMBRA_BOUNDARY], (double)startTime, (double)(endTime + 1))
+           * (double)TimePiece::GetSecondsPerTimeStep());
+}
+
+/* ************************************************************************************************** */
+
+double
+EclipseTimeline::GetPenumbraSeconds(int startTime,
+                                    int endTime) const
+{
+    // the umbra always lies inside the penumbra cone
+    const double penumbraSteps = DetermineOverlap(boundaryIntervals_a[PENUMBRA_BOUNDARY],
+                                 (double)startTime, (double)(endTime + 1));
+    const double umbraSteps = DetermineOverlap(boundaryIntervals_a[UMBRA_BOUNDARY],
+                              (double)startTime, (double)(endTime + 1));
+    return(std::max(0.0, (penumbraSteps - umbraSteps)) * (double)TimePiece::GetSecondsPerTimeStep());
+}
+
+/* ************************************************************************************************** */
+
+size_t
+EclipseTimeline::GetMemoryFootprint() const
+{
+    size_t footprint = sizeof(*this);
+    vector<vector<Interval>>::const_iterator boundaryIter;
+
+    for (boundaryIter = boundaryIntervals_a.begin(); boundaryIter != boundaryIntervals_a.end(); ++boundaryIter) {
+        footprint += (sizeof(vector<Interval>) + (boundaryIter->capacity() * sizeof(Interval)));
+    }
+
+    return(footprint);
+}
+
+/* ************************************************************************************************** */
+
+void
+EclipseTimeline::DetermineIntervals(const Journey &journey)
+{
+    int          timeIndex = 0;
+    int          boundary = 0;
+    const int    numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    double       previousFunctions[NUMBER_OF_BOUNDARIES];
+    double       currentFunctions[NUMBER_OF_BOUNDARIES];
+    Interval     interval;
+
+    while (timeIndex < numberOfTimeSteps) {
+        DetermineShadowFunctions(journey, timeIndex, 0.0, currentFunctions);
+
+        for (boundary = 0; boundary < NUMBER_OF_BOUNDARIES; ++boundary) {
+            vector<Interval> &intervals = boundaryIntervals_a[boundary];
+            const bool        inShadow = (currentFunctions[boundary] < 0.0);
+
+            if (timeIndex == 0) {
+                if (inShadow == true) {
+                    interval.entryTime = -1.0;
+                    interval.exitTime = (double)numberOfTimeSteps;
+                    intervals.push_back(interval);
+                }
+            } else if (inShadow != (previousFunctions[boundary] < 0.0)) {
+                const double crossingTime = DetermineCrossingTime(journey, (timeIndex - 1),
+                                            (SHADOW_BOUNDARY)boundary,
+                                            previousFunctions[boundary],
+                                            currentFunctions[boundary]);
+
+                if (inShadow == true) {
+                    interval.entryTime = crossingTime;
+                    interval.exitTime = (double)numberOfTimeSteps;
+                    intervals.push_back(interval);
+                } else {
+                    intervals.back().exitTime = crossingTime;
+                }
+            }
+
+            previousFunctions[boundary] = currentFunctions[boundary];
+        }
+
+        ++timeIndex;
+    }
+
+    for (boundary = 0; boundary < NUMBER_OF_BOUNDARIES; ++boundary) {
+        boundaryIntervals_a[boundary].shrink_to_fit();
+    }
+
+    return;
+}
+
+/* ************************************************************************************************** */
+
+void
+EclipseTimeline::DetermineShadowFunctions(const Journey &journey,
+        int timeIndex,
+        double additionalSeconds,
+        double *ptrShadowFunctions)
+{
+    const SpaceVector position = journey.GetInterimPosition(timeIndex, additionalSeconds);
+    const SpaceVector sunDirection = Sun::GetInterimPosition(timeIndex, additionalSeconds) - position;
+    const double      positionMagnitude = position.GetMagnitude();
+    const double      sunMagnitude = sunDirection.GetMagnitude();
+    // apparent angle between the Earth center and the Sun center
+    const double      separation = atan2(position.CrossProduct(sunDirection).GetMagnitude(),
+                                         -position.DotProduct(sunDirection));
+    // apparent radii of the Earth and the Sun
+    const double      earthAngle = asin(std::min(1.0, (Earth::GetStoreRadius() / positionMagnitude)));
+    const double      sunAngle = asin(std::min(1.0, (Sun::GetStoreRadius() / sunMagnitude)));
+    ptrShadowFunctions[PENUMBRA_BOUNDARY] = separation - (earthAngle + sunAngle);
+    ptrShadowFunctions[CENTER_BOUNDARY] = separation - earthAngle;
+    ptrShadowFunctions[UMBRA_BOUNDARY] = separation - (earthAngle - sunAngle);
+    return;
+}
+
+/* ************************************************************************************************** */
+
+double
+EclipseTimeline::DetermineCrossingTime(const Journey &journey,
+                                       int timeIndex,
+                                       const SHADOW_BOUNDARY &boundary,
+                                       double startFunction,
+                                       double endFunction)
+{
+    int          iteration = 0;
+    int          retainedSide = 0;
+    double       lowerSeconds = 0.0;
+    double       upperSeconds = (double)TimePiece::GetSecondsPerTimeStep();
+    double       lowerFunction = startFunction;
+    double       upperFunction = endFunction;
+    const double secondsPerTimeStep = upperSeconds;
+    const bool   lowerInShadow = (startFunction < 0.0);
+    double       shadowFunctions[NUMBER_OF_BOUNDARIES];
+
+    // Illinois variant of regula falsi, which keeps the crossing bracketed
+    while (((upperSeconds - lowerSeconds) > CROSSING_TOLERANCE_s) && (iteration < MAXIMUM_ITERATIONS_s)) {
+        double seconds = ((lowerSeconds * upperFunction) - (upperSeconds * lowerFunction))
+                         / (upperFunction - lowerFunction);
+
+        if ((seconds <= lowerSeconds) || (seconds >= upperSeconds)) {
+            seconds = 0.5 * (lowerSeconds + upperSeconds);
+        }
+
+        DetermineShadowFunctions(journey, timeIndex, seconds, shadowFunctions);
+
+        if ((shadowFunctions[boundary] < 0.0) == lowerInShadow) {
+            lowerSeconds = seconds;
+            lowerFunction = shadowFunctions[boundary];
+
+            if (retainedSide == 1) {
+                upperFunction *= 0.5;
+            }
+
+            retainedSide = 1;
+        } else {
+            upperSeconds = seconds;
+            upperFunction = shadowFunctions[boundary];
+
+            if (retainedSide == -1) {
+                lowerFunction *= 0.5;
+            }
+
+            retainedSide = -1;
+        }
+
+        ++iteration;
+    }
+
+    // keep the sunlit end of the bracket so the sampled time steps agree
+    // with the intervals
+    if (lowerInShadow == true) {
+        lowerSeconds = upperSeconds;
+    }
+
+    return((double)timeIndex + (lowerSeconds / secondsPerTimeStep));
+}
+
+/* ************************************************************************************************** */
+
+bool
+EclipseTimeline::IsInside(const vector<Interval> &intervals,
+                          double time)
+{
+    // first interval entered at or after the time, the one before it is the
+    // only candidate
+    vector<Interval>::const_iterator intervalIter = std::lower_bound(intervals.begin(), intervals.end(), time,
+    [](const Interval & interval, double value) {
+        return(interval.entryTime < value);
+    });
+
+    bool inside = false;
+
+    if (intervalIter != intervals.begin()) {
+        --intervalIter;
+        inside = (time < intervalIter->exitTime);
+    }
+
+    return(inside);
+}
+
+/* ************************************************************************************************** */
+
+double
+EclipseTimeline::DetermineOverlap(const vector<Interval> &intervals,
+                                  double startTime,
+                                  double endTime)
+{
+    double overlap = 0.0;
+    vector<Interval>::const_iterator intervalIter = std::lower_bound(intervals.begin(), intervals.end(), startTime,
+    [](const Interval & interval, double value) {
+        return(interval.exitTime < value);
+    });
+
+    while ((intervalIter != intervals.end()) && (intervalIter->entryTime < endTime)) {
+        overlap += std::max(0.0, (std::min(endTime, intervalIter->exitTime)
+                                  - std::max(startTime, intervalIter->entryTime)));
+        ++intervalIter;
+    }
+
+    return(overlap);
+}
+
+/* ************************************************************************************************** */
+
+EclipseTimeline::~EclipseTimeline()
+{
+    return;
+}
@@ -0,0 +1,177 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * EclipseTimeline.h
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+#ifndef ECLIPSE_TIMELINE_H
+#define ECLIPSE_TIMELINE_H "EclipseTimeline"
+
+#include <vector>
+#include <string>
+
+using namespace std;
+
+class Journey;
+
+/**
+ * This class holds the shadow intervals of a journey over the whole time
+ * horizon.  The shadow functions (the apparent separation of the Sun from the
+ * Earth center less the shadow cone half angles) are sampled at each time step
+ * and the entry and exit times are root found inside every time step that
+ * shows a sign change.  Intervals are stored as fractional time indices so the
+ * time step queries are a binary search.
+ *
+ * Intervals already open at the first time step begin at -1.0, those still
+ * open at the last time step end one time step past it.  An eclipse that both
+ * begins and ends within a single time step is not detected.
+ *
+ * Name                     Description (units)
+ * -------------            ----------------------------------------------------
+ * boundaryIntervals_a      the shadow intervals for each SHADOW_BOUNDARY
+ *                            (fractional time indices)
+ *
+ * CROSSING_TOLERANCE_s     root finding tolerance on a crossing time (seconds)
+ * MAXIMUM_ITERATIONS_s     maximum root finding iterations per crossing
+ */
+class EclipseTimeline
+{
+public:
+
+    enum SHADOW {
+        SUNLIGHT = 0,
+        PENUMBRA = 1,
+        UMBRA = 2
+    };
+
+    /**
+     * The cone that bounds a shadow: the PENUMBRA_BOUNDARY is first contact
+     * with the solar disk, the CENTER_BOUNDARY occults the center of the Sun
+     * (the Sun::IsInLight test) and the UMBRA_BOUNDARY occults the whole disk.
+     */
+    enum SHADOW_BOUNDARY {
+        PENUMBRA_BOUNDARY = 0,
+        CENTER_BOUNDARY = 1,
+        UMBRA_BOUNDARY = 2,
+        NUMBER_OF_BOUNDARIES = 3
+    };
+
+    struct Interval {
+        double entryTime;
+        double exitTime;
+    };
+
+    EclipseTimeline();
+    explicit EclipseTimeline(const Journey &journey);
+    EclipseTimeline(const EclipseTimeline &copyMe);
+    virtual ~EclipseTimeline();
+
+    EclipseTimeline& operator =  (const EclipseTimeline &copyMe);
+    bool             operator == (const EclipseTimeline &compareMe) const;
+
+    /**
+     * Determines if the center of the Sun is visible at the time index, a
+     * binary search of the CENTER_BOUNDARY intervals
+     *
+     * @param timeIndex the time index
+     * @return true if the center of the Sun is not occulted by the Earth
+     */
+    bool   IsInLight(int timeIndex) const;
+
+    /**
+     * Gets the shadow the journey is in at the time index
+     *
+     * @param timeIndex the time index
+     * @return SHADOW the shadow
+     */
+    SHADOW GetShadow(int timeIndex) const;
+
+    /**
+     * Gets the seconds spent in the umbra from the start of the start time
+     * index to the end of the end time index
+     *
+     * @param startTime the start time index
+     * @param endTime the end time index (inclusive)
+     * @return double the umbra seconds
+     */
+    double GetUmbraSeconds(int startTime,
+                           int endTime) const;
+
+    /**
+     * Gets the seconds spent in the penumbra (partial phase only) from the
+     * start of the start time index to the end of the end time index
+     *
+     * @param startTime the start time index
+     * @param endTime the end time index (inclusive)
+     * @return double the penumbra seconds
+     */
+    double GetPenumbraSeconds(int startTime,
+                              int endTime) const;
+
+    size_t GetMemoryFootprint() const;
+
+    inline const vector<Interval>& GetIntervals(const SHADOW_BOUNDARY &boundary) const;
+
+protected:
+
+private:
+
+    void   DetermineIntervals(const Journey &journey);
+
+    static void   DetermineShadowFunctions(const Journey &journey,
+                                           int timeIndex,
+                                           double additionalSeconds,
+                                           double *ptrShadowFunctions);
+
+    static double DetermineCrossingTime(const Journey &journey,
+                                        int timeIndex,
+                                        const SHADOW_BOUNDARY &boundary,
+                                        double startFunction,
+                                        double endFunction);
+
+    static bool   IsInside(const vector<Interval> &intervals,
+                           double time);
+
+    static double DetermineOverlap(const vector<Interval> &intervals,
+                                   double startTime,
+                                   double endTime);
+
+    static inline string GetClassName();
+
+    vector<vector<Interval>> boundaryIntervals_a;
+
+    static const double CROSSING_TOLERANCE_s;
+    static const int    MAXIMUM_ITERATIONS_s;
+};
+
+inline
+const vector<EclipseTimeline::Interval>&
+EclipseTimeline::GetIntervals(const SHADOW_BOUNDARY &boundary) const
+{
+    return(boundaryIntervals_a[boundary]);
+}
+
+inline
+string
+EclipseTimeline::GetClassName()
+{
+    return(ECLIPSE_TIMELINE_H);
+}
+
+#endif
@@ -20,12 +20,18 @@
  *============================================================================================*/
 
 
+#include <algorithm>
+#include <cmath>
+
 #include "Journey.h"
+#include "EclipseTimeline.h"
 #include "Revolution.h"
 #include "PositionUtility.h"
+#include "mural/coorframe/ElementCoordinateFrame.h"
 
 
 #include "general/array/ListIterator.h"
+#include "general/math/CoordinateFrame.h"
 #include "general/math/SpaceVector.h"
 #include "general/utility/StringEditor.h"
 #include "general/time/TimePiece.h"
@@ -34,16 +40,27 @@
 #include "general/data/InputDataElement.h"
 #include "general\utility\Utility.h"
 
+Journey::State               Journey::defaultState_s;
+thread_local Journey::State *Journey::ptrBoundState_s = NULL;
+mutex                        Journey::hermiteMutex_s;
+mutex                        Journey::eclipseMutex_s;
+
 Journey::Journey()
     : positionGenerationMethod_a(UNKNOWN_POSITION_METHOD),
-      ptrPositionStateArray_a(NULL)
+      ptrPositionStateArray_a(NULL), ptrHermiteCoefficients_a(NULL),
+      ptrEclipseTimeline_a(NULL), ptrTopocentricFrame_a(NULL),
+      ptrFixedVelocity_a(NULL)
 {
     return;
 }
 
 Journey::Journey(const Journey &copyMe)
     : positionGenerationMethod_a(copyMe.positionGenerationMethod_a),
-      ptrPositionStateArray_a(NULL)
+      ptrPositionStateArray_a(NULL),
+      ptrHermiteCoefficients_a(atomic_load(&copyMe.ptrHermiteCoefficients_a)),
+      ptrEclipseTimeline_a(atomic_load(&copyMe.ptrEclipseTimeline_a)),
+      ptrTopocentricFrame_a(copyMe.ptrTopocentricFrame_a),
+      ptrFixedVelocity_a(copyMe.ptrFixedVelocity_a)
 {
     if (copyMe.ptrPositionStateArray_a != NULL) {
         ptrPositionStateArray_a = shared_ptr<MURALTypes::PositionStateVector>(copyMe.ptrPositionStateArray_a);
@@ -57,6 +74,10 @@ Journey::operator = (const Journey &copyMe)
 {
     positionGenerationMethod_a = copyMe.positionGenerationMethod_a;
     ptrPositionStateArray_a  = NULL;
+    atomic_store(&ptrHermiteCoefficients_a, atomic_load(&copyMe.ptrHermiteCoefficients_a));
+    atomic_store(&ptrEclipseTimeline_a, atomic_load(&copyMe.ptrEclipseTimeline_a));
+    ptrTopocentricFrame_a    = copyMe.ptrTopocentricFrame_a;
+    ptrFixedVelocity_a       = copyMe.ptrFixedVelocity_a;
 
     if (copyMe.ptrPositionStateArray_a != NULL) {
         ptrPositionStateArray_a = shared_ptr<MURALTypes::PositionStateVector>(copyMe.ptrPositionStateArray_a);
@@ -102,6 +123,29 @@ Journey::SetPositionState(int timeIndex,
     try {
         // should i replace this with ->insert?
         (*ptrPositionStateArray_a)[timeIndex] = ptrPositionState;
+        // the Hermite coefficients are shared atomically (see DetermineHermiteVector)
+        atomic_store(&ptrHermiteCoefficients_a, shared_ptr<vector<double>>());
+        atomic_store(&ptrEclipseTimeline_a, shared_ptr<EclipseTimeline>());
+        ptrTopocentricFrame_a = NULL;
+        ptrFixedVelocity_a = NULL;
+
+        if (positionGenerationMethod_a == STATIONARY) {
+            const REFERENCE_FRAME internalFrame = UnitData::GetInternalReferenceFrame();
+            const SpaceVector    &fixedPosition = *(ptrPositionState->GetPosition());
+
+            if (internalFrame != EARTH_CENTER_INERTIAL) {
+                ptrTopocentricFrame_a = ElementCoordinateFrame::DetermineGroundCoordinateFrame(
+                                            GetPosition(timeIndex, internalFrame));
+            }
+
+            // the Earth turns about the Z axis of the Earth fixed frame
+            if (fixedPosition.GetReferenceFrame() != EARTH_CENTER_INERTIAL) {
+                const SpaceVector angularVelocity(0.0, 0.0, EARTH_ROTATION_RATE_RAD_PER_S,
+                                                  fixedPosition.GetReferenceFrame());
+                ptrFixedVelocity_a = shared_ptr<const SpaceVector>(
+                                         new SpaceVector(angularVelocity.CrossProduct(fixedPosition)));
+            }
+        }
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(),
                             "SetPositionState(int, PositionState*)");
@@ -256,16 +300,15 @@ SpaceVector
 Journey::GetPosition(int timeIndex,
                      const REFERENCE_FRAME &returnFrame) const
 {
-    int        listIndex = 0;
     SpaceVector positionVector;
 
-    if (positionGenerationMethod_a != STATIONARY) {
-        listIndex = timeIndex;
-    }
-
     try {
-        positionVector = (ptrPositionStateArray_a->at(listIndex))
-                         ->GetPosition(returnFrame, timeIndex);
+        if (positionGenerationMethod_a == STATIONARY) {
+            positionVector = DetermineStationaryVector(timeIndex, returnFrame, false);
+        } else {
+            positionVector = (ptrPositionStateArray_a->at(timeIndex))
+                             ->GetPosition(returnFrame, timeIndex);
+        }
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(),
                             "GetPosition(int, const REFERENCE_FRAME&)");
@@ -282,13 +325,20 @@ Journey::GetInterimPosition(int timeIndex,
     const double totalSeconds = (double)TimePiece::GetSecondsPerTimeStep();
     SpaceVector  interimPosition;
 
-    if ((additionalSeconds == 0.0) || (positionGenerationMethod_a == STATIONARY)) {
+    if (positionGenerationMethod_a == STATIONARY) {
+        interimPosition = DetermineStationaryVector(timeIndex,
+                          UnitData::GetInternalReferenceFrame(), false);
+    } else if (additionalSeconds == 0.0) {
         interimPosition = GetPosition(timeIndex);
     } else if (timeIndex < TimePiece::GetEndIndexTime()) {
         try {
-            interimPosition = PositionUtility::DetermineInterimPosition(GetPosition(timeIndex),
-                              GetPosition(timeIndex + 1),
-                              totalSeconds, additionalSeconds);
+            if (UsesHermiteInterpolation() == true) {
+                interimPosition = DetermineHermiteVector(timeIndex, additionalSeconds, false);
+            } else {
+                interimPosition = PositionUtility::DetermineInterimPosition(GetPosition(timeIndex),
+                                  GetPosition(timeIndex + 1),
+                                  totalSeconds, additionalSeconds);
+            }
         } catch (Exception *ptrError) {
             ptrError->AddMethod(GetClassName(),
                                 "GetInterimPosition(int, const double&)");
@@ -319,16 +369,15 @@ SpaceVector
 Journey::GetVelocity(int timeIndex,
                      const REFERENCE_FRAME &returnFrame) const
 {
-    int        listIndex = 0;
     SpaceVector velocityVector;
 
-    if (positionGenerationMethod_a != STATIONARY) {
-        listIndex = timeIndex;
-    }
-
     try {
-        velocityVector = (ptrPositionStateArray_a->at(listIndex))
-                         ->GetVelocity(returnFrame, timeIndex);
+        if (positionGenerationMethod_a == STATIONARY) {
+            velocityVector = DetermineStationaryVector(timeIndex, returnFrame, true);
+        } else {
+            velocityVector = (ptrPositionStateArray_a->at(timeIndex))
+                             ->GetVelocity(returnFrame, timeIndex);
+        }
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetVelocity(int, const REFERENCE_FRAME&)");
         throw;
@@ -344,13 +393,20 @@ Journey::GetInterimVelocity(int timeIndex,
     const double totalSeconds = (double)TimePiece::GetSecondsPerTimeStep();
     SpaceVector  interimVelocity;
 
-    if ((additionalSeconds == 0.0) || (positionGenerationMethod_a == STATIONARY)) {
+    if (positionGenerationMethod_a == STATIONARY) {
+        interimVelocity = DetermineStationaryVector(timeIndex,
+                          UnitData::GetInternalReferenceFrame(), true);
+    } else if (additionalSeconds == 0.0) {
         interimVelocity = GetVelocity(timeIndex);
     } else if (timeIndex < TimePiece::GetEndIndexTime()) {
         try {
-            interimVelocity = PositionUtility::DetermineInterimPosition(GetVelocity(timeIndex),
-                              GetVelocity(timeIndex + 1),
-                              totalSeconds, additionalSeconds);
+            if (UsesHermiteInterpolation() == true) {
+                interimVelocity = DetermineHermiteVector(timeIndex, additionalSeconds, true);
+            } else {
+                interimVelocity = PositionUtility::DetermineInterimPosition(GetVelocity(timeIndex),
+                                  GetVelocity(timeIndex + 1),
+                                  totalSeconds, additionalSeconds);
+            }
         } catch (Exception *ptrError) {
             ptrError->AddMethod(GetClassName(),
                                 "GetInterimVelocity(int, const double&)");
@@ -363,6 +419,229 @@ Journey::GetInterimVelocity(int timeIndex,
 
 /* ************************************************************************************************** */
 
+bool
+Journey::UsesHermiteInterpolation() const
+{
+    // moving treks carry ground relative velocities, so they stay on the
+    // great circle interpolation regardless of the selected method
+    return((GetState().interimMethod == HERMITE) && (positionGenerationMethod_a != MOVING) &&
+           (positionGenerationMethod_a != STATIONARY));
+}
+
+/* ************************************************************************************************** */
+
+void
+Journey::BuildHermiteCoefficients() const
+{
+    const int    coefficientSize = PositionUtility::HERMITE_SIZE_s;
+    const double totalSeconds = (double)TimePiece::GetSecondsPerTimeStep();
+    const int    numberOfIntervals = GetNumberOfPositionStates() - 1;
+    shared_ptr<vector<double>> ptrCoefficients = NULL;
+
+    if (numberOfIntervals <= 0) {
+        return;
+    }
+
+    try {
+        int         timeIndex = 0;
+        // states are interpolated in ECI where the stored velocity is the
+        // true derivative of the position
+        SpaceVector startPosition = GetPosition(timeIndex, EARTH_CENTER_INERTIAL);
+        SpaceVector startVelocity = GetVelocity(timeIndex, EARTH_CENTER_INERTIAL);
+        SpaceVector endPosition;
+        SpaceVector endVelocity;
+        ptrCoefficients = shared_ptr<vector<double>>(new vector<double>(numberOfIntervals * coefficientSize));
+
+        while (timeIndex < numberOfIntervals) {
+            endPosition = GetPosition(timeIndex + 1, EARTH_CENTER_INERTIAL);
+            endVelocity = GetVelocity(timeIndex + 1, EARTH_CENTER_INERTIAL);
+            PositionUtility::DetermineHermiteCoefficients(startPosition, startVelocity,
+                    endPosition, endVelocity, totalSeconds,
+                    &(*ptrCoefficients)[timeIndex * coefficientSize]);
+            startPosition = endPosition;
+            startVelocity = endVelocity;
+            ++timeIndex;
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "BuildHermiteCoefficients()");
+        throw;
+    }
+
+    atomic_store(&ptrHermiteCoefficients_a, ptrCoefficients);
+    return;
+}
+
+/* ************************************************************************************************** */
+
+SpaceVector
+Journey::DetermineHermiteVector(int timeIndex,
+                                double additionalSeconds,
+                                bool returnVelocity) const
+{
+    const double totalSeconds = (double)TimePiece::GetSecondsPerTimeStep();
+    const double j2000Time = TimePiece::GetJ2000Time(timeIndex) + additionalSeconds;
+    SpaceVector  hermiteVector;
+    shared_ptr<vector<double>> ptrCoefficients = atomic_load(&ptrHermiteCoefficients_a);
+
+    if (ptrCoefficients == NULL) {
+        lock_guard<mutex> hermiteLock(hermiteMutex_s);
+        // another thread may have built them while this one waited
+        ptrCoefficients = atomic_load(&ptrHermiteCoefficients_a);
+
+        if (ptrCoefficients == NULL) {
+            BuildHermiteCoefficients();
+            ptrCoefficients = atomic_load(&ptrHermiteCoefficients_a);
+        }
+    }
+
+    hermiteVector = PositionUtility::EvaluateHermiteCoefficients(
+                        &(*ptrCoefficients)[timeIndex * PositionUtility::HERMITE_SIZE_s],
+                        totalSeconds, additionalSeconds, returnVelocity);
+    return(hermiteVector.ConvertTo(UnitData::GetInternalReferenceFrame(), j2000Time));
+}
+
+/* ************************************************************************************************** */
+
+SpaceVector
+Journey::DetermineStationaryVector(int timeIndex,
+                                   const REFERENCE_FRAME &returnFrame,
+                                   bool returnVelocity) const
+{
+    const PositionState &positionState = *(ptrPositionStateArray_a->at(0));
+    const SpaceVector   &fixedPosition = *(positionState.GetPosition());
+    SpaceVector          stationaryVector(returnFrame);
+
+    // interim times are served at the time step, an inertial state as stored
+    if (fixedPosition.GetReferenceFrame() == EARTH_CENTER_INERTIAL) {
+        if (returnVelocity == true) {
+            stationaryVector = positionState.GetVelocity(returnFrame, timeIndex);
+        } else {
+            stationaryVector = positionState.GetPosition(returnFrame, timeIndex);
+        }
+    } else if (returnFrame == EARTH_CENTER_INERTIAL) {
+        // the inertial velocity of an Earth fixed point is omega x r (this
+        // used to be the rotated zero vector), only the rotation is per call
+        if (returnVelocity == true) {
+            stationaryVector = ptrFixedVelocity_a->ConvertTo(EARTH_CENTER_INERTIAL, timeIndex);
+        } else {
+            stationaryVector = fixedPosition.ConvertTo(EARTH_CENTER_INERTIAL, timeIndex);
+        }
+    } else if (returnVelocity == false) {
+        // Earth fixed frames do not depend on the time
+        if (fixedPosition.GetReferenceFrame() == returnFrame) {
+            stationaryVector = fixedPosition;
+        } else {
+            stationaryVector = fixedPosition.ConvertTo(returnFrame, 0.0);
+        }
+    }
+
+    return(stationaryVector);
+}
+
+/* ************************************************************************************************** */
+
+double
+Journey::EstimateHermiteError() const
+{
+    const double doubleSeconds = 2.0 * (double)TimePiece::GetSecondsPerTimeStep();
+    const int    lastIndex = GetNumberOfPositionStates() - 2;
+    vector<double> coefficients(PositionUtility::HERMITE_SIZE_s);
+    double       maximumError = 0.0;
+
+    try {
+        int timeIndex = 0;
+
+        while (timeIndex < lastIndex) {
+            PositionUtility::DetermineHermiteCoefficients(GetPosition(timeIndex, EARTH_CENTER_INERTIAL),
+                    GetVelocity(timeIndex, EARTH_CENTER_INERTIAL),
+                    GetPosition(timeIndex + 2, EARTH_CENTER_INERTIAL),
+                    GetVelocity(timeIndex + 2, EARTH_CENTER_INERTIAL),
+                    doubleSeconds, &coefficients[0]);
+            maximumError = std::max(maximumError,
+                                    (PositionUtility::EvaluateHermiteCoefficients(&coefficients[0], doubleSeconds,
+                                            (0.5 * doubleSeconds), false)
+                                     - GetPosition(timeIndex + 1, EARTH_CENTER_INERTIAL)).GetMagnitude());
+            ++timeIndex;
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "EstimateHermiteError()");
+        throw;
+    }
+
+    // the cubic Hermite error grows with the fourth power of the step
+    return(maximumError / 16.0);
+}
+
+/* ************************************************************************************************** */
+
+double
+Journey::DetermineMaximumTimeStep(double maximumPositionError) const
+{
+    const double totalSeconds = (double)TimePiece::GetSecondsPerTimeStep();
+    double       maximumTimeStep = totalSeconds * (double)TimePiece::GetNumberOfTimeSteps();
+
+    try {
+        const double estimatedError = EstimateHermiteError();
+
+        if (estimatedError > 0.0) {
+            maximumTimeStep = std::min(maximumTimeStep,
+                                       totalSeconds * pow((maximumPositionError / estimatedError), 0.25));
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "DetermineMaximumTimeStep(double)");
+        throw;
+    }
+
+    return(maximumTimeStep);
+}
+
+/* ************************************************************************************************** */
+
+void
+Journey::BuildEclipseTimeline() const
+{
+    try {
+        atomic_store(&ptrEclipseTimeline_a, shared_ptr<EclipseTimeline>(new EclipseTimeline(*this)));
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "BuildEclipseTimeline()");
+        throw;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************** */
+
+const EclipseTimeline&
+Journey::GetEclipseTimeline() const
+{
+    shared_ptr<EclipseTimeline> ptrTimeline = atomic_load(&ptrEclipseTimeline_a);
+
+    if (ptrTimeline == NULL) {
+        // its own lock, building the timeline takes hermiteMutex_s for the interim positions
+        lock_guard<mutex> eclipseLock(eclipseMutex_s);
+        // another thread may have built it while this one waited
+        ptrTimeline = atomic_load(&ptrEclipseTimeline_a);
+
+        if (ptrTimeline == NULL) {
+            BuildEclipseTimeline();
+            ptrTimeline = atomic_load(&ptrEclipseTimeline_a);
+        }
+    }
+
+    return(*ptrTimeline);
+}
+
+/* ************************************************************************************************** */
+
+bool
+Journey::IsInLight(int timeIndex) const
+{
+    return(GetEclipseTimeline().IsInLight(timeIndex));
+}
+
+/* ************************************************************************************************** */
+
 int
 Journey::GetNumberOfPositionStates() const
 {
@@ -376,6 +655,40 @@ Journey::GetNumberOfPositionStates() const
     return numberOfPositionStates;
 }
 
+size_t
+Journey::GetMemoryFootprint() const
+{
+    size_t footprint = sizeof(*this);
+    const shared_ptr<vector<double>> ptrCoefficients = atomic_load(&ptrHermiteCoefficients_a);
+
+    if (ptrPositionStateArray_a != NULL) {
+        MURALTypes::PositionStateVector::const_iterator stateIter;
+        footprint += (ptrPositionStateArray_a->capacity() * sizeof(shared_ptr<PositionState>));
+
+        for (stateIter = ptrPositionStateArray_a->begin(); stateIter != ptrPositionStateArray_a->end(); ++stateIter) {
+            if ((*stateIter) != NULL) {
+                footprint += (sizeof(PositionState) + (2 * sizeof(SpaceVector)));
+            }
+        }
+    }
+
+    if (ptrCoefficients != NULL) {
+        footprint += (ptrCoefficients->capacity() * sizeof(double));
+    }
+
+    const shared_ptr<EclipseTimeline> ptrTimeline = atomic_load(&ptrEclipseTimeline_a);
+
+    if (ptrTimeline != NULL) {
+        footprint += ptrTimeline->GetMemoryFootprint();
+    }
+
+    if (ptrTopocentricFrame_a != NULL) {
+        footprint += (sizeof(CoordinateFrame) + (3 * sizeof(SpaceVector)));
+    }
+
+    return(footprint);
+}
+
 /* ************************************************************************************************** */
 
 shared_ptr<PositionState>
@@ -466,6 +779,23 @@ Journey::ConvertPositionMethod(const string &positionMethodString)
 
 /* ******************************************************************************** */
 
+Journey::INTERIM_METHOD
+Journey::ConvertInterimMethod(const string &methodString)
+{
+    INTERIM_METHOD interimMethod = GREAT_CIRCLE;
+
+    if (methodString == "HERMITE") {
+        interimMethod = HERMITE;
+    } else if (methodString != "GREAT_CIRCLE") {
+        throw new InputException(GetClassName(), "ConvertInterimMethod(const string&)",
+                                 ("Invalid interim method '" + methodString + "'"));
+    }
+
+    return(interimMethod);
+}
+
+/* ******************************************************************************** */
+
 string
 Journey::GetGenerationMethodString(const POSITION_METHOD &positionMethod)
 {
@@ -489,6 +819,14 @@ Journey::GetGenerationMethodString(const POSITION_METHOD &positionMethod)
 }
 
 /* ************************************************************************************* */
+Journey::State*
+Journey::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 Journey::~Journey()
 {
     return;
@@ -24,6 +24,7 @@
 #define JOURNEY_H "Journey"
 
 #include <fstream>
+#include <mutex>
 #include <vector>
 
 #include "mural/MURALTypes.h"
@@ -34,6 +35,8 @@
 
 using namespace std;
 
+class CoordinateFrame;
+class EclipseTimeline;
 class InputDataElement;
 class Revolution;
 class SpaceVector;
@@ -48,6 +51,17 @@ class PositionState;
  * ptrPositionStateArray_a*    an array of pointer(s) to PositionState
  *                               instances for each time index (non-STATIONARY)
  *                               or single instance (STATIONARY)
+ * ptrHermiteCoefficients_a*   cached cubic Hermite coefficients (ECI) for each
+ *                               time step interval, built on first use
+ * ptrEclipseTimeline_a*       cached shadow intervals over the time horizon,
+ *                               built on first use
+ * ptrTopocentricFrame_a*      the fixed ground frame of a STATIONARY journey
+ *                               (Earth fixed internal frame only), built when
+ *                               its state is set
+ * ptrFixedVelocity_a*         the Earth fixed omega x r of a STATIONARY journey
+ *                               stored Earth fixed, set with its state and
+ *                               rotated to ECI on each inertial velocity
+ * State::interimMethod        the INTERIM_METHOD used between time steps
  *
  * @author Brian Fowler
  * @date 12/20/2011
@@ -66,6 +80,28 @@ public:
         MOVING = 5
     };
 
+    enum INTERIM_METHOD {
+        GREAT_CIRCLE = 0,
+        HERMITE = 1
+    };
+
+    /**
+     * The interpolation settings of a scenario.  Each ScenarioContext holds
+     *  its own, threads with no context bound share the process wide default.
+     */
+    struct State {
+        INTERIM_METHOD interimMethod = GREAT_CIRCLE;
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     Journey();
     Journey(const Journey &copyMe);
     virtual ~Journey();
@@ -104,6 +140,64 @@ public:
 
     shared_ptr<PositionState> GetPositionStateAt(int timeIndex) const;
 
+    /**
+     * Estimates the bytes held by this journey: the position states (with
+     * their position and velocity vectors), any cached Hermite coefficients
+     * and any cached shadow intervals.
+     *
+     * @return the footprint (bytes)
+     */
+    size_t GetMemoryFootprint() const;
+
+    /**
+     * Builds the cubic Hermite coefficients for every time step interval from
+     * the stored positions and velocities.  Called on first use by the interim
+     * methods (under a lock, so concurrent first calls build them once); call
+     * it up front to keep the build out of the threaded link generation.
+     */
+    void   BuildHermiteCoefficients() const;
+
+    /**
+     * Estimates the largest Hermite interpolation position error (internal
+     * distance units) at the current time step size.  Each interval pair is
+     * interpolated across the doubled step and compared to the stored middle
+     * state; the fourth order remainder then scales that back by 1/16.
+     *
+     * @return the estimated maximum position error
+     */
+    double EstimateHermiteError() const;
+
+    /**
+     * Recommends the largest time step (seconds) whose estimated Hermite
+     * position error does not exceed the given bound.
+     *
+     * @param maximumPositionError the error bound (internal distance units)
+     * @return the recommended seconds per time step
+     */
+    double DetermineMaximumTimeStep(double maximumPositionError) const;
+
+    /**
+     * Builds the shadow intervals over the whole time horizon.  Called on
+     * first use by the eclipse methods (under eclipseMutex_s).
+     */
+    void   BuildEclipseTimeline() const;
+
+    /**
+     * Gets the shadow intervals over the whole time horizon
+     *
+     * @return const EclipseTimeline&
+     */
+    const EclipseTimeline& GetEclipseTimeline() const;
+
+    /**
+     * Determines if the center of the Sun is visible at the time index, a
+     * binary search of the shadow intervals (see Sun::IsInLight)
+     *
+     * @param timeIndex the time index
+     * @return true if the center of the Sun is not occulted by the Earth
+     */
+    bool   IsInLight(int timeIndex) const;
+
     virtual inline int GetNumberOfRevs() const;
     virtual inline double GetSemiMajorAxis() const;
     virtual inline double GetEccentricity() const;
@@ -129,6 +223,14 @@ public:
 
     inline bool   IsStationaryPosition() const;
 
+    /**
+     * Gets the topocentric frame (X north, Y west, Z overhead) of a STATIONARY
+     * journey, NULL when the journey moves or the internal frame is inertial
+     *
+     * @return shared_ptr<const CoordinateFrame>
+     */
+    inline shared_ptr<const CoordinateFrame> GetTopocentricFrame() const;
+
     inline const Journey::POSITION_METHOD GetGenerationMethod() const;
 
     /**
@@ -145,16 +247,64 @@ public:
      * @return POSITION_METHOD
      */
     static string GetGenerationMethodString(const POSITION_METHOD &positionMethod);
+
+    /**
+     * Method to convert from a string to an INTERIM_METHOD enum
+     *
+     * @param &methodString string to convert
+     */
+    static INTERIM_METHOD ConvertInterimMethod(const string &methodString);
+
+    static inline void SetInterimMethod(INTERIM_METHOD interimMethod);
+
+    static inline INTERIM_METHOD GetInterimMethod();
+
 protected:
 
     POSITION_METHOD                             positionGenerationMethod_a;
     shared_ptr<MURALTypes::PositionStateVector> ptrPositionStateArray_a;
+    mutable shared_ptr<vector<double>>          ptrHermiteCoefficients_a;
+    mutable shared_ptr<EclipseTimeline>         ptrEclipseTimeline_a;
+    shared_ptr<const CoordinateFrame>           ptrTopocentricFrame_a;
+    shared_ptr<const SpaceVector>               ptrFixedVelocity_a;
 
 private:
 
+    bool        UsesHermiteInterpolation() const;
+
+    SpaceVector DetermineHermiteVector(int timeIndex,
+                                       double additionalSeconds,
+                                       bool returnVelocity) const;
+
+    SpaceVector DetermineStationaryVector(int timeIndex,
+                                          const REFERENCE_FRAME &returnFrame,
+                                          bool returnVelocity) const;
+
     static inline string GetClassName();
+
+    static inline State& GetState();
+
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
+    static mutex                hermiteMutex_s;
+    static mutex                eclipseMutex_s;
 };
 
+inline
+void
+Journey::SetInterimMethod(INTERIM_METHOD interimMethod)
+{
+    GetState().interimMethod = interimMethod;
+    return;
+}
+
+inline
+Journey::INTERIM_METHOD
+Journey::GetInterimMethod()
+{
+    return(GetState().interimMethod);
+}
+
 inline
 bool
 Journey::IsStationaryPosition() const
@@ -162,6 +312,13 @@ Journey::IsStationaryPosition() const
     return(positionGenerationMethod_a == STATIONARY);
 }
 
+inline
+shared_ptr<const CoordinateFrame>
+Journey::GetTopocentricFrame() const
+{
+    return(ptrTopocentricFrame_a);
+}
+
 inline
 int
 Journey::GetNumberOfRevs() const
@@ -260,6 +417,13 @@ Journey::GetRevolutionList() const
     return(NULL);
 }
 
+inline
+Journey::State&
+Journey::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
+}
+
 inline
 string
 Journey::GetClassName()
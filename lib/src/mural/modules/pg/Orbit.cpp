@@ -20,6 +20,9 @@
  *============================================================================================*/
 
 
+#include <cmath>
+#include <vector>
+
 #include "Orbit.h"
 #include "Revolution.h"
 #include "PositionUtility.h"
@@ -34,6 +37,7 @@
 #include "general/data/PositionState.h"
 #include "general/data/InputData.h"
 #include "general/data/InputDataElement.h"
+#include "general/utility/TaskScheduler.h"
 
 // From General Engineering
 #include "constants.h"
@@ -45,6 +49,7 @@
 #include "IERS96.h"
 #include "GenUtility.h"
 
+const int    Orbit::BATCH_KEPLER_ITERATIONS_s = 8;
 const double Orbit::J2_s = 1082.629989e-6;
 const double Orbit::J4_s = -1.610988e-6;
 
@@ -306,7 +311,7 @@ Orbit::ConvertMeanVectors(const SpaceVector &positionVector,
         double crossMagnitude;
         double positionMagnitude;
         double velocityMagnitude;
-        cout << "MURALInputProcessor(Orbit Conversion): Interpret State Vector as Mean" << NEW_LINE;
+        TaskScheduler::WriteLine(cout, "MURALInputProcessor(Orbit Conversion): Interpret State Vector as Mean");
         PositionState positionState(positionVector, velocityVector);
         // make sure the vectors are in ECI
         positionVectorECI = positionState.GetPositionECI(epochTime_a);
@@ -348,7 +353,7 @@ void
 Orbit::ConvertOsculatingVectors(const SpaceVector &positionVector,
                                 const SpaceVector &velocityVector)
 {
-    cout << "MURALInputProcessor(Orbit Conversion): Converting Osculating State Vector to Mean" << NEW_LINE;
+    TaskScheduler::WriteLine(cout, "MURALInputProcessor(Orbit Conversion): Converting Osculating State Vector to Mean");
     A3::VectorCartesian posVector(positionVector.GetX(), positionVector.GetY(), positionVector.GetZ());
     A3::VectorCartesian velVector(velocityVector.GetX(), velocityVector.GetY(), velocityVector.GetZ());
     // Convert from MURAL units (meters) to GenEng units (nmi)
@@ -357,19 +362,20 @@ Orbit::ConvertOsculatingVectors(const SpaceVector &positionVector,
     velVector *= METERS_TO_NMI;
 
     if ( jplRequired_a == true ) {
-        cout << "MURALInputProcessor(Orbit Conversion): Found JPL Files.  Converting from J2000 to True of Date" << NEW_LINE;
+        TaskScheduler::WriteLine(cout, "MURALInputProcessor(Orbit Conversion): Found JPL Files.  Converting from J2000 to True of Date");
         // Translation from J2000 to TOD
         A3::TimeJ2000 timeJ2000(epochTime_a);
-        A3::CoorTransDcm J2000ToModDCM;
+        A3::Matrix3 J2000ToModDCM;
         A3::IERS96::dcmJ2000ToMod(timeJ2000, J2000ToModDCM);
-        J2000ToModDCM.Multiply(posVector, posVector);
-        J2000ToModDCM.Multiply(velVector, velVector);
-        A3::CoorTransDcm ModToTodDCM;
+        A3::Matrix3 ModToTodDCM;
         A3::IERS96::dcmModToTod(timeJ2000, ModToTodDCM);
-        ModToTodDCM.Multiply(posVector, posVector);
-        ModToTodDCM.Multiply(velVector, velVector);
+        // Matrix3::Multiply reads the whole input before writing, so the
+        // vectors may be rotated in place
+        const A3::Matrix3 J2000ToTodDCM(ModToTodDCM * J2000ToModDCM);
+        J2000ToTodDCM.Multiply(posVector, posVector);
+        J2000ToTodDCM.Multiply(velVector, velVector);
     } else {
-        cout << "MURALInputProcessor(Orbit Conversion): Did not find JPL File.  Assuming vector is already in True of Date" << NEW_LINE;
+        TaskScheduler::WriteLine(cout, "MURALInputProcessor(Orbit Conversion): Did not find JPL File.  Assuming vector is already in True of Date");
     }
 
     // Create data object for GenEng with the osculating elements
@@ -508,6 +514,80 @@ Orbit::AnomalyConverter(double inputAnomaly,
     return(outputAnomaly);
 }
 
+//------------------------------------------------------------------------------
+//
+//  Method Name: Orbit::ConvertMeanToTrueAnomalies
+//
+//  Purpose:
+//    Converts an array of mean anomalies to true anomalies.  Same algorithm as
+//    the MEAN_TO_TRUE path of AnomalyConverter, but each stage runs as its own
+//    loop over the whole array and Kepler's equation gets a fixed
+//    BATCH_KEPLER_ITERATIONS_s Newton iterations (converged to round off for
+//    eccentricities up to 0.9) instead of stopping at a 1.0e-7 change.
+//
+//------------------------------------------------------------------------------
+
+void
+Orbit::ConvertMeanToTrueAnomalies(const double *ptrMeanAnomaly,
+                                  int numberOfAnomalies,
+                                  double eccentricity,
+                                  double *ptrTrueAnomaly)
+{
+    int          index = 0;
+    const double fullCircle = UnitData::GetStoreFullCircle();
+
+    if ((eccentricity < 0.0) || (eccentricity >= 1.0)) {
+        // matches AnomalyConverter, which flags invalid input with -1
+        while (index < numberOfAnomalies) {
+            ptrTrueAnomaly[index] = -1.0;
+            ++index;
+        }
+
+        return;
+    }
+
+    const double term = SimpleMath::SquareRoot((1.0 + eccentricity) / (1.0 - eccentricity));
+
+    // range reduction and initial guess
+    for (index = 0; index < numberOfAnomalies; ++index) {
+        const double meanAnomaly = fmod(ptrMeanAnomaly[index] + (3.0 * fullCircle), fullCircle);
+        ptrTrueAnomaly[index] = meanAnomaly;
+    }
+
+    // ptrTrueAnomaly holds the mean anomaly until the eccentric anomaly is known
+    vector<double> eccentricAnomaly(ptrTrueAnomaly, ptrTrueAnomaly + numberOfAnomalies);
+
+    for (index = 0; index < numberOfAnomalies; ++index) {
+        eccentricAnomaly[index] = ptrTrueAnomaly[index] + eccentricity * sin(ptrTrueAnomaly[index]);
+    }
+
+    for (int iteration = 0; iteration < BATCH_KEPLER_ITERATIONS_s; ++iteration) {
+        for (index = 0; index < numberOfAnomalies; ++index) {
+            const double anomaly = eccentricAnomaly[index];
+            eccentricAnomaly[index] = anomaly - (anomaly - eccentricity * sin(anomaly)
+                                                 - ptrTrueAnomaly[index])
+                                      / (1.0 - eccentricity * cos(anomaly));
+        }
+    }
+
+    // eccentric to true anomaly
+    for (index = 0; index < numberOfAnomalies; ++index) {
+        const double anomaly = eccentricAnomaly[index];
+        const double temp = anomaly - PI;
+        double       trueAnomaly = 0.0;
+
+        if (fabs(temp) < 1.0e-5) {
+            trueAnomaly = temp / term - (temp >= 0.0 ? PI : -PI);
+        } else {
+            trueAnomaly = 2.0 * atan(term * tan(0.5 * anomaly));
+        }
+
+        ptrTrueAnomaly[index] = (trueAnomaly < 0.0) ? (trueAnomaly + fullCircle) : trueAnomaly;
+    }
+
+    return;
+}
+
 void
 Orbit::DetermineRevolutionTimes()
 {
@@ -20,6 +20,9 @@
  *============================================================================================*/
 
 
+#include <algorithm>
+#include <vector>
+
 #include "PositionGenerator.h"
 #include "mural/Earth.h"
 #include "mural/io/FileNames.h"
@@ -36,6 +39,7 @@
 #include "general/parse/ParseUtility.h"
 #include "general/data/PositionState.h"
 #include "general/utility/Constant.h"
+#include "general/utility/TaskScheduler.h"
 
 PositionGenerator::PositionGenerator()
 {
@@ -50,43 +54,50 @@ PositionGenerator::PositionGenerator(const PositionGenerator &copyMe)
 void
 PositionGenerator::GeneratePositions(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection)
 {
-    string                                      designator = "";
-    shared_ptr<Journey>                         ptrJourney = NULL;
-    Orbit                                      *ptrOrbit = NULL;
     shared_ptr<MURALTypes::DataProviderVector>  ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
-    shared_ptr<DataProvider>                    ptrDataProvider = NULL;
-    shared_ptr<UserVehicle>                     ptrTrailVehicle = NULL;
 
     try {
         vector<shared_ptr<DataProvider>>::iterator dataProviderIter;
 
         for( dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
-            bool dataCollector;
-            ptrDataProvider = (*dataProviderIter);
-            ptrJourney = ptrDataProvider->GetJourney();
-            designator = ptrDataProvider->GetDesignator();
-            dataCollector = false;
-            shared_ptr<UserVehicle> ptrUserVehicle(dynamic_pointer_cast<UserVehicle>(ptrDataProvider));
-
-            if (ptrUserVehicle != NULL) {
-                dataCollector = true;
-            }
+            GenerateProviderPositions(*dataProviderIter);
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(), "GenerateOrbits(LinkList<DataProvider>*)");
+        throw;
+    }
 
-            DeterminePositionData(ptrJourney, designator, dataCollector);
+    return;
+}
 
-            // if this is an orbiting data collector, determine it's revolutions
-            if (ptrUserVehicle != NULL) {
-                ptrTrailVehicle = ptrUserVehicle->GetTrailVehicle();
+void
+PositionGenerator::GenerateProviderPositions(const shared_ptr<DataProvider> &ptrDataProvider)
+{
+    bool                    dataCollector = false;
+    shared_ptr<Journey>     ptrJourney = ptrDataProvider->GetJourney();
+    string                  designator = ptrDataProvider->GetDesignator();
+    shared_ptr<UserVehicle> ptrUserVehicle(dynamic_pointer_cast<UserVehicle>(ptrDataProvider));
+    shared_ptr<UserVehicle> ptrTrailVehicle = NULL;
+
+    try {
+        if (ptrUserVehicle != NULL) {
+            dataCollector = true;
+        }
+
+        DeterminePositionData(ptrJourney, designator, dataCollector);
+
+        // if this is an orbiting data collector, determine it's revolutions
+        if (ptrUserVehicle != NULL) {
+            ptrTrailVehicle = ptrUserVehicle->GetTrailVehicle();
 
-                if (ptrTrailVehicle != NULL) {
-                    ptrJourney = ptrTrailVehicle->GetJourney();
-                    designator = ptrTrailVehicle->GetDesignator();
-                    DeterminePositionData(ptrJourney, designator, dataCollector);
-                }
+            if (ptrTrailVehicle != NULL) {
+                ptrJourney = ptrTrailVehicle->GetJourney();
+                designator = ptrTrailVehicle->GetDesignator();
+                DeterminePositionData(ptrJourney, designator, dataCollector);
             }
         }
     } catch (Exception *ptrError) {
-        ptrError->AddMethod(GetClassName(), "GenerateOrbits(LinkList<DataProvider>*)");
+        ptrError->AddMethod(GetClassName(), "GenerateProviderPositions(const shared_ptr<DataProvider>&)");
         throw;
     }
 
@@ -100,11 +111,20 @@ PositionGenerator::DeterminePositionData(const shared_ptr<Journey> &ptrJourney,
 {
     shared_ptr<Orbit> ptrOrbit(dynamic_pointer_cast<Orbit>(ptrJourney));
     shared_ptr<Trek>  ptrTrek(dynamic_pointer_cast<Trek>(ptrJourney));
+    // states are only present up front when restored from a position checkpoint
+    const bool        restoredStates = (ptrJourney->GetNumberOfPositionStates() > 0);
 
     try {
+        if (restoredStates == true) {
+            TaskScheduler::WriteLine(cout, "PositionGenerator: Using Checkpoint Positions For " + designator);
+        }
+
         if (ptrJourney->GetGenerationMethod() == Journey::READ_MURAL) {
-            cout << "PositionGenerator: Retrieving Position Data For " << designator << NEW_LINE;
-            PositionUtility::RetrievePositionData(FileNames::GetFileName(FileNames::POSITION_INPUTFILE), designator, ptrJourney);
+            if (restoredStates == false) {
+                TaskScheduler::WriteLine(cout, "PositionGenerator: Retrieving Position Data For " + designator);
+                PositionUtility::RetrievePositionData(FileNames::GetFileName(FileNames::POSITION_INPUTFILE), designator, ptrJourney);
+            }
+
             ptrJourney->CheckPositionStates(designator);
 
             // if this is an Orbit and positions are READ in, determine the classical elements
@@ -113,8 +133,11 @@ PositionGenerator::DeterminePositionData(const shared_ptr<Journey> &ptrJourney,
                 ptrOrbit->CalculateClassicalElements();
             }
         } else if (ptrJourney->GetGenerationMethod() == Journey::READ_P470) {
-            cout << "PositionGenerator: Retrieving P470 Position Data For " << designator << NEW_LINE;
-            PositionUtility::RetrieveP470PositionData(FileNames::GetFileName(FileNames::POSITION_P470_INPUTFILE), designator, ptrJourney);
+            if (restoredStates == false) {
+                TaskScheduler::WriteLine(cout, "PositionGenerator: Retrieving P470 Position Data For " + designator);
+                PositionUtility::RetrieveP470PositionData(FileNames::GetFileName(FileNames::POSITION_P470_INPUTFILE), designator, ptrJourney);
+            }
+
             ptrJourney->CheckPositionStates(designator);
 
             // if this is an Orbit and positions are READ in, determine the classical elements
@@ -123,21 +146,26 @@ PositionGenerator::DeterminePositionData(const shared_ptr<Journey> &ptrJourney,
                 ptrOrbit->CalculateClassicalElements();
             }
         } else if (ptrOrbit != NULL) {
-            cout << "PositionGenerator: Generating Ephemeris For " << designator << NEW_LINE;
             // The Calculate Perturbations used to be done during parsing and constructing of the orbit
             ptrOrbit->CalculatePerturbations();
-            GenerateEphemeris(ptrOrbit);
+
+            if (restoredStates == false) {
+                TaskScheduler::WriteLine(cout, "PositionGenerator: Generating Ephemeris For " + designator);
+                GenerateEphemeris(ptrOrbit);
+            }
         } else if (ptrTrek != NULL) {
             // This method retrieves the trek from the trek file (moving)
             // or sets the trek's node for each timestep (stationary)
             ptrTrek->CreateTrek();
 
             // Populate the PositionStates for the Trek
-            if (ptrTrek->GetGenerationMethod() == Journey::STATIONARY) {
-                cout << "PositionGenerator: Generating Stationary Trek For " << designator << NEW_LINE;
+            if (restoredStates == true) {
+                ptrTrek->CheckPositionStates(designator);
+            } else if (ptrTrek->GetGenerationMethod() == Journey::STATIONARY) {
+                TaskScheduler::WriteLine(cout, "PositionGenerator: Generating Stationary Trek For " + designator);
                 PositionUtility::GenerateStationaryTrek(ptrTrek);
             } else if (ptrTrek->GetGenerationMethod() == Journey::MOVING) {
-                cout << "PositionGenerator: Generating Moving Trek For " << designator << NEW_LINE;
+                TaskScheduler::WriteLine(cout, "PositionGenerator: Generating Moving Trek For " + designator);
                 PositionUtility::GenerateMovingTrek(ptrTrek);
             }
         }
@@ -158,19 +186,40 @@ PositionGenerator::DeterminePositionData(const shared_ptr<Journey> &ptrJourney,
 void
 PositionGenerator::GenerateEphemeris(const shared_ptr<Orbit> &ptrOrbit)
 {
+    // time steps propagated per call to PositionUtility::GeneratePositionStates
+    const int                 batchSize = 4096;
     const int                 numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    const int                 stateSize = PositionUtility::STATE_SIZE_s;
+    const REFERENCE_FRAME     storeFrame = UnitData::GetInternalReferenceFrame();
+    vector<double>            j2000Times(std::min(batchSize, numberOfTimeSteps));
+    vector<double>            stateBuffer(j2000Times.size() * stateSize);
     shared_ptr<PositionState> ptrPositionState = NULL;
 
     try {
-        int timeIndex = 0;
-
-        while (timeIndex < numberOfTimeSteps) {
-            double j2000Time;
-            j2000Time = TimePiece::GetJ2000Time(timeIndex);
-            ptrPositionState = PositionUtility::GeneratePositionState(ptrOrbit, j2000Time);
-            ptrOrbit->SetPositionState(timeIndex, ptrPositionState);
-            ptrPositionState = NULL;
-            ++timeIndex;
+        int startIndex = 0;
+
+        while (startIndex < numberOfTimeSteps) {
+            const int numberInBatch = std::min(batchSize, numberOfTimeSteps - startIndex);
+            int       batchIndex = 0;
+
+            while (batchIndex < numberInBatch) {
+                j2000Times[batchIndex] = TimePiece::GetJ2000Time(startIndex + batchIndex);
+                ++batchIndex;
+            }
+
+            PositionUtility::GeneratePositionStates(ptrOrbit, &j2000Times[0], numberInBatch, &stateBuffer[0]);
+            batchIndex = 0;
+
+            while (batchIndex < numberInBatch) {
+                const double *ptrState = &stateBuffer[batchIndex * stateSize];
+                ptrPositionState = shared_ptr<PositionState>(new PositionState(ptrState[0], ptrState[1], ptrState[2],
+                                   ptrState[3], ptrState[4], ptrState[5], storeFrame));
+                ptrOrbit->SetPositionState(startIndex + batchIndex, ptrPositionState);
+                ptrPositionState = NULL;
+                ++batchIndex;
+            }
+
+            startIndex += numberInBatch;
         }
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GenerateEphemeris(Orbit*)");
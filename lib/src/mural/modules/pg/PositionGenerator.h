@@ -55,6 +55,15 @@ public:
 
     void   GeneratePositions(const shared_ptr<DataProviderCollection> &ptrDataProviderCollection);
 
+    /**
+     * Generates the positions of a single data provider (and its trail
+     * vehicle, if any).  Providers are independent of each other so this
+     * may be called concurrently for different providers.
+     *
+     * @param &ptrDataProvider the data provider to generate positions for
+     */
+    void   GenerateProviderPositions(const shared_ptr<DataProvider> &ptrDataProvider);
+
 protected:
 
 private:
@@ -20,6 +20,8 @@
  *============================================================================================*/
 
 
+#include <vector>
+
 #include "PositionUtility.h"
 #include "general/array/ListIterator.h"
 #include "mural/modules/pg/Orbit.h"
@@ -33,6 +35,9 @@
 #include "general/math/SimpleMath.h"
 #include "general/math/SpaceVector.h"
 
+const int PositionUtility::STATE_SIZE_s = 6;
+const int PositionUtility::HERMITE_SIZE_s = 12;
+
 PositionUtility::PositionUtility()
 {
     return;
@@ -102,6 +107,120 @@ PositionUtility::GeneratePositionState(shared_ptr<Orbit> ptrOrbit,
 
 /* ******************************************************************************** */
 
+void
+PositionUtility::GeneratePositionStates(const shared_ptr<Orbit> &ptrOrbit,
+                                        const double *ptrJ2000Times,
+                                        int numberOfTimes,
+                                        double *ptrStateBuffer)
+{
+    const double   epochTime = ptrOrbit->GetEpochTime();
+    const double   inclination = ptrOrbit->GetInclination();
+    const double   eccentricity = ptrOrbit->GetEccentricity();
+    const double   rightAscension = ptrOrbit->GetRightAscension();
+    const double   argumentOfPerigee = ptrOrbit->GetArgumentOfPerigee();
+    const double   meanAnomaly = ptrOrbit->GetMeanAnomaly();
+    const double   semiLatusRectum = ptrOrbit->GetSemiLatusRectum();
+    const double   apsidalRotation = ptrOrbit->GetApsidalRotationRate();
+    const double   nodalPrecession = ptrOrbit->GetNodalPrecessionRate();
+    const double   anomalisticMean = ptrOrbit->GetAnomalisticMeanMotion();
+    const double   vfactor = anomalisticMean * SimpleMath::SquareRoot(ptrOrbit->GetSemiMajorAxisCubed() / semiLatusRectum);
+    const double   cosInclination = cos(inclination);
+    const double   sinInclination = sin(inclination);
+    const REFERENCE_FRAME storeFrame = UnitData::GetInternalReferenceFrame();
+    vector<double> currentRA(numberOfTimes);
+    vector<double> currentAOP(numberOfTimes);
+    vector<double> trueAnomaly(numberOfTimes);
+    int            timeIndex = 0;
+
+    try {
+        // secular J2/J4 drift of the node, perigee and mean anomaly
+        for (timeIndex = 0; timeIndex < numberOfTimes; ++timeIndex) {
+            const double deltaTime = ptrJ2000Times[timeIndex] - epochTime;
+            currentRA[timeIndex] = MakeAngleBetweenZeroAndTwoPI(rightAscension + (deltaTime * nodalPrecession));
+            currentAOP[timeIndex] = MakeAngleBetweenZeroAndTwoPI(argumentOfPerigee + (deltaTime * apsidalRotation));
+            trueAnomaly[timeIndex] = MakeAngleBetweenZeroAndTwoPI(meanAnomaly + (deltaTime * anomalisticMean));
+        }
+
+        Orbit::ConvertMeanToTrueAnomalies(&trueAnomaly[0], numberOfTimes, eccentricity, &trueAnomaly[0]);
+
+        for (timeIndex = 0; timeIndex < numberOfTimes; ++timeIndex) {
+            const double cosineTrueAnomaly = cos(trueAnomaly[timeIndex]);
+            const double sineTrueAnomaly = sin(trueAnomaly[timeIndex]);
+            const double radius = semiLatusRectum / (1.0 + eccentricity * cosineTrueAnomaly);
+            const double cosRightAscension = cos(currentRA[timeIndex]);
+            const double sinRightAscension = sin(currentRA[timeIndex]);
+            const double cosArgumentOfPerigee = cos(currentAOP[timeIndex]);
+            const double sinArgumentOfPerigee = sin(currentAOP[timeIndex]);
+            // rows of the PQW to ECI rotation (see ConvertPQWToECI)
+            const double e00 = cosRightAscension*cosArgumentOfPerigee
+                               - sinRightAscension*sinArgumentOfPerigee*cosInclination;
+            const double e01 = - cosRightAscension*sinArgumentOfPerigee
+                               - sinRightAscension*cosArgumentOfPerigee*cosInclination;
+            const double e02 = sinRightAscension*sinInclination;
+            const double e10 = sinRightAscension*cosArgumentOfPerigee
+                               + cosRightAscension*sinArgumentOfPerigee*cosInclination;
+            const double e11 = - sinRightAscension*sinArgumentOfPerigee
+                               + cosRightAscension*cosArgumentOfPerigee*cosInclination;
+            const double e12 = - cosRightAscension*sinInclination;
+            const double e20 = sinArgumentOfPerigee * sinInclination;
+            const double e21 = cosArgumentOfPerigee * sinInclination;
+            const double e22 = cosInclination;
+            // position and velocity in the PQW system
+            const double pqwPositionX = radius * cosineTrueAnomaly;
+            const double pqwPositionY = radius * sineTrueAnomaly;
+            const double pqwVelocityX = -vfactor * sineTrueAnomaly;
+            const double pqwVelocityY = vfactor * (eccentricity + cosineTrueAnomaly);
+            const double positionX = (e00 * pqwPositionX) + (e01 * pqwPositionY) + (e02 * 0.0);
+            const double positionY = (e10 * pqwPositionX) + (e11 * pqwPositionY) + (e12 * 0.0);
+            const double positionZ = (e20 * pqwPositionX) + (e21 * pqwPositionY) + (e22 * 0.0);
+            double       velocityX = (e00 * pqwVelocityX) + (e01 * pqwVelocityY) + (e02 * 0.0);
+            double       velocityY = (e10 * pqwVelocityX) + (e11 * pqwVelocityY) + (e12 * 0.0);
+            double       velocityZ = (e20 * pqwVelocityX) + (e21 * pqwVelocityY) + (e22 * 0.0);
+            double      *ptrState = ptrStateBuffer + (timeIndex * STATE_SIZE_s);
+            // add apsidal rotation component to velocity
+            velocityX += (-apsidalRotation * (positionZ * cosRightAscension
+                                              * sinInclination - positionY * cosInclination));
+            velocityY += (apsidalRotation * (positionX * cosInclination
+                                             - positionZ * sinRightAscension * sinInclination));
+            velocityZ += (apsidalRotation * (positionY * sinRightAscension
+                                             + positionX * cosRightAscension) * sinInclination);
+            // add nodal rotation component to velocity
+            velocityX += (-nodalPrecession * positionY);
+            velocityY += (nodalPrecession * positionX);
+            velocityZ += 0.0;
+
+            if (storeFrame == EARTH_CENTER_INERTIAL) {
+                ptrState[0] = positionX;
+                ptrState[1] = positionY;
+                ptrState[2] = positionZ;
+                ptrState[3] = velocityX;
+                ptrState[4] = velocityY;
+                ptrState[5] = velocityZ;
+            } else {
+                const double j2000Time = ptrJ2000Times[timeIndex];
+                const SpaceVector position = SpaceVector(positionX, positionY, positionZ,
+                                             EARTH_CENTER_INERTIAL).ConvertTo(storeFrame, j2000Time);
+                const SpaceVector velocity = SpaceVector(velocityX, velocityY, velocityZ,
+                                             EARTH_CENTER_INERTIAL).ConvertTo(storeFrame, j2000Time);
+                ptrState[0] = position.GetX();
+                ptrState[1] = position.GetY();
+                ptrState[2] = position.GetZ();
+                ptrState[3] = velocity.GetX();
+                ptrState[4] = velocity.GetY();
+                ptrState[5] = velocity.GetZ();
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod(GetClassName(),
+                            "GeneratePositionStates(const shared_ptr<Orbit>&, const double*, int, double*)");
+        throw;
+    }
+
+    return;
+}
+
+/* ******************************************************************************** */
+
 void
 PositionUtility::RetrievePositionData(const string &positionFile,
                                       const string &designator,
@@ -450,6 +569,62 @@ PositionUtility::DetermineInterimPosition(const SpaceVector &startPosition,
 
 /* ******************************************************************************** */
 
+void
+PositionUtility::DetermineHermiteCoefficients(const SpaceVector &startPosition,
+        const SpaceVector &startVelocity,
+        const SpaceVector &endPosition,
+        const SpaceVector &endVelocity,
+        double totalSeconds,
+        double *ptrCoefficients)
+{
+    const double startP[3] = {startPosition.GetX(), startPosition.GetY(), startPosition.GetZ()};
+    const double startV[3] = {startVelocity.GetX(), startVelocity.GetY(), startVelocity.GetZ()};
+    const double endP[3] = {endPosition.GetX(), endPosition.GetY(), endPosition.GetZ()};
+    const double endV[3] = {endVelocity.GetX(), endVelocity.GetY(), endVelocity.GetZ()};
+    int          axis = 0;
+
+    for (axis = 0; axis < 3; ++axis) {
+        double *ptrAxis = ptrCoefficients + (axis * 4);
+        // velocities are scaled to the normalized interval time
+        const double startSlope = startV[axis] * totalSeconds;
+        const double endSlope = endV[axis] * totalSeconds;
+        ptrAxis[0] = startP[axis];
+        ptrAxis[1] = startSlope;
+        ptrAxis[2] = (3.0 * (endP[axis] - startP[axis])) - (2.0 * startSlope) - endSlope;
+        ptrAxis[3] = (2.0 * (startP[axis] - endP[axis])) + startSlope + endSlope;
+    }
+
+    return;
+}
+
+/* ******************************************************************************** */
+
+SpaceVector
+PositionUtility::EvaluateHermiteCoefficients(const double *ptrCoefficients,
+        double totalSeconds,
+        double currentSeconds,
+        bool returnVelocity)
+{
+    const double fraction = currentSeconds / totalSeconds;
+    double       component[3];
+    int          axis = 0;
+
+    for (axis = 0; axis < 3; ++axis) {
+        const double *ptrAxis = ptrCoefficients + (axis * 4);
+
+        if (returnVelocity == true) {
+            component[axis] = (ptrAxis[1] + fraction * ((2.0 * ptrAxis[2]) + fraction * (3.0 * ptrAxis[3])))
+                              / totalSeconds;
+        } else {
+            component[axis] = ptrAxis[0] + fraction * (ptrAxis[1] + fraction * (ptrAxis[2] + fraction * ptrAxis[3]));
+        }
+    }
+
+    return(SpaceVector(component[0], component[1], component[2], EARTH_CENTER_INERTIAL));
+}
+
+/* ******************************************************************************** */
+
 Orbit
 PositionUtility::UpdateOrbit(const Orbit &currentOrbit,
                              double newEpochTime)
@@ -41,21 +41,9 @@
 #include "mural/modules/ts/TargetRegion.h"
 #include "mural/sensor/SpectralSensor.h"
 
-Array<int>*            TargetDeck::ptrSubPriorityThreshold_s = NULL;
-double                    TargetDeck::opticalPriorityFactorCoeff_s = 0.0;
-double                    TargetDeck::opticalPriorityFactorExpnt_s = 0.0;
-double                    TargetDeck::radarPriorityFactorCoeff_s = 0.0;
-double                    TargetDeck::radarPriorityFactorExpnt_s = 0.0;
-double                    TargetDeck::areaFactor_s = 0.0;
 const char               TargetDeck::ACTIVE_TARGET_ID_s = 'A';
-bool                     TargetDeck::printDeckAsRequirements_s = false;
-bool                     TargetDeck::scheduleTargets_s = false;
-bool                     TargetDeck::useFullOpticalScoreEquation_s = true;
-string*                  TargetDeck::ptrDeckFileBaseDirectory_s = NULL;
-Array<string>*           TargetDeck::ptrTargetDeckFileNameArray_s = NULL;
-Array<string>*           TargetDeck::ptrTargetGroupArray_s = NULL;
-TargetDeck::EFFECTIVITY  TargetDeck::effectivity_s = UNKNOWN_EFFECTIVITY;
-LinkList<CountryFactor>* TargetDeck::ptrCountryFactorList_s = NULL;
+TargetDeck::State               TargetDeck::defaultState_s;
+thread_local TargetDeck::State *TargetDeck::ptrBoundState_s = NULL;
 
 TargetDeck::TargetDeck()
     : deckFileName_a(""), ptrTargetList_a(NULL)
@@ -66,10 +54,10 @@ TargetDeck::TargetDeck()
 TargetDeck::TargetDeck(int targetDeckIndex,
                        const Array2D<bool> *ptrActiveRequirements,
                        int numberOfResources)
-    : deckFileName_a(*ptrDeckFileBaseDirectory_s + ptrTargetDeckFileNameArray_s->ElementAt(targetDeckIndex)),
+    : deckFileName_a(*GetState().ptrDeckFileBaseDirectory + GetState().ptrTargetDeckFileNameArray->ElementAt(targetDeckIndex)),
       ptrTargetList_a(NULL)
 {
-    if (scheduleTargets_s == true) {
+    if (GetState().scheduleTargets == true) {
         ptrTargetList_a = new LinkList<Target>();
     }
 
@@ -105,17 +93,17 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
         ptrInputData = (*inputDataIter);
 
         if (ptrInputData->LabelContainsString("Optical Priority Factor Coefficient") == true) {
-            opticalPriorityFactorCoeff_s = ptrInputData->GetDoubleValue();
+            GetState().opticalPriorityFactorCoeff = ptrInputData->GetDoubleValue();
         } else if (ptrInputData->LabelContainsString("Optical Priority Factor Exponential") == true) {
-            opticalPriorityFactorExpnt_s = ptrInputData->GetDoubleValue();
+            GetState().opticalPriorityFactorExpnt = ptrInputData->GetDoubleValue();
         } else if (ptrInputData->LabelContainsString("Use Full Optical Score Equation") == true) {
-            useFullOpticalScoreEquation_s = ptrInputData->GetBoolValue();
+            GetState().useFullOpticalScoreEquation = ptrInputData->GetBoolValue();
         } else if (ptrInputData->LabelContainsString("Radar Priority Factor Coefficient") == true) {
-            radarPriorityFactorCoeff_s = ptrInputData->GetDoubleValue();
+            GetState().radarPriorityFactorCoeff = ptrInputData->GetDoubleValue();
         } else if (ptrInputData->LabelContainsString("Radar Priority Factor Exponential") == true) {
-            radarPriorityFactorExpnt_s = ptrInputData->GetDoubleValue();
+            GetState().radarPriorityFactorExpnt = ptrInputData->GetDoubleValue();
         } else if (ptrInputData->LabelContainsString("Area Factor") == true) {
-            areaFactor_s = ptrInputData->GetDoubleValue();
+            GetState().areaFactor = ptrInputData->GetDoubleValue();
         } else if (ptrInputData->LabelContainsString("Spectral Quality Bins") == true) {
             numberOfInputs = ptrInputData->GetNumberOfValues();
 
@@ -134,46 +122,46 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
                 }
             }
         } else if (ptrInputData->LabelContainsString("Deck File Base Directory") == true) {
-            if (ptrDeckFileBaseDirectory_s != NULL) {
-                delete ptrDeckFileBaseDirectory_s;
+            if (GetState().ptrDeckFileBaseDirectory != NULL) {
+                delete GetState().ptrDeckFileBaseDirectory;
             }
 
-            ptrDeckFileBaseDirectory_s = new string(ptrInputData->GetStringValue());
+            GetState().ptrDeckFileBaseDirectory = new string(ptrInputData->GetStringValue());
         } else if (ptrInputData->LabelContainsString("Print Deck As Requirements") == true) {
-            printDeckAsRequirements_s = ptrInputData->GetBoolValue();
+            GetState().printDeckAsRequirements = ptrInputData->GetBoolValue();
         } else if (ptrInputData->LabelContainsString("Sub Priority Level Threshold") == true) {
-            if (ptrSubPriorityThreshold_s == NULL) {
-                ptrSubPriorityThreshold_s = new Array<int>();
+            if (GetState().ptrSubPriorityThreshold == NULL) {
+                GetState().ptrSubPriorityThreshold = new Array<int>();
             }
 
             index = 0;
             numberOfInputs = ptrInputData->GetNumberOfValues();
 
             while (index < numberOfInputs) {
-                ptrSubPriorityThreshold_s->InsertUniqueElement(ptrInputData->GetIntValue(index));
+                GetState().ptrSubPriorityThreshold->InsertUniqueElement(ptrInputData->GetIntValue(index));
                 ++index;
             }
         } else if (ptrInputData->LabelContainsString("Effectivity") == true) {
-            effectivity_s = GetEffectivity(ptrInputData->GetStringValue());
+            GetState().effectivity = GetEffectivity(ptrInputData->GetStringValue());
         } else if (ptrInputData->LabelContainsString("Country Code Factor") == true) {
             if (ptrInputData->GetSpecificDoubleNumber(factor) == true) {
                 ptrCountryFactor = new CountryFactor(factor, ptrInputData->GetValueArray());
 
-                if (ptrCountryFactorList_s == NULL) {
-                    ptrCountryFactorList_s = new LinkList<CountryFactor>();
+                if (GetState().ptrCountryFactorList == NULL) {
+                    GetState().ptrCountryFactorList = new LinkList<CountryFactor>();
                 }
 
-                ptrCountryFactorList_s->Append(ptrCountryFactor);
+                GetState().ptrCountryFactorList->Append(ptrCountryFactor);
                 ptrCountryFactor = NULL;
             }
         }
     }
 
-    if (effectivity_s == UNKNOWN_EFFECTIVITY) {
+    if (GetState().effectivity == UNKNOWN_EFFECTIVITY) {
         errorString = "Missing/invalid 'Effectivity' input";
     }
 
-    if (opticalPriorityFactorCoeff_s <= 0.0) {
+    if (GetState().opticalPriorityFactorCoeff <= 0.0) {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
@@ -181,7 +169,7 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
         errorString = "Missing/invalid 'Optical Priority Factor Coefficient' input";
     }
 
-    if (opticalPriorityFactorExpnt_s <= 0.0) {
+    if (GetState().opticalPriorityFactorExpnt <= 0.0) {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
@@ -189,7 +177,7 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
         errorString += "Missing/invalid 'Optical Priority Factor Exponential' input";
     }
 
-    if (radarPriorityFactorCoeff_s <= 0.0) {
+    if (GetState().radarPriorityFactorCoeff <= 0.0) {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
@@ -197,7 +185,7 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
         errorString += "Missing/invalid 'Radar Priority Factor Coefficient' input";
     }
 
-    if (radarPriorityFactorExpnt_s <= 0.0) {
+    if (GetState().radarPriorityFactorExpnt <= 0.0) {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
@@ -205,7 +193,7 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
         errorString += "Missing/invalid 'Radar Priority Factor Exponential' input";
     }
 
-    if (areaFactor_s <= 0.0) {
+    if (GetState().areaFactor <= 0.0) {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
@@ -221,13 +209,13 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
         errorString += "Missing/invalid 'Spectral Quality Bins' input";
     }
 
-    if (ptrDeckFileBaseDirectory_s == NULL) {
+    if (GetState().ptrDeckFileBaseDirectory == NULL) {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
 
         errorString += "Missing 'Deck File Base Directory' input";
-    } else if (ptrDeckFileBaseDirectory_s->at(ptrDeckFileBaseDirectory_s->length() - 1) != '\\') {
+    } else if (GetState().ptrDeckFileBaseDirectory->at(GetState().ptrDeckFileBaseDirectory->length() - 1) != '\\') {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
@@ -235,7 +223,7 @@ TargetDeck::ExtractTargetDeckInfo(shared_ptr<InputDataElement> ptrElement,
         errorString += "Invalid 'Deck File Base Directory' input.  MUST end with a back slash!";
     }
 
-    if ((runTargetScheduler == true) && (ptrTargetGroupArray_s == NULL)) {
+    if ((runTargetScheduler == true) && (GetState().ptrTargetGroupArray == NULL)) {
         if (errorString.size() > 0) {
             errorString += "\n         ";
         }
@@ -258,44 +246,44 @@ void
 TargetDeck::PrintAttributes(ostream &outfile)
 {
     string factorString = "";
-    ListIterator<CountryFactor> countryFactorListIter(ptrCountryFactorList_s);
+    ListIterator<CountryFactor> countryFactorListIter(GetState().ptrCountryFactorList);
     CountryFactor              *ptrCountryFactor = countryFactorListIter.First();
     outfile << "<TARGET_PARAMETERS_START>" << NEW_LINE;
     outfile << "   Optical Priority Factor Coefficient : ";
-    outfile << opticalPriorityFactorCoeff_s << NEW_LINE;
+    outfile << GetState().opticalPriorityFactorCoeff << NEW_LINE;
     outfile << "   Optical Priority Factor Exponential : ";
-    outfile << opticalPriorityFactorExpnt_s << NEW_LINE;
+    outfile << GetState().opticalPriorityFactorExpnt << NEW_LINE;
     outfile << "   Use Full Optical Score Equation     : ";
-    outfile << StringEditor::ConvertToString(useFullOpticalScoreEquation_s) << NEW_LINE;
+    outfile << StringEditor::ConvertToString(GetState().useFullOpticalScoreEquation) << NEW_LINE;
     outfile << "   Radar Priority Factor Coefficient   : ";
-    outfile << radarPriorityFactorCoeff_s << NEW_LINE;
+    outfile << GetState().radarPriorityFactorCoeff << NEW_LINE;
     outfile << "   Radar Priority Factor Exponential   : ";
-    outfile << radarPriorityFactorExpnt_s << NEW_LINE;
+    outfile << GetState().radarPriorityFactorExpnt << NEW_LINE;
     outfile << "   Area Factor                         : ";
-    outfile << areaFactor_s << NEW_LINE;
+    outfile << GetState().areaFactor << NEW_LINE;
     outfile << "   Spectral Quality Bins               : ";
     SpectralSensor::PrintQualityBinArray(outfile);
     outfile << NEW_LINE;
 
-    if (ptrDeckFileBaseDirectory_s != NULL) {
+    if (GetState().ptrDeckFileBaseDirectory != NULL) {
         outfile << "   Deck File Base Directory            : ";
-        outfile << *ptrDeckFileBaseDirectory_s << NEW_LINE;
+        outfile << *GetState().ptrDeckFileBaseDirectory << NEW_LINE;
     }
 
     outfile << "   Print Deck As Requirements          : ";
-    outfile << StringEditor::ConvertToString(printDeckAsRequirements_s) << NEW_LINE;
+    outfile << StringEditor::ConvertToString(GetState().printDeckAsRequirements) << NEW_LINE;
 
-    if (ptrTargetGroupArray_s != NULL) {
+    if (GetState().ptrTargetGroupArray != NULL) {
         outfile << "   Schedule Targets                    : ";
-        outfile << StringEditor::ConvertToString(scheduleTargets_s) << NEW_LINE;
+        outfile << StringEditor::ConvertToString(GetState().scheduleTargets) << NEW_LINE;
         outfile << "   Target Groups                       : ";
-        ptrTargetGroupArray_s->Print(outfile);
+        GetState().ptrTargetGroupArray->Print(outfile);
         outfile << NEW_LINE;
     }
 
-    if (ptrSubPriorityThreshold_s != NULL) {
+    if (GetState().ptrSubPriorityThreshold != NULL) {
         outfile << "   Sub Priority Level Threshold(s)     : ";
-        ptrSubPriorityThreshold_s->Print(outfile);
+        GetState().ptrSubPriorityThreshold->Print(outfile);
         outfile << NEW_LINE;
     }
 
@@ -435,11 +423,11 @@ TargetDeck::RetrieveTargetsAndBuildRequirements(int targetDeckIndex,
                         ptrTarget = new Target(targetID, missionNumber, targetDeckIndex,
                                                fcpsID, ptrQuality, ptrPriority, ptrPreference,
                                                ptrMode, ptrSensorScore, ptrRegionNumber,
-                                               ptrRegionArea, scheduleTargets_s);
+                                               ptrRegionArea, GetState().scheduleTargets);
 
                         // if scheduling targets, add this target region's to the
                         // corresponding (geographical) region in the requirement map
-                        if (scheduleTargets_s == true) {
+                        if (GetState().scheduleTargets == true) {
                             ListIterator<TargetRegion> targetRegionIter = ListIterator<TargetRegion>(ptrTarget->GetTargetRegionList());
                             TargetRegion *ptrTargetRegion = targetRegionIter.First();
 
@@ -679,10 +667,10 @@ TargetDeck::CalculateSensorScore(Array<double> *&ptrSensorScore,
             sensorScore = countryFactor;
 
             if (sensorIndex != Sensor::SAR) {
-                if (useFullOpticalScoreEquation_s == true) {
+                if (GetState().useFullOpticalScoreEquation == true) {
                     // score for visible and int wave sensors include an area adjust factor
-                    if (totalTargetArea > areaFactor_s) {
-                        sensorScore *= (totalTargetArea / areaFactor_s);
+                    if (totalTargetArea > GetState().areaFactor) {
+                        sensorScore *= (totalTargetArea / GetState().areaFactor);
                     }
 
                     // score for visible and int wave sensors also include a timeliness factor
@@ -691,11 +679,11 @@ TargetDeck::CalculateSensorScore(Array<double> *&ptrSensorScore,
                                     * ((double)duration / 365.0) * 100.0);
                 }
 
-                priorityFactorCoeff = opticalPriorityFactorCoeff_s;
-                priorityFactorExpnt = opticalPriorityFactorExpnt_s;
+                priorityFactorCoeff = GetState().opticalPriorityFactorCoeff;
+                priorityFactorExpnt = GetState().opticalPriorityFactorExpnt;
             } else {
-                priorityFactorCoeff = radarPriorityFactorCoeff_s;
-                priorityFactorExpnt = radarPriorityFactorExpnt_s;
+                priorityFactorCoeff = GetState().radarPriorityFactorCoeff;
+                priorityFactorExpnt = GetState().radarPriorityFactorExpnt;
             }
 
             exponent = 9.0 - ((double)ptrPriority->ElementAt(sensorIndex) / 100.0);
@@ -817,10 +805,10 @@ TargetDeck::GetEffectiveSimulationTimes(int &simulationStart,
     simulationStart = 0;
     simulationEnd = 0;
 
-    if (effectivity_s == MONTH_ONLY) {
+    if (GetState().effectivity == MONTH_ONLY) {
         simulationStart = Date::GetCummulativeDays(startYear, (startMonth - 1)) + 1;
         simulationEnd = Date::GetCummulativeDays(startYear, startMonth);
-    } else if (effectivity_s == MONTH_AND_DAY) {
+    } else if (GetState().effectivity == MONTH_AND_DAY) {
         simulationStart = Date::GetCummulativeDays(startYear, startMonth,
                           TimePiece::GetStartDay());
         simulationEnd = simulationStart;
@@ -842,10 +830,10 @@ TargetDeck::EffectiveTarget(const char &statusFlag,
     bool   effectiveTarget = false;
     Date  *ptrDate = NULL;
 
-    if (effectivity_s == ALL_TARGETS) {
+    if (GetState().effectivity == ALL_TARGETS) {
         effectiveTarget = true;
     } else if (statusFlag == ACTIVE_TARGET_ID_s) {
-        if (effectivity_s == ALL_ACTIVE_TARGETS) {
+        if (GetState().effectivity == ALL_ACTIVE_TARGETS) {
             effectiveTarget = true;
         } else if (duration >= (int)DAYS_PER_YEAR) {
             // a duration of 365 indicates a 'standing target'
@@ -881,7 +869,7 @@ double
 TargetDeck::GetCountryFactor(const string &countryCode)
 {
     double           coutryCodeFactor = 1.0;
-    ListIterator<CountryFactor> countryFactorListIter(ptrCountryFactorList_s);
+    ListIterator<CountryFactor> countryFactorListIter(GetState().ptrCountryFactorList);
     CountryFactor  *ptrCountryFactor = countryFactorListIter.First();
 
     while (ptrCountryFactor != NULL) {
@@ -901,13 +889,13 @@ TargetDeck::GetTargetDeckFileName(int deckIndex)
 {
     string targetFileName = "";
 
-    if (ptrTargetDeckFileNameArray_s == NULL) {
+    if (GetState().ptrTargetDeckFileNameArray == NULL) {
         throw new NullPointerException(GetClassName(), "GetTargetDeckFileName(int)",
-                                       "ptrTargetDeckFileNameArray_s");
+                                       "GetState().ptrTargetDeckFileNameArray");
     }
 
     try {
-        targetFileName = ptrTargetDeckFileNameArray_s->ElementAt(deckIndex);
+        targetFileName = GetState().ptrTargetDeckFileNameArray->ElementAt(deckIndex);
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetTargetDeckFileName(int)");
         throw;
@@ -1268,30 +1256,38 @@ TargetDeck::PrintSummary(ofstream &outfile,
 void
 TargetDeck::DestroyTargetDeck()
 {
-    if (ptrDeckFileBaseDirectory_s != NULL) {
-        delete ptrDeckFileBaseDirectory_s;
-        ptrDeckFileBaseDirectory_s = NULL;
+    if (GetState().ptrDeckFileBaseDirectory != NULL) {
+        delete GetState().ptrDeckFileBaseDirectory;
+        GetState().ptrDeckFileBaseDirectory = NULL;
     }
 
-    if (ptrTargetDeckFileNameArray_s != NULL) {
-        delete ptrTargetDeckFileNameArray_s;
-        ptrTargetDeckFileNameArray_s = NULL;
+    if (GetState().ptrTargetDeckFileNameArray != NULL) {
+        delete GetState().ptrTargetDeckFileNameArray;
+        GetState().ptrTargetDeckFileNameArray = NULL;
     }
 
-    if (ptrSubPriorityThreshold_s != NULL) {
-        delete ptrSubPriorityThreshold_s;
-        ptrSubPriorityThreshold_s = NULL;
+    if (GetState().ptrSubPriorityThreshold != NULL) {
+        delete GetState().ptrSubPriorityThreshold;
+        GetState().ptrSubPriorityThreshold = NULL;
     }
 
-    if (ptrCountryFactorList_s != NULL) {
-        ptrCountryFactorList_s->Delete();
-        delete ptrCountryFactorList_s;
-        ptrCountryFactorList_s = NULL;
+    if (GetState().ptrCountryFactorList != NULL) {
+        GetState().ptrCountryFactorList->Delete();
+        delete GetState().ptrCountryFactorList;
+        GetState().ptrCountryFactorList = NULL;
     }
 
     return;
 }
 
+TargetDeck::State*
+TargetDeck::BindState(State *ptrState)
+{
+    State *ptrPreviousState = ptrBoundState_s;
+    ptrBoundState_s = ptrState;
+    return(ptrPreviousState);
+}
+
 TargetDeck::~TargetDeck()
 {
     if (ptrTargetList_a != NULL) {
@@ -57,6 +57,37 @@ public:
         ALL_TARGETS = 3
     };
 
+    /**
+     * The target deck settings of a scenario (released by DestroyTargetDeck).
+     *  Each ScenarioContext holds its own, threads with no context bound share
+     *  the process wide default.
+     */
+    struct State {
+        Array<int>              *ptrSubPriorityThreshold = NULL;
+        double                   opticalPriorityFactorCoeff = 0.0;
+        double                   opticalPriorityFactorExpnt = 0.0;
+        double                   radarPriorityFactorCoeff = 0.0;
+        double                   radarPriorityFactorExpnt = 0.0;
+        double                   areaFactor = 0.0;
+        bool                     printDeckAsRequirements = false;
+        bool                     scheduleTargets = false;
+        bool                     useFullOpticalScoreEquation = true;
+        string                  *ptrDeckFileBaseDirectory = NULL;
+        Array<string>           *ptrTargetDeckFileNameArray = NULL;
+        Array<string>           *ptrTargetGroupArray = NULL;
+        EFFECTIVITY              effectivity = UNKNOWN_EFFECTIVITY;
+        LinkList<CountryFactor> *ptrCountryFactorList = NULL;
+    };
+
+    /**
+     * Binds the state used by the calling thread (see ScenarioContext),
+     *  NULL returns the thread to the process wide default state
+     *
+     * @param *ptrState the state to bind (or NULL)
+     * @return State* the previously bound state
+     */
+    static State* BindState(State *ptrState);
+
     TargetDeck();
 
 
@@ -154,21 +185,12 @@ private:
 
     static inline EFFECTIVITY GetEffectivity(const string &effectivityString);
 
-    static Array<int>            *ptrSubPriorityThreshold_s;
-    static double                    opticalPriorityFactorCoeff_s;
-    static double                    opticalPriorityFactorExpnt_s;
-    static double                    radarPriorityFactorCoeff_s;
-    static double                    radarPriorityFactorExpnt_s;
-    static double                    areaFactor_s;
+    static inline State& GetState();
+
     static const char               ACTIVE_TARGET_ID_s;
-    static bool                     printDeckAsRequirements_s;
-    static bool                     scheduleTargets_s;
-    static bool                     useFullOpticalScoreEquation_s;
-    static string                  *ptrDeckFileBaseDirectory_s;
-    static Array<string>           *ptrTargetDeckFileNameArray_s;
-    static Array<string>           *ptrTargetGroupArray_s;
-    static EFFECTIVITY              effectivity_s;
-    static LinkList<CountryFactor> *ptrCountryFactorList_s;
+
+    static State                defaultState_s;
+    static thread_local State  *ptrBoundState_s;
 
     string                deckFileName_a;
     LinkList<Target>     *ptrTargetList_a;
@@ -178,10 +200,10 @@ inline
 void
 TargetDeck::AddTargetDeckFileName(const string &fileName)
 {
-    if (ptrTargetDeckFileNameArray_s == NULL) {
-        ptrTargetDeckFileNameArray_s = new Array<string>(1, fileName);
+    if (GetState().ptrTargetDeckFileNameArray == NULL) {
+        GetState().ptrTargetDeckFileNameArray = new Array<string>(1, fileName);
     } else {
-        ptrTargetDeckFileNameArray_s->AddUniqueElement(fileName);
+        GetState().ptrTargetDeckFileNameArray->AddUniqueElement(fileName);
     }
 }
 
@@ -191,12 +213,12 @@ TargetDeck::GetSubPriorityLevel(int priorityNumber)
 {
     int subPriorityLevel = 0;
 
-    if (ptrSubPriorityThreshold_s != NULL) {
+    if (GetState().ptrSubPriorityThreshold != NULL) {
         bool foundLevel = false;
 
-        while ( (subPriorityLevel < ptrSubPriorityThreshold_s->Size()) &&
+        while ( (subPriorityLevel < GetState().ptrSubPriorityThreshold->Size()) &&
                 (foundLevel == false) ) {
-            if (priorityNumber <= ptrSubPriorityThreshold_s->ElementAt(subPriorityLevel)) {
+            if (priorityNumber <= GetState().ptrSubPriorityThreshold->ElementAt(subPriorityLevel)) {
                 foundLevel = true;
             }
 
@@ -213,8 +235,8 @@ TargetDeck::GetNumberOfTargetDecks()
 {
     int numberOfTargetDecks = 0;
 
-    if (ptrTargetDeckFileNameArray_s != NULL) {
-        numberOfTargetDecks = ptrTargetDeckFileNameArray_s->Size();
+    if (GetState().ptrTargetDeckFileNameArray != NULL) {
+        numberOfTargetDecks = GetState().ptrTargetDeckFileNameArray->Size();
     }
 
     return(numberOfTargetDecks);
@@ -226,8 +248,8 @@ TargetDeck::GetTargetDeckIndex(const string &fileName)
 {
     int targetDeckIndex = -1;
 
-    if (ptrTargetDeckFileNameArray_s != NULL) {
-        targetDeckIndex = ptrTargetDeckFileNameArray_s->FindIndex(fileName);
+    if (GetState().ptrTargetDeckFileNameArray != NULL) {
+        targetDeckIndex = GetState().ptrTargetDeckFileNameArray->FindIndex(fileName);
     }
 
     return(targetDeckIndex);
@@ -239,8 +261,8 @@ TargetDeck::IsTargetGroup(const string &groupName)
 {
     bool isTargetGroup = false;
 
-    if (ptrTargetGroupArray_s != NULL) {
-        isTargetGroup = ptrTargetGroupArray_s->ValueExists(groupName);
+    if (GetState().ptrTargetGroupArray != NULL) {
+        isTargetGroup = GetState().ptrTargetGroupArray->ValueExists(groupName);
     }
 
     return(isTargetGroup);
@@ -250,14 +272,14 @@ inline
 bool
 TargetDeck::PrintDeckAsRequirements()
 {
-    return(printDeckAsRequirements_s);
+    return(GetState().printDeckAsRequirements);
 }
 
 inline
 bool
 TargetDeck::ScheduleTargets()
 {
-    return(scheduleTargets_s);
+    return(GetState().scheduleTargets);
 }
 
 inline
@@ -292,13 +314,13 @@ TargetDeck::GetEffectivityString()
 {
     string effectivityString = "UNKNOWN";
 
-    if (effectivity_s == MONTH_ONLY) {
+    if (GetState().effectivity == MONTH_ONLY) {
         effectivityString = "MO";
-    } else if (effectivity_s == MONTH_AND_DAY) {
+    } else if (GetState().effectivity == MONTH_AND_DAY) {
         effectivityString = "MAD";
-    } else if (effectivity_s == ALL_ACTIVE_TARGETS) {
+    } else if (GetState().effectivity == ALL_ACTIVE_TARGETS) {
         effectivityString = "ACTIVE";
-    } else if (effectivity_s == ALL_TARGETS) {
+    } else if (GetState().effectivity == ALL_TARGETS) {
         effectivityString = "ALL";
     }
 
@@ -309,7 +331,7 @@ inline
 string*
 TargetDeck::GetDeckFileBaseDirectory()
 {
-    return(ptrDeckFileBaseDirectory_s);
+    return(GetState().ptrDeckFileBaseDirectory);
 }
 
 inline
@@ -319,6 +341,13 @@ TargetDeck::GetTargetList() const
     return(ptrTargetList_a);
 }
 
+inline
+TargetDeck::State&
+TargetDeck::GetState()
+{
+    return((ptrBoundState_s != NULL) ? *ptrBoundState_s : defaultState_s);
+}
+
 inline
 string
 TargetDeck::GetClassName()
@@ -35,6 +35,7 @@
 #include "general/array/ListIterator.h"
 #include "general/utility/Constant.h"
 #include "general/utility/StringEditor.h"
+#include "general/utility/MemoryArena.h"
 
 
 #include "mural/Region.h"
@@ -685,6 +686,18 @@ RegionData::RemoveAllRequirements()
     return;
 }
 
+void*
+RegionData::operator new (size_t numberOfBytes)
+{
+    return(MemoryArena::AllocateObject(numberOfBytes));
+}
+
+void
+RegionData::operator delete (void *ptrRegionData)
+{
+    MemoryArena::DeallocateObject(ptrRegionData);
+}
+
 RegionData::~RegionData()
 {
     ptrRegion_a = NULL;
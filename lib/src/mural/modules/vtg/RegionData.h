@@ -88,6 +88,9 @@ public:
     RegionData(const RegionData &copyIndex);
     virtual ~RegionData();
 
+    static void* operator new (size_t numberOfBytes);
+    static void  operator delete (void *ptrRegionData);
+
     RegionData& operator =  (const RegionData &copyMe);
     bool        operator == (const RegionData &compareMe);
     bool        operator != (const RegionData &compareMe);
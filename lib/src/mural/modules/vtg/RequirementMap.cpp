@@ -293,6 +293,35 @@ RequirementMap::DeleteRequirements()
 
 /* ***************************************************************************** */
 
+size_t
+RequirementMap::GetMemoryFootprint() const
+{
+    map<string, shared_ptr<MURALTypes::RequirementVector>>::const_iterator requirementIter;
+    map<double, LinkList<TargetRegion>*>::const_iterator                    targetRegionIter;
+    size_t footprint = sizeof(*this) + (regionNumberKeys_a->capacity() * sizeof(double));
+
+    for (requirementIter = requirementMap_a->begin(); requirementIter != requirementMap_a->end(); ++requirementIter) {
+        footprint += (sizeof(*requirementIter) + requirementIter->first.capacity());
+
+        if (requirementIter->second != NULL) {
+            footprint += (requirementIter->second->capacity()
+                          * (sizeof(shared_ptr<Requirement>) + sizeof(Requirement)));
+        }
+    }
+
+    for (targetRegionIter = targetRegionMap_a->begin(); targetRegionIter != targetRegionMap_a->end(); ++targetRegionIter) {
+        footprint += sizeof(*targetRegionIter);
+
+        if (targetRegionIter->second != NULL) {
+            footprint += (targetRegionIter->second->Size() * sizeof(TargetRegion));
+        }
+    }
+
+    return(footprint);
+}
+
+/* ***************************************************************************** */
+
 RequirementMap::~RequirementMap()
 {
     return;
@@ -178,6 +178,14 @@ public:
     */
     LinkList<TargetRegion>* GetTargetRegionList(double fullRegionNumber) const;
 
+    /**
+     * Estimates the bytes held by the map: the requirements and target regions
+     * along with their keys
+     *
+     * @return the footprint (bytes)
+     */
+    size_t GetMemoryFootprint() const;
+
 private:
     /**
      * Creates the string key for the map from the region number, deck index, and sensor index
@@ -52,6 +52,7 @@
 #include "general/data/TimePeriod.h"
 #include "general/math/CoordinateFrame.h"
 #include "general/parse/ParseUtility.h"
+#include "general/utility/MemoryArena.h"
 #include "general/utility/StringEditor.h"
 
 const int                  TimelineGenerator::CRISIS_MISSION_NUMBER_s           = 10;
@@ -611,6 +612,9 @@ TimelineGenerator::DetermineBasicTimelineElements(const shared_ptr<UserVehicle>
     MURALTypes::RequirementVector::iterator          requirementIter;
 
     try {
+        // RegionData, Requirement and ValueTimelineElement instances created
+        // below are carved from the user's timeline arena and released with it
+        MemoryArena::Binding arenaBinding(ptrUserVehicle->GetTimelineArena());
         int calculatedQuality = 0;
         int requiredQuality = 0;
         int deckIndex = 0;
@@ -845,6 +849,11 @@ TimelineGenerator::DetermineBasicTimelineElements(const shared_ptr<UserVehicle>
             ptrCrisisPatternInViewList->RemoveAll();
             ++timeIndex;
         }
+
+        if (valtLogFile.is_open() == true) {
+            ptrUserVehicle->GetTimelineArena()->PrintStatistics(valtLogFile, "TimelineGenerator: Timeline Arena For "
+                    + userDesignator);
+        }
     } catch (Exception *ptrError) {
         delete ptrValidMission;
         ptrValidMission = NULL;
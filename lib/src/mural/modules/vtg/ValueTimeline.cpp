@@ -24,8 +24,10 @@
 #include "CrisisData.h"
 #include "mural/Region.h"
 #include "ValueTimelineElement.h"
+#include "RegionData.h"
 
 #include "general/time/TimePiece.h"
+#include "general/utility/MemoryArena.h"
 
 //----------------------------------------------------------------------
 //
@@ -52,19 +54,21 @@
 #include "ValueTimeline.h"
 
 ValueTimeline::ValueTimeline()
-    : maximumTimelineScore_a(0.0), ptrTimelineElementArray_a(NULL)
+    : maximumTimelineScore_a(0.0), ptrTimelineElementArray_a(NULL), ptrArena_a(NULL)
 {
     ptrTimelineElementArray_a = new
     ArrayOfPointers<ValueTimelineElement>(TimePiece::GetNumberOfTimeSteps());
+    ptrArena_a = new MemoryArena();
     return;
 }
 
 ValueTimeline::ValueTimeline(const ValueTimeline &copyMe)
     : maximumTimelineScore_a(copyMe.maximumTimelineScore_a),
-      ptrTimelineElementArray_a(NULL)
+      ptrTimelineElementArray_a(NULL), ptrArena_a(NULL)
 {
     ptrTimelineElementArray_a = new
     ArrayOfPointers<ValueTimelineElement>(*(copyMe.ptrTimelineElementArray_a));
+    ptrArena_a = new MemoryArena();
     return;
 }
 
@@ -405,6 +409,39 @@ ValueTimeline::GetRegionDataList(int timeIndex) const
     return(ptrReturnList);
 }
 
+size_t
+ValueTimeline::GetMemoryFootprint(size_t &regionDataBytes) const
+{
+    const int numberOfTimeSteps = ptrTimelineElementArray_a->Size();
+    size_t    footprint = sizeof(*this) + (numberOfTimeSteps * sizeof(ValueTimelineElement*));
+    size_t    elementBytes = 0;
+    int       timeIndex = 0;
+    regionDataBytes = 0;
+
+    while (timeIndex < numberOfTimeSteps) {
+        const ValueTimelineElement *ptrElement = ptrTimelineElementArray_a->ElementAt(timeIndex);
+
+        if (ptrElement != NULL) {
+            const LinkList<RegionData> *ptrRegionDataList = ptrElement->GetRegionDataList();
+            elementBytes += sizeof(ValueTimelineElement);
+
+            if (ptrRegionDataList != NULL) {
+                regionDataBytes += (ptrRegionDataList->Size() * sizeof(RegionData));
+            }
+        }
+
+        ++timeIndex;
+    }
+
+    // the elements and their region data are allocated from the arena, so
+    // count the arena's blocks less the region data share
+    if ((ptrArena_a != NULL) && (ptrArena_a->GetBytesReserved() > (elementBytes + regionDataBytes))) {
+        elementBytes = ptrArena_a->GetBytesReserved() - regionDataBytes;
+    }
+
+    return(footprint + elementBytes);
+}
+
 void
 ValueTimeline::RemoveRegionData(int timeIndex)
 {
@@ -424,5 +461,12 @@ ValueTimeline::~ValueTimeline()
         ptrTimelineElementArray_a = NULL;
     }
 
+    // the elements (and their region data) must be deleted before the
+    // arena they were allocated from is released
+    if (ptrArena_a != NULL) {
+        delete ptrArena_a;
+        ptrArena_a = NULL;
+    }
+
     return;
 }
@@ -33,6 +33,7 @@
 
 using namespace std;
 
+class MemoryArena;
 class ValueTimelineElement;
 class RegionData;
 
@@ -46,6 +47,8 @@ class RegionData;
  *                                 user
  * ptrTimelineElementArray_a*    array of pointers of collection elements at
  *                                 each time step
+ * ptrArena_a*                   arena holding the timeline elements and their
+ *                                 region data (released with the timeline)
  *
  * @author Brian Fowler
  * @date 09/07/2011
@@ -101,10 +104,21 @@ public:
 
     LinkList<RegionData>* GetRegionDataList(int timeIndex) const;
 
+    /**
+     * Estimates the bytes held by this timeline.  The share held by the
+     * region data of its elements is returned separately.
+     *
+     * @param &regionDataBytes [return] the bytes held by the region data
+     * @return the footprint excluding the region data (bytes)
+     */
+    size_t  GetMemoryFootprint(size_t &regionDataBytes) const;
+
     inline double  GetMaximumTimelineScore() const;
 
     inline ArrayOfPointers<ValueTimelineElement>* GetValueTimeline() const;
 
+    inline MemoryArena* GetArena() const;
+
 protected:
 
 private:
@@ -113,6 +127,7 @@ private:
 
     double                                  maximumTimelineScore_a;
     ArrayOfPointers<ValueTimelineElement> *ptrTimelineElementArray_a;
+    MemoryArena                           *ptrArena_a;
 };
 
 inline
@@ -129,6 +144,13 @@ ValueTimeline::GetValueTimeline() const
     return(ptrTimelineElementArray_a);
 }
 
+inline
+MemoryArena*
+ValueTimeline::GetArena() const
+{
+    return(ptrArena_a);
+}
+
 inline
 string
 ValueTimeline::GetClassName()
@@ -20,15 +20,18 @@
  *============================================================================================*/
 
 
+#include <algorithm>
+#include <climits>
 #include <iomanip>
 #include "ValueTimelineElement.h"
 #include "mural/Region.h"
 #include "RegionData.h"
 
+#include "general/exception/InputException.h"
 #include "general/exception/NullPointerException.h"
 #include "general/exception/UpdateException.h"
 #include "general/time/TimePiece.h"
-#include "general/math/SimpleMath.h"
+#include "general/utility/MemoryArena.h"
 
 //------------------------------------------------------------------------------
 //
@@ -56,8 +59,9 @@ ValueTimelineElement::ValueTimelineElement()
     : CollectionElement(), crisisLevel_a(0), ptrSensorNumber_a(NULL),
       ptrMissionNumber_a(NULL), ptrSubPriorityLevel_a(NULL),
       overflownRegion_a(0.0), ptrImagedRegion_a(NULL), ptrCollectionTime_a(NULL),
-      ptrMaxPossibleBitsCollected_a(NULL)
+      ptrMaxPossibleBitsCollected_a(NULL), ptrResourceStorage_a(NULL)
 {
+    std::fill(resourceArraySize_a, resourceArraySize_a + NUMBER_OF_RESOURCE_ARRAYS, 0);
     return;
 }
 
@@ -79,57 +83,99 @@ ValueTimelineElement::ValueTimelineElement(double overRegion,
       crisisLevel_a(crisisLevel), ptrSensorNumber_a(NULL),
       ptrMissionNumber_a(NULL), ptrSubPriorityLevel_a(NULL),
       overflownRegion_a(overRegion), ptrImagedRegion_a(NULL), ptrCollectionTime_a(NULL),
-      ptrMaxPossibleBitsCollected_a(NULL)
+      ptrMaxPossibleBitsCollected_a(NULL), ptrResourceStorage_a(NULL)
 {
-    if (ptrSensorNumber == NULL) {
-        ptrSensorNumber_a = new Array<int>(numberOfResources, 0);
-    } else {
-        ptrSensorNumber_a = new Array<int>(*ptrSensorNumber);
+    int resourceIndex = 0;
+    int arraySize[NUMBER_OF_RESOURCE_ARRAYS];
+    // each array takes the size of the one passed in, or the number of
+    // resources when it is defaulted
+    arraySize[SENSOR_NUMBER] = (ptrSensorNumber == NULL)
+                               ? numberOfResources : ptrSensorNumber->Size();
+    arraySize[MISSION_NUMBER] = (ptrMissionNumber == NULL)
+                                ? numberOfResources : ptrMissionNumber->Size();
+    arraySize[SUB_PRIORITY_LEVEL] = (ptrSubPriorityLevel == NULL)
+                                    ? numberOfResources : ptrSubPriorityLevel->Size();
+    arraySize[IMAGED_REGION] = (ptrImagedRegion == NULL)
+                               ? numberOfResources : ptrImagedRegion->Size();
+    arraySize[COLLECTION_TIME] = (ptrCollectionTime == NULL)
+                                 ? numberOfResources : ptrCollectionTime->Size();
+    arraySize[MAX_POSSIBLE_BITS_COLLECTED] = (ptrMaxPossibleBitsCollected == NULL)
+            ? numberOfResources : ptrMaxPossibleBitsCollected->Size();
+
+    if ( (numberOfResources <= 0) &&
+            ((ptrSensorNumber == NULL) || (ptrMissionNumber == NULL) ||
+             (ptrSubPriorityLevel == NULL) || (ptrImagedRegion == NULL) ||
+             (ptrCollectionTime == NULL) || (ptrMaxPossibleBitsCollected == NULL)) ) {
+        throw new InputException(GetClassName(), "ValueTimelineElement(double, int, ...)",
+                                 "Entered zero or negative number for initial size");
     }
 
-    if (ptrMissionNumber == NULL) {
-        ptrMissionNumber_a = new Array<int>(numberOfResources, 0);
-    } else {
-        ptrMissionNumber_a = new Array<int>(*ptrMissionNumber);
+    AllocateResourceStorage(arraySize);
+
+    for (resourceIndex = 0; resourceIndex < arraySize[SENSOR_NUMBER]; ++resourceIndex) {
+        ptrSensorNumber_a[resourceIndex] = (ptrSensorNumber == NULL)
+                                           ? 0 : ptrSensorNumber->ElementAt(resourceIndex);
     }
 
-    if (ptrSubPriorityLevel == NULL) {
-        ptrSubPriorityLevel_a = new Array<int>(numberOfResources, 0);
-    } else {
-        ptrSubPriorityLevel_a = new Array<int>(*ptrSubPriorityLevel);
+    for (resourceIndex = 0; resourceIndex < arraySize[MISSION_NUMBER]; ++resourceIndex) {
+        ptrMissionNumber_a[resourceIndex] = (ptrMissionNumber == NULL)
+                                            ? 0 : ptrMissionNumber->ElementAt(resourceIndex);
     }
 
-    if (ptrImagedRegion == NULL) {
-        ptrImagedRegion_a = new Array<double>(numberOfResources, 0.00);
-    } else {
-        ptrImagedRegion_a = new Array<double>(*ptrImagedRegion);
+    for (resourceIndex = 0; resourceIndex < arraySize[SUB_PRIORITY_LEVEL]; ++resourceIndex) {
+        ptrSubPriorityLevel_a[resourceIndex] = (ptrSubPriorityLevel == NULL)
+                                               ? 0 : ptrSubPriorityLevel->ElementAt(resourceIndex);
     }
 
-    if (ptrCollectionTime == NULL) {
-        ptrCollectionTime_a = new Array<double>(numberOfResources, 0.0);
-    } else {
-        ptrCollectionTime_a = new Array<double>(*ptrCollectionTime);
+    for (resourceIndex = 0; resourceIndex < arraySize[IMAGED_REGION]; ++resourceIndex) {
+        ptrImagedRegion_a[resourceIndex] = (ptrImagedRegion == NULL)
+                                           ? 0.0 : ptrImagedRegion->ElementAt(resourceIndex);
     }
 
-    if (ptrMaxPossibleBitsCollected == NULL) {
-        ptrMaxPossibleBitsCollected_a = new Array<double>(numberOfResources, 0.0);
-    } else {
-        ptrMaxPossibleBitsCollected_a = new Array<double>(*ptrMaxPossibleBitsCollected);
+    for (resourceIndex = 0; resourceIndex < arraySize[COLLECTION_TIME]; ++resourceIndex) {
+        ptrCollectionTime_a[resourceIndex] = (ptrCollectionTime == NULL)
+                                             ? 0.0 : ptrCollectionTime->ElementAt(resourceIndex);
+    }
+
+    for (resourceIndex = 0; resourceIndex < arraySize[MAX_POSSIBLE_BITS_COLLECTED]; ++resourceIndex) {
+        ptrMaxPossibleBitsCollected_a[resourceIndex] = (ptrMaxPossibleBitsCollected == NULL)
+                ? 0.0 : ptrMaxPossibleBitsCollected->ElementAt(resourceIndex);
     }
 
     return;
 }
 
 ValueTimelineElement::ValueTimelineElement(const ValueTimelineElement &copyMe)
-    : CollectionElement(copyMe),
-      ptrSensorNumber_a(new Array<int>(*(copyMe.ptrSensorNumber_a))),
-      ptrMissionNumber_a(new Array<int>(*(copyMe.ptrMissionNumber_a))),
-      ptrSubPriorityLevel_a(new Array<int>(*(copyMe.ptrSubPriorityLevel_a))),
-      overflownRegion_a(copyMe.overflownRegion_a),
-      ptrImagedRegion_a(new Array<double>(*(copyMe.ptrImagedRegion_a))),
-      ptrCollectionTime_a(new Array<double>(*(copyMe.ptrCollectionTime_a))),
-      ptrMaxPossibleBitsCollected_a(new Array<double>(*(copyMe.ptrMaxPossibleBitsCollected_a)))
+    : CollectionElement(copyMe), crisisLevel_a(copyMe.crisisLevel_a),
+      ptrSensorNumber_a(NULL), ptrMissionNumber_a(NULL),
+      ptrSubPriorityLevel_a(NULL), overflownRegion_a(copyMe.overflownRegion_a),
+      ptrImagedRegion_a(NULL), ptrCollectionTime_a(NULL),
+      ptrMaxPossibleBitsCollected_a(NULL), ptrResourceStorage_a(NULL)
 {
+    std::fill(resourceArraySize_a, resourceArraySize_a + NUMBER_OF_RESOURCE_ARRAYS, 0);
+
+    if (copyMe.ptrResourceStorage_a != NULL) {
+        AllocateResourceStorage(copyMe.resourceArraySize_a);
+        std::copy(copyMe.ptrSensorNumber_a,
+                  copyMe.ptrSensorNumber_a + resourceArraySize_a[SENSOR_NUMBER],
+                  ptrSensorNumber_a);
+        std::copy(copyMe.ptrMissionNumber_a,
+                  copyMe.ptrMissionNumber_a + resourceArraySize_a[MISSION_NUMBER],
+                  ptrMissionNumber_a);
+        std::copy(copyMe.ptrSubPriorityLevel_a,
+                  copyMe.ptrSubPriorityLevel_a + resourceArraySize_a[SUB_PRIORITY_LEVEL],
+                  ptrSubPriorityLevel_a);
+        std::copy(copyMe.ptrImagedRegion_a,
+                  copyMe.ptrImagedRegion_a + resourceArraySize_a[IMAGED_REGION],
+                  ptrImagedRegion_a);
+        std::copy(copyMe.ptrCollectionTime_a,
+                  copyMe.ptrCollectionTime_a + resourceArraySize_a[COLLECTION_TIME],
+                  ptrCollectionTime_a);
+        std::copy(copyMe.ptrMaxPossibleBitsCollected_a,
+                  copyMe.ptrMaxPossibleBitsCollected_a + resourceArraySize_a[MAX_POSSIBLE_BITS_COLLECTED],
+                  ptrMaxPossibleBitsCollected_a);
+    }
+
     return;
 }
 
@@ -143,13 +189,22 @@ bool
 ValueTimelineElement::operator == (const ValueTimelineElement &compareMe) const
 {
     return( (CollectionElement::operator == (compareMe)) &&
-            (*ptrSensorNumber_a == *compareMe.ptrSensorNumber_a) &&
-            (*ptrMissionNumber_a == *compareMe.ptrMissionNumber_a) &&
-            (*ptrSubPriorityLevel_a == *compareMe.ptrSubPriorityLevel_a) &&
+            (std::equal(resourceArraySize_a, resourceArraySize_a + NUMBER_OF_RESOURCE_ARRAYS,
+                        compareMe.resourceArraySize_a)) &&
+            (std::equal(ptrSensorNumber_a, ptrSensorNumber_a + resourceArraySize_a[SENSOR_NUMBER],
+                        compareMe.ptrSensorNumber_a)) &&
+            (std::equal(ptrMissionNumber_a, ptrMissionNumber_a + resourceArraySize_a[MISSION_NUMBER],
+                        compareMe.ptrMissionNumber_a)) &&
+            (std::equal(ptrSubPriorityLevel_a, ptrSubPriorityLevel_a + resourceArraySize_a[SUB_PRIORITY_LEVEL],
+                        compareMe.ptrSubPriorityLevel_a)) &&
             (overflownRegion_a == compareMe.overflownRegion_a) &&
-            (*ptrImagedRegion_a == *compareMe.ptrImagedRegion_a) &&
-            (*ptrCollectionTime_a == *compareMe.ptrCollectionTime_a) &&
-            (*ptrMaxPossibleBitsCollected_a == *compareMe.ptrMaxPossibleBitsCollected_a) );
+            (std::equal(ptrImagedRegion_a, ptrImagedRegion_a + resourceArraySize_a[IMAGED_REGION],
+                        compareMe.ptrImagedRegion_a)) &&
+            (std::equal(ptrCollectionTime_a, ptrCollectionTime_a + resourceArraySize_a[COLLECTION_TIME],
+                        compareMe.ptrCollectionTime_a)) &&
+            (std::equal(ptrMaxPossibleBitsCollected_a,
+                        ptrMaxPossibleBitsCollected_a + resourceArraySize_a[MAX_POSSIBLE_BITS_COLLECTED],
+                        compareMe.ptrMaxPossibleBitsCollected_a)) );
 }
 
 bool
@@ -170,12 +225,8 @@ ValueTimelineElement::GetSensorNumber(int resourceIndex) const
     int sensorNumber = 0;
 
     try {
-        if ((resourceIndex >= 0) && (resourceIndex < ptrSensorNumber_a->Size())) {
-            sensorNumber = ptrSensorNumber_a->ElementAt(resourceIndex);
-        } else {
-            int index = 0;
-            sensorNumber = ptrSensorNumber_a->ElementAt(index);
-        }
+        sensorNumber = ptrSensorNumber_a[GetStorageIndex(resourceIndex, SENSOR_NUMBER,
+                          "GetSensorNumber(int)")];
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetSensorNumber(int)");
         throw;
@@ -188,11 +239,11 @@ int
 ValueTimelineElement::GetHighestScoreSensorNumber() const
 {
     int      highestScoreSensorNumber = 0;
-    int       numberOfResources = ptrSensorNumber_a->Size();
+    int       numberOfResources = resourceArraySize_a[SENSOR_NUMBER];
     const int index = 0;
 
     if (numberOfResources == 1) {
-        highestScoreSensorNumber = ptrSensorNumber_a->ElementAt(index);
+        highestScoreSensorNumber = ptrSensorNumber_a[index];
     } else {
         int resourceIndex = 0;
         double highestScore = -1.0;
@@ -203,7 +254,7 @@ ValueTimelineElement::GetHighestScoreSensorNumber() const
 
             if (score > highestScore) {
                 highestScore = score;
-                highestScoreSensorNumber = ptrSensorNumber_a->ElementAt(resourceIndex);
+                highestScoreSensorNumber = ptrSensorNumber_a[resourceIndex];
             }
 
             ++resourceIndex;
@@ -219,12 +270,8 @@ ValueTimelineElement::GetMissionNumber(int resourceIndex) const
     int targetType = 0;
 
     try {
-        if ((resourceIndex >= 0) && (resourceIndex < ptrMissionNumber_a->Size())) {
-            targetType = ptrMissionNumber_a->ElementAt(resourceIndex);
-        } else {
-            int index = 0;
-            targetType = ptrMissionNumber_a->ElementAt(index);
-        }
+        targetType = ptrMissionNumber_a[GetStorageIndex(resourceIndex, MISSION_NUMBER,
+                          "GetMissionNumber(int)")];
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetMissionNumber(int)");
         throw;
@@ -239,12 +286,8 @@ ValueTimelineElement::GetSubPriorityLevel(int resourceIndex) const
     int subPriorityLevel = 0;
 
     try {
-        if ((resourceIndex >= 0) && (resourceIndex < ptrSubPriorityLevel_a->Size())) {
-            subPriorityLevel = ptrSubPriorityLevel_a->ElementAt(resourceIndex);
-        } else {
-            int index = 0;
-            subPriorityLevel = ptrSubPriorityLevel_a->ElementAt(index);
-        }
+        subPriorityLevel = ptrSubPriorityLevel_a[GetStorageIndex(resourceIndex, SUB_PRIORITY_LEVEL,
+                          "GetSubPriorityLevel(int)")];
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetSubPriorityLevel(int)");
         throw;
@@ -259,12 +302,8 @@ ValueTimelineElement::GetCollectionTime(int resourceIndex) const
     double collectionTime = 0.0;
 
     try {
-        if ((resourceIndex >= 0) && (resourceIndex < ptrCollectionTime_a->Size())) {
-            collectionTime = ptrCollectionTime_a->ElementAt(resourceIndex);
-        } else {
-            int index = 0;
-            collectionTime = ptrCollectionTime_a->ElementAt(index);
-        }
+        collectionTime = ptrCollectionTime_a[GetStorageIndex(resourceIndex, COLLECTION_TIME,
+                          "GetCollectionTime(int)")];
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetCollectionTime(int)");
         throw;
@@ -276,7 +315,15 @@ ValueTimelineElement::GetCollectionTime(int resourceIndex) const
 double
 ValueTimelineElement::GetMaximumCollectionTime() const
 {
-    return(SimpleMath::Maximum(ptrCollectionTime_a));
+    int    resourceIndex = 0;
+    double maximumCollectionTime = (double)LONG_MIN;
+
+    while (resourceIndex < resourceArraySize_a[COLLECTION_TIME]) {
+        maximumCollectionTime = std::max(maximumCollectionTime, ptrCollectionTime_a[resourceIndex]);
+        ++resourceIndex;
+    }
+
+    return(maximumCollectionTime);
 }
 
 double
@@ -285,14 +332,8 @@ ValueTimelineElement::GetMaxPossibleBitsCollected(int resourceIndex) const
     double maxPossibleBitsCollected = 0.0;
 
     try {
-        if ((resourceIndex >= 0) && (resourceIndex < ptrMaxPossibleBitsCollected_a->Size())) {
-            maxPossibleBitsCollected
-                = ptrMaxPossibleBitsCollected_a->ElementAt(resourceIndex);
-        } else {
-            int index = 0;
-            maxPossibleBitsCollected
-                = ptrMaxPossibleBitsCollected_a->ElementAt(index);
-        }
+        maxPossibleBitsCollected = ptrMaxPossibleBitsCollected_a[GetStorageIndex(resourceIndex, MAX_POSSIBLE_BITS_COLLECTED,
+                          "GetMaxPossibleBitsCollected(int)")];
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetMaxPossibleBitsCollected(int)");
         throw;
@@ -304,7 +345,16 @@ ValueTimelineElement::GetMaxPossibleBitsCollected(int resourceIndex) const
 double
 ValueTimelineElement::GetMaximumMaxPossibleBitsCollected() const
 {
-    return(SimpleMath::Maximum(ptrMaxPossibleBitsCollected_a));
+    int    resourceIndex = 0;
+    double maximumBitsCollected = (double)LONG_MIN;
+
+    while (resourceIndex < resourceArraySize_a[MAX_POSSIBLE_BITS_COLLECTED]) {
+        maximumBitsCollected = std::max(maximumBitsCollected,
+                                        ptrMaxPossibleBitsCollected_a[resourceIndex]);
+        ++resourceIndex;
+    }
+
+    return(maximumBitsCollected);
 }
 
 double
@@ -313,12 +363,8 @@ ValueTimelineElement::GetImagedRegion(int resourceIndex) const
     double imagedRegion = 0.0;
 
     try {
-        if ((resourceIndex >= 0) && (resourceIndex < ptrImagedRegion_a->Size())) {
-            imagedRegion = ptrImagedRegion_a->ElementAt(resourceIndex);
-        } else {
-            int index = 0;
-            imagedRegion = ptrImagedRegion_a->ElementAt(index);
-        }
+        imagedRegion = ptrImagedRegion_a[GetStorageIndex(resourceIndex, IMAGED_REGION,
+                          "GetImagedRegion(int)")];
     } catch (Exception *ptrError) {
         ptrError->AddMethod(GetClassName(), "GetImagedRegion(int)");
         throw;
@@ -327,38 +373,71 @@ ValueTimelineElement::GetImagedRegion(int resourceIndex) const
     return(imagedRegion);
 }
 
-ValueTimelineElement::~ValueTimelineElement()
+void*
+ValueTimelineElement::operator new (size_t numberOfBytes)
 {
-    if (ptrImagedRegion_a != NULL) {
-        delete ptrImagedRegion_a;
-        ptrImagedRegion_a = NULL;
-    }
+    return(MemoryArena::AllocateObject(numberOfBytes));
+}
 
-    if (ptrSensorNumber_a != NULL) {
-        delete ptrSensorNumber_a;
-        ptrSensorNumber_a = NULL;
-    }
+void
+ValueTimelineElement::operator delete (void *ptrElement)
+{
+    MemoryArena::DeallocateObject(ptrElement);
+}
 
-    if (ptrMissionNumber_a != NULL) {
-        delete ptrMissionNumber_a;
-        ptrMissionNumber_a = NULL;
-    }
+/**
+ * Carves all of the by resource arrays out of one allocation (doubles first
+ *  to keep them aligned) instead of six separately allocated Array objects.
+ */
+void
+ValueTimelineElement::AllocateResourceStorage(const int *ptrArraySize)
+{
+    char  *ptrStorage = NULL;
+    size_t numberOfBytes = 0;
 
-    if (ptrCollectionTime_a != NULL) {
-        delete ptrCollectionTime_a;
-        ptrCollectionTime_a = NULL;
-    }
+    std::copy(ptrArraySize, ptrArraySize + NUMBER_OF_RESOURCE_ARRAYS, resourceArraySize_a);
+    numberOfBytes = ((size_t)(resourceArraySize_a[IMAGED_REGION] + resourceArraySize_a[COLLECTION_TIME]
+                              + resourceArraySize_a[MAX_POSSIBLE_BITS_COLLECTED]) * sizeof(double))
+                    + ((size_t)(resourceArraySize_a[SENSOR_NUMBER] + resourceArraySize_a[MISSION_NUMBER]
+                                + resourceArraySize_a[SUB_PRIORITY_LEVEL]) * sizeof(int));
 
-    if (ptrMaxPossibleBitsCollected_a != NULL) {
-        delete ptrMaxPossibleBitsCollected_a;
-        ptrMaxPossibleBitsCollected_a = NULL;
+    if (numberOfBytes == 0) {
+        return;
     }
 
-    if (ptrSubPriorityLevel_a != NULL) {
-        delete ptrSubPriorityLevel_a;
-        ptrSubPriorityLevel_a = NULL;
+    ptrResourceStorage_a = MemoryArena::AllocateObject(numberOfBytes);
+    ptrStorage = static_cast<char*>(ptrResourceStorage_a);
+    ptrImagedRegion_a = reinterpret_cast<double*>(ptrStorage);
+    ptrCollectionTime_a = ptrImagedRegion_a + resourceArraySize_a[IMAGED_REGION];
+    ptrMaxPossibleBitsCollected_a = ptrCollectionTime_a + resourceArraySize_a[COLLECTION_TIME];
+    ptrSensorNumber_a = reinterpret_cast<int*>(ptrMaxPossibleBitsCollected_a
+                        + resourceArraySize_a[MAX_POSSIBLE_BITS_COLLECTED]);
+    ptrMissionNumber_a = ptrSensorNumber_a + resourceArraySize_a[SENSOR_NUMBER];
+    ptrSubPriorityLevel_a = ptrMissionNumber_a + resourceArraySize_a[MISSION_NUMBER];
+    return;
+}
+
+void
+ValueTimelineElement::DeallocateResourceStorage()
+{
+    if (ptrResourceStorage_a != NULL) {
+        MemoryArena::DeallocateObject(ptrResourceStorage_a);
+        ptrResourceStorage_a = NULL;
     }
 
+    std::fill(resourceArraySize_a, resourceArraySize_a + NUMBER_OF_RESOURCE_ARRAYS, 0);
+    ptrSensorNumber_a = NULL;
+    ptrMissionNumber_a = NULL;
+    ptrSubPriorityLevel_a = NULL;
+    ptrImagedRegion_a = NULL;
+    ptrCollectionTime_a = NULL;
+    ptrMaxPossibleBitsCollected_a = NULL;
+    return;
+}
+
+ValueTimelineElement::~ValueTimelineElement()
+{
+    DeallocateResourceStorage();
     // the VTE is the class that contains the original RegionData
     // instances, so delete them
     RemoveAllRegionData();
@@ -27,6 +27,7 @@
 #include <fstream>
 
 #include "mural/CollectionElement.h"
+#include "general/exception/IndexOutOfBoundsException.h"
 
 using namespace std;
 
@@ -54,6 +55,11 @@ using namespace std;
  *                                   specific timeline)
  * ptrMaxPossibleBitsCollected_a*  maximum number of bits being collected (by
  *                                   resource if resource specific timeline)
+ * resourceArraySize_a             number of entries in each of the by resource
+ *                                   arrays (indexed by RESOURCE_ARRAY)
+ * ptrResourceStorage_a*           single allocation holding all of the by
+ *                                   resource arrays (from the timeline's
+ *                                   MemoryArena when one is bound)
  *
  * @author Brian Fowler
  * @date 09/07/2011
@@ -79,6 +85,9 @@ public:
     ValueTimelineElement(const ValueTimelineElement &copyMe);
     virtual ~ValueTimelineElement();
 
+    static void* operator new (size_t numberOfBytes);
+    static void  operator delete (void *ptrElement);
+
     ValueTimelineElement& operator =  (const ValueTimelineElement &copyMe);
     bool              operator == (const ValueTimelineElement &compareMe) const;
     bool              operator != (const ValueTimelineElement &compareMe) const;
@@ -122,18 +131,40 @@ protected:
 
 private:
 
+    enum RESOURCE_ARRAY {
+        SENSOR_NUMBER = 0,
+        MISSION_NUMBER = 1,
+        SUB_PRIORITY_LEVEL = 2,
+        IMAGED_REGION = 3,
+        COLLECTION_TIME = 4,
+        MAX_POSSIBLE_BITS_COLLECTED = 5,
+        NUMBER_OF_RESOURCE_ARRAYS = 6
+    };
+
+    void   AllocateResourceStorage(const int *ptrArraySize);
+    void   DeallocateResourceStorage();
+
     static inline string GetClassName();
 
     inline void SetOverflownRegion(double newValue);
 
+    inline int  GetStorageIndex(int resourceIndex,
+                                RESOURCE_ARRAY resourceArray,
+                                const char *methodName) const;
+    inline int  GetCheckedStorageIndex(int resourceIndex,
+                                       RESOURCE_ARRAY resourceArray,
+                                       const char *methodName) const;
+
     int                 crisisLevel_a;
-    Array<int>         *ptrSensorNumber_a;
-    Array<int>         *ptrMissionNumber_a;
-    Array<int>         *ptrSubPriorityLevel_a;
-    double                 overflownRegion_a;
-    Array<double>         *ptrImagedRegion_a;
-    Array<double>         *ptrCollectionTime_a;
-    Array<double>         *ptrMaxPossibleBitsCollected_a;
+    int                 resourceArraySize_a[NUMBER_OF_RESOURCE_ARRAYS];
+    int                *ptrSensorNumber_a;
+    int                *ptrMissionNumber_a;
+    int                *ptrSubPriorityLevel_a;
+    double              overflownRegion_a;
+    double             *ptrImagedRegion_a;
+    double             *ptrCollectionTime_a;
+    double             *ptrMaxPossibleBitsCollected_a;
+    void               *ptrResourceStorage_a;
 };
 
 inline
@@ -147,42 +178,42 @@ inline
 int
 ValueTimelineElement::GetNumberOfSensors() const
 {
-    return(ptrSensorNumber_a->Size());
+    return(resourceArraySize_a[SENSOR_NUMBER]);
 }
 
 inline
 int
 ValueTimelineElement::GetNumberOfMissions() const
 {
-    return(ptrMissionNumber_a->Size());
+    return(resourceArraySize_a[MISSION_NUMBER]);
 }
 
 inline
 int
 ValueTimelineElement::GetNumberOfSubPriorities() const
 {
-    return(ptrSubPriorityLevel_a->Size());
+    return(resourceArraySize_a[SUB_PRIORITY_LEVEL]);
 }
 
 inline
 int
 ValueTimelineElement::GetNumberOfImagedRegions() const
 {
-    return(ptrImagedRegion_a->Size());
+    return(resourceArraySize_a[IMAGED_REGION]);
 }
 
 inline
 int
 ValueTimelineElement::GetNumberOfMaxPossibleBitsCollected() const
 {
-    return(ptrMaxPossibleBitsCollected_a->Size());
+    return(resourceArraySize_a[MAX_POSSIBLE_BITS_COLLECTED]);
 }
 
 inline
 int
 ValueTimelineElement::GetNumberOfCollectionTimes() const
 {
-    return(ptrCollectionTime_a->Size());
+    return(resourceArraySize_a[COLLECTION_TIME]);
 }
 
 inline
@@ -197,12 +228,7 @@ void
 ValueTimelineElement::SetImagedRegion(double newValue,
                                       int resourceIndex)
 {
-    if (resourceIndex < 0) {
-        int index = 0;
-        (*ptrImagedRegion_a)[index] = newValue;
-    } else {
-        (*ptrImagedRegion_a)[resourceIndex] = newValue;
-    }
+    ptrImagedRegion_a[GetCheckedStorageIndex(resourceIndex, IMAGED_REGION, "SetImagedRegion(double, int)")] = newValue;
 }
 
 inline
@@ -217,12 +243,7 @@ void
 ValueTimelineElement::SetSensorNumber(int newValue,
                                       int resourceIndex)
 {
-    if (resourceIndex < 0) {
-        int index = 0;
-        (*ptrSensorNumber_a)[index] = newValue;
-    } else {
-        (*ptrSensorNumber_a)[resourceIndex] = newValue;
-    }
+    ptrSensorNumber_a[GetCheckedStorageIndex(resourceIndex, SENSOR_NUMBER, "SetSensorNumber(int, int)")] = newValue;
 }
 
 inline
@@ -230,12 +251,7 @@ void
 ValueTimelineElement::SetMissionNumber(int newValue,
                                        int resourceIndex)
 {
-    if (resourceIndex < 0) {
-        int index = 0;
-        (*ptrMissionNumber_a)[index] = newValue;
-    } else {
-        (*ptrMissionNumber_a)[resourceIndex] = newValue;
-    }
+    ptrMissionNumber_a[GetCheckedStorageIndex(resourceIndex, MISSION_NUMBER, "SetMissionNumber(int, int)")] = newValue;
 }
 
 inline
@@ -243,12 +259,7 @@ void
 ValueTimelineElement::SetSubPriorityLevel(int newValue,
         int resourceIndex)
 {
-    if (resourceIndex < 0) {
-        int index = 0;
-        (*ptrSubPriorityLevel_a)[index] = newValue;
-    } else {
-        (*ptrSubPriorityLevel_a)[resourceIndex] = newValue;
-    }
+    ptrSubPriorityLevel_a[GetCheckedStorageIndex(resourceIndex, SUB_PRIORITY_LEVEL, "SetSubPriorityLevel(int, int)")] = newValue;
 }
 
 inline
@@ -256,12 +267,7 @@ void
 ValueTimelineElement::SetMaxPossibleBitsCollected(double newValue,
         int resourceIndex)
 {
-    if (resourceIndex < 0) {
-        int index = 0;
-        (*ptrMaxPossibleBitsCollected_a)[index] = newValue;
-    } else {
-        (*ptrMaxPossibleBitsCollected_a)[resourceIndex] = newValue;
-    }
+    ptrMaxPossibleBitsCollected_a[GetCheckedStorageIndex(resourceIndex, MAX_POSSIBLE_BITS_COLLECTED, "SetMaxPossibleBitsCollected(double, int)")] = newValue;
 }
 
 inline
@@ -269,12 +275,54 @@ void
 ValueTimelineElement::SetCollectionTime(double newValue,
                                         int resourceIndex)
 {
-    if (resourceIndex < 0) {
-        int index = 0;
-        (*ptrCollectionTime_a)[index] = newValue;
-    } else {
-        (*ptrCollectionTime_a)[resourceIndex] = newValue;
+    ptrCollectionTime_a[GetCheckedStorageIndex(resourceIndex, COLLECTION_TIME, "SetCollectionTime(double, int)")] = newValue;
+}
+
+/**
+ * Returns the storage index for a getter.  Matches the previous Array
+ *  behavior where a negative or unknown resource index reads the first entry
+ *  (which is an error when the array is empty).
+ */
+inline
+int
+ValueTimelineElement::GetStorageIndex(int resourceIndex,
+                                      RESOURCE_ARRAY resourceArray,
+                                      const char *methodName) const
+{
+    const int arraySize = resourceArraySize_a[resourceArray];
+    int       storageIndex = 0;
+
+    if ((resourceIndex >= 0) && (resourceIndex < arraySize)) {
+        storageIndex = resourceIndex;
+    } else if (arraySize == 0) {
+        throw new IndexOutOfBoundsException(GetClassName(), methodName, arraySize, storageIndex);
     }
+
+    return(storageIndex);
+}
+
+/**
+ * Returns the storage index for a setter, where a negative resource index
+ *  refers to the first entry and any index past the end is an error.
+ */
+inline
+int
+ValueTimelineElement::GetCheckedStorageIndex(int resourceIndex,
+        RESOURCE_ARRAY resourceArray,
+        const char *methodName) const
+{
+    const int arraySize = resourceArraySize_a[resourceArray];
+    int       storageIndex = 0;
+
+    if (resourceIndex >= 0) {
+        storageIndex = resourceIndex;
+    }
+
+    if (storageIndex >= arraySize) {
+        throw new IndexOutOfBoundsException(GetClassName(), methodName, arraySize, storageIndex);
+    }
+
+    return(storageIndex);
 }
 
 inline
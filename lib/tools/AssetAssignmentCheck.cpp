@@ -0,0 +1,279 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * AssetAssignmentCheck.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+/**
+ * Standalone check and benchmark of the antenna capacity slot assignment.
+ * The positions and links of a scenario are generated as MURAL generates
+ * them.  The links are then given seeded random allocations (receive prep,
+ * acquisition, mission/buffer/state of health, droplink) inside their inview
+ * periods, since no allocator runs in this tree, and every antenna with links
+ * is assigned with both the interval sweep
+ * (MakeBestFitAllocatedAssetAssignments) and the slot by slot time step scan
+ * (MakeTimeStepAllocatedAssetAssignments) for each switch threshold.  Every
+ * (time step, slot) asset number must be identical.  The time per assignment
+ * of each method is printed.  Exits non-zero on any difference.
+ *
+ * Build (from the repository root, linked with the MURAL library objects
+ * built by the solution's mural project):
+ *   g++ -std=c++17 -pthread -I lib/src -I lib/src/mural lib/tools/AssetAssignmentCheck.cpp
+ *       <mural library> -o AssetAssignmentCheck
+ * Run (from a copy of the scenario directory, the links output is written):
+ *   AssetAssignmentCheck mural.input
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "mural/MURALTypes.h"
+#include "mural/antenna/Antenna.h"
+#include "mural/element/DataProvider.h"
+#include "mural/element/DataProviderCollection.h"
+#include "mural/io/MURALInputProcessor.h"
+#include "mural/modules/lg/Link.h"
+#include "mural/modules/lg/LinksGenerator.h"
+#include "mural/modules/pg/PositionGenerator.h"
+#include "general/array/LinkList.h"
+#include "general/array/ListIterator.h"
+#include "general/exception/Exception.h"
+#include "general/time/TimePiece.h"
+
+using namespace std;
+
+namespace
+{
+const int NUMBER_OF_TRIALS_s = 50;
+const int TIMING_REPEATS_s = 20;
+const int SWITCH_THRESHOLDS_s[] = {0, 1, 5};
+
+// longest allocated contact, in time steps
+const int MAXIMUM_CONTACT_s = 40;
+
+int    numberOfChecks_s = 0;
+int    numberOfMismatches_s = 0;
+int    numberOfAllocatedCells_s = 0;
+double sweepNanoseconds_s = 0.0;
+double timeStepNanoseconds_s = 0.0;
+
+mt19937 generator_s(20181);
+
+double
+ElapsedNanoseconds(const chrono::steady_clock::time_point &startTime)
+{
+    return(chrono::duration<double, nano>(chrono::steady_clock::now() - startTime).count());
+}
+
+/**
+ * Clears each link's allocations and lays random contacts over its inview
+ * time steps: an optional receive prep step, an acquisition step, a mix of
+ * mission/buffer/state of health steps and an optional droplink step
+ */
+void
+AllocateLinks(const LinkList<Link> *ptrLinksList)
+{
+    const int                   numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    const Link::ALLOCATION_STATUS body[] = {Link::MISSION, Link::BUFFER, Link::STATE_OF_HEALTH};
+    uniform_int_distribution<int> gapLength(0, MAXIMUM_CONTACT_s);
+    uniform_int_distribution<int> contactLength(1, MAXIMUM_CONTACT_s);
+    uniform_int_distribution<int> coin(0, 1);
+    uniform_int_distribution<int> bodyStatus(0, 2);
+    ListIterator<Link>            linksListIter(ptrLinksList);
+    Link                         *ptrLink = linksListIter.First();
+
+    while (ptrLink != NULL) {
+        int timeIndex = 0;
+
+        for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+            ptrLink->SetAllocationStatus(timeIndex, Link::NO_ALLOCATION);
+        }
+
+        timeIndex = gapLength(generator_s);
+
+        while (timeIndex < numberOfTimeSteps) {
+            const int endTime = std::min(timeIndex + contactLength(generator_s), numberOfTimeSteps) - 1;
+
+            if (ptrLink->IsInview(timeIndex, endTime) == true) {
+                const bool prep = (coin(generator_s) == 1);
+                const bool droplink = (coin(generator_s) == 1);
+                int        contactIndex = timeIndex;
+
+                while (contactIndex <= endTime) {
+                    Link::ALLOCATION_STATUS status = body[bodyStatus(generator_s)];
+
+                    if ((contactIndex == timeIndex) && (prep == true)) {
+                        status = Link::RECEIVE_ANTENNA_PREP;
+                    } else if ((contactIndex == timeIndex) || ((contactIndex == (timeIndex + 1)) && (prep == true))) {
+                        status = Link::ACQUISITION_WIDEBAND;
+                    } else if ((contactIndex == endTime) && (droplink == true)) {
+                        status = Link::DROPLINK_WIDEBAND;
+                    }
+
+                    ptrLink->SetAllocationStatus(contactIndex, status);
+                    ++contactIndex;
+                }
+
+                timeIndex = endTime + 1;
+            }
+
+            timeIndex += (gapLength(generator_s) + 1);
+        }
+
+        ptrLink = linksListIter.Next();
+    }
+
+    return;
+}
+
+vector<int>
+CopyAssignments(const Antenna &antenna)
+{
+    const int   numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    const int   capacity = antenna.GetCapacity();
+    vector<int> assignments;
+    assignments.reserve(numberOfTimeSteps * capacity);
+
+    for (int timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+        for (int capacityIndex = 0; capacityIndex < capacity; ++capacityIndex) {
+            assignments.push_back(antenna.GetAllocatedAssetNumber(timeIndex, capacityIndex));
+        }
+    }
+
+    return(assignments);
+}
+
+void
+CheckAntenna(const string &name,
+             Antenna &antenna)
+{
+    // the over capacity warnings both methods print are not what is checked
+    ostringstream nullStream;
+    streambuf    *ptrCoutBuffer = NULL;
+
+    for (int trial = 0; trial < NUMBER_OF_TRIALS_s; ++trial) {
+        AllocateLinks(antenna.GetLinksList());
+
+        for (const int switchThreshold : SWITCH_THRESHOLDS_s) {
+            chrono::steady_clock::time_point startTime;
+            vector<int>                      timeStepAssignments;
+            vector<int>                      sweepAssignments;
+            int                              repeat = 0;
+            ptrCoutBuffer = cout.rdbuf(nullStream.rdbuf());
+            startTime = chrono::steady_clock::now();
+
+            for (repeat = 0; repeat < TIMING_REPEATS_s; ++repeat) {
+                antenna.MakeTimeStepAllocatedAssetAssignments(false, switchThreshold);
+            }
+
+            timeStepNanoseconds_s += ElapsedNanoseconds(startTime) / TIMING_REPEATS_s;
+            timeStepAssignments = CopyAssignments(antenna);
+            startTime = chrono::steady_clock::now();
+
+            for (repeat = 0; repeat < TIMING_REPEATS_s; ++repeat) {
+                antenna.MakeBestFitAllocatedAssetAssignments(false, switchThreshold);
+            }
+
+            sweepNanoseconds_s += ElapsedNanoseconds(startTime) / TIMING_REPEATS_s;
+            sweepAssignments = CopyAssignments(antenna);
+            cout.rdbuf(ptrCoutBuffer);
+            nullStream.str("");
+            ++numberOfChecks_s;
+
+            for (const int assetNumber : timeStepAssignments) {
+                if (assetNumber != 0) {
+                    ++numberOfAllocatedCells_s;
+                }
+            }
+
+            if (sweepAssignments != timeStepAssignments) {
+                ++numberOfMismatches_s;
+                cout << "MISMATCH " << name << " trial " << trial
+                     << " switch threshold " << switchThreshold << endl;
+            }
+        }
+    }
+
+    return;
+}
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        cout << "usage: AssetAssignmentCheck <mural input file>" << endl;
+        return(2);
+    }
+
+    try {
+        TimePiece::SetSystemStartTime();
+        MURALInputProcessor inputProcessor((string(argv[1])));
+        shared_ptr<DataProviderCollection> ptrDataProviderCollection = inputProcessor.CreateDataProviderList();
+        shared_ptr<MURALTypes::DataProviderVector> ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
+        MURALTypes::DataProviderVector::iterator dataProviderIter;
+        PositionGenerator positionGenerator;
+        LinksGenerator    linksGenerator;
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            positionGenerator.GenerateProviderPositions(*dataProviderIter);
+        }
+
+        linksGenerator.GenerateLinks(ptrDataProviderCollection);
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            const shared_ptr<MURALTypes::AntennaVector> ptrAntennaList = (*dataProviderIter)->GetConjunctionAntennaList();
+            int antennaIndex = 0;
+
+            if (ptrAntennaList == NULL) {
+                continue;
+            }
+
+            for (const shared_ptr<Antenna> &ptrAntenna : *ptrAntennaList) {
+                if (ptrAntenna->GetNumberOfLinks() > 0) {
+                    ostringstream name;
+                    name << (*dataProviderIter)->GetDesignator() << " antenna " << antennaIndex;
+                    CheckAntenna(name.str(), *ptrAntenna);
+                    cout << name.str() << ": " << ptrAntenna->GetNumberOfLinks() << " links, capacity "
+                         << ptrAntenna->GetCapacity() << endl;
+                }
+
+                ++antennaIndex;
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod("AssetAssignmentCheck", "main(int, char**)");
+        ptrError->ReportError();
+        delete ptrError;
+        return(1);
+    }
+
+    if (numberOfChecks_s > 0) {
+        cout << "time step scan " << (timeStepNanoseconds_s / numberOfChecks_s / 1000.0)
+             << " us/assignment, interval sweep " << (sweepNanoseconds_s / numberOfChecks_s / 1000.0)
+             << " us/assignment, " << numberOfAllocatedCells_s << " allocated (time step, slot) cells" << endl;
+    }
+
+    cout << numberOfChecks_s << " checks, " << numberOfMismatches_s << " mismatches" << endl;
+    return((numberOfMismatches_s == 0) ? 0 : 1);
+}
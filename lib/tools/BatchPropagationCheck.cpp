@@ -0,0 +1,199 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * BatchPropagationCheck.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+/**
+ * Standalone check and benchmark of the batch analytic propagation.  The
+ * positions of every data provider are generated as MURAL generates them.
+ * Each orbiting provider is then propagated over the scenario's time steps
+ * through the scalar PositionUtility::GeneratePositionState and the batch
+ * PositionUtility::GeneratePositionStates, as scenario loaded and again with
+ * its eccentricity set to each of ECCENTRICITY_s.  The largest position and
+ * velocity difference between the two (relative to the state's magnitude)
+ * and the states per second of each path are printed.  Exits non-zero if a
+ * difference exceeds TOLERANCE_s, the documented 1.0e-13 radians of true
+ * anomaly with a margin for rounding.
+ *
+ * Build (from the repository root, optimized, linked with the MURAL library
+ * objects built by the solution's mural project):
+ *   g++ -std=c++17 -O2 -pthread -I lib/src -I lib/src/mural lib/tools/BatchPropagationCheck.cpp
+ *       <mural library> -o BatchPropagationCheck
+ * Run (from the scenario directory):
+ *   BatchPropagationCheck mural.input
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "mural/MURALTypes.h"
+#include "mural/element/DataProvider.h"
+#include "mural/element/DataProviderCollection.h"
+#include "mural/io/MURALInputProcessor.h"
+#include "mural/modules/pg/Orbit.h"
+#include "mural/modules/pg/PositionGenerator.h"
+#include "mural/modules/pg/PositionUtility.h"
+#include "general/data/PositionState.h"
+#include "general/exception/Exception.h"
+#include "general/math/SpaceVector.h"
+#include "general/time/TimePiece.h"
+
+using namespace std;
+
+namespace
+{
+const double ECCENTRICITY_s[] = {0.0, 0.01, 0.1, 0.3, 0.6, 0.9};
+const double TOLERANCE_s = 1.0e-12;
+const int    TIMING_REPEATS_s = 20;
+
+int    numberOfChecks_s = 0;
+int    numberOfMismatches_s = 0;
+double scalarSeconds_s = 0.0;
+double batchSeconds_s = 0.0;
+long   numberOfTimedStates_s = 0;
+
+// defeats dead code elimination of the states being timed
+volatile double sink_s = 0.0;
+
+double
+ElapsedSeconds(const chrono::steady_clock::time_point &startTime)
+{
+    return(chrono::duration<double>(chrono::steady_clock::now() - startTime).count());
+}
+
+double
+RelativeDifference(const double *ptrBatch,
+                   const SpaceVector &scalar)
+{
+    const SpaceVector batch(ptrBatch[0], ptrBatch[1], ptrBatch[2], scalar.GetReferenceFrame());
+    return((batch - scalar).GetMagnitude() / scalar.GetMagnitude());
+}
+
+void
+CheckOrbit(const string &name,
+           const shared_ptr<Orbit> &ptrOrbit)
+{
+    const int      numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    const int      stateSize = PositionUtility::STATE_SIZE_s;
+    vector<double> j2000Times(numberOfTimeSteps);
+    vector<double> stateBuffer(numberOfTimeSteps * stateSize);
+    double         maximumPosition = 0.0;
+    double         maximumVelocity = 0.0;
+    int            timeIndex = 0;
+    int            repeat = 0;
+
+    for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+        j2000Times[timeIndex] = TimePiece::GetJ2000Time(timeIndex);
+    }
+
+    PositionUtility::GeneratePositionStates(ptrOrbit, &j2000Times[0], numberOfTimeSteps, &stateBuffer[0]);
+
+    for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+        const shared_ptr<PositionState> ptrState = PositionUtility::GeneratePositionState(ptrOrbit, j2000Times[timeIndex]);
+        const double positionDifference = RelativeDifference(&stateBuffer[timeIndex * stateSize], *(ptrState->GetPosition()));
+        const double velocityDifference = RelativeDifference(&stateBuffer[(timeIndex * stateSize) + 3], *(ptrState->GetVelocity()));
+        maximumPosition = std::max(maximumPosition, positionDifference);
+        maximumVelocity = std::max(maximumVelocity, velocityDifference);
+        ++numberOfChecks_s;
+
+        if ((positionDifference > TOLERANCE_s) || (velocityDifference > TOLERANCE_s)) {
+            ++numberOfMismatches_s;
+        }
+    }
+
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    for (repeat = 0; repeat < TIMING_REPEATS_s; ++repeat) {
+        for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+            sink_s = sink_s + PositionUtility::GeneratePositionState(ptrOrbit, j2000Times[timeIndex])->GetPosition()->GetX();
+        }
+    }
+
+    scalarSeconds_s += ElapsedSeconds(startTime);
+    startTime = chrono::steady_clock::now();
+
+    for (repeat = 0; repeat < TIMING_REPEATS_s; ++repeat) {
+        PositionUtility::GeneratePositionStates(ptrOrbit, &j2000Times[0], numberOfTimeSteps, &stateBuffer[0]);
+        sink_s = sink_s + stateBuffer[0];
+    }
+
+    batchSeconds_s += ElapsedSeconds(startTime);
+    numberOfTimedStates_s += (long)TIMING_REPEATS_s * numberOfTimeSteps;
+    printf("%-24s e %.4f  max relative difference position %.3e velocity %.3e%s\n", name.c_str(),
+           ptrOrbit->GetEccentricity(), maximumPosition, maximumVelocity,
+           ((maximumPosition > TOLERANCE_s) || (maximumVelocity > TOLERANCE_s)) ? "  MISMATCH" : "");
+    return;
+}
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        cout << "usage: BatchPropagationCheck <mural input file>" << endl;
+        return(2);
+    }
+
+    try {
+        TimePiece::SetSystemStartTime();
+        MURALInputProcessor inputProcessor((string(argv[1])));
+        shared_ptr<DataProviderCollection> ptrDataProviderCollection = inputProcessor.CreateDataProviderList();
+        shared_ptr<MURALTypes::DataProviderVector> ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
+        MURALTypes::DataProviderVector::iterator dataProviderIter;
+        PositionGenerator positionGenerator;
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            positionGenerator.GenerateProviderPositions(*dataProviderIter);
+        }
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            const shared_ptr<Orbit> ptrOrbit = dynamic_pointer_cast<Orbit>((*dataProviderIter)->GetJourney());
+
+            if (ptrOrbit == NULL) {
+                continue;
+            }
+
+            CheckOrbit((*dataProviderIter)->GetDesignator(), ptrOrbit);
+
+            for (const double eccentricity : ECCENTRICITY_s) {
+                shared_ptr<Orbit> ptrEccentricOrbit(new Orbit(*ptrOrbit));
+                ptrEccentricOrbit->SetEccentricity(eccentricity);
+                CheckOrbit((*dataProviderIter)->GetDesignator(), ptrEccentricOrbit);
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod("BatchPropagationCheck", "main(int, char**)");
+        ptrError->ReportError();
+        delete ptrError;
+        return(1);
+    }
+
+    if (numberOfTimedStates_s > 0) {
+        printf("scalar %.3e states/s, batch %.3e states/s\n", numberOfTimedStates_s / scalarSeconds_s,
+               numberOfTimedStates_s / batchSeconds_s);
+    }
+
+    printf("%d checks, %d mismatches\n", numberOfChecks_s, numberOfMismatches_s);
+    return((numberOfMismatches_s == 0) ? 0 : 1);
+}
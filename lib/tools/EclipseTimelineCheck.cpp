@@ -0,0 +1,228 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * EclipseTimelineCheck.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+/**
+ * Standalone check of the journey eclipse queries on a scenario.  The
+ * positions of every data provider are generated as MURAL generates them,
+ * then at every time step Journey::IsInLight (the binary search of the
+ * EclipseTimeline) is compared with the point-wise Sun::IsInLight.  The two
+ * may only disagree at a time step next to a shadow crossing, where the
+ * vehicle-to-Sun direction of the timeline and the Earth-to-Sun direction of
+ * Sun::IsInLight differ by the parallax; any other disagreement is a
+ * mismatch.
+ *
+ * The timeline of a fresh copy of each journey is then queried from several
+ * threads at once, which must build it exactly once and answer as the serial
+ * timeline does.  The time taken by both queries over the whole horizon is
+ * printed.  Exits non-zero if any mismatch is found.
+ *
+ * Build (from the repository root, linked with the MURAL library objects
+ * built by the solution's mural project):
+ *   g++ -std=c++17 -pthread -I lib/src -I lib/src/mural lib/tools/EclipseTimelineCheck.cpp
+ *       <mural library> -o EclipseTimelineCheck
+ * Run (from the scenario directory):
+ *   EclipseTimelineCheck mural.input
+ */
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "mural/MURALTypes.h"
+#include "mural/Sun.h"
+#include "mural/element/DataProvider.h"
+#include "mural/element/DataProviderCollection.h"
+#include "mural/io/MURALInputProcessor.h"
+#include "mural/modules/pg/EclipseTimeline.h"
+#include "mural/modules/pg/Journey.h"
+#include "mural/modules/pg/PositionGenerator.h"
+#include "general/exception/Exception.h"
+#include "general/math/SpaceVector.h"
+#include "general/time/TimePiece.h"
+
+using namespace std;
+
+namespace
+{
+const int NUMBER_OF_THREADS_s = 4;
+
+int numberOfChecks_s = 0;
+int numberOfParallaxSteps_s = 0;
+int numberOfMismatches_s = 0;
+
+double
+ElapsedSeconds(const chrono::steady_clock::time_point &startTime)
+{
+    return(chrono::duration<double>(chrono::steady_clock::now() - startTime).count());
+}
+
+/**
+ * True when a crossing of the Sun center cone lies within a time step of the
+ * time index
+ */
+bool
+IsNextToCrossing(const EclipseTimeline &eclipseTimeline,
+                 int timeIndex)
+{
+    const vector<EclipseTimeline::Interval> &intervals
+        = eclipseTimeline.GetIntervals(EclipseTimeline::CENTER_BOUNDARY);
+    vector<EclipseTimeline::Interval>::const_iterator intervalIter;
+    bool nextToCrossing = false;
+
+    for (intervalIter = intervals.begin(); (nextToCrossing == false) && (intervalIter != intervals.end()); ++intervalIter) {
+        nextToCrossing = ((fabs(intervalIter->entryTime - (double)timeIndex) <= 1.0)
+                          || (fabs(intervalIter->exitTime - (double)timeIndex) <= 1.0));
+    }
+
+    return(nextToCrossing);
+}
+
+void
+CheckJourney(const string &designator,
+             const Journey &journey)
+{
+    const int    numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    int          timeIndex = 0;
+    int          numberOfBuilds = 0;
+    vector<bool> pointInLight(numberOfTimeSteps);
+    vector<bool> timelineInLight(numberOfTimeSteps);
+    // a copy made before the first query, so its timeline is still unbuilt
+    const Journey raceJourney(journey);
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+        pointInLight[timeIndex] = Sun::IsInLight(timeIndex, journey.GetPosition(timeIndex));
+    }
+
+    const double pointSeconds = ElapsedSeconds(startTime);
+    startTime = chrono::steady_clock::now();
+    const EclipseTimeline &eclipseTimeline = journey.GetEclipseTimeline();
+    const double buildSeconds = ElapsedSeconds(startTime);
+    startTime = chrono::steady_clock::now();
+
+    for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+        timelineInLight[timeIndex] = journey.IsInLight(timeIndex);
+    }
+
+    const double timelineSeconds = ElapsedSeconds(startTime);
+
+    for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+        ++numberOfChecks_s;
+
+        if (pointInLight[timeIndex] != timelineInLight[timeIndex]) {
+            if (IsNextToCrossing(eclipseTimeline, timeIndex) == true) {
+                ++numberOfParallaxSteps_s;
+            } else {
+                ++numberOfMismatches_s;
+                cout << "MISMATCH " << designator << " time index " << timeIndex
+                     << ": Sun::IsInLight " << pointInLight[timeIndex]
+                     << ", Journey::IsInLight " << timelineInLight[timeIndex] << endl;
+            }
+        }
+    }
+
+    vector<thread>                 threads;
+    vector<const EclipseTimeline*> ptrTimelines(NUMBER_OF_THREADS_s, NULL);
+    vector<vector<bool>>           threadInLight(NUMBER_OF_THREADS_s, vector<bool>(numberOfTimeSteps));
+
+    for (int threadIndex = 0; threadIndex < NUMBER_OF_THREADS_s; ++threadIndex) {
+        threads.push_back(thread([&raceJourney, &ptrTimelines, &threadInLight, threadIndex, numberOfTimeSteps]() {
+            ptrTimelines[threadIndex] = &(raceJourney.GetEclipseTimeline());
+
+            for (int raceIndex = 0; raceIndex < numberOfTimeSteps; ++raceIndex) {
+                threadInLight[threadIndex][raceIndex] = raceJourney.IsInLight(raceIndex);
+            }
+        }));
+    }
+
+    for (int threadIndex = 0; threadIndex < NUMBER_OF_THREADS_s; ++threadIndex) {
+        threads[threadIndex].join();
+        ++numberOfChecks_s;
+
+        if (ptrTimelines[threadIndex] != ptrTimelines[0]) {
+            ++numberOfBuilds;
+        }
+
+        if ((threadInLight[threadIndex] != timelineInLight)
+                || ((*ptrTimelines[threadIndex] == eclipseTimeline) == false)) {
+            ++numberOfMismatches_s;
+            cout << "MISMATCH " << designator << " thread " << threadIndex
+                 << ": concurrent timeline differs from the serial timeline" << endl;
+        }
+    }
+
+    if (numberOfBuilds > 0) {
+        ++numberOfMismatches_s;
+        cout << "MISMATCH " << designator << ": concurrent queries built "
+             << (numberOfBuilds + 1) << " timelines" << endl;
+    }
+
+    cout << designator << ": " << eclipseTimeline.GetIntervals(EclipseTimeline::CENTER_BOUNDARY).size()
+         << " shadow intervals, Sun::IsInLight " << (pointSeconds * 1.0e6 / numberOfTimeSteps)
+         << " us/step, timeline build " << (buildSeconds * 1.0e3)
+         << " ms, Journey::IsInLight " << (timelineSeconds * 1.0e6 / numberOfTimeSteps) << " us/step" << endl;
+    return;
+}
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        cout << "usage: EclipseTimelineCheck <mural input file>" << endl;
+        return(2);
+    }
+
+    try {
+        TimePiece::SetSystemStartTime();
+        MURALInputProcessor inputProcessor((string(argv[1])));
+        shared_ptr<DataProviderCollection> ptrDataProviderCollection = inputProcessor.CreateDataProviderList();
+        shared_ptr<MURALTypes::DataProviderVector> ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
+        MURALTypes::DataProviderVector::iterator dataProviderIter;
+        PositionGenerator positionGenerator;
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            positionGenerator.GenerateProviderPositions(*dataProviderIter);
+        }
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            const shared_ptr<Journey> ptrJourney = (*dataProviderIter)->GetJourney();
+
+            if ((ptrJourney != NULL) && (ptrJourney->IsStationaryPosition() == false)) {
+                CheckJourney((*dataProviderIter)->GetDesignator(), *ptrJourney);
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod("EclipseTimelineCheck", "main(int, char**)");
+        ptrError->ReportError();
+        delete ptrError;
+        return(1);
+    }
+
+    cout << numberOfChecks_s << " checks, " << numberOfParallaxSteps_s
+         << " steps next to a crossing differ by the parallax, "
+         << numberOfMismatches_s << " mismatches" << endl;
+    return((numberOfMismatches_s == 0) ? 0 : 1);
+}
@@ -0,0 +1,252 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ElevationMaskCheck.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+/**
+ * Standalone check that Antenna::GetAzimuthBasedElevationAngles (the compiled
+ * elevation mask and its binary search) returns the same elevation limits as
+ * the linear AzimuthAngleData walk it replaced, bit for bit.  Random masks
+ * spanning -180 to 180 deg (duplicate azimuths included, sorted as the
+ * AntennaExtractor sorts them) are queried at random azimuths and at the
+ * mask azimuths themselves.  Also checks that an azimuth a full circle away
+ * is mapped onto the mask, and that an azimuth in the gap of a mask that does
+ * not cover the full circle throws.  Prints each mismatch and exits non-zero
+ * if any is found.
+ *
+ * Build (from the repository root, linked with the MURAL library objects
+ * built by the solution's mural project):
+ *   g++ -std=c++17 -I lib/src -I lib/src/mural lib/tools/ElevationMaskCheck.cpp
+ *       <mural library> -o ElevationMaskCheck
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "mural/MURALTypes.h"
+#include "mural/antenna/Antenna.h"
+#include "mural/modules/lg/AzimuthAngleData.h"
+#include "general/data/UnitData.h"
+#include "general/exception/Exception.h"
+#include "general/math/SimpleMath.h"
+
+using namespace std;
+
+namespace
+{
+const int NUMBER_OF_MASKS_s = 2000;
+const int QUERIES_PER_MASK_s = 500;
+
+int numberOfChecks_s = 0;
+int numberOfMismatches_s = 0;
+
+/**
+ * The lookup as it was before the compiled mask: a linear walk of the sorted
+ * list to the first azimuth past the query.  Only defined for queries inside
+ * the mask's azimuth range.
+ */
+void
+LinearLookup(const MURALTypes::AzimuthAngleDataVector &azimuthDataList,
+             double azimuthAngle,
+             double &minimumElevationAngle,
+             double &maximumElevationAngle)
+{
+    MURALTypes::AzimuthAngleDataVector::const_iterator azimuthDataIter;
+    minimumElevationAngle = UNDEFINED_ANGLE;
+    maximumElevationAngle = UNDEFINED_ANGLE;
+
+    for (azimuthDataIter = azimuthDataList.begin();
+            (azimuthDataIter != azimuthDataList.end()) && (minimumElevationAngle == UNDEFINED_ANGLE);
+            ++azimuthDataIter) {
+        const AzimuthAngleData &azimuthData = **azimuthDataIter;
+
+        if (azimuthData.GetAzimuthAngle() > azimuthAngle) {
+            const AzimuthAngleData &lowerData = **(azimuthDataIter - 1);
+            minimumElevationAngle = SimpleMath::Interpolate(lowerData.GetAzimuthAngle(),
+                                    azimuthData.GetAzimuthAngle(), azimuthAngle,
+                                    lowerData.GetMinimumElevationAngle(),
+                                    azimuthData.GetMinimumElevationAngle());
+            maximumElevationAngle = SimpleMath::Interpolate(lowerData.GetAzimuthAngle(),
+                                    azimuthData.GetAzimuthAngle(), azimuthAngle,
+                                    lowerData.GetMaximumElevationAngle(),
+                                    azimuthData.GetMaximumElevationAngle());
+        } else if (azimuthData.GetAzimuthAngle() == azimuthAngle) {
+            minimumElevationAngle = azimuthData.GetMinimumElevationAngle();
+            maximumElevationAngle = azimuthData.GetMaximumElevationAngle();
+        }
+    }
+
+    return;
+}
+
+bool
+Lookup(const Antenna &antenna,
+       double azimuthAngle,
+       double &minimumElevationAngle,
+       double &maximumElevationAngle)
+{
+    bool found = true;
+
+    try {
+        antenna.GetAzimuthBasedElevationAngles(azimuthAngle, "", minimumElevationAngle, maximumElevationAngle);
+    } catch (Exception *ptrError) {
+        delete ptrError;
+        found = false;
+    }
+
+    return(found);
+}
+
+void
+Compare(const char *caseName,
+        int maskIndex,
+        double azimuthAngle,
+        bool found,
+        double minimumElevation,
+        double maximumElevation,
+        double expectedMinimum,
+        double expectedMaximum)
+{
+    ++numberOfChecks_s;
+
+    if ((found == false) ||
+            (memcmp(&minimumElevation, &expectedMinimum, sizeof(double)) != 0) ||
+            (memcmp(&maximumElevation, &expectedMaximum, sizeof(double)) != 0)) {
+        ++numberOfMismatches_s;
+        printf("MISMATCH %-10s mask %4d azimuth %a: got %a %a, expected %a %a%s\n",
+               caseName, maskIndex, azimuthAngle, minimumElevation, maximumElevation,
+               expectedMinimum, expectedMaximum, (found == false) ? " (threw)" : "");
+    }
+
+    return;
+}
+}
+
+int
+main()
+{
+    const double fullCircle = UnitData::GetStoreFullCircle();
+    const double halfCircle = UnitData::GetStoreHalfCircle();
+    mt19937      generator(3);
+    uniform_real_distribution<double> angleDistribution(-halfCircle, halfCircle);
+
+    for (int maskIndex = 0; maskIndex < NUMBER_OF_MASKS_s; ++maskIndex) {
+        const int numberOfInterior = 2 + (int)(generator() % 30);
+        shared_ptr<MURALTypes::AzimuthAngleDataVector> ptrFullMask(new MURALTypes::AzimuthAngleDataVector());
+        shared_ptr<MURALTypes::AzimuthAngleDataVector> ptrPartialMask(new MURALTypes::AzimuthAngleDataVector());
+        double minimumElevation = 0.0;
+        double maximumElevation = 0.0;
+        double expectedMinimum = 0.0;
+        double expectedMaximum = 0.0;
+        Antenna fullAntenna;
+        Antenna partialAntenna;
+
+        for (int pointIndex = 0; pointIndex < (numberOfInterior + 2); ++pointIndex) {
+            double azimuth = angleDistribution(generator);
+
+            if (pointIndex == 0) {
+                azimuth = -halfCircle;
+            } else if (pointIndex == 1) {
+                azimuth = halfCircle;
+            } else if ((pointIndex > 2) && ((generator() % 4) == 0)) {
+                // a duplicate azimuth
+                azimuth = (*ptrFullMask)[generator() % ptrFullMask->size()]->GetAzimuthAngle();
+            }
+
+            const double lowerElevation = angleDistribution(generator);
+            const double upperElevation = angleDistribution(generator);
+            ptrFullMask->push_back(shared_ptr<AzimuthAngleData>(new AzimuthAngleData(
+                                       std::min(lowerElevation, upperElevation),
+                                       std::max(lowerElevation, upperElevation), azimuth)));
+        }
+
+        // as AntennaExtractor::ExtractAntennaInfo sorts the list
+        std::sort(ptrFullMask->begin(), ptrFullMask->end(),
+        [](const shared_ptr<AzimuthAngleData> &ptrI, const shared_ptr<AzimuthAngleData> &ptrJ) {
+            return(ptrI->GetAzimuthAngle() < ptrJ->GetAzimuthAngle());
+        });
+        fullAntenna.SetAzimuthAngleDataList(ptrFullMask);
+
+        // the same mask less its -180 and 180 deg end points
+        ptrPartialMask->assign(ptrFullMask->begin() + 1, ptrFullMask->end() - 1);
+        partialAntenna.SetAzimuthAngleDataList(ptrPartialMask);
+
+        for (int queryIndex = 0; queryIndex < QUERIES_PER_MASK_s; ++queryIndex) {
+            double azimuth = angleDistribution(generator);
+
+            if ((queryIndex % 3) == 0) {
+                azimuth = (*ptrFullMask)[generator() % ptrFullMask->size()]->GetAzimuthAngle();
+            }
+
+            LinearLookup(*ptrFullMask, azimuth, expectedMinimum, expectedMaximum);
+            bool found = Lookup(fullAntenna, azimuth, minimumElevation, maximumElevation);
+            Compare("full", maskIndex, azimuth, found, minimumElevation, maximumElevation,
+                    expectedMinimum, expectedMaximum);
+
+            // a full circle away (and off the mask) maps back onto the mask
+            const double wrappedAzimuth = (azimuth > 0.0) ? (azimuth - fullCircle) : (azimuth + fullCircle);
+            const double mappedAzimuth = (azimuth > 0.0) ? (wrappedAzimuth + fullCircle) : (wrappedAzimuth - fullCircle);
+
+            if (((wrappedAzimuth < -halfCircle) || (wrappedAzimuth > halfCircle)) &&
+                    (mappedAzimuth >= -halfCircle) && (mappedAzimuth <= halfCircle)) {
+                LinearLookup(*ptrFullMask, mappedAzimuth, expectedMinimum, expectedMaximum);
+                found = Lookup(fullAntenna, wrappedAzimuth, minimumElevation, maximumElevation);
+                Compare("wrapped", maskIndex, wrappedAzimuth, found, minimumElevation, maximumElevation,
+                        expectedMinimum, expectedMaximum);
+            }
+
+            // the partial mask matches inside its range (or a full circle
+            // away from it) and throws in its gap
+            const double firstAzimuth = ptrPartialMask->front()->GetAzimuthAngle();
+            const double lastAzimuth = ptrPartialMask->back()->GetAzimuthAngle();
+            double       maskAzimuth = azimuth;
+
+            if ((maskAzimuth < firstAzimuth) && ((maskAzimuth + fullCircle) <= lastAzimuth)) {
+                maskAzimuth += fullCircle;
+            } else if ((maskAzimuth > lastAzimuth) && ((maskAzimuth - fullCircle) >= firstAzimuth)) {
+                maskAzimuth -= fullCircle;
+            }
+
+            found = Lookup(partialAntenna, azimuth, minimumElevation, maximumElevation);
+
+            if ((maskAzimuth >= firstAzimuth) && (maskAzimuth <= lastAzimuth)) {
+                LinearLookup(*ptrPartialMask, maskAzimuth, expectedMinimum, expectedMaximum);
+                Compare("partial", maskIndex, azimuth, found, minimumElevation, maximumElevation,
+                        expectedMinimum, expectedMaximum);
+            } else {
+                ++numberOfChecks_s;
+
+                if (found == true) {
+                    ++numberOfMismatches_s;
+                    printf("MISMATCH %-10s mask %4d azimuth %a: gap azimuth did not throw\n",
+                           "gap", maskIndex, azimuth);
+                }
+            }
+        }
+    }
+
+    cout << numberOfChecks_s << " checks, " << numberOfMismatches_s << " mismatches" << endl;
+    return((numberOfMismatches_s == 0) ? 0 : 1);
+}
@@ -0,0 +1,189 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ReportComparison.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+/**
+ * Standalone before/after comparison of two sets of MURAL reports, used to
+ * record the tables under PLTGEN/data/nominal/comparison.  Each named file is
+ * read from the before and the after run directories and printed as one row:
+ * its size in the after run, the MD5 of each copy and whether the two are
+ * byte for byte identical.  A file missing from either run is reported as
+ * such.  Exits non-zero if any file differs or is missing.
+ *
+ * Build (from the repository root):
+ *   g++ -std=c++17 lib/tools/ReportComparison.cpp -o ReportComparison
+ * Run (after running the scenario with each executable into its own
+ * directory):
+ *   ReportComparison <before run directory> <after run directory>
+ *       conjunctionRF.out conjunctionUPA.out crosslinks.out downlinks.out
+ *       positions.out regionsInView.out revolutionTimes.out updatedOrbits.out
+ *       links.debug
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+// RFC 1321 per round shift amounts and sine derived constants
+const uint32_t SHIFT_s[64] = {
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+    5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+const uint32_t SINE_s[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+bool
+ReadFile(const string &fileName,
+         string &contents)
+{
+    ifstream infile(fileName.c_str(), ios::in | ios::binary);
+
+    if (!infile) {
+        return(false);
+    }
+
+    contents.assign(istreambuf_iterator<char>(infile), istreambuf_iterator<char>());
+    return(true);
+}
+
+string
+MD5(const string &contents)
+{
+    const uint64_t  bitLength = (uint64_t)contents.size() * 8;
+    uint32_t        state[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    vector<uint8_t> message(contents.begin(), contents.end());
+    char            hex[33];
+
+    message.push_back(0x80);
+
+    while ((message.size() % 64) != 56) {
+        message.push_back(0);
+    }
+
+    for (int byteIndex = 0; byteIndex < 8; ++byteIndex) {
+        message.push_back((uint8_t)(bitLength >> (8 * byteIndex)));
+    }
+
+    for (size_t blockStart = 0; blockStart < message.size(); blockStart += 64) {
+        uint32_t word[16];
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+
+        for (int wordIndex = 0; wordIndex < 16; ++wordIndex) {
+            const uint8_t *ptrByte = &message[blockStart + (4 * wordIndex)];
+            word[wordIndex] = (uint32_t)ptrByte[0] | ((uint32_t)ptrByte[1] << 8)
+                              | ((uint32_t)ptrByte[2] << 16) | ((uint32_t)ptrByte[3] << 24);
+        }
+
+        for (int round = 0; round < 64; ++round) {
+            uint32_t f = 0;
+            int      wordIndex = 0;
+
+            if (round < 16) {
+                f = (b & c) | (~b & d);
+                wordIndex = round;
+            } else if (round < 32) {
+                f = (d & b) | (~d & c);
+                wordIndex = ((5 * round) + 1) % 16;
+            } else if (round < 48) {
+                f = b ^ c ^ d;
+                wordIndex = ((3 * round) + 5) % 16;
+            } else {
+                f = c ^ (b | ~d);
+                wordIndex = (7 * round) % 16;
+            }
+
+            f += a + SINE_s[round] + word[wordIndex];
+            a = d;
+            d = c;
+            c = b;
+            b += (f << SHIFT_s[round]) | (f >> (32 - SHIFT_s[round]));
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+    }
+
+    for (int byteIndex = 0; byteIndex < 16; ++byteIndex) {
+        snprintf(&hex[2 * byteIndex], 3, "%02x", (state[byteIndex / 4] >> (8 * (byteIndex % 4))) & 0xff);
+    }
+
+    return(string(hex, 32));
+}
+}
+
+int
+main(int argc, char *argv[])
+{
+    int numberOfDifferences = 0;
+
+    if (argc < 4) {
+        cout << "usage: ReportComparison <before directory> <after directory> <file> [<file> ...]" << endl;
+        return(2);
+    }
+
+    printf("    %-20s %10s  %-32s  %-32s  %s\n", "FILE", "BYTES", "MD5 BEFORE", "MD5 AFTER", "RESULT");
+
+    for (int argIndex = 3; argIndex < argc; ++argIndex) {
+        const string fileName = argv[argIndex];
+        string       before;
+        string       after;
+        const bool   hasBefore = ReadFile(string(argv[1]) + "/" + fileName, before);
+        const bool   hasAfter = ReadFile(string(argv[2]) + "/" + fileName, after);
+
+        if ((hasBefore == false) || (hasAfter == false)) {
+            ++numberOfDifferences;
+            printf("    %-20s %10s  %-32s  %-32s  %s\n", fileName.c_str(), "-",
+                   (hasBefore == true) ? MD5(before).c_str() : "-",
+                   (hasAfter == true) ? MD5(after).c_str() : "-", "MISSING");
+            continue;
+        }
+
+        if (before != after) {
+            ++numberOfDifferences;
+        }
+
+        printf("    %-20s %10zu  %s  %s  %s\n", fileName.c_str(), after.size(),
+               MD5(before).c_str(), MD5(after).c_str(), (before == after) ? "identical" : "DIFFERS");
+    }
+
+    return((numberOfDifferences == 0) ? 0 : 1);
+}
@@ -0,0 +1,145 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * ReportWriterCheck.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+/**
+ * Standalone check that ReportWriter produces the same characters as the
+ * stream formatting it replaced: outfile << setw(width) << setprecision(precision)
+ * << value under ios::fixed, and outfile << setw(width) << value for integers.
+ * Covers negative zero, values that round to negative zero, the half-way
+ * rounding edge, values wider than their field and magnitudes that overflow
+ * the writer's buffer.  Prints each mismatch and exits non-zero if any is found.
+ *
+ * Build (from the repository root):
+ *   g++ -std=c++17 -I lib/src lib/tools/ReportWriterCheck.cpp
+ *       lib/src/general/utility/ReportWriter.cpp
+ *       lib/src/general/utility/MemoryAccounting.cpp -o ReportWriterCheck
+ */
+
+#include <climits>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "general/utility/ReportWriter.h"
+
+using namespace std;
+
+namespace
+{
+int numberOfChecks_s = 0;
+int numberOfMismatches_s = 0;
+
+void
+Compare(const string &description,
+        const string &expected,
+        const string &actual)
+{
+    ++numberOfChecks_s;
+
+    if (expected != actual) {
+        ++numberOfMismatches_s;
+        cout << "MISMATCH " << description << ": stream [" << expected
+             << "] writer [" << actual << "]" << endl;
+    }
+
+    return;
+}
+
+void
+CheckFixed(double value,
+           int width,
+           int precision,
+           int bufferSize)
+{
+    ostringstream expected;
+    ostringstream actual;
+    ostringstream description;
+    expected.setf(ios::fixed, ios::floatfield);
+    expected << setw(width) << setprecision(precision) << value;
+    {
+        ReportWriter writer(actual, bufferSize);
+        // a leading character moves the number off the start of the buffer
+        writer.WriteChar('|');
+        writer.WriteFixed(value, width, precision);
+    }
+    description << "WriteFixed(" << setprecision(17) << value << ", "
+                << width << ", " << precision << ") buffer " << bufferSize;
+    Compare(description.str(), "|" + expected.str(), actual.str());
+    return;
+}
+
+void
+CheckInt(int value,
+         int width,
+         int bufferSize)
+{
+    ostringstream expected;
+    ostringstream actual;
+    ostringstream description;
+    expected << setw(width) << value;
+    {
+        ReportWriter writer(actual, bufferSize);
+        writer.WriteChar('|');
+        writer.WriteInt(value, width);
+    }
+    description << "WriteInt(" << value << ", " << width << ") buffer " << bufferSize;
+    Compare(description.str(), "|" + expected.str(), actual.str());
+    return;
+}
+}
+
+int
+main()
+{
+    const double fixedValues[] = {
+        0.0, -0.0, 1.0e-12, -1.0e-12, -0.0004, -0.0005, -0.0006, 0.0004, 0.0005,
+        0.0015, 0.0025, 0.1245, 0.1255, 1.0005, 2.0005, -2.0005, 0.125, 0.375,
+        2.675, -2.675, 1.45, 1.55, 0.5, 1.5, 2.5, -0.5, 99999.9995, 123456.789,
+        -123456.789, 6378.137, -42164.1696, 7.5343, 86400.0, 1.0e15, -1.0e15,
+        1.0e300, -1.0e300
+    };
+    const int fixedFormats[][2] = {
+        {15, 3}, {8, 3}, {12, 3}, {10, 1}, {6, 0}, {0, 3}, {3, 6}
+    };
+    const int intValues[] = {
+        0, 1, -1, 9, 10, -10, 1234, -1234, 99999, 123456789, INT_MAX, INT_MIN
+    };
+    const int intWidths[] = {0, 1, 4, 8, 15};
+    const int bufferSizes[] = {0, 64, 4096};
+
+    for (int bufferSize : bufferSizes) {
+        for (double value : fixedValues) {
+            for (const auto &format : fixedFormats) {
+                CheckFixed(value, format[0], format[1], bufferSize);
+            }
+        }
+
+        for (int value : intValues) {
+            for (int width : intWidths) {
+                CheckInt(value, width, bufferSize);
+            }
+        }
+    }
+
+    cout << numberOfChecks_s << " checks, " << numberOfMismatches_s << " mismatches" << endl;
+    return (numberOfMismatches_s == 0) ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+/*=============================================================================================
+ * CLASSIFICATION: Unclassified
+ * Government Purpose Rights
+ * Contract No: 12-C-0158
+ * Contractor Name: Perspecta
+ * Contractor Address: 15052 Conference Center Dr. Chantilly, VA 20151
+ * Expiration Date: 31 Aug. 2023
+ * The Government's rights to use, modify, reproduce, release, perform, display, or disclose these
+ * technical data and computer software are restricted by paragraph (b)(1) of clause N52.227-002,
+ * Rights in Technical Data and Computer Software: Noncommercial Items, contained in the contract
+ * identified above. No restrictions apply after the expiration date shown above. Any reproduction of
+ * technical data or computer software, or portions thereof marked with this legend,must also reproduce the markings.
+ *
+ *
+ * StationaryJourneyCheck.cpp
+ *
+ * PLTGEN - Positions, Links, Timeline GENerator
+ *
+ * POC: Anthony Ragusa | Joe DiBruno | Ken Ivory (2018- )
+ *============================================================================================*/
+
+
+/**
+ * Standalone check of the inertial velocity of the stationary journeys of a
+ * scenario.  The positions of every data provider are generated as MURAL
+ * generates them.  At every interior time step the ECI velocity of each Earth
+ * fixed stationary journey (the omega x r cached at SetPositionState and
+ * rotated per call) is compared with the central difference of its ECI
+ * positions one time step either side, and with omega x r taken about the
+ * inertial Z axis (the formula before the cache).  The Earth fixed position
+ * must come back exactly as stored.  The time per ECI velocity and per ECI
+ * position call is printed.  Exits non-zero if the velocity differs from the
+ * central difference by more than VELOCITY_TOLERANCE_s (relative) or if a
+ * fixed position changed.
+ *
+ * Build (from the repository root, linked with the MURAL library objects
+ * built by the solution's mural project):
+ *   g++ -std=c++17 -pthread -I lib/src -I lib/src/mural lib/tools/StationaryJourneyCheck.cpp
+ *       <mural library> -o StationaryJourneyCheck
+ * Run (from the scenario directory):
+ *   StationaryJourneyCheck mural.input
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include "mural/MURALTypes.h"
+#include "mural/element/DataProvider.h"
+#include "mural/element/DataProviderCollection.h"
+#include "mural/io/MURALInputProcessor.h"
+#include "mural/modules/pg/Journey.h"
+#include "mural/modules/pg/PositionGenerator.h"
+#include "general/data/PositionState.h"
+#include "general/exception/Exception.h"
+#include "general/math/SpaceVector.h"
+#include "general/time/TimePiece.h"
+#include "general/utility/Constant.h"
+
+using namespace std;
+
+namespace
+{
+// the central difference of a point turning 0.25 deg per minute is good to
+// a few parts in a million
+const double VELOCITY_TOLERANCE_s = 1.0e-5;
+const int    TIMING_REPEATS_s = 200;
+
+int    numberOfChecks_s = 0;
+int    numberOfMismatches_s = 0;
+
+// defeats dead code elimination of the calls being timed
+volatile double sink_s = 0.0;
+
+double
+ElapsedNanoseconds(const chrono::steady_clock::time_point &startTime)
+{
+    return(chrono::duration<double, nano>(chrono::steady_clock::now() - startTime).count());
+}
+
+void
+CheckJourney(const string &designator,
+             const Journey &journey)
+{
+    const int          numberOfTimeSteps = TimePiece::GetNumberOfTimeSteps();
+    const double       doubleSeconds = 2.0 * (double)TimePiece::GetSecondsPerTimeStep();
+    const SpaceVector &fixedPosition = *(journey.GetPositionStateAt(0)->GetPosition());
+    double             maximumDifference = 0.0;
+    double             maximumFormulaDifference = 0.0;
+    int                timeIndex = 0;
+
+    if (fixedPosition.GetReferenceFrame() == EARTH_CENTER_INERTIAL) {
+        cout << designator << ": stored inertial, served through its PositionState" << endl;
+        return;
+    }
+
+    for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+        ++numberOfChecks_s;
+
+        if (journey.GetPosition(timeIndex, fixedPosition.GetReferenceFrame()) != fixedPosition) {
+            ++numberOfMismatches_s;
+            cout << "MISMATCH " << designator << " time index " << timeIndex
+                 << ": the Earth fixed position changed" << endl;
+        }
+    }
+
+    for (timeIndex = 1; timeIndex < (numberOfTimeSteps - 1); ++timeIndex) {
+        const SpaceVector velocity = journey.GetVelocity(timeIndex, EARTH_CENTER_INERTIAL);
+        const SpaceVector position = journey.GetPosition(timeIndex, EARTH_CENTER_INERTIAL);
+        const SpaceVector differenceVelocity = (journey.GetPosition(timeIndex + 1, EARTH_CENTER_INERTIAL)
+                                                - journey.GetPosition(timeIndex - 1, EARTH_CENTER_INERTIAL)) / doubleSeconds;
+        const SpaceVector angularVelocity(0.0, 0.0, EARTH_ROTATION_RATE_RAD_PER_S, EARTH_CENTER_INERTIAL);
+        const double      speed = differenceVelocity.GetMagnitude();
+        const double      difference = (velocity - differenceVelocity).GetMagnitude() / speed;
+        maximumDifference = std::max(maximumDifference, difference);
+        maximumFormulaDifference = std::max(maximumFormulaDifference,
+                                            (velocity - angularVelocity.CrossProduct(position)).GetMagnitude() / speed);
+        ++numberOfChecks_s;
+
+        if (difference > VELOCITY_TOLERANCE_s) {
+            ++numberOfMismatches_s;
+            cout << "MISMATCH " << designator << " time index " << timeIndex
+                 << ": ECI velocity differs from the central difference by " << difference << endl;
+        }
+    }
+
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    for (int repeat = 0; repeat < TIMING_REPEATS_s; ++repeat) {
+        for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+            sink_s = sink_s + journey.GetVelocity(timeIndex, EARTH_CENTER_INERTIAL).GetX();
+        }
+    }
+
+    const double velocityNanoseconds = ElapsedNanoseconds(startTime) / (TIMING_REPEATS_s * numberOfTimeSteps);
+    startTime = chrono::steady_clock::now();
+
+    for (int repeat = 0; repeat < TIMING_REPEATS_s; ++repeat) {
+        for (timeIndex = 0; timeIndex < numberOfTimeSteps; ++timeIndex) {
+            sink_s = sink_s + journey.GetPosition(timeIndex, EARTH_CENTER_INERTIAL).GetX();
+        }
+    }
+
+    const double positionNanoseconds = ElapsedNanoseconds(startTime) / (TIMING_REPEATS_s * numberOfTimeSteps);
+    cout << designator << ": ECI velocity vs central difference " << maximumDifference
+         << ", vs omega x r about the inertial Z " << maximumFormulaDifference
+         << " (relative), ECI velocity " << velocityNanoseconds << " ns/call, ECI position "
+         << positionNanoseconds << " ns/call" << endl;
+    return;
+}
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        cout << "usage: StationaryJourneyCheck <mural input file>" << endl;
+        return(2);
+    }
+
+    try {
+        TimePiece::SetSystemStartTime();
+        MURALInputProcessor inputProcessor((string(argv[1])));
+        shared_ptr<DataProviderCollection> ptrDataProviderCollection = inputProcessor.CreateDataProviderList();
+        shared_ptr<MURALTypes::DataProviderVector> ptrDataProviderList = ptrDataProviderCollection->GetDataProviderListPtr();
+        MURALTypes::DataProviderVector::iterator dataProviderIter;
+        PositionGenerator positionGenerator;
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            positionGenerator.GenerateProviderPositions(*dataProviderIter);
+        }
+
+        for (dataProviderIter = ptrDataProviderList->begin(); dataProviderIter != ptrDataProviderList->end(); ++dataProviderIter) {
+            const shared_ptr<Journey> ptrJourney = (*dataProviderIter)->GetJourney();
+
+            if ((ptrJourney != NULL) && (ptrJourney->IsStationaryPosition() == true)) {
+                CheckJourney((*dataProviderIter)->GetDesignator(), *ptrJourney);
+            }
+        }
+    } catch (Exception *ptrError) {
+        ptrError->AddMethod("StationaryJourneyCheck", "main(int, char**)");
+        ptrError->ReportError();
+        delete ptrError;
+        return(1);
+    }
+
+    cout << numberOfChecks_s << " checks, " << numberOfMismatches_s << " mismatches" << endl;
+    return((numberOfMismatches_s == 0) ? 0 : 1);
+}